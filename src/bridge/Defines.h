@@ -38,4 +38,9 @@
 #undef DEFAULT_LOCK_FILE
 #define DEFAULT_LOCK_FILE "/tmp/dvmbridge.lock"
 
+#define MBE_SAMPLES_LENGTH 160
+
+const uint8_t TX_MODE_DMR = 1U;
+const uint8_t TX_MODE_P25 = 2U;
+
 #endif // __DEFINES_H__
@@ -20,6 +20,8 @@
 #include "common/p25/lc/LC.h"
 #include "common/p25/P25Utils.h"
 #include "common/network/udp/Socket.h"
+#include "common/network/RTPExtensionHeader.h"
+#include "common/network/RTPHeader.h"
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Thread.h"
@@ -55,6 +57,15 @@ const int NUMBER_OF_BUFFERS = 32;
 #define LOCAL_CALL "Local Traffic"
 #define UDP_CALL "UDP Traffic"
 
+const uint8_t RTP_L16_PAYLOAD_TYPE = 96U;       // dynamic payload type; 16-bit linear PCM, mono
+const uint16_t RTP_METADATA_EXT_TYPE = 0x4456U; // "DV"; RTP extension carrying the destination and source IDs
+#define RTP_METADATA_EXT_LENGTH_WORDS 2U
+
+#define UDP_PLAYOUT_FRAME_MS 20U
+#define AUDIO_FRAME_MS 20U
+#define MAX_AUDIO_FRAME_LENGTH 1024U    // room for 20ms of audio at the highest supported sample rate (48kHz)
+#define UDP_TALKSPURT_GAP_MS 60U
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
@@ -74,34 +85,17 @@ void audioCallback(ma_device* device, void* output, const void* input, ma_uint32
     if (!bridge->m_running)
         return;
 
-    ma_uint32 pcmBytes = frameCount * ma_get_bytes_per_frame(device->capture.format, device->capture.channels);
+    // this runs on the audio device's real-time thread; the sample FIFOs are wait-free and this callback
+    // is their only producer (capture) and only consumer (playback), so nothing here may lock or log
 
-    // capture input audio
+    // capture input audio (the device is configured for native endian signed 16-bit mono)
     if (frameCount > 0U) {
-        std::lock_guard<std::mutex> lock(HostBridge::m_audioMutex);
-
-        int smpIdx = 0;
-        short samples[MBE_SAMPLES_LENGTH];
-        const uint8_t* pcm = (const uint8_t*)input;
-        for (uint32_t pcmIdx = 0; pcmIdx < pcmBytes; pcmIdx += 2) {
-            samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-            smpIdx++;
-        }
-
-        bridge->m_inputAudio.addData(samples, MBE_SAMPLES_LENGTH);
+        bridge->m_inputAudio.addData((const short*)input, frameCount);
     }
 
-    // playback output audio
-    if (bridge->m_outputAudio.dataSize() >= MBE_SAMPLES_LENGTH) {
-        short samples[MBE_SAMPLES_LENGTH];
-        bridge->m_outputAudio.get(samples, MBE_SAMPLES_LENGTH);
-        uint8_t* pcm = (uint8_t*)output;
-        int pcmIdx = 0;
-        for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-            pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-            pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-            pcmIdx += 2;
-        }
+    // playback output audio; an empty FIFO is idle, a partly filled one is an underrun and plays silence
+    if (bridge->m_outputAudio.hasData()) {
+        bridge->m_outputAudio.get((short*)output, frameCount);
     }
 }
 
@@ -118,8 +112,8 @@ void mdcPacketDetected(int frameCount, mdc_u8_t op, mdc_u8_t arg, mdc_u16_t unit
         ::LogMessage(LOG_HOST, "Local Traffic, MDC Detect, unitId = $%04X", unitID);
 
         // HACK: nasty bullshit to convert MDC unitID to decimal
-        char* pCharRes = new (char);
-        ::sprintf(pCharRes, "0x%X", unitID);
+        char pCharRes[8U];
+        ::snprintf(pCharRes, sizeof(pCharRes), "0x%X", unitID);
 
         uint32_t res = 0U;
         std::string s = std::string(pCharRes + 2U);
@@ -131,7 +125,7 @@ void mdcPacketDetected(int frameCount, mdc_u8_t op, mdc_u8_t arg, mdc_u16_t unit
         }
 
         bridge->m_srcIdOverride = res;
-        ::LogMessage(LOG_HOST, "Local Traffic, MDC Detect, converted srcId = %u", bridge->m_srcIdOverride);
+        ::LogMessage(LOG_HOST, "Local Traffic, MDC Detect, converted srcId = %u", res);
     }
 }
 
@@ -152,6 +146,19 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_udpSendAddress("127.0.0.1"),
     m_udpReceivePort(32001),
     m_udpReceiveAddress("127.0.0.1"),
+    m_udpRTPFrames(false),
+    m_udpJitterMinDelay(2U),
+    m_udpJitterMaxDelay(10U),
+    m_udpJitterBuffer(nullptr),
+    m_udpPlayoutMs(0U),
+    m_udpTxSeq(0U),
+    m_udpTxTimestamp(0U),
+    m_udpTxSSRC(0U),
+    m_udpTxLastFrame(0U),
+    m_udpSampleRate(SAMPLE_RATE),
+    m_udpFrameLength(MBE_SAMPLES_LENGTH),
+    m_udpRxResampler(nullptr),
+    m_udpTxResampler(nullptr),
     m_srcId(p25::defines::WUID_FNE),
     m_srcIdOverride(0U),
     m_overrideSrcIdFromMDC(false),
@@ -168,22 +175,40 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_voxSampleLevel(30.0f),
     m_dropTimeMS(180U),
     m_dropTime(1000U, 0U, 180U),
+    m_vadEnabled(false),
+    m_vadMarginDb(12.0f),
+    m_vadMinLevelDb(-50.0f),
+    m_vadHangTimeMs(200U),
+    m_localVad(nullptr),
+    m_localVadSilence(false),
+    m_udpVad(nullptr),
+    m_udpVadSilence(false),
+    m_vadSilentFrames(0U),
     m_detectAnalogMDC1200(false),
     m_preambleLeaderTone(false),
     m_preambleTone(2175),
     m_preambleLength(200U),
     m_grantDemand(false),
     m_localAudio(false),
+    m_localSampleRate(SAMPLE_RATE),
+    m_localFrameLength(MBE_SAMPLES_LENGTH),
+    m_localCaptureResampler(nullptr),
+    m_localPlaybackResampler(nullptr),
     m_maContext(),
     m_maPlaybackDevices(nullptr),
     m_maCaptureDevices(nullptr),
     m_maDeviceConfig(),
     m_maDevice(),
-    m_inputAudio(MBE_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Input Audio Buffer"),
-    m_outputAudio(MBE_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Output Audio Buffer"),
+    m_inputAudio(MAX_AUDIO_FRAME_LENGTH * NUMBER_OF_BUFFERS, "Input Audio Buffer"),
+    m_outputAudio(MAX_AUDIO_FRAME_LENGTH * NUMBER_OF_BUFFERS, "Output Audio Buffer"),
+    m_inputAudioOverruns(0U),
+    m_outputAudioOverruns(0U),
+    m_outputAudioUnderruns(0U),
     m_decoder(nullptr),
     m_encoder(nullptr),
     m_mdcDecoder(nullptr),
+    m_mdcAudio(MBE_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "MDC Audio Buffer"),
+    m_mdcAudioOverruns(0U),
     m_dmrEmbeddedData(),
     m_rxDMRLC(),
     m_rxDMRPILC(),
@@ -208,6 +233,9 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_txStreamId(0U),
     m_detectedSampleCnt(0U),
     m_dumpSampleLevel(false),
+    m_multiTalkgroup(false),
+    m_workerPool(nullptr),
+    m_mappings(),
     m_running(false),
     m_debug(false)
 #if defined(_WIN32)
@@ -327,11 +355,16 @@ int HostBridge::run()
     if (!ret)
         return EXIT_FAILURE;
 
-    if (!m_localAudio && !m_udpAudio) {
+    if (!m_localAudio && !m_udpAudio && !m_multiTalkgroup) {
         ::LogError(LOG_HOST, "Must at least local audio or UDP audio!");
         return EXIT_FAILURE;
     }
 
+    if (m_multiTalkgroup && m_localAudio) {
+        ::LogError(LOG_HOST, "Cannot have local audio and multi-talkgroup mappings.");
+        return EXIT_FAILURE;
+    }
+
     if (m_localAudio) {
         if (g_inputDevice == -1) {
             ::LogError(LOG_HOST, "Cannot have local audio and no specified input audio device.");
@@ -351,6 +384,12 @@ int HostBridge::run()
     if (!ret)
         return EXIT_FAILURE;
 
+    if (m_multiTalkgroup) {
+        ret = createMappings();
+        if (!ret)
+            return EXIT_FAILURE;
+    }
+
     ma_result result;
     if (m_localAudio) {
         // initialize audio devices
@@ -373,7 +412,7 @@ int HostBridge::run()
 
         // configure audio devices
         m_maDeviceConfig = ma_device_config_init(ma_device_type_duplex);
-        m_maDeviceConfig.sampleRate = SAMPLE_RATE;
+        m_maDeviceConfig.sampleRate = m_localSampleRate;
 
         m_maDeviceConfig.capture.pDeviceID = &m_maCaptureDevices[g_inputDevice].id;
         m_maDeviceConfig.capture.format = ma_format_s16;
@@ -385,7 +424,7 @@ int HostBridge::run()
         m_maDeviceConfig.playback.channels = 1;
         m_maDeviceConfig.playback.shareMode = ma_share_mode_shared;
 
-        m_maDeviceConfig.periodSizeInFrames = MBE_SAMPLES_LENGTH;
+        m_maDeviceConfig.periodSizeInFrames = m_localFrameLength;
         m_maDeviceConfig.dataCallback = audioCallback;
         m_maDeviceConfig.pUserData = this;
 
@@ -402,9 +441,22 @@ int HostBridge::run()
             ma_context_uninit(&m_maContext);
             return EXIT_FAILURE;
         }
+
+        // the device runs at its native rate; audio is converted to and from the vocoder rate here, rather
+        // than by the backend
+        if (m_localSampleRate != SAMPLE_RATE) {
+            m_localCaptureResampler = new PolyphaseResampler(m_localSampleRate, SAMPLE_RATE);
+            m_localPlaybackResampler = new PolyphaseResampler(SAMPLE_RATE, m_localSampleRate);
+        }
     }
 
     m_mdcDecoder = mdc_decoder_new(SAMPLE_RATE);
+
+    if (m_vadEnabled) {
+        // the local and UDP audio paths each track their own noise floor and hangover
+        m_localVad = new VoiceActivityDetector(m_vadMarginDb, m_vadMinLevelDb, m_vadHangTimeMs / AUDIO_FRAME_MS);
+        m_udpVad = new VoiceActivityDetector(m_vadMarginDb, m_vadMinLevelDb, m_vadHangTimeMs / AUDIO_FRAME_MS);
+    }
     mdc_decoder_set_callback(m_mdcDecoder, mdcPacketDetected, this);
 
     // initialize vocoders
@@ -457,12 +509,18 @@ int HostBridge::run()
 
     if (!Thread::runAsThread(this, threadNetworkProcess))
         return EXIT_FAILURE;
-    if (!Thread::runAsThread(this, threadCallWatchdog))
-        return EXIT_FAILURE;
+    if (!m_multiTalkgroup) {
+        if (!Thread::runAsThread(this, threadCallWatchdog))
+            return EXIT_FAILURE;
+    }
 
     if (m_localAudio) {
         if (!Thread::runAsThread(this, threadAudioProcess))
             return EXIT_FAILURE;
+        if (m_overrideSrcIdFromMDC) {
+            if (!Thread::runAsThread(this, threadMDCProcess))
+                return EXIT_FAILURE;
+        }
 
         // start audio device
         result = ma_device_start(&m_maDevice);
@@ -504,6 +562,31 @@ int HostBridge::run()
                     ::fatal("failed to reinitialize audio device! panic.");
                 }
             }
+
+            // the audio callback cannot log, so report FIFO overruns and underruns from here
+            uint32_t overruns = m_inputAudio.overruns();
+            if (overruns != m_inputAudioOverruns) {
+                LogWarning(LOG_HOST, "**** Overflow in %s, %u frames dropped", m_inputAudio.name(), overruns - m_inputAudioOverruns);
+                m_inputAudioOverruns = overruns;
+            }
+
+            overruns = m_outputAudio.overruns();
+            if (overruns != m_outputAudioOverruns) {
+                LogWarning(LOG_HOST, "**** Overflow in %s, %u frames dropped", m_outputAudio.name(), overruns - m_outputAudioOverruns);
+                m_outputAudioOverruns = overruns;
+            }
+
+            uint32_t underruns = m_outputAudio.underruns();
+            if (underruns != m_outputAudioUnderruns) {
+                LogWarning(LOG_HOST, "**** Underflow in %s, %u periods of silence", m_outputAudio.name(), underruns - m_outputAudioUnderruns);
+                m_outputAudioUnderruns = underruns;
+            }
+
+            overruns = m_mdcAudio.overruns();
+            if (overruns != m_mdcAudioOverruns) {
+                LogWarning(LOG_HOST, "**** Overflow in %s, %u frames dropped", m_mdcAudio.name(), overruns - m_mdcAudioOverruns);
+                m_mdcAudioOverruns = overruns;
+            }
         }
 
         // ------------------------------------------------------
@@ -516,13 +599,46 @@ int HostBridge::run()
             m_network->clock(ms);
         }
 
-        if (m_udpAudio && m_udpAudioSocket != nullptr)
+        if (m_udpAudio && m_udpAudioSocket != nullptr) {
             processUDPAudio();
+            if (m_udpRTPFrames)
+                clockUDPPlayout(ms);
+        }
+
+        // ------------------------------------------------------
+        //  -- Talkgroup Mapping Clocking                     --
+        // ------------------------------------------------------
+
+        for (auto& entry : m_mappings) {
+            entry.second->processUDPAudio();
+            entry.second->clock(ms);
+        }
 
         if (ms < 2U)
             Thread::sleep(1U);
     }
 
+    // stop network dispatch before tearing down the talkgroup mappings and the network; the network
+    // thread only reads and dispatches frames while holding the network mutex with the bridge running
+    {
+        std::lock_guard<std::mutex> lock(HostBridge::m_networkMutex);
+        m_running = false;
+    }
+
+    if (m_workerPool != nullptr) {
+        m_workerPool->stop();
+    }
+
+    for (auto& entry : m_mappings) {
+        entry.second->close();
+        delete entry.second;
+    }
+    m_mappings.clear();
+
+    if (m_workerPool != nullptr) {
+        delete m_workerPool;
+    }
+
     ::LogSetNetwork(nullptr);
     if (m_network != nullptr) {
         m_network->close();
@@ -535,6 +651,13 @@ int HostBridge::run()
         delete m_udpAudioSocket;
     }
 
+    if (m_udpJitterBuffer != nullptr)
+        delete m_udpJitterBuffer;
+    if (m_udpRxResampler != nullptr)
+        delete m_udpRxResampler;
+    if (m_udpTxResampler != nullptr)
+        delete m_udpTxResampler;
+
     if (m_decoder != nullptr)
         delete m_decoder;
     if (m_encoder != nullptr)
@@ -542,6 +665,11 @@ int HostBridge::run()
 
     delete m_mdcDecoder;
 
+    if (m_localVad != nullptr)
+        delete m_localVad;
+    if (m_udpVad != nullptr)
+        delete m_udpVad;
+
 #if defined(_WIN32)
     if (m_encoderState != nullptr)
         delete m_encoderState;
@@ -555,6 +683,11 @@ int HostBridge::run()
     ma_device_uninit(&m_maDevice);
     ma_context_uninit(&m_maContext);
 
+    if (m_localCaptureResampler != nullptr)
+        delete m_localCaptureResampler;
+    if (m_localPlaybackResampler != nullptr)
+        delete m_localPlaybackResampler;
+
     return EXIT_SUCCESS;
 }
 
@@ -811,6 +944,11 @@ bool HostBridge::readParams()
     m_dropTimeMS = (uint16_t)systemConf["dropTimeMs"].as<uint32_t>(180);
     m_dropTime = Timer(1000U, 0U, m_dropTimeMS);
 
+    m_vadEnabled = systemConf["vad"].as<bool>(false);
+    m_vadMarginDb = systemConf["vadMarginDb"].as<float>(12.0f);
+    m_vadMinLevelDb = systemConf["vadMinLevelDb"].as<float>(-50.0f);
+    m_vadHangTimeMs = systemConf["vadHangTimeMs"].as<uint32_t>(200U);
+
     m_detectAnalogMDC1200 = systemConf["detectAnalogMDC1200"].as<bool>(false);
 
     m_preambleLeaderTone = systemConf["preambleLeaderTone"].as<bool>(false);
@@ -822,10 +960,19 @@ bool HostBridge::readParams()
     m_grantDemand = systemConf["grantDemand"].as<bool>(false);
 
     m_localAudio = systemConf["localAudio"].as<bool>(true);
+    m_localSampleRate = systemConf["localAudioSampleRate"].as<uint32_t>(SAMPLE_RATE);
+    if (!PolyphaseResampler::isSupportedRate(m_localSampleRate)) {
+        ::LogError(LOG_HOST, "Unsupported local audio sample rate, %uHz", m_localSampleRate);
+        return false;
+    }
+    m_localFrameLength = SampleTimeConvert::ToSamples(m_localSampleRate, 1, AUDIO_FRAME_MS);
 
     yaml::Node networkConf = m_conf["network"];
     m_udpAudio = networkConf["udpAudio"].as<bool>(false);
 
+    yaml::Node multiTalkgroupConf = m_conf["multiTalkgroup"];
+    m_multiTalkgroup = multiTalkgroupConf["enable"].as<bool>(false);
+
     LogInfo("General Parameters");
     LogInfo("    Rx Audio Gain: %.1f", m_rxAudioGain);
     LogInfo("    Vocoder Decoder Audio Gain: %.1f", m_vocoderDecoderAudioGain);
@@ -835,6 +982,12 @@ bool HostBridge::readParams()
     LogInfo("    Transmit Mode: %s", m_txMode == TX_MODE_DMR ? "DMR" : "P25");
     LogInfo("    VOX Sample Level: %.1f", m_voxSampleLevel);
     LogInfo("    Drop Time: %ums", m_dropTimeMS);
+    LogInfo("    Voice Activity Detection: %s", m_vadEnabled ? "yes" : "no");
+    if (m_vadEnabled) {
+        LogInfo("    VAD Margin: %.1fdB", m_vadMarginDb);
+        LogInfo("    VAD Minimum Level: %.1fdBFS", m_vadMinLevelDb);
+        LogInfo("    VAD Hang Time: %ums", m_vadHangTimeMs);
+    }
     LogInfo("    Detect Analog MDC1200: %s", m_detectAnalogMDC1200 ? "yes" : "no");
     LogInfo("    Generate Preamble Tone: %s", m_preambleLeaderTone ? "yes" : "no");
     LogInfo("    Preamble Tone: %uhz", m_preambleTone);
@@ -842,7 +995,11 @@ bool HostBridge::readParams()
     LogInfo("    Dump Sample Levels: %s", m_dumpSampleLevel ? "yes" : "no");
     LogInfo("    Grant Demands: %s", m_grantDemand ? "yes" : "no");
     LogInfo("    Local Audio: %s", m_localAudio ? "yes" : "no");
+    if (m_localAudio) {
+        LogInfo("    Local Audio Sample Rate: %uHz", m_localSampleRate);
+    }
     LogInfo("    UDP Audio: %s", m_udpAudio ? "yes" : "no");
+    LogInfo("    Multi-Talkgroup: %s", m_multiTalkgroup ? "yes" : "no");
 
     return true;
 }
@@ -867,6 +1024,19 @@ bool HostBridge::createNetwork()
     m_udpSendAddress = networkConf["udpSendAddress"].as<std::string>();
     m_udpReceivePort = (uint16_t)networkConf["udpReceivePort"].as<uint32_t>(34001);
     m_udpReceiveAddress = networkConf["udpReceiveAddress"].as<std::string>();
+    m_udpRTPFrames = networkConf["udpRTPFrames"].as<bool>(false);
+    m_udpJitterMinDelay = networkConf["udpJitterMinDelay"].as<uint32_t>(2U);
+    m_udpJitterMaxDelay = networkConf["udpJitterMaxDelay"].as<uint32_t>(10U);
+    if (m_udpJitterMinDelay < 1U)
+        m_udpJitterMinDelay = 1U;
+    if (m_udpJitterMaxDelay < m_udpJitterMinDelay)
+        m_udpJitterMaxDelay = m_udpJitterMinDelay;
+    m_udpSampleRate = networkConf["udpSampleRate"].as<uint32_t>(SAMPLE_RATE);
+    if (!PolyphaseResampler::isSupportedRate(m_udpSampleRate)) {
+        ::LogError(LOG_HOST, "Unsupported UDP audio sample rate, %uHz", m_udpSampleRate);
+        return false;
+    }
+    m_udpFrameLength = SampleTimeConvert::ToSamples(m_udpSampleRate, 1, AUDIO_FRAME_MS);
 
     m_srcId = (uint32_t)networkConf["sourceId"].as<uint32_t>(p25::defines::WUID_FNE);
     m_overrideSrcIdFromMDC = networkConf["overrideSourceIdFromMDC"].as<bool>(false);
@@ -929,6 +1099,11 @@ bool HostBridge::createNetwork()
         LogInfo("    UDP Audio Send Port: %u", m_udpSendPort);
         LogInfo("    UDP Audio Receive Address: %s", m_udpReceiveAddress.c_str());
         LogInfo("    UDP Audio Receive Port: %u", m_udpReceivePort);
+        LogInfo("    UDP Audio Sample Rate: %uHz", m_udpSampleRate);
+        LogInfo("    UDP Audio RTP Framing: %s", m_udpRTPFrames ? "yes" : "no");
+        if (m_udpRTPFrames) {
+            LogInfo("    UDP Audio Jitter Buffer Delay: %u - %u frames", m_udpJitterMinDelay, m_udpJitterMaxDelay);
+        }
     }
 
     LogInfo("    Source ID: %u", m_srcId);
@@ -972,14 +1147,104 @@ bool HostBridge::createNetwork()
 
     ::LogSetNetwork(m_network);
 
-    if (m_udpAudio) {
+    // talkgroup mappings open their own UDP audio sockets
+    if (m_udpAudio && !m_multiTalkgroup) {
         m_udpAudioSocket = new Socket(m_udpReceiveAddress, m_udpReceivePort);
         m_udpAudioSocket->open();
+
+        if (m_udpRTPFrames) {
+            m_udpJitterBuffer = new RTPJitterBuffer(m_udpFrameLength, m_udpJitterMinDelay, m_udpJitterMaxDelay, m_udpSampleRate);
+
+            std::random_device rd;
+            std::mt19937 mt(rd());
+            std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
+            m_udpTxSSRC = dist(mt);
+            m_udpTxSeq = (uint16_t)dist(mt);
+            m_udpTxTimestamp = dist(mt);
+        }
+
+        if (m_udpSampleRate != SAMPLE_RATE) {
+            m_udpRxResampler = new PolyphaseResampler(m_udpSampleRate, SAMPLE_RATE);
+            m_udpTxResampler = new PolyphaseResampler(SAMPLE_RATE, m_udpSampleRate);
+        }
     }
 
     return true;
 }
 
+/* Reads the multi-talkgroup mappings from the YAML configuration file and opens them. */
+
+bool HostBridge::createMappings()
+{
+    yaml::Node multiTalkgroupConf = m_conf["multiTalkgroup"];
+    uint32_t workers = multiTalkgroupConf["workers"].as<uint32_t>(0U);
+
+    m_workerPool = new VocoderWorkerPool(workers);
+
+    yaml::Node& mappingList = multiTalkgroupConf["mappings"];
+    if (mappingList.size() == 0U) {
+        ::LogError(LOG_HOST, "Multi-talkgroup mode requires at least one talkgroup mapping.");
+        return false;
+    }
+
+    LogInfo("Multi-Talkgroup Parameters");
+    LogInfo("    Vocoder Workers: %u", m_workerPool->workers());
+
+    for (size_t i = 0; i < mappingList.size(); i++) {
+        yaml::Node& mappingConf = mappingList[i];
+
+        uint32_t dstId = mappingConf["destinationId"].as<uint32_t>(0U);
+        uint8_t slot = (uint8_t)mappingConf["slot"].as<uint32_t>(1U);
+        uint32_t srcId = mappingConf["sourceId"].as<uint32_t>(m_srcId);
+        std::string udpSendAddress = mappingConf["udpSendAddress"].as<std::string>(m_udpSendAddress);
+        uint16_t udpSendPort = (uint16_t)mappingConf["udpSendPort"].as<uint32_t>(0U);
+        std::string udpReceiveAddress = mappingConf["udpReceiveAddress"].as<std::string>(m_udpReceiveAddress);
+        uint16_t udpReceivePort = (uint16_t)mappingConf["udpReceivePort"].as<uint32_t>(0U);
+
+        // P25 has no slots; all P25 mappings share slot 0
+        if (m_txMode == TX_MODE_P25)
+            slot = 0U;
+
+        if (dstId == 0U || udpSendPort == 0U || udpReceivePort == 0U) {
+            ::LogError(LOG_HOST, "Talkgroup mapping %u is missing a destination ID or UDP audio port.", (uint32_t)i);
+            return false;
+        }
+
+        if (m_txMode == TX_MODE_DMR && (slot < 1U || slot > 2U)) {
+            ::LogError(LOG_HOST, "Talkgroup mapping %u has an invalid DMR slot, slot = %u", (uint32_t)i, slot);
+            return false;
+        }
+
+        uint32_t key = TalkgroupMapping::key(dstId, slot);
+        if (m_mappings.find(key) != m_mappings.end()) {
+            ::LogError(LOG_HOST, "Talkgroup mapping %u duplicates TG %u, slot = %u", (uint32_t)i, dstId, slot);
+            return false;
+        }
+
+        TalkgroupMapping* mapping = new TalkgroupMapping(m_network, HostBridge::m_networkMutex, m_workerPool,
+            m_txMode, dstId, slot, srcId);
+        mapping->setUDPAudio(udpSendAddress, udpSendPort, udpReceiveAddress, udpReceivePort, m_udpMetadata, m_overrideSrcIdFromUDP);
+        mapping->setAudioGain(m_rxAudioGain, m_vocoderDecoderAudioGain, m_vocoderDecoderAutoGain, m_txAudioGain, m_vocoderEncoderAudioGain);
+        mapping->setOptions(m_dropTimeMS, m_grantDemand, m_debug);
+
+        if (!mapping->open()) {
+            delete mapping;
+            return false;
+        }
+
+        m_mappings[key] = mapping;
+
+        if (m_txMode == TX_MODE_DMR)
+            LogInfo("    TG %u (Slot %u): Source ID %u, UDP Send %s:%u, UDP Receive %s:%u", dstId, slot, srcId,
+                udpSendAddress.c_str(), udpSendPort, udpReceiveAddress.c_str(), udpReceivePort);
+        else
+            LogInfo("    TG %u: Source ID %u, UDP Send %s:%u, UDP Receive %s:%u", dstId, srcId,
+                udpSendAddress.c_str(), udpSendPort, udpReceiveAddress.c_str(), udpReceivePort);
+    }
+
+    return m_workerPool->start();
+}
+
 /* Helper to process UDP audio. */
 
 void HostBridge::processUDPAudio()
@@ -1004,8 +1269,20 @@ void HostBridge::processUDPAudio()
         if (m_debug)
             Utils::dump(1U, "UDP Audio Network Packet", buffer, length);
 
+        // RTP framed audio is played out through the jitter buffer by clockUDPPlayout()
+        if (m_udpRTPFrames) {
+            processUDPRTPAudio(buffer, (uint32_t)length);
+            return;
+        }
+
         uint32_t pcmLength = __GET_UINT32(buffer, 0U);
 
+        // wideband audio is converted to the vocoder rate one whole frame at a time
+        if (m_udpRxResampler != nullptr && pcmLength != m_udpFrameLength * 2U) {
+            LogWarning(LOG_HOST, "%s, invalid UDP audio frame length, len = %u", UDP_CALL, pcmLength);
+            return;
+        }
+
         UInt8Array __pcm = std::make_unique<uint8_t[]>(pcmLength);
         uint8_t* pcm = __pcm.get();
 
@@ -1019,65 +1296,184 @@ void HostBridge::processUDPAudio()
                 m_udpSrcId = __GET_UINT32(buffer, pcmLength + 8U);
         }
 
-        m_udpDstId = m_dstId;
+        if (m_udpRxResampler != nullptr) {
+            short samples[MAX_AUDIO_FRAME_LENGTH];
+            for (uint32_t smpIdx = 0U; smpIdx < m_udpFrameLength; smpIdx++) {
+                samples[smpIdx] = (short)((pcm[(smpIdx * 2U) + 1U] << 8) | pcm[(smpIdx * 2U) + 0U]);
+            }
+
+            processUDPAudioSamples(samples);
+            return;
+        }
+
+        processUDPAudioFrame(pcm);
+    }
+}
+
+/* Helper to process RTP framed UDP audio. */
+
+void HostBridge::processUDPRTPAudio(const uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+
+    frame::RTPHeader rtpHeader;
+    if (length < RTP_HEADER_LENGTH_BYTES || !rtpHeader.decode(buffer)) {
+        LogWarning(LOG_HOST, "%s, invalid RTP audio packet, len = %u", UDP_CALL, length);
+        return;
+    }
+
+    uint32_t offset = RTP_HEADER_LENGTH_BYTES + (rtpHeader.getCSRCCount() * 4U);
+
+    uint32_t srcId = m_srcId;
+    if (rtpHeader.getExtension() && length >= offset + RTP_EXTENSION_HEADER_LENGTH_BYTES) {
+        frame::RTPExtensionHeader extHeader;
+        extHeader.decode(buffer + offset);
+
+        uint32_t extLength = RTP_EXTENSION_HEADER_LENGTH_BYTES + (extHeader.getPayloadLength() * 4U);
+        if (extHeader.getPayloadType() == RTP_METADATA_EXT_TYPE && extHeader.getPayloadLength() >= RTP_METADATA_EXT_LENGTH_WORDS &&
+            length >= offset + extLength) {
+            if (m_overrideSrcIdFromUDP)
+                srcId = __GET_UINT32(buffer, offset + RTP_EXTENSION_HEADER_LENGTH_BYTES + 4U);
+        }
+
+        offset += extLength;
+    }
+
+    if (rtpHeader.getPayloadType() != RTP_L16_PAYLOAD_TYPE || length < offset + (m_udpFrameLength * 2U)) {
+        LogWarning(LOG_HOST, "%s, unsupported RTP audio payload, pt = %u, len = %u", UDP_CALL, rtpHeader.getPayloadType(), length);
+        return;
+    }
+
+    // L16 samples are carried in network byte order
+    short samples[MAX_AUDIO_FRAME_LENGTH];
+    const uint8_t* payload = buffer + offset;
+    for (uint32_t smpIdx = 0U; smpIdx < m_udpFrameLength; smpIdx++) {
+        samples[smpIdx] = (short)((payload[(smpIdx * 2U) + 0U] << 8) | payload[(smpIdx * 2U) + 1U]);
+    }
+
+    m_udpSrcId = srcId;
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    m_udpJitterBuffer->addFrame(rtpHeader, samples, now);
+}
+
+/* Helper to play out RTP framed UDP audio from the jitter buffer. */
+
+void HostBridge::clockUDPPlayout(uint32_t ms)
+{
+    if (m_udpJitterBuffer == nullptr)
+        return;
+
+    // don't try to catch up on more than a few frames after a stall
+    m_udpPlayoutMs += ms;
+    if (m_udpPlayoutMs > (UDP_PLAYOUT_FRAME_MS * 4U))
+        m_udpPlayoutMs = UDP_PLAYOUT_FRAME_MS * 4U;
+
+    while (m_udpPlayoutMs >= UDP_PLAYOUT_FRAME_MS) {
+        m_udpPlayoutMs -= UDP_PLAYOUT_FRAME_MS;
+
+        short samples[MAX_AUDIO_FRAME_LENGTH];
+        if (!m_udpJitterBuffer->getFrame(samples))
+            continue;
+
+        processUDPAudioSamples(samples);
+    }
+}
+
+/* Helper to convert a frame of received UDP audio to the vocoder sample rate, and encode and transmit it. */
+
+void HostBridge::processUDPAudioSamples(const short* samples)
+{
+    assert(samples != nullptr);
+
+    short frame[MBE_SAMPLES_LENGTH];
+    if (m_udpRxResampler != nullptr) {
+        m_udpRxResampler->process(samples, m_udpFrameLength, frame);
+        samples = frame;
+    }
 
-        std::lock_guard<std::mutex> lock(m_audioMutex);
+    uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
+    for (uint32_t smpIdx = 0U; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+        pcm[(smpIdx * 2U) + 0U] = (uint8_t)(samples[smpIdx] & 0xFF);
+        pcm[(smpIdx * 2U) + 1U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+    }
+
+    processUDPAudioFrame(pcm);
+}
 
-        int smpIdx = 0;
+/* Helper to encode and transmit a frame of UDP audio. */
+
+void HostBridge::processUDPAudioFrame(uint8_t* pcm)
+{
+    assert(pcm != nullptr);
+
+    m_udpDstId = m_dstId;
+
+    // UDP audio is encoded directly below; only the audio callback feeds the input audio FIFO
+    std::lock_guard<std::mutex> lock(m_audioMutex);
+
+    bool voice = true;
+    if (m_udpVad != nullptr) {
         short samples[MBE_SAMPLES_LENGTH];
-        for (uint32_t pcmIdx = 0; pcmIdx < pcmLength; pcmIdx += 2) {
-            samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-            smpIdx++;
-        }
-
-        m_inputAudio.addData(samples, MBE_SAMPLES_LENGTH);
-
-        m_trafficFromUDP = true;
-
-        // force start a call if one isn't already in progress
-        if (!m_audioDetect && !m_callInProgress) {
-            m_audioDetect = true;
-            if (m_txStreamId == 0U) {
-                m_txStreamId = 1U; // prevent further false starts -- this isn't the right way to handle this...
-                LogMessage(LOG_HOST, "%s, call start, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_udpDstId);
-                if (m_grantDemand) {
-                    switch (m_txMode)
-                    {
-                    case TX_MODE_P25:
-                    {
-                        p25::lc::LC lc = p25::lc::LC();
-                        lc.setLCO(p25::defines::LCO::GROUP);
-                        lc.setDstId(m_udpDstId);
-                        lc.setSrcId(m_udpSrcId);
-
-                        p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
-
-                        uint8_t controlByte = 0x80U;
-                        m_network->writeP25TDU(lc, lsd, controlByte);
-                    }
-                    break;
-                    }
+        for (uint32_t smpIdx = 0U; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+            samples[smpIdx] = (short)((pcm[(smpIdx * 2U) + 1U] << 8) | pcm[(smpIdx * 2U) + 0U]);
+        }
+
+        voice = m_udpVad->process(samples, MBE_SAMPLES_LENGTH);
+        m_udpVadSilence = !voice;
+
+        // silence doesn't start a call
+        if (!voice && !m_audioDetect)
+            return;
+    }
+
+    m_trafficFromUDP = true;
+
+    // force start a call if one isn't already in progress
+    if (!m_audioDetect && !m_callInProgress) {
+        m_audioDetect = true;
+        if (m_txStreamId == 0U) {
+            m_txStreamId = 1U; // prevent further false starts -- this isn't the right way to handle this...
+            LogMessage(LOG_HOST, "%s, call start, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_udpDstId);
+            if (m_grantDemand) {
+                switch (m_txMode)
+                {
+                case TX_MODE_P25:
+                {
+                    p25::lc::LC lc = p25::lc::LC();
+                    lc.setLCO(p25::defines::LCO::GROUP);
+                    lc.setDstId(m_udpDstId);
+                    lc.setSrcId(m_udpSrcId);
+
+                    p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+
+                    uint8_t controlByte = 0x80U;
+                    m_network->writeP25TDU(lc, lsd, controlByte);
+                }
+                break;
                 }
             }
+        }
 
-            m_dropTime.stop();
+        m_dropTime.stop();
 
-            if (!m_dropTime.isRunning())
-                m_dropTime.start();
-        }
+        if (!m_dropTime.isRunning())
+            m_dropTime.start();
+    }
 
-        // If audio detection is active and no call is in progress, encode and transmit the audio
-        if (m_audioDetect && !m_callInProgress) {
+    // If audio detection is active and no call is in progress, encode and transmit the audio
+    if (m_audioDetect && !m_callInProgress) {
+        // silence doesn't hold the call open either; the drop timer keeps running until it ends the call
+        if (voice)
             m_dropTime.start();
 
-            switch (m_txMode) {
-            case TX_MODE_DMR:
-                encodeDMRAudioFrame(pcm, m_udpSrcId);
-                break;
-            case TX_MODE_P25:
-                encodeP25AudioFrame(pcm, m_udpSrcId);
-                break;
-            }
+        switch (m_txMode) {
+        case TX_MODE_DMR:
+            encodeDMRAudioFrame(pcm, m_udpVadSilence, m_udpSrcId);
+            break;
+        case TX_MODE_P25:
+            encodeP25AudioFrame(pcm, m_udpVadSilence, m_udpSrcId);
+            break;
         }
     }
 }
@@ -1124,6 +1520,13 @@ void HostBridge::processDMRNetwork(uint8_t* buffer, uint32_t length)
         return;
     }
 
+    if (m_multiTalkgroup) {
+        auto it = m_mappings.find(TalkgroupMapping::key(dstId, (uint8_t)slotNo));
+        if (it != m_mappings.end())
+            it->second->processDMRNetwork(buffer, length);
+        return;
+    }
+
     bool dataSync = (buffer[15U] & 0x20U) == 0x20U;
     bool voiceSync = (buffer[15U] & 0x10U) == 0x10U;
 
@@ -1302,51 +1705,124 @@ void HostBridge::decodeDMRAudioFrame(uint8_t* ambe, uint32_t srcId, uint32_t dst
         }
 
         if (m_localAudio) {
-            m_outputAudio.addData(samples, MBE_SAMPLES_LENGTH);
+            writeLocalAudio(samples);
         }
 
         if (m_udpAudio) {
-            int pcmIdx = 0;
-            uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
-            for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-                pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-                pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-                pcmIdx += 2;
-            }
+            writeUDPAudio(samples, srcId, dstId);
+        }
+    }
+}
 
-            uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
-            uint8_t* audioData = nullptr;
-            if (!m_udpMetadata) {
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 4U]; // PCM + 4 bytes (PCM length)
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-            }
-            else {
-                length = (MBE_SAMPLES_LENGTH * 2U) + 12U;
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 12U]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-
-                // embed destination and source IDs
-                __SET_UINT32(dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
-                __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
-            }
+/* Helper to write decoded audio samples to the UDP audio endpoint. */
 
-            sockaddr_storage addr;
-            uint32_t addrLen;
+void HostBridge::writeUDPAudio(const short* samples, uint32_t srcId, uint32_t dstId)
+{
+    assert(samples != nullptr);
 
-            if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, addr, addrLen) == 0) {
-                m_udpAudioSocket->write(audioData, length, addr, addrLen);
-            }
+    if (m_udpAudioSocket == nullptr)
+        return;
+
+    uint32_t frameLength = MBE_SAMPLES_LENGTH;
+    short frame[MAX_AUDIO_FRAME_LENGTH];
+    if (m_udpTxResampler != nullptr) {
+        frameLength = m_udpTxResampler->process(samples, MBE_SAMPLES_LENGTH, frame);
+        samples = frame;
+    }
+
+    uint8_t audioData[RTP_HEADER_LENGTH_BYTES + RTP_EXTENSION_HEADER_LENGTH_BYTES + (RTP_METADATA_EXT_LENGTH_WORDS * 4U) + (MAX_AUDIO_FRAME_LENGTH * 2U)];
+    uint32_t length = 0U;
+
+    if (m_udpRTPFrames) {
+        uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-            delete[] audioData;
+        // a gap in the audio starts a new talkspurt; mark it, and keep the timestamp running in real time across the gap
+        bool marker = false;
+        if (m_udpTxLastFrame == 0U || (now - m_udpTxLastFrame) > UDP_TALKSPURT_GAP_MS) {
+            marker = true;
+            if (m_udpTxLastFrame != 0U)
+                m_udpTxTimestamp += (uint32_t)(((now - m_udpTxLastFrame) * m_udpSampleRate) / 1000U) - frameLength;
         }
+        m_udpTxLastFrame = now;
+
+        frame::RTPHeader rtpHeader;
+        rtpHeader.setMarker(marker);
+        rtpHeader.setPayloadType(RTP_L16_PAYLOAD_TYPE);
+        rtpHeader.setSequence(m_udpTxSeq++);
+        rtpHeader.setTimestamp(m_udpTxTimestamp);
+        rtpHeader.setSSRC(m_udpTxSSRC);
+        rtpHeader.setExtension(m_udpMetadata);
+        rtpHeader.encode(audioData);
+        length = RTP_HEADER_LENGTH_BYTES;
+
+        m_udpTxTimestamp += frameLength;
+
+        // embed destination and source IDs
+        if (m_udpMetadata) {
+            frame::RTPExtensionHeader extHeader;
+            extHeader.setPayloadType(RTP_METADATA_EXT_TYPE);
+            extHeader.setPayloadLength(RTP_METADATA_EXT_LENGTH_WORDS);
+            extHeader.encode(audioData + length);
+            length += RTP_EXTENSION_HEADER_LENGTH_BYTES;
+
+            __SET_UINT32(dstId, audioData, length);
+            __SET_UINT32(srcId, audioData, length + 4U);
+            length += RTP_METADATA_EXT_LENGTH_WORDS * 4U;
+        }
+
+        // L16 samples are carried in network byte order
+        for (uint32_t smpIdx = 0U; smpIdx < frameLength; smpIdx++) {
+            audioData[length + 0U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+            audioData[length + 1U] = (uint8_t)(samples[smpIdx] & 0xFF);
+            length += 2U;
+        }
+    }
+    else {
+        // PCM + 4 bytes (PCM length), optionally followed by 4 bytes (dstId) + 4 bytes (srcId)
+        __SET_UINT32((frameLength * 2U), audioData, 0U);
+        length = 4U;
+
+        for (uint32_t smpIdx = 0U; smpIdx < frameLength; smpIdx++) {
+            audioData[length + 0U] = (uint8_t)(samples[smpIdx] & 0xFF);
+            audioData[length + 1U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+            length += 2U;
+        }
+
+        // embed destination and source IDs
+        if (m_udpMetadata) {
+            __SET_UINT32(dstId, audioData, length);
+            __SET_UINT32(srcId, audioData, length + 4U);
+            length += 8U;
+        }
+    }
+
+    sockaddr_storage addr;
+    uint32_t addrLen;
+
+    if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, addr, addrLen) == 0) {
+        m_udpAudioSocket->write(audioData, length, addr, addrLen);
+    }
+}
+
+/* Helper to write decoded audio samples to the local audio device. */
+
+void HostBridge::writeLocalAudio(const short* samples)
+{
+    assert(samples != nullptr);
+
+    if (m_localPlaybackResampler != nullptr) {
+        short frame[MAX_AUDIO_FRAME_LENGTH];
+        uint32_t length = m_localPlaybackResampler->process(samples, MBE_SAMPLES_LENGTH, frame);
+        m_outputAudio.addData(frame, length);
+    }
+    else {
+        m_outputAudio.addData(samples, MBE_SAMPLES_LENGTH);
     }
 }
 
 /* Helper to encode DMR network traffic audio frames. */
 
-void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_t forcedDstId)
+void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, bool silence, uint32_t forcedSrcId, uint32_t forcedDstId)
 {
     assert(pcm != nullptr);
     using namespace dmr;
@@ -1480,19 +1956,25 @@ void HostBridge::encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
         }
     }
 
-    // encode PCM samples into AMBE codewords
+    // encode PCM samples into AMBE codewords; silence is sent as the null codeword without running the encoder
     uint8_t ambe[RAW_AMBE_LENGTH_BYTES];
-    ::memset(ambe, 0x00U, RAW_AMBE_LENGTH_BYTES);
-#if defined(_WIN32)
-    if (m_useExternalVocoder) {
-        ambeEncode(samples, MBE_SAMPLES_LENGTH, ambe);
+    if (silence) {
+        ::memcpy(ambe, NULL_AMBE, RAW_AMBE_LENGTH_BYTES);
+        m_vadSilentFrames++;
     }
     else {
+        ::memset(ambe, 0x00U, RAW_AMBE_LENGTH_BYTES);
+#if defined(_WIN32)
+        if (m_useExternalVocoder) {
+            ambeEncode(samples, MBE_SAMPLES_LENGTH, ambe);
+        }
+        else {
 #endif // defined(_WIN32)
-        m_encoder->encode(samples, ambe);
+            m_encoder->encode(samples, ambe);
 #if defined(_WIN32)
-    }
+        }
 #endif // defined(_WIN32)
+    }
 
     // Utils::dump(1U, "Encoded AMBE", ambe, RAW_AMBE_LENGTH_BYTES);
 
@@ -1512,6 +1994,14 @@ void HostBridge::processP25Network(uint8_t* buffer, uint32_t length)
     if (m_txMode != TX_MODE_P25)
         return;
 
+    if (m_multiTalkgroup) {
+        uint32_t dstId = __GET_UINT16(buffer, 8U);
+        auto it = m_mappings.find(TalkgroupMapping::key(dstId, 0U));
+        if (it != m_mappings.end())
+            it->second->processP25Network(buffer, length);
+        return;
+    }
+
     bool grantDemand = (buffer[14U] & 0x80U) == 0x80U;
     bool grantDenial = (buffer[14U] & 0x40U) == 0x40U;
     bool unitToUnit = (buffer[14U] & 0x01U) == 0x01U;
@@ -1849,51 +2339,18 @@ void HostBridge::decodeP25AudioFrame(uint8_t* ldu, uint32_t srcId, uint32_t dstI
         }
 
         if (m_localAudio) {
-            m_outputAudio.addData(samples, MBE_SAMPLES_LENGTH);
+            writeLocalAudio(samples);
         }
 
         if (m_udpAudio) {
-            int pcmIdx = 0;
-            uint8_t pcm[MBE_SAMPLES_LENGTH * 2U];
-            for (uint32_t smpIdx = 0; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
-                pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
-                pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-                pcmIdx += 2;
-            }
-
-            uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
-            uint8_t* audioData = nullptr;
-            if (!m_udpMetadata) {
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 4U]; // PCM + 4 bytes (PCM length)
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-            }
-            else {
-                length = (MBE_SAMPLES_LENGTH * 2U) + 12U;
-                audioData = new uint8_t[(MBE_SAMPLES_LENGTH * 2U) + 12U]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
-                __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
-                ::memcpy(audioData + 4U, pcm, MBE_SAMPLES_LENGTH * 2U);
-
-                // embed destination and source IDs
-                __SET_UINT32(dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
-                __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
-            }
-
-            sockaddr_storage addr;
-            uint32_t addrLen;
-
-            if (udp::Socket::lookup(m_udpSendAddress, m_udpSendPort, addr, addrLen) == 0) {
-                m_udpAudioSocket->write(audioData, length, addr, addrLen);
-            }
-
-            delete[] audioData;
+            writeUDPAudio(samples, srcId, dstId);
         }
     }
 }
 
 /* Helper to encode P25 network traffic audio frames. */
 
-void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_t forcedDstId)
+void HostBridge::encodeP25AudioFrame(uint8_t* pcm, bool silence, uint32_t forcedSrcId, uint32_t forcedDstId)
 {
     assert(pcm != nullptr);
     using namespace p25;
@@ -1932,19 +2389,25 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
         }
     }
 
-    // encode PCM samples into IMBE codewords
+    // encode PCM samples into IMBE codewords; silence is sent as the null codeword without running the encoder
     uint8_t imbe[RAW_IMBE_LENGTH_BYTES];
-    ::memset(imbe, 0x00U, RAW_IMBE_LENGTH_BYTES);
-#if defined(_WIN32)
-    if (m_useExternalVocoder) {
-        ambeEncode(samples, MBE_SAMPLES_LENGTH, imbe);
+    if (silence) {
+        ::memcpy(imbe, NULL_IMBE, RAW_IMBE_LENGTH_BYTES);
+        m_vadSilentFrames++;
     }
     else {
+        ::memset(imbe, 0x00U, RAW_IMBE_LENGTH_BYTES);
+#if defined(_WIN32)
+        if (m_useExternalVocoder) {
+            ambeEncode(samples, MBE_SAMPLES_LENGTH, imbe);
+        }
+        else {
 #endif // defined(_WIN32)
-        m_encoder->encode(samples, imbe);
+            m_encoder->encode(samples, imbe);
 #if defined(_WIN32)
-    }
+        }
 #endif // defined(_WIN32)
+    }
 
     // Utils::dump(1U, "Encoded IMBE", imbe, RAW_IMBE_LENGTH_BYTES);
 
@@ -2050,9 +2513,7 @@ void HostBridge::encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId, uint32_
 
 void HostBridge::generatePreambleTone()
 {
-    std::lock_guard<std::mutex> lock(m_audioMutex);
-
-    uint64_t frameCount = SampleTimeConvert::ToSamples(SAMPLE_RATE, 1, m_preambleLength);
+    uint64_t frameCount = SampleTimeConvert::ToSamples(m_localSampleRate, 1, m_preambleLength);
     if (frameCount > m_outputAudio.freeSpace()) {
         ::LogError(LOG_HOST, "failed to generate preamble tone");
         return;
@@ -2087,6 +2548,10 @@ void HostBridge::callEnd(uint32_t srcId, uint32_t dstId)
     }
 
     LogMessage(LOG_HOST, "%s, call end, srcId = %u, dstId = %u", trafficType.c_str(), srcId, dstId);
+    if (m_vadEnabled && m_debug) {
+        LogDebug(LOG_HOST, "%s, %u silent frames sent as null codewords", trafficType.c_str(), m_vadSilentFrames);
+    }
+    m_vadSilentFrames = 0U;
 
     m_audioDetect = false;
     m_dropTime.stop();
@@ -2173,17 +2638,27 @@ void* HostBridge::threadAudioProcess(void* arg)
             uint32_t ms = stopWatch.elapsed();
             stopWatch.start();
 
-            // scope is intentional
-            {
-                std::lock_guard<std::mutex> lock(m_audioMutex);
-
-                if (bridge->m_inputAudio.dataSize() >= MBE_SAMPLES_LENGTH) {
-                    short samples[MBE_SAMPLES_LENGTH];
+            if (bridge->m_inputAudio.dataSize() >= bridge->m_localFrameLength) {
+                short samples[MBE_SAMPLES_LENGTH];
+                if (bridge->m_localCaptureResampler != nullptr) {
+                    // every supported rate holds a whole number of decimation periods in 20ms, so a device frame
+                    // always converts to exactly one vocoder frame
+                    short frame[MAX_AUDIO_FRAME_LENGTH];
+                    bridge->m_inputAudio.get(frame, bridge->m_localFrameLength);
+                    bridge->m_localCaptureResampler->process(frame, bridge->m_localFrameLength, samples);
+                }
+                else {
                     bridge->m_inputAudio.get(samples, MBE_SAMPLES_LENGTH);
+                }
 
-                    // process MDC, if necessary
+                // the audio mutex guards the encoder and call state only; the FIFO itself is lock-free
+                {
+                    std::lock_guard<std::mutex> lock(m_audioMutex);
+
+                    // hand the frame to the MDC decode thread, if necessary; if it falls behind, frames are dropped
+                    // rather than delaying the encoder
                     if (bridge->m_overrideSrcIdFromMDC)
-                        mdc_decoder_process_samples(bridge->m_mdcDecoder, samples, MBE_SAMPLES_LENGTH);
+                        bridge->m_mdcAudio.addData(samples, MBE_SAMPLES_LENGTH);
 
                     float sampleLevel = bridge->m_voxSampleLevel / 1000;
 
@@ -2216,8 +2691,16 @@ void* HostBridge::threadAudioProcess(void* arg)
                         bridge->m_detectedSampleCnt++;
                     }
 
+                    // the voice activity detector additionally rejects audio above the VOX level that isn't speech
+                    bool voice = maxSample > sampleLevel;
+                    if (bridge->m_localVad != nullptr) {
+                        bool speech = bridge->m_localVad->process(samples, MBE_SAMPLES_LENGTH);
+                        bridge->m_localVadSilence = !speech;
+                        voice = voice && speech;
+                    }
+
                     // handle Rx triggered by internal VOX
-                    if (maxSample > sampleLevel) {
+                    if (voice) {
                         bridge->m_audioDetect = true;
                         if (bridge->m_txStreamId == 0U) {
                             bridge->m_txStreamId = 1U; // prevent further false starts -- this isn't the right way to handle this...
@@ -2270,10 +2753,10 @@ void* HostBridge::threadAudioProcess(void* arg)
                         switch (bridge->m_txMode)
                         {
                         case TX_MODE_DMR:
-                            bridge->encodeDMRAudioFrame(pcm);
+                            bridge->encodeDMRAudioFrame(pcm, bridge->m_localVadSilence);
                             break;
                         case TX_MODE_P25:
-                            bridge->encodeP25AudioFrame(pcm);
+                            bridge->encodeP25AudioFrame(pcm, bridge->m_localVadSilence);
                             break;
                         }
                     }
@@ -2335,6 +2818,9 @@ void* HostBridge::threadNetworkProcess(void* arg)
             bool netReadRet = false;
             if (bridge->m_txMode == TX_MODE_DMR) {
                 std::lock_guard<std::mutex> lock(HostBridge::m_networkMutex);
+                if (!bridge->m_running)
+                    continue;
+
                 UInt8Array dmrBuffer = bridge->m_network->readDMR(netReadRet, length);
                 if (netReadRet) {
                     bridge->processDMRNetwork(dmrBuffer.get(), length);
@@ -2343,6 +2829,9 @@ void* HostBridge::threadNetworkProcess(void* arg)
 
             if (bridge->m_txMode == TX_MODE_P25) {
                 std::lock_guard<std::mutex> lock(HostBridge::m_networkMutex);
+                if (!bridge->m_running)
+                    continue;
+
                 UInt8Array p25Buffer = bridge->m_network->readP25(netReadRet, length);
                 if (netReadRet) {
                     bridge->processP25Network(p25Buffer.get(), length);
@@ -2359,6 +2848,59 @@ void* HostBridge::threadNetworkProcess(void* arg)
     return nullptr;
 }
 
+/* Entry point to MDC1200 decode thread. */
+
+void* HostBridge::threadMDCProcess(void* arg)
+{
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
+#if defined(_WIN32)
+        ::CloseHandle(th->thread);
+#else
+        ::pthread_detach(th->thread);
+#endif // defined(_WIN32)
+
+        std::string threadName("bridge:mdc-process");
+        HostBridge* bridge = static_cast<HostBridge*>(th->obj);
+        if (bridge == nullptr) {
+            g_killed = true;
+            LogDebug(LOG_HOST, "[FAIL] %s", threadName.c_str());
+        }
+
+        if (g_killed) {
+            delete th;
+            return nullptr;
+        }
+
+        LogDebug(LOG_HOST, "[ OK ] %s", threadName.c_str());
+#ifdef _GNU_SOURCE
+        ::pthread_setname_np(th->thread, threadName.c_str());
+#endif // _GNU_SOURCE
+
+        while (!g_killed) {
+            if (!bridge->m_running) {
+                Thread::sleep(1U);
+                continue;
+            }
+
+            // this thread is the MDC FIFO's only consumer, and the only user of the MDC decoder; a detected
+            // packet updates the source ID override from here
+            short samples[MBE_SAMPLES_LENGTH];
+            while (bridge->m_mdcAudio.dataSize() >= MBE_SAMPLES_LENGTH) {
+                bridge->m_mdcAudio.get(samples, MBE_SAMPLES_LENGTH);
+                mdc_decoder_process_samples(bridge->m_mdcDecoder, samples, MBE_SAMPLES_LENGTH);
+            }
+
+            Thread::sleep(1U);
+        }
+
+        LogDebug(LOG_HOST, "[STOP] %s", threadName.c_str());
+        delete th;
+    }
+
+    return nullptr;
+}
+
 /* Entry point to call watchdog handler thread. */
 
 void* HostBridge::threadCallWatchdog(void* arg)
@@ -21,8 +21,9 @@
 #include "common/dmr/lc/LC.h"
 #include "common/dmr/lc/PrivacyLC.h"
 #include "common/network/udp/Socket.h"
+#include "common/network/RTPJitterBuffer.h"
 #include "common/yaml/Yaml.h"
-#include "common/RingBuffer.h"
+#include "common/SPSCRingBuffer.h"
 #include "common/Timer.h"
 #include "vocoder/MBEDecoder.h"
 #include "vocoder/MBEEncoder.h"
@@ -30,7 +31,12 @@
 #include "audio/miniaudio.h"
 #include "mdc/mdc_decode.h"
 #include "network/PeerNetwork.h"
+#include "PolyphaseResampler.h"
+#include "TalkgroupMapping.h"
+#include "VocoderWorkerPool.h"
+#include "VoiceActivityDetector.h"
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -47,7 +53,6 @@
 //  Constants
 // ---------------------------------------------------------------------------
 
-#define MBE_SAMPLES_LENGTH 160
 #define NO_BIT_STEAL 0
 
 #define ECMODE_NOISE_SUPPRESS 0x40
@@ -59,10 +64,6 @@
 const uint8_t FULL_RATE_MODE = 0x00U;
 const uint8_t HALF_RATE_MODE = 0x01U;
 
-const uint8_t TX_MODE_DMR = 1U;
-const uint8_t TX_MODE_P25 = 2U;
-
-
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -134,9 +135,22 @@ private:
     std::string m_udpSendAddress;
     uint16_t m_udpReceivePort;
     std::string m_udpReceiveAddress;
+    bool m_udpRTPFrames;
+    uint32_t m_udpJitterMinDelay;
+    uint32_t m_udpJitterMaxDelay;
+    network::RTPJitterBuffer* m_udpJitterBuffer;
+    uint32_t m_udpPlayoutMs;
+    uint16_t m_udpTxSeq;
+    uint32_t m_udpTxTimestamp;
+    uint32_t m_udpTxSSRC;
+    uint64_t m_udpTxLastFrame;
+    uint32_t m_udpSampleRate;
+    uint32_t m_udpFrameLength;
+    PolyphaseResampler* m_udpRxResampler;
+    PolyphaseResampler* m_udpTxResampler;
 
     uint32_t m_srcId;
-    uint32_t m_srcIdOverride;
+    std::atomic<uint32_t> m_srcIdOverride;
     bool m_overrideSrcIdFromMDC;
     bool m_overrideSrcIdFromUDP;
     uint32_t m_dstId;
@@ -155,6 +169,16 @@ private:
     uint16_t m_dropTimeMS;
     Timer m_dropTime;
 
+    bool m_vadEnabled;
+    float m_vadMarginDb;
+    float m_vadMinLevelDb;
+    uint32_t m_vadHangTimeMs;
+    VoiceActivityDetector* m_localVad;
+    bool m_localVadSilence;
+    VoiceActivityDetector* m_udpVad;
+    bool m_udpVadSilence;
+    uint32_t m_vadSilentFrames;
+
     bool m_detectAnalogMDC1200;
 
     bool m_preambleLeaderTone;
@@ -164,6 +188,10 @@ private:
     bool m_grantDemand;
 
     bool m_localAudio;
+    uint32_t m_localSampleRate;
+    uint32_t m_localFrameLength;
+    PolyphaseResampler* m_localCaptureResampler;
+    PolyphaseResampler* m_localPlaybackResampler;
 
     ma_context m_maContext;
     ma_device_info* m_maPlaybackDevices;
@@ -174,13 +202,18 @@ private:
     ma_waveform m_maSineWaveform;
     ma_waveform_config m_maSineWaveConfig;
 
-    RingBuffer<short> m_inputAudio;
-    RingBuffer<short> m_outputAudio;
+    SPSCRingBuffer<short> m_inputAudio;
+    SPSCRingBuffer<short> m_outputAudio;
+    uint32_t m_inputAudioOverruns;
+    uint32_t m_outputAudioOverruns;
+    uint32_t m_outputAudioUnderruns;
 
     vocoder::MBEDecoder* m_decoder;
     vocoder::MBEEncoder* m_encoder;
 
     mdc_decoder_t* m_mdcDecoder;
+    SPSCRingBuffer<short> m_mdcAudio;
+    uint32_t m_mdcAudioOverruns;
 
     dmr::data::EmbeddedData m_dmrEmbeddedData;
     dmr::lc::LC m_rxDMRLC;
@@ -210,10 +243,14 @@ private:
     uint8_t m_detectedSampleCnt;
     bool m_dumpSampleLevel;
 
+    bool m_multiTalkgroup;
+    VocoderWorkerPool* m_workerPool;
+    std::unordered_map<uint32_t, TalkgroupMapping*> m_mappings;
+
     bool m_running;
     bool m_debug;
 
-    static std::mutex m_audioMutex;
+    static std::mutex m_audioMutex;         // guards the encoder and local/UDP call state; never taken by the audio callback
     static std::mutex m_networkMutex;
 
 #if defined(_WIN32)
@@ -356,11 +393,49 @@ private:
      * @returns bool True, if network connectivity was initialized, otherwise false.
      */
     bool createNetwork();
+    /**
+     * @brief Reads the multi-talkgroup mappings from the YAML configuration file and opens them.
+     * @returns bool True, if the mappings were created, otherwise false.
+     */
+    bool createMappings();
 
     /**
      * @brief Helper to process UDP audio.
      */
     void processUDPAudio();
+    /**
+     * @brief Helper to process RTP framed UDP audio.
+     * @param buffer Buffer containing the RTP packet.
+     * @param length Length of buffer.
+     */
+    void processUDPRTPAudio(const uint8_t* buffer, uint32_t length);
+    /**
+     * @brief Helper to play out RTP framed UDP audio from the jitter buffer.
+     * @param ms Number of milliseconds elapsed since the last call.
+     */
+    void clockUDPPlayout(uint32_t ms);
+    /**
+     * @brief Helper to encode and transmit a frame of UDP audio.
+     * @param pcm PCM audio frame (little endian 16-bit samples).
+     */
+    void processUDPAudioFrame(uint8_t* pcm);
+    /**
+     * @brief Helper to convert a frame of received UDP audio to the vocoder sample rate, and encode and transmit it.
+     * @param samples PCM samples (one frame at the UDP audio sample rate).
+     */
+    void processUDPAudioSamples(const short* samples);
+    /**
+     * @brief Helper to write decoded audio samples to the UDP audio endpoint.
+     * @param samples PCM samples.
+     * @param srcId Source ID.
+     * @param dstId Destination ID.
+     */
+    void writeUDPAudio(const short* samples, uint32_t srcId, uint32_t dstId);
+    /**
+     * @brief Helper to write decoded audio samples to the local audio device.
+     * @param samples PCM samples.
+     */
+    void writeLocalAudio(const short* samples);
 
     /**
      * @brief Helper to process DMR network traffic.
@@ -379,10 +454,11 @@ private:
     /**
      * @brief Helper to encode DMR network traffic audio frames.
      * @param pcm 
+     * @param silence Flag indicating the voice activity detector classified the frame as silence.
      * @param forcedSrcId 
      * @param forcedDstId 
      */
-    void encodeDMRAudioFrame(uint8_t* pcm, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
+    void encodeDMRAudioFrame(uint8_t* pcm, bool silence, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
 
     /**
      * @brief Helper to process P25 network traffic.
@@ -401,10 +477,11 @@ private:
     /**
      * @brief Helper to encode P25 network traffic audio frames.
      * @param pcm 
+     * @param silence Flag indicating the voice activity detector classified the frame as silence.
      * @param forcedSrcId 
      * @param forcedDstId 
      */
-    void encodeP25AudioFrame(uint8_t* pcm, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
+    void encodeP25AudioFrame(uint8_t* pcm, bool silence, uint32_t forcedSrcId = 0U, uint32_t forcedDstId = 0U);
 
     /**
      * @brief Helper to generate the preamble tone.
@@ -425,6 +502,13 @@ private:
      */
     static void* threadAudioProcess(void* arg);
 
+    /**
+     * @brief Entry point to MDC1200 decode thread.
+     * @param arg Instance of the thread_t structure.
+     * @returns void* (Ignore)
+     */
+    static void* threadMDCProcess(void* arg);
+
     /**
      * @brief Entry point to network processing thread.
      * @param arg Instance of the thread_t structure.
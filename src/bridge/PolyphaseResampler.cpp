@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "PolyphaseResampler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define RESAMPLER_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RESAMPLER_NEON 1
+#endif
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define FILTER_ZERO_CROSSINGS 8U        // sinc zero crossings either side of the center tap, per output period
+#define FILTER_KAISER_BETA 8.0          // ~80dB stopband
+#define FILTER_ROLLOFF 0.92             // passband edge, as a fraction of the lower Nyquist frequency
+
+const uint32_t SUPPORTED_SAMPLE_RATES[] = { 8000U, 16000U, 22050U, 24000U, 32000U, 44100U, 48000U };
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to compute the zeroth order modified Bessel function of the first kind. */
+
+static double besselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (uint32_t k = 1U; k < 32U; k++) {
+        double f = x / (2.0 * k);
+        term *= f * f;
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+
+    return sum;
+}
+
+/* Helper to compute the dot product of two float vectors (length is a multiple of 4). */
+
+static inline float dot(const float* a, const float* b, uint32_t n)
+{
+    uint32_t i = 0U;
+    float sum = 0.0f;
+
+#if defined(RESAMPLER_SSE2)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4U <= n; i += 4U)
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+    sum = _mm_cvtss_f32(acc);
+#elif defined(RESAMPLER_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (; i + 4U <= n; i += 4U)
+        acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+
+    float32x2_t acc2 = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    sum = vget_lane_f32(vpadd_f32(acc2, acc2), 0);
+#endif
+    for (; i < n; i++)
+        sum += a[i] * b[i];
+
+    return sum;
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the PolyphaseResampler class. */
+
+PolyphaseResampler::PolyphaseResampler(uint32_t inputRate, uint32_t outputRate) :
+    m_interpolation(1U),
+    m_decimation(1U),
+    m_bank(nullptr),
+    m_history(),
+    m_historyPos(0U),
+    m_phase(0U)
+{
+    assert(inputRate > 0U);
+    assert(outputRate > 0U);
+
+    // reduce the conversion ratio; L = output / gcd, M = input / gcd
+    uint32_t a = inputRate, b = outputRate;
+    while (b != 0U) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    m_interpolation = outputRate / a;
+    m_decimation = inputRate / a;
+
+    if (!isPassthrough()) {
+        m_bank = getFilterBank(m_interpolation, m_decimation);
+
+        // the history is kept twice over, so the newest taps samples are always contiguous
+        m_history.resize(m_bank->taps * 2U, 0.0f);
+    }
+}
+
+/* Finalizes a instance of the PolyphaseResampler class. */
+
+PolyphaseResampler::~PolyphaseResampler() = default;
+
+/* Converts a block of samples. */
+
+uint32_t PolyphaseResampler::process(const short* input, uint32_t inputLength, short* output)
+{
+    assert(input != nullptr);
+    assert(output != nullptr);
+
+    if (isPassthrough()) {
+        ::memcpy(output, input, inputLength * sizeof(short));
+        return inputLength;
+    }
+
+    const uint32_t taps = m_bank->taps;
+    const float* coeffs = m_bank->coeffs.data();
+    float* history = m_history.data();
+
+    uint32_t outputLength = 0U;
+    for (uint32_t i = 0U; i < inputLength; i++) {
+        history[m_historyPos] = history[m_historyPos + taps] = (float)input[i];
+        m_historyPos++;
+        if (m_historyPos >= taps)
+            m_historyPos = 0U;
+
+        // emit every output sample falling between this input sample and the next
+        const float* window = history + m_historyPos;
+        while (m_phase < m_interpolation) {
+            float sample = ::roundf(dot(window, coeffs + (m_phase * taps), taps));
+            if (sample > 32767.0f)
+                sample = 32767.0f;
+            else if (sample < -32768.0f)
+                sample = -32768.0f;
+
+            output[outputLength++] = (short)sample;
+            m_phase += m_decimation;
+        }
+
+        m_phase -= m_interpolation;
+    }
+
+    return outputLength;
+}
+
+/* Clears the filter history. */
+
+void PolyphaseResampler::reset()
+{
+    std::fill(m_history.begin(), m_history.end(), 0.0f);
+    m_historyPos = 0U;
+    m_phase = 0U;
+}
+
+/* Gets the largest number of output samples process() may produce for the given input length. */
+
+uint32_t PolyphaseResampler::getMaxOutputLength(uint32_t inputLength) const
+{
+    return (uint32_t)((((uint64_t)inputLength * m_interpolation) + m_decimation - 1U) / m_decimation) + 1U;
+}
+
+/* Helper to check whether a sample rate is supported for conversion to and from 8kHz. */
+
+bool PolyphaseResampler::isSupportedRate(uint32_t sampleRate)
+{
+    for (uint32_t rate : SUPPORTED_SAMPLE_RATES) {
+        if (rate == sampleRate)
+            return true;
+    }
+
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to get (building if necessary) the shared filter bank for a conversion ratio. */
+
+std::shared_ptr<const PolyphaseResampler::FilterBank> PolyphaseResampler::getFilterBank(uint32_t interpolation, uint32_t decimation)
+{
+    static std::mutex mutex;
+    static std::map<uint64_t, std::shared_ptr<const FilterBank>> banks;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    uint64_t key = ((uint64_t)interpolation << 32) | decimation;
+    auto it = banks.find(key);
+    if (it != banks.end())
+        return it->second;
+
+    // the filter runs at the interpolated rate; its cutoff is the lower of the two Nyquist frequencies
+    uint32_t factor = std::max(interpolation, decimation);
+    double cutoff = (0.5 * FILTER_ROLLOFF) / factor;
+
+    uint32_t taps = (2U * FILTER_ZERO_CROSSINGS * factor + interpolation - 1U) / interpolation;
+    taps = (taps + 3U) & ~3U;
+
+    uint32_t length = taps * interpolation;
+    double center = (length - 1U) / 2.0;
+
+    std::vector<double> prototype(length);
+    double sum = 0.0;
+    for (uint32_t n = 0U; n < length; n++) {
+        double x = n - center;
+        double sinc = (x == 0.0) ? 2.0 * cutoff : ::sin(2.0 * M_PI * cutoff * x) / (M_PI * x);
+
+        double r = (2.0 * n) / (length - 1U) - 1.0;
+        double window = besselI0(FILTER_KAISER_BETA * ::sqrt(std::max(0.0, 1.0 - (r * r)))) / besselI0(FILTER_KAISER_BETA);
+
+        prototype[n] = sinc * window;
+        sum += prototype[n];
+    }
+
+    // unity gain through every phase; zero stuffing by L otherwise scales the signal by 1/L
+    std::shared_ptr<FilterBank> bank = std::make_shared<FilterBank>();
+    bank->interpolation = interpolation;
+    bank->decimation = decimation;
+    bank->taps = taps;
+    bank->coeffs.resize(length);
+
+    // phase p holds prototype taps p, p + L, p + 2L ..., reversed to run oldest to newest sample
+    for (uint32_t p = 0U; p < interpolation; p++) {
+        for (uint32_t j = 0U; j < taps; j++) {
+            bank->coeffs[(p * taps) + (taps - 1U - j)] = (float)((prototype[p + (j * interpolation)] * interpolation) / sum);
+        }
+    }
+
+    banks[key] = bank;
+    return bank;
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file PolyphaseResampler.h
+ * @ingroup bridge
+ * @file PolyphaseResampler.cpp
+ * @ingroup bridge
+ */
+#if !defined(__POLYPHASE_RESAMPLER_H__)
+#define __POLYPHASE_RESAMPLER_H__
+
+#include "Defines.h"
+
+#include <memory>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief This class implements a rational ratio (L/M) polyphase FIR sample rate converter.
+ *
+ *  The prototype low-pass filter is a Kaiser windowed sinc, split into L phases of equal length
+ *  and stored time reversed, so every output sample is a single contiguous dot product against a
+ *  linear history window (SSE2 or NEON where available). Filter banks are built once per ratio and
+ *  shared between all converters using that ratio; processing never allocates.
+ *
+ *  A converter is stateful and must only be used by one thread at a time.
+ * @ingroup bridge
+ */
+class HOST_SW_API PolyphaseResampler {
+public:
+    /**
+     * @brief Initializes a new instance of the PolyphaseResampler class.
+     * @param inputRate Input sample rate (in Hz).
+     * @param outputRate Output sample rate (in Hz).
+     */
+    PolyphaseResampler(uint32_t inputRate, uint32_t outputRate);
+    /**
+     * @brief Finalizes a instance of the PolyphaseResampler class.
+     */
+    ~PolyphaseResampler();
+
+    /**
+     * @brief Converts a block of samples.
+     *
+     *  For an input length that is a multiple of the decimation factor, exactly
+     *  inputLength * interpolation / decimation samples are produced.
+     * @param[in] input Input samples.
+     * @param inputLength Number of input samples.
+     * @param[out] output Buffer to write the output samples to (at least getMaxOutputLength() samples).
+     * @returns uint32_t Number of output samples written.
+     */
+    uint32_t process(const short* input, uint32_t inputLength, short* output);
+    /**
+     * @brief Clears the filter history.
+     */
+    void reset();
+
+    /**
+     * @brief Gets the largest number of output samples process() may produce for the given input length.
+     * @param inputLength Number of input samples.
+     * @returns uint32_t Maximum number of output samples.
+     */
+    uint32_t getMaxOutputLength(uint32_t inputLength) const;
+    /**
+     * @brief Flag indicating whether the input and output rates are equal and samples are copied as-is.
+     * @returns bool True, if the converter is a passthrough, otherwise false.
+     */
+    bool isPassthrough() const { return m_interpolation == m_decimation; }
+
+    /**
+     * @brief Helper to check whether a sample rate is supported for conversion to and from 8kHz.
+     * @param sampleRate Sample rate (in Hz).
+     * @returns bool True, if the sample rate is supported, otherwise false.
+     */
+    static bool isSupportedRate(uint32_t sampleRate);
+
+public:
+    /**
+     * @brief Interpolation factor (L).
+     */
+    __READONLY_PROPERTY_PLAIN(uint32_t, interpolation);
+    /**
+     * @brief Decimation factor (M).
+     */
+    __READONLY_PROPERTY_PLAIN(uint32_t, decimation);
+
+private:
+    /**
+     * @brief Represents the polyphase filter bank for one conversion ratio.
+     */
+    struct FilterBank {
+        uint32_t interpolation;
+        uint32_t decimation;
+        uint32_t taps;                      //! Taps per phase (a multiple of 4).
+        std::vector<float> coeffs;          //! interpolation phases of taps coefficients, time reversed.
+    };
+
+    std::shared_ptr<const FilterBank> m_bank;
+
+    std::vector<float> m_history;
+    uint32_t m_historyPos;
+    uint32_t m_phase;
+
+    /**
+     * @brief Helper to get (building if necessary) the shared filter bank for a conversion ratio.
+     * @param interpolation Interpolation factor (L).
+     * @param decimation Decimation factor (M).
+     * @returns std::shared_ptr<const FilterBank> Filter bank.
+     */
+    static std::shared_ptr<const FilterBank> getFilterBank(uint32_t interpolation, uint32_t decimation);
+};
+
+#endif // __POLYPHASE_RESAMPLER_H__
@@ -0,0 +1,959 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/dmr/DMRDefines.h"
+#include "common/dmr/data/EMB.h"
+#include "common/dmr/data/NetData.h"
+#include "common/dmr/lc/FullLC.h"
+#include "common/dmr/SlotType.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/data/LowSpeedData.h"
+#include "common/p25/dfsi/DFSIDefines.h"
+#include "common/p25/dfsi/LC.h"
+#include "common/p25/lc/LC.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+#include "TalkgroupMapping.h"
+#include "VocoderWorkerPool.h"
+
+using namespace network;
+using namespace network::udp;
+
+#include <cassert>
+#include <chrono>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define MAX_QUEUED_JOBS 64U             // 64 frames is over a second of audio; anything deeper is a stalled pool
+#define MAX_JOBS_PER_RUN 8U
+#define RX_CALL_TIMEOUT_MS 1000U
+
+#define UDP_CALL "UDP Traffic"
+
+const uint8_t JOB_DECODE_DMR = 0U;
+const uint8_t JOB_DECODE_P25 = 1U;
+const uint8_t JOB_ENCODE = 2U;
+const uint8_t JOB_GRANT_DEMAND = 3U;
+const uint8_t JOB_CALL_END = 4U;
+
+const uint32_t IMBE_PER_LDU = 9U;
+const uint32_t LDU_IMBE_OFFSETS[IMBE_PER_LDU] = { 10U, 26U, 55U, 80U, 105U, 130U, 155U, 180U, 204U };
+const uint32_t LDU_DFSI_FRAME_LENGTHS[IMBE_PER_LDU] = {
+    p25::dfsi::defines::DFSI_LDU1_VOICE1_FRAME_LENGTH_BYTES, p25::dfsi::defines::DFSI_LDU1_VOICE2_FRAME_LENGTH_BYTES,
+    p25::dfsi::defines::DFSI_LDU1_VOICE3_FRAME_LENGTH_BYTES, p25::dfsi::defines::DFSI_LDU1_VOICE4_FRAME_LENGTH_BYTES,
+    p25::dfsi::defines::DFSI_LDU1_VOICE5_FRAME_LENGTH_BYTES, p25::dfsi::defines::DFSI_LDU1_VOICE6_FRAME_LENGTH_BYTES,
+    p25::dfsi::defines::DFSI_LDU1_VOICE7_FRAME_LENGTH_BYTES, p25::dfsi::defines::DFSI_LDU1_VOICE8_FRAME_LENGTH_BYTES,
+    p25::dfsi::defines::DFSI_LDU1_VOICE9_FRAME_LENGTH_BYTES
+};
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the current time in milliseconds. */
+
+static uint64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/* Helper to apply gain to PCM samples. */
+
+static void applyGain(short* samples, float gain)
+{
+    if (gain == 1.0f)
+        return;
+
+    for (int n = 0; n < MBE_SAMPLES_LENGTH; n++) {
+        float newSample = samples[n] * gain;
+        short sample = (short)newSample;
+
+        // clip if necessary
+        if (gain > 1.0f) {
+            if (newSample > 32767)
+                sample = 32767;
+            else if (newSample < -32767)
+                sample = -32767;
+        }
+
+        samples[n] = sample;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TalkgroupMapping class. */
+
+TalkgroupMapping::TalkgroupMapping(PeerNetwork* network, std::mutex& networkMutex, VocoderWorkerPool* pool,
+    uint8_t txMode, uint32_t dstId, uint8_t slot, uint32_t srcId) :
+    m_network(network),
+    m_networkMutex(networkMutex),
+    m_pool(pool),
+    m_udpAudioSocket(nullptr),
+    m_udpSendAddress("127.0.0.1"),
+    m_udpSendPort(34001U),
+    m_udpReceiveAddress("127.0.0.1"),
+    m_udpReceivePort(32001U),
+    m_udpSendAddr(),
+    m_udpSendAddrLen(0U),
+    m_udpMetadata(false),
+    m_overrideSrcIdFromUDP(false),
+    m_txMode(txMode),
+    m_dstId(dstId),
+    m_slot(slot),
+    m_srcId(srcId),
+    m_rxAudioGain(1.0f),
+    m_vocoderDecoderAudioGain(3.0f),
+    m_vocoderDecoderAutoGain(false),
+    m_txAudioGain(1.0f),
+    m_vocoderEncoderAudioGain(3.0f),
+    m_dropTimeMS(180U),
+    m_grantDemand(false),
+    m_debug(false),
+    m_jobMutex(),
+    m_jobs(),
+    m_scheduled(false),
+    m_callInProgress(false),
+    m_rxLastFrame(0U),
+    m_ignoreCall(false),
+    m_callAlgoId(0U),
+    m_rxStartTime(0U),
+    m_audioDetect(false),
+    m_udpSrcId(0U),
+    m_dropTime(1000U, 0U, 180U),
+    m_decoder(nullptr),
+    m_encoder(nullptr),
+    m_dmrEmbeddedData(),
+    m_ambeCount(0U),
+    m_dmrSeqNo(0U),
+    m_dmrN(0U),
+    m_p25N(0U),
+    m_txStreamId(0U),
+    m_txPktSeq(0U)
+{
+    assert(network != nullptr);
+    assert(pool != nullptr);
+
+    ::memset(m_ambeBuffer, 0x00U, sizeof(m_ambeBuffer));
+    ::memset(m_netLDU1, 0x00U, sizeof(m_netLDU1));
+    ::memset(m_netLDU2, 0x00U, sizeof(m_netLDU2));
+}
+
+/* Finalizes a instance of the TalkgroupMapping class. */
+
+TalkgroupMapping::~TalkgroupMapping()
+{
+    close();
+
+    if (m_decoder != nullptr)
+        delete m_decoder;
+    if (m_encoder != nullptr)
+        delete m_encoder;
+}
+
+/* Sets the UDP audio endpoints. */
+
+void TalkgroupMapping::setUDPAudio(const std::string& sendAddress, uint16_t sendPort, const std::string& receiveAddress, uint16_t receivePort,
+    bool metadata, bool overrideSrcIdFromUDP)
+{
+    m_udpSendAddress = sendAddress;
+    m_udpSendPort = sendPort;
+    m_udpReceiveAddress = receiveAddress;
+    m_udpReceivePort = receivePort;
+    m_udpMetadata = metadata;
+    m_overrideSrcIdFromUDP = overrideSrcIdFromUDP;
+}
+
+/* Sets the audio gains. */
+
+void TalkgroupMapping::setAudioGain(float rxAudioGain, float vocoderDecoderAudioGain, bool vocoderDecoderAutoGain,
+    float txAudioGain, float vocoderEncoderAudioGain)
+{
+    m_rxAudioGain = rxAudioGain;
+    m_vocoderDecoderAudioGain = vocoderDecoderAudioGain;
+    m_vocoderDecoderAutoGain = vocoderDecoderAutoGain;
+    m_txAudioGain = txAudioGain;
+    m_vocoderEncoderAudioGain = vocoderEncoderAudioGain;
+}
+
+/* Sets the call options. */
+
+void TalkgroupMapping::setOptions(uint16_t dropTimeMS, bool grantDemand, bool debug)
+{
+    m_dropTimeMS = dropTimeMS;
+    m_dropTime = Timer(1000U, 0U, m_dropTimeMS);
+    m_grantDemand = grantDemand;
+    m_debug = debug;
+}
+
+/* Opens the UDP audio socket. */
+
+bool TalkgroupMapping::open()
+{
+    if (Socket::lookup(m_udpSendAddress, m_udpSendPort, m_udpSendAddr, m_udpSendAddrLen) != 0) {
+        ::LogError(LOG_HOST, "TG %u, could not resolve UDP audio send address %s:%u", m_dstId, m_udpSendAddress.c_str(), m_udpSendPort);
+        return false;
+    }
+
+    m_udpAudioSocket = new Socket(m_udpReceiveAddress, m_udpReceivePort);
+    if (!m_udpAudioSocket->open()) {
+        ::LogError(LOG_HOST, "TG %u, could not open UDP audio receive port %s:%u", m_dstId, m_udpReceiveAddress.c_str(), m_udpReceivePort);
+        delete m_udpAudioSocket;
+        m_udpAudioSocket = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/* Closes the UDP audio socket. */
+
+void TalkgroupMapping::close()
+{
+    if (m_udpAudioSocket != nullptr) {
+        m_udpAudioSocket->close();
+        delete m_udpAudioSocket;
+        m_udpAudioSocket = nullptr;
+    }
+}
+
+/* Helper to process DMR network traffic destined to this mapping. */
+
+void TalkgroupMapping::processDMRNetwork(const uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+    using namespace dmr;
+    using namespace dmr::defines;
+
+    if (length < 20U + DMR_FRAME_LENGTH_BYTES)
+        return;
+
+    uint32_t srcId = __GET_UINT16(buffer, 5U);
+
+    FLCO::E flco = (buffer[15U] & 0x40U) == 0x40U ? FLCO::PRIVATE : FLCO::GROUP;
+    if (flco != FLCO::GROUP || srcId == 0U)
+        return;
+
+    bool dataSync = (buffer[15U] & 0x20U) == 0x20U;
+    bool voiceSync = (buffer[15U] & 0x10U) == 0x10U;
+
+    DataType::E dataType = DataType::VOICE_SYNC;
+    uint8_t n = 0U;
+    if (dataSync) {
+        dataType = (DataType::E)(buffer[15U] & 0x0FU);
+    }
+    else if (!voiceSync) {
+        n = buffer[15U] & 0x0FU;
+        dataType = DataType::VOICE;
+    }
+
+    const uint8_t* data = buffer + 20U;
+
+    if (dataSync && (dataType == DataType::TERMINATOR_WITH_LC)) {
+        rxCallEnd(srcId, "");
+        m_ignoreCall = false;
+        m_callAlgoId = 0U;
+        return;
+    }
+
+    if (!m_callInProgress && !m_ignoreCall)
+        rxCallStart(srcId);
+
+    m_rxLastFrame = now();
+
+    if (dataSync && (dataType == DataType::VOICE_PI_HEADER)) {
+        lc::FullLC fullLC = lc::FullLC();
+        std::unique_ptr<lc::PrivacyLC> lc = fullLC.decodePI(data);
+        if (lc != nullptr)
+            m_callAlgoId = lc->getAlgId();
+    }
+
+    if (m_ignoreCall && m_callAlgoId == 0U)
+        m_ignoreCall = false;
+
+    if (m_ignoreCall)
+        return;
+
+    if (m_callAlgoId != 0U) {
+        rxCallEnd(srcId, " (T)");
+        m_ignoreCall = true;
+        return;
+    }
+
+    if (dataType == DataType::VOICE_SYNC || dataType == DataType::VOICE) {
+        VocoderJob job;
+        job.type = JOB_DECODE_DMR;
+        job.srcId = srcId;
+        job.n = n;
+
+        ::memcpy(job.data, data, 14U);
+        job.data[13U] &= 0xF0U;
+        job.data[13U] |= (uint8_t)(data[19U] & 0x0FU);
+        ::memcpy(job.data + 14U, data + 20U, 13U);
+
+        queueJob(job);
+    }
+}
+
+/* Helper to process P25 network traffic destined to this mapping. */
+
+void TalkgroupMapping::processP25Network(const uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+    using namespace p25;
+    using namespace p25::defines;
+    using namespace p25::dfsi::defines;
+
+    if (length < 24U)
+        return;
+
+    bool grantDemand = (buffer[14U] & 0x80U) == 0x80U;
+
+    DUID::E duid = (DUID::E)buffer[22U];
+    if (duid == DUID::HDU || duid == DUID::TSDU || duid == DUID::PDU)
+        return;
+
+    uint32_t srcId = __GET_UINT16(buffer, 5U);
+
+    lc::LC control;
+    control.setLCO(buffer[4U]);
+    control.setSrcId(srcId);
+    control.setDstId(m_dstId);
+    control.setMFId(buffer[15U]);
+
+    if (!control.isStandardMFId()) {
+        control.setLCO(LCO::GROUP);
+    }
+    else {
+        if (control.getLCO() == LCO::GROUP_UPDT || control.getLCO() == LCO::RFSS_STS_BCAST) {
+            control.setLCO(LCO::GROUP);
+        }
+    }
+
+    if (control.getLCO() != LCO::GROUP || srcId == 0U)
+        return;
+
+    if ((duid == DUID::TDU) || (duid == DUID::TDULC)) {
+        // ignore TDU's that are grant demands
+        if (grantDemand)
+            return;
+
+        rxCallEnd(srcId, "");
+        m_ignoreCall = false;
+        m_callAlgoId = ALGO_UNENCRYPT;
+        return;
+    }
+
+    uint8_t frameLength = buffer[23U];
+    if (frameLength <= 24U || length < 24U + frameLength)
+        return;
+
+    const uint8_t* data = buffer + 24U;
+
+    if (!m_callInProgress && !m_ignoreCall)
+        rxCallStart(srcId);
+
+    m_rxLastFrame = now();
+
+    if (m_ignoreCall && m_callAlgoId == ALGO_UNENCRYPT)
+        m_ignoreCall = false;
+
+    // if this is an LDU1 see if this is the first LDU with HDU encryption data
+    if (duid == DUID::LDU1 && !m_ignoreCall && length > 181U) {
+        if (buffer[180U] == FrameType::HDU_VALID)
+            m_callAlgoId = buffer[181U];
+    }
+
+    if (duid == DUID::LDU2 && !m_ignoreCall && frameLength > 88U)
+        m_callAlgoId = data[88U];
+
+    if (m_ignoreCall)
+        return;
+
+    if (m_callAlgoId != ALGO_UNENCRYPT) {
+        rxCallEnd(srcId, " (T)");
+        m_ignoreCall = true;
+        return;
+    }
+
+    if (duid != DUID::LDU1 && duid != DUID::LDU2)
+        return;
+
+    data::LowSpeedData lsd;
+    lsd.setLSD1(buffer[20U]);
+    lsd.setLSD2(buffer[21U]);
+
+    dfsi::LC dfsiLC = dfsi::LC(control, lsd);
+
+    VocoderJob job;
+    job.type = JOB_DECODE_P25;
+    job.srcId = srcId;
+    job.n = (duid == DUID::LDU1) ? 1U : 2U;
+
+    // the voice frames of an LDU follow one another, each led by its DFSI frame type
+    uint8_t frameType = (duid == DUID::LDU1) ? DFSIFrameType::LDU1_VOICE1 : DFSIFrameType::LDU2_VOICE10;
+    uint32_t count = 0U;
+    for (uint32_t n = 0U; n < IMBE_PER_LDU; n++) {
+        if (count + LDU_DFSI_FRAME_LENGTHS[n] > frameLength || data[count] != (uint8_t)(frameType + n))
+            return;
+
+        dfsiLC.setFrameType((DFSIFrameType::E)(frameType + n));
+        if (duid == DUID::LDU1)
+            dfsiLC.decodeLDU1(data + count, job.data + (n * RAW_IMBE_LENGTH_BYTES));
+        else
+            dfsiLC.decodeLDU2(data + count, job.data + (n * RAW_IMBE_LENGTH_BYTES));
+
+        count += LDU_DFSI_FRAME_LENGTHS[n];
+    }
+
+    queueJob(job);
+}
+
+/* Helper to read and process UDP audio. */
+
+bool TalkgroupMapping::processUDPAudio()
+{
+    if (m_udpAudioSocket == nullptr)
+        return false;
+
+    sockaddr_storage addr;
+    uint32_t addrLen;
+
+    // read message from socket
+    uint8_t buffer[DATA_PACKET_LENGTH];
+    int length = m_udpAudioSocket->read(buffer, DATA_PACKET_LENGTH, addr, addrLen);
+    if (length <= 0)
+        return false;
+
+    if (m_debug)
+        Utils::dump(1U, "UDP Audio Network Packet", buffer, length);
+
+    uint32_t pcmLength = __GET_UINT32(buffer, 0U);
+    if (pcmLength != MBE_SAMPLES_LENGTH * 2U || (uint32_t)length < pcmLength + 4U) {
+        ::LogWarning(LOG_HOST, "TG %u, invalid UDP audio frame, pcmLength = %u, len = %d", m_dstId, pcmLength, length);
+        return true;
+    }
+
+    m_udpSrcId = m_srcId;
+    if (m_udpMetadata && m_overrideSrcIdFromUDP && (uint32_t)length >= pcmLength + 12U)
+        m_udpSrcId = __GET_UINT32(buffer, pcmLength + 8U);
+
+    // network traffic has the talkgroup
+    if (m_callInProgress)
+        return true;
+
+    if (!m_audioDetect) {
+        m_audioDetect = true;
+        LogMessage(LOG_HOST, "%s, call start, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_dstId);
+
+        if (m_grantDemand && m_txMode == TX_MODE_P25) {
+            VocoderJob job;
+            job.type = JOB_GRANT_DEMAND;
+            job.srcId = m_udpSrcId;
+            queueJob(job);
+        }
+    }
+
+    m_dropTime.start();
+
+    VocoderJob job;
+    job.type = JOB_ENCODE;
+    job.srcId = m_udpSrcId;
+    ::memcpy(job.data, buffer + 4U, pcmLength);
+    queueJob(job);
+
+    return true;
+}
+
+/* Updates the call timers by the passed number of milliseconds. */
+
+void TalkgroupMapping::clock(uint32_t ms)
+{
+    if (m_audioDetect) {
+        m_dropTime.clock(ms);
+
+        // if we've exceeded the audio drop timeout, then really drop the audio
+        if (m_dropTime.isRunning() && m_dropTime.hasExpired()) {
+            LogMessage(LOG_HOST, "%s, call end, srcId = %u, dstId = %u", UDP_CALL, m_udpSrcId, m_dstId);
+
+            m_audioDetect = false;
+            m_dropTime.stop();
+
+            VocoderJob job;
+            job.type = JOB_CALL_END;
+            job.srcId = m_udpSrcId;
+            queueJob(job);
+        }
+    }
+
+    // a network call whose terminator was lost would otherwise hold the talkgroup forever
+    if (m_callInProgress && (now() - m_rxLastFrame) > RX_CALL_TIMEOUT_MS) {
+        if (m_callInProgress.exchange(false))
+            LogMessage(LOG_HOST, "%s, call end (timeout), dstId = %u", (m_txMode == TX_MODE_DMR) ? "DMR" : "P25", m_dstId);
+    }
+}
+
+/* Runs the queued vocoder work. */
+
+void TalkgroupMapping::process()
+{
+    for (uint32_t count = 0U; count < MAX_JOBS_PER_RUN; count++) {
+        VocoderJob job;
+
+        // scope is intentional
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            if (m_jobs.empty()) {
+                m_scheduled = false;
+                return;
+            }
+
+            job = m_jobs.front();
+            m_jobs.pop_front();
+        }
+
+        switch (job.type) {
+        case JOB_DECODE_DMR:
+        case JOB_DECODE_P25:
+            decodeAudioFrames(job);
+            break;
+
+        case JOB_ENCODE:
+        {
+            if (m_encoder == nullptr) {
+                m_encoder = new vocoder::MBEEncoder((m_txMode == TX_MODE_DMR) ? vocoder::ENCODE_DMR_AMBE : vocoder::ENCODE_88BIT_IMBE);
+                m_encoder->setGainAdjust(m_vocoderEncoderAudioGain);
+            }
+
+            short samples[MBE_SAMPLES_LENGTH];
+            for (uint32_t smpIdx = 0U; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++)
+                samples[smpIdx] = (short)((job.data[(smpIdx * 2U) + 1U] << 8) + job.data[smpIdx * 2U]);
+
+            // pre-process: apply gain to PCM audio frames
+            applyGain(samples, m_txAudioGain);
+
+            if (m_txMode == TX_MODE_DMR)
+                encodeDMRAudioFrame(samples, job.srcId);
+            else
+                encodeP25AudioFrame(samples, job.srcId);
+        }
+        break;
+
+        case JOB_GRANT_DEMAND:
+            txGrantDemand(job.srcId);
+            break;
+
+        case JOB_CALL_END:
+            txCallEnd(job.srcId);
+            break;
+        }
+    }
+
+    // the mapping still has work; go to the back of the ready queue so one busy talkgroup cannot starve the others
+    m_pool->schedule(this);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to queue vocoder work and schedule the mapping on the worker pool. */
+
+void TalkgroupMapping::queueJob(const VocoderJob& job)
+{
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        if (m_jobs.size() >= MAX_QUEUED_JOBS) {
+            ::LogWarning(LOG_HOST, "TG %u, vocoder work queue overflow, dropping frame", m_dstId);
+            return;
+        }
+
+        m_jobs.push_back(job);
+    }
+
+    if (!m_scheduled.exchange(true))
+        m_pool->schedule(this);
+}
+
+/* Helper to mark the start of a network call. */
+
+void TalkgroupMapping::rxCallStart(uint32_t srcId)
+{
+    m_callInProgress = true;
+    m_callAlgoId = (m_txMode == TX_MODE_DMR) ? 0U : p25::defines::ALGO_UNENCRYPT;
+    m_rxStartTime = now();
+
+    if (m_txMode == TX_MODE_DMR)
+        LogMessage(LOG_HOST, "DMR, call start, srcId = %u, dstId = %u, slot = %u", srcId, m_dstId, m_slot);
+    else
+        LogMessage(LOG_HOST, "P25, call start, srcId = %u, dstId = %u", srcId, m_dstId);
+}
+
+/* Helper to mark the end of a network call. */
+
+void TalkgroupMapping::rxCallEnd(uint32_t srcId, const char* reason)
+{
+    if (!m_callInProgress.exchange(false))
+        return;
+
+    uint64_t diff = now() - m_rxStartTime;
+    LogMessage(LOG_HOST, "%s, call end%s, srcId = %u, dstId = %u, dur = %us", (m_txMode == TX_MODE_DMR) ? "DMR" : "P25",
+        reason, srcId, m_dstId, (uint32_t)(diff / 1000U));
+
+    m_rxStartTime = 0U;
+}
+
+/* Helper to decode network audio frames and send them as UDP audio. */
+
+void TalkgroupMapping::decodeAudioFrames(const VocoderJob& job)
+{
+    if (m_decoder == nullptr) {
+        m_decoder = new vocoder::MBEDecoder((m_txMode == TX_MODE_DMR) ? vocoder::DECODE_DMR_AMBE : vocoder::DECODE_88BIT_IMBE);
+        m_decoder->setGainAdjust(m_vocoderDecoderAudioGain);
+        m_decoder->setAutoGain(m_vocoderDecoderAutoGain);
+    }
+
+    uint32_t frames = IMBE_PER_LDU;
+    uint32_t codewordLength = p25::defines::RAW_IMBE_LENGTH_BYTES;
+    if (job.type == JOB_DECODE_DMR) {
+        frames = dmr::defines::AMBE_PER_SLOT;
+        codewordLength = dmr::defines::RAW_AMBE_LENGTH_BYTES;
+    }
+
+    for (uint32_t n = 0U; n < frames; n++) {
+        uint8_t codeword[p25::defines::RAW_IMBE_LENGTH_BYTES];
+        ::memcpy(codeword, job.data + (n * codewordLength), codewordLength);
+
+        short samples[MBE_SAMPLES_LENGTH];
+        int32_t errs = m_decoder->decode(codeword, samples);
+
+        if (m_debug)
+            LogDebug(LOG_HOST, "%s, Frame, VC%u.%u, srcId = %u, dstId = %u, errs = %d", (m_txMode == TX_MODE_DMR) ? "DMR" : "P25",
+                job.n, n, job.srcId, m_dstId, errs);
+
+        // post-process: apply gain to decoded audio frames
+        applyGain(samples, m_rxAudioGain);
+
+        writeUDPAudio(samples, job.srcId);
+    }
+}
+
+/* Helper to write decoded PCM samples as UDP audio. */
+
+void TalkgroupMapping::writeUDPAudio(short* samples, uint32_t srcId)
+{
+    if (m_udpAudioSocket == nullptr)
+        return;
+
+    // PCM + 4 bytes (PCM length), optionally followed by 4 bytes (dstId) + 4 bytes (srcId)
+    uint8_t audioData[(MBE_SAMPLES_LENGTH * 2U) + 12U];
+    uint32_t length = (MBE_SAMPLES_LENGTH * 2U) + 4U;
+
+    __SET_UINT32((MBE_SAMPLES_LENGTH * 2U), audioData, 0U);
+
+    uint8_t* pcm = audioData + 4U;
+    for (uint32_t smpIdx = 0U; smpIdx < MBE_SAMPLES_LENGTH; smpIdx++) {
+        pcm[(smpIdx * 2U) + 0U] = (uint8_t)(samples[smpIdx] & 0xFF);
+        pcm[(smpIdx * 2U) + 1U] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
+    }
+
+    if (m_udpMetadata) {
+        length = (MBE_SAMPLES_LENGTH * 2U) + 12U;
+
+        // embed destination and source IDs
+        __SET_UINT32(m_dstId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 4U));
+        __SET_UINT32(srcId, audioData, ((MBE_SAMPLES_LENGTH * 2U) + 8U));
+    }
+
+    m_udpAudioSocket->write(audioData, length, m_udpSendAddr, m_udpSendAddrLen);
+}
+
+/* Helper to encode UDP audio into DMR network frames. */
+
+void TalkgroupMapping::encodeDMRAudioFrame(short* samples, uint32_t srcId)
+{
+    assert(samples != nullptr);
+    using namespace dmr;
+    using namespace dmr::defines;
+
+    // encode PCM samples into AMBE codewords
+    uint8_t ambe[RAW_AMBE_LENGTH_BYTES];
+    ::memset(ambe, 0x00U, RAW_AMBE_LENGTH_BYTES);
+    m_encoder->encode(samples, ambe);
+
+    ::memcpy(m_ambeBuffer + (m_ambeCount * RAW_AMBE_LENGTH_BYTES), ambe, RAW_AMBE_LENGTH_BYTES);
+    m_ambeCount++;
+
+    if (m_ambeCount < AMBE_PER_SLOT)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_networkMutex);
+
+    data::NetData dmrData;
+    dmrData.setSlotNo(m_slot);
+    dmrData.setSrcId(srcId);
+    dmrData.setDstId(m_dstId);
+    dmrData.setFLCO(FLCO::GROUP);
+    dmrData.setBER(0U);
+    dmrData.setRSSI(0U);
+
+    uint8_t data[DMR_FRAME_LENGTH_BYTES];
+
+    // is this the intitial sequence?
+    if (m_txStreamId == 0U) {
+        m_txStreamId = m_network->createCallStreamId();
+        m_txPktSeq = 0U;
+        m_dmrSeqNo = 0U;
+        m_dmrN = 0U;
+
+        // generate DMR LC
+        lc::LC dmrLC = lc::LC();
+        dmrLC.setFLCO(FLCO::GROUP);
+        dmrLC.setSrcId(srcId);
+        dmrLC.setDstId(m_dstId);
+        m_dmrEmbeddedData.setLC(dmrLC);
+
+        // generate the Slot Type
+        SlotType slotType = SlotType();
+        slotType.setDataType(DataType::VOICE_LC_HEADER);
+        slotType.encode(data);
+
+        lc::FullLC fullLC = lc::FullLC();
+        fullLC.encode(dmrLC, data, DataType::VOICE_LC_HEADER);
+
+        // send DMR voice header
+        dmrData.setDataType(DataType::VOICE_LC_HEADER);
+        dmrData.setN(m_dmrN);
+        dmrData.setSeqNo(m_dmrSeqNo);
+        dmrData.setData(data);
+
+        m_network->writeDMRStream(dmrData, m_txStreamId, txPktSeq());
+        m_dmrSeqNo++;
+    }
+
+    // send DMR voice
+    ::memcpy(data, m_ambeBuffer, 13U);
+    data[13U] = (uint8_t)(m_ambeBuffer[13U] & 0xF0);
+    data[19U] = (uint8_t)(m_ambeBuffer[13U] & 0x0F);
+    ::memcpy(data + 20U, m_ambeBuffer + 14U, 13U);
+
+    DataType::E dataType = DataType::VOICE_SYNC;
+    if (m_dmrN != 0U) {
+        dataType = DataType::VOICE;
+
+        uint8_t lcss = m_dmrEmbeddedData.getData(data, m_dmrN);
+
+        // generated embedded signalling
+        data::EMB emb = data::EMB();
+        emb.setColorCode(0U);
+        emb.setLCSS(lcss);
+        emb.encode(data);
+    }
+
+    if (m_debug)
+        LogDebug(LOG_HOST, DMR_DT_VOICE ", srcId = %u, dstId = %u, slot = %u, seqNo = %u", srcId, m_dstId, m_slot, m_dmrN);
+
+    dmrData.setDataType(dataType);
+    dmrData.setN(m_dmrN);
+    dmrData.setSeqNo(m_dmrSeqNo);
+    dmrData.setData(data);
+
+    m_network->writeDMRStream(dmrData, m_txStreamId, txPktSeq());
+
+    m_dmrSeqNo++;
+    m_dmrN = (m_dmrN + 1U) % 6U;
+
+    ::memset(m_ambeBuffer, 0x00U, sizeof(m_ambeBuffer));
+    m_ambeCount = 0U;
+}
+
+/* Helper to encode UDP audio into P25 network frames. */
+
+void TalkgroupMapping::encodeP25AudioFrame(short* samples, uint32_t srcId)
+{
+    assert(samples != nullptr);
+    using namespace p25;
+    using namespace p25::defines;
+
+    if (m_p25N > 17U)
+        m_p25N = 0U;
+    if (m_p25N == 0U)
+        ::memset(m_netLDU1, 0x00U, sizeof(m_netLDU1));
+    if (m_p25N == 9U)
+        ::memset(m_netLDU2, 0x00U, sizeof(m_netLDU2));
+
+    // encode PCM samples into IMBE codewords, and fill the LDU buffers appropriately
+    uint8_t* ldu = (m_p25N < IMBE_PER_LDU) ? m_netLDU1 : m_netLDU2;
+    m_encoder->encode(samples, ldu + LDU_IMBE_OFFSETS[m_p25N % IMBE_PER_LDU]);
+
+    if (m_p25N == 8U || m_p25N == 17U) {
+        lc::LC lc = lc::LC();
+        lc.setLCO(LCO::GROUP);
+        lc.setGroup(true);
+        lc.setPriority(4U);
+        lc.setDstId(m_dstId);
+        lc.setSrcId(srcId);
+
+        data::LowSpeedData lsd = data::LowSpeedData();
+
+        std::lock_guard<std::mutex> lock(m_networkMutex);
+        if (m_txStreamId == 0U) {
+            m_txStreamId = m_network->createCallStreamId();
+            m_txPktSeq = 0U;
+        }
+
+        // send P25 LDU1 or LDU2
+        if (m_p25N == 8U) {
+            if (m_debug)
+                LogDebug(LOG_HOST, P25_LDU1_STR " audio, srcId = %u, dstId = %u", srcId, m_dstId);
+            m_network->writeP25LDU1Stream(lc, lsd, m_netLDU1, FrameType::HDU_VALID, m_txStreamId, txPktSeq());
+        }
+        else {
+            if (m_debug)
+                LogDebug(LOG_HOST, P25_LDU2_STR " audio, srcId = %u, dstId = %u", srcId, m_dstId);
+            m_network->writeP25LDU2Stream(lc, lsd, m_netLDU2, m_txStreamId, txPktSeq());
+        }
+    }
+
+    m_p25N++;
+}
+
+/* Helper to send a grant demand for the UDP call. */
+
+void TalkgroupMapping::txGrantDemand(uint32_t srcId)
+{
+    p25::lc::LC lc = p25::lc::LC();
+    lc.setLCO(p25::defines::LCO::GROUP);
+    lc.setDstId(m_dstId);
+    lc.setSrcId(srcId);
+
+    p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+
+    std::lock_guard<std::mutex> lock(m_networkMutex);
+    if (m_txStreamId == 0U) {
+        m_txStreamId = m_network->createCallStreamId();
+        m_txPktSeq = 0U;
+    }
+
+    m_network->writeP25TDUStream(lc, lsd, 0x80U, m_txStreamId, txPktSeq());
+}
+
+/* Helper to terminate the UDP call on the network. */
+
+void TalkgroupMapping::txCallEnd(uint32_t srcId)
+{
+    // nothing was ever sent for this call
+    if (m_txStreamId == 0U) {
+        m_ambeCount = 0U;
+        m_p25N = 0U;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_networkMutex);
+
+    switch (m_txMode) {
+    case TX_MODE_DMR:
+    {
+        using namespace dmr;
+        using namespace dmr::defines;
+
+        data::NetData dmrData;
+        dmrData.setSlotNo(m_slot);
+        dmrData.setSrcId(srcId);
+        dmrData.setDstId(m_dstId);
+        dmrData.setFLCO(FLCO::GROUP);
+
+        uint8_t data[DMR_FRAME_LENGTH_BYTES];
+
+        // pad the voice superframe out with silence
+        if (m_dmrN != 0U) {
+            for (; m_dmrN < 6U; m_dmrN++) {
+                ::memcpy(data, SILENCE_DATA, DMR_FRAME_LENGTH_BYTES);
+
+                uint8_t lcss = m_dmrEmbeddedData.getData(data, m_dmrN);
+
+                // generated embedded signalling
+                data::EMB emb = data::EMB();
+                emb.setColorCode(0U);
+                emb.setLCSS(lcss);
+                emb.encode(data);
+
+                dmrData.setDataType(DataType::VOICE);
+                dmrData.setN(m_dmrN);
+                dmrData.setSeqNo(m_dmrSeqNo++);
+                dmrData.setData(data);
+
+                m_network->writeDMRStream(dmrData, m_txStreamId, txPktSeq());
+            }
+        }
+
+        // generate DMR LC
+        lc::LC dmrLC = lc::LC();
+        dmrLC.setFLCO(FLCO::GROUP);
+        dmrLC.setSrcId(srcId);
+        dmrLC.setDstId(m_dstId);
+
+        // generate the Slot Type
+        SlotType slotType = SlotType();
+        slotType.setDataType(DataType::TERMINATOR_WITH_LC);
+        slotType.encode(data);
+
+        lc::FullLC fullLC = lc::FullLC();
+        fullLC.encode(dmrLC, data, DataType::TERMINATOR_WITH_LC);
+
+        dmrData.setDataType(DataType::TERMINATOR_WITH_LC);
+        dmrData.setN(0U);
+        dmrData.setSeqNo(m_dmrSeqNo);
+        dmrData.setData(data);
+
+        m_network->writeDMRStream(dmrData, m_txStreamId, RTP_END_OF_CALL_SEQ);
+    }
+    break;
+    case TX_MODE_P25:
+    {
+        p25::lc::LC lc = p25::lc::LC();
+        lc.setLCO(p25::defines::LCO::GROUP);
+        lc.setDstId(m_dstId);
+        lc.setSrcId(srcId);
+
+        p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+
+        m_network->writeP25TDUStream(lc, lsd, 0x00U, m_txStreamId, RTP_END_OF_CALL_SEQ);
+    }
+    break;
+    }
+
+    m_txStreamId = 0U;
+    m_txPktSeq = 0U;
+
+    ::memset(m_ambeBuffer, 0x00U, sizeof(m_ambeBuffer));
+    m_ambeCount = 0U;
+    m_dmrSeqNo = 0U;
+    m_dmrN = 0U;
+    m_p25N = 0U;
+}
+
+/* Helper to get the next packet sequence of the transmitted call stream. */
+
+uint16_t TalkgroupMapping::txPktSeq()
+{
+    uint16_t curr = m_txPktSeq;
+    ++m_txPktSeq;
+    if (m_txPktSeq > (RTP_END_OF_CALL_SEQ - 1U)) {
+        m_txPktSeq = 0U;
+    }
+
+    return curr;
+}
@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TalkgroupMapping.h
+ * @ingroup bridge
+ * @file TalkgroupMapping.cpp
+ * @ingroup bridge
+ */
+#if !defined(__TALKGROUP_MAPPING_H__)
+#define __TALKGROUP_MAPPING_H__
+
+#include "Defines.h"
+#include "common/dmr/data/EmbeddedData.h"
+#include "common/network/udp/Socket.h"
+#include "common/Timer.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+#include "network/PeerNetwork.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+
+// ---------------------------------------------------------------------------
+//  Class Prototypes
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API VocoderWorkerPool;
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief This class implements a single talkgroup to UDP audio mapping for the multi-talkgroup
+ *  bridge mode.
+ *
+ *  Each mapping owns its own vocoder state, UDP audio socket and call state. Network and UDP audio
+ *  frames are parsed on the thread that receives them, and the vocoder work they generate is queued
+ *  on the mapping; the mapping is then handed to the vocoder worker pool, which drains the queue. A
+ *  mapping is only ever run by one worker at a time, so its vocoders and transmit state need no
+ *  locking, and a mapping with no call in progress never reaches the pool at all.
+ * @ingroup bridge
+ */
+class HOST_SW_API TalkgroupMapping {
+public:
+    /**
+     * @brief Initializes a new instance of the TalkgroupMapping class.
+     * @param network Instance of the PeerNetwork class.
+     * @param networkMutex Mutex guarding access to the network.
+     * @param pool Instance of the VocoderWorkerPool class.
+     * @param txMode Audio transmit mode (DMR or P25).
+     * @param dstId Talkgroup ID.
+     * @param slot DMR slot.
+     * @param srcId Source ID for transmitted audio frames.
+     */
+    TalkgroupMapping(network::PeerNetwork* network, std::mutex& networkMutex, VocoderWorkerPool* pool,
+        uint8_t txMode, uint32_t dstId, uint8_t slot, uint32_t srcId);
+    /**
+     * @brief Finalizes a instance of the TalkgroupMapping class.
+     */
+    ~TalkgroupMapping();
+
+    /**
+     * @brief Sets the UDP audio endpoints.
+     * @param sendAddress PCM over UDP send address.
+     * @param sendPort PCM over UDP send port.
+     * @param receiveAddress PCM over UDP receive address.
+     * @param receivePort PCM over UDP receive port.
+     * @param metadata Flag indicating source and destination IDs are carried with the UDP audio.
+     * @param overrideSrcIdFromUDP Flag indicating the source ID will be taken from the UDP audio metadata.
+     */
+    void setUDPAudio(const std::string& sendAddress, uint16_t sendPort, const std::string& receiveAddress, uint16_t receivePort,
+        bool metadata, bool overrideSrcIdFromUDP);
+    /**
+     * @brief Sets the audio gains.
+     * @param rxAudioGain PCM audio gain for received (from digital network) audio frames.
+     * @param vocoderDecoderAudioGain Vocoder audio gain for decoded audio frames.
+     * @param vocoderDecoderAutoGain Flag indicating AGC should be used for decoded audio frames.
+     * @param txAudioGain PCM audio gain for transmitted (to digital network) audio frames.
+     * @param vocoderEncoderAudioGain Vocoder audio gain for encoded audio frames.
+     */
+    void setAudioGain(float rxAudioGain, float vocoderDecoderAudioGain, bool vocoderDecoderAutoGain,
+        float txAudioGain, float vocoderEncoderAudioGain);
+    /**
+     * @brief Sets the call options.
+     * @param dropTimeMS Amount of time (ms) from loss of UDP audio to drop the call.
+     * @param grantDemand Flag indicating whether a network grant demand packet will be sent before audio.
+     * @param debug Flag indicating whether verbose debug logging is enabled.
+     */
+    void setOptions(uint16_t dropTimeMS, bool grantDemand, bool debug);
+
+    /**
+     * @brief Opens the UDP audio socket.
+     * @returns bool True, if the socket was opened, otherwise false.
+     */
+    bool open();
+    /**
+     * @brief Closes the UDP audio socket.
+     */
+    void close();
+
+    /**
+     * @brief Helper to process DMR network traffic destined to this mapping.
+     * @param buffer Buffer containing the DMR network frame.
+     * @param length Length of buffer.
+     */
+    void processDMRNetwork(const uint8_t* buffer, uint32_t length);
+    /**
+     * @brief Helper to process P25 network traffic destined to this mapping.
+     * @param buffer Buffer containing the P25 network frame.
+     * @param length Length of buffer.
+     */
+    void processP25Network(const uint8_t* buffer, uint32_t length);
+
+    /**
+     * @brief Helper to read and process UDP audio.
+     * @returns bool True, if a UDP audio frame was read, otherwise false.
+     */
+    bool processUDPAudio();
+    /**
+     * @brief Updates the call timers by the passed number of milliseconds.
+     * @param ms Number of milliseconds.
+     */
+    void clock(uint32_t ms);
+
+    /**
+     * @brief Runs the queued vocoder work.
+     *
+     *  This is only called by the vocoder worker pool.
+     */
+    void process();
+
+    /**
+     * @brief Helper to generate the lookup key of a mapping.
+     * @param dstId Talkgroup ID.
+     * @param slot DMR slot (0 for P25).
+     * @returns uint32_t Lookup key.
+     */
+    static uint32_t key(uint32_t dstId, uint8_t slot) { return (dstId << 2) | (slot & 0x03U); }
+
+private:
+    /**
+     * @brief Represents a unit of vocoder work queued on a mapping.
+     */
+    struct VocoderJob {
+        uint8_t type;                   //! Job type.
+        uint32_t srcId;                 //! Source ID.
+        uint8_t n;                      //! Frame number.
+        uint8_t data[MBE_SAMPLES_LENGTH * 2U]; //! Codewords (decode) or PCM (encode).
+    };
+
+    network::PeerNetwork* m_network;
+    std::mutex& m_networkMutex;
+    VocoderWorkerPool* m_pool;
+
+    network::udp::Socket* m_udpAudioSocket;
+    std::string m_udpSendAddress;
+    uint16_t m_udpSendPort;
+    std::string m_udpReceiveAddress;
+    uint16_t m_udpReceivePort;
+    sockaddr_storage m_udpSendAddr;
+    uint32_t m_udpSendAddrLen;
+    bool m_udpMetadata;
+    bool m_overrideSrcIdFromUDP;
+
+    uint8_t m_txMode;
+    uint32_t m_dstId;
+    uint8_t m_slot;
+    uint32_t m_srcId;
+
+    float m_rxAudioGain;
+    float m_vocoderDecoderAudioGain;
+    bool m_vocoderDecoderAutoGain;
+    float m_txAudioGain;
+    float m_vocoderEncoderAudioGain;
+
+    uint16_t m_dropTimeMS;
+    bool m_grantDemand;
+    bool m_debug;
+
+    std::mutex m_jobMutex;
+    std::deque<VocoderJob> m_jobs;
+    std::atomic<bool> m_scheduled;
+
+    // network receive state; owned by the network thread
+    std::atomic<bool> m_callInProgress;
+    std::atomic<uint64_t> m_rxLastFrame;
+    bool m_ignoreCall;
+    uint8_t m_callAlgoId;
+    uint64_t m_rxStartTime;
+
+    // UDP receive state; owned by the main thread
+    bool m_audioDetect;
+    uint32_t m_udpSrcId;
+    Timer m_dropTime;
+
+    // vocoder and transmit state; owned by whichever worker runs the mapping
+    vocoder::MBEDecoder* m_decoder;
+    vocoder::MBEEncoder* m_encoder;
+
+    dmr::data::EmbeddedData m_dmrEmbeddedData;
+    uint8_t m_ambeBuffer[27U];
+    uint32_t m_ambeCount;
+    uint32_t m_dmrSeqNo;
+    uint8_t m_dmrN;
+
+    uint8_t m_netLDU1[9U * 25U];
+    uint8_t m_netLDU2[9U * 25U];
+    uint8_t m_p25N;
+
+    uint32_t m_txStreamId;
+    uint16_t m_txPktSeq;
+
+    /**
+     * @brief Helper to queue vocoder work and schedule the mapping on the worker pool.
+     * @param job Vocoder work.
+     */
+    void queueJob(const VocoderJob& job);
+
+    /**
+     * @brief Helper to mark the start of a network call.
+     * @param srcId Source ID.
+     */
+    void rxCallStart(uint32_t srcId);
+    /**
+     * @brief Helper to mark the end of a network call.
+     * @param srcId Source ID.
+     * @param reason Textual reason the call ended.
+     */
+    void rxCallEnd(uint32_t srcId, const char* reason);
+
+    /**
+     * @brief Helper to decode network audio frames and send them as UDP audio.
+     * @param job Vocoder work.
+     */
+    void decodeAudioFrames(const VocoderJob& job);
+    /**
+     * @brief Helper to write decoded PCM samples as UDP audio.
+     * @param samples PCM samples.
+     * @param srcId Source ID.
+     */
+    void writeUDPAudio(short* samples, uint32_t srcId);
+    /**
+     * @brief Helper to encode UDP audio into DMR network frames.
+     * @param samples PCM samples.
+     * @param srcId Source ID.
+     */
+    void encodeDMRAudioFrame(short* samples, uint32_t srcId);
+    /**
+     * @brief Helper to encode UDP audio into P25 network frames.
+     * @param samples PCM samples.
+     * @param srcId Source ID.
+     */
+    void encodeP25AudioFrame(short* samples, uint32_t srcId);
+    /**
+     * @brief Helper to send a grant demand for the UDP call.
+     * @param srcId Source ID.
+     */
+    void txGrantDemand(uint32_t srcId);
+    /**
+     * @brief Helper to terminate the UDP call on the network.
+     * @param srcId Source ID.
+     */
+    void txCallEnd(uint32_t srcId);
+    /**
+     * @brief Helper to get the next packet sequence of the transmitted call stream.
+     * @returns uint16_t RTP packet sequence.
+     */
+    uint16_t txPktSeq();
+};
+
+#endif // __TALKGROUP_MAPPING_H__
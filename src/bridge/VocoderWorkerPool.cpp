@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Log.h"
+#include "TalkgroupMapping.h"
+#include "VocoderWorkerPool.h"
+
+#include <cassert>
+#include <string>
+#include <thread>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the VocoderWorkerPool class. */
+
+VocoderWorkerPool::VocoderWorkerPool(uint32_t workers) :
+    m_workerCnt(workers),
+    m_workers(),
+    m_mutex(),
+    m_cond(),
+    m_ready(),
+    m_running(false)
+{
+    if (m_workerCnt == 0U) {
+        m_workerCnt = std::thread::hardware_concurrency();
+        if (m_workerCnt == 0U)
+            m_workerCnt = 1U;
+    }
+}
+
+/* Finalizes a instance of the VocoderWorkerPool class. */
+
+VocoderWorkerPool::~VocoderWorkerPool()
+{
+    stop();
+}
+
+/* Starts the worker threads. */
+
+bool VocoderWorkerPool::start()
+{
+    m_running = true;
+
+    for (uint32_t i = 0U; i < m_workerCnt; i++) {
+        Worker* worker = new Worker(this);
+        m_workers.push_back(worker);
+
+        if (!worker->run()) {
+            ::LogError(LOG_HOST, "failed to start vocoder worker %u", i);
+            return false;
+        }
+
+        worker->setName("bridge:vocoder-" + std::to_string(i));
+    }
+
+    return true;
+}
+
+/* Stops and waits for the worker threads. */
+
+void VocoderWorkerPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+        m_ready.clear();
+    }
+
+    m_cond.notify_all();
+
+    for (Worker* worker : m_workers) {
+        if (worker->started())
+            worker->wait();
+        delete worker;
+    }
+
+    m_workers.clear();
+}
+
+/* Places a mapping with queued work on the ready queue. */
+
+void VocoderWorkerPool::schedule(TalkgroupMapping* mapping)
+{
+    assert(mapping != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running)
+            return;
+
+        m_ready.push_back(mapping);
+    }
+
+    m_cond.notify_one();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Runs the worker. */
+
+void VocoderWorkerPool::Worker::entry()
+{
+    while (true) {
+        TalkgroupMapping* mapping = nullptr;
+
+        // scope is intentional
+        {
+            std::unique_lock<std::mutex> lock(m_pool->m_mutex);
+            m_pool->m_cond.wait(lock, [this] { return !m_pool->m_running || !m_pool->m_ready.empty(); });
+            if (!m_pool->m_running)
+                break;
+
+            mapping = m_pool->m_ready.front();
+            m_pool->m_ready.pop_front();
+        }
+
+        mapping->process();
+    }
+}
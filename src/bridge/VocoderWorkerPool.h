@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file VocoderWorkerPool.h
+ * @ingroup bridge
+ * @file VocoderWorkerPool.cpp
+ * @ingroup bridge
+ */
+#if !defined(__VOCODER_WORKER_POOL_H__)
+#define __VOCODER_WORKER_POOL_H__
+
+#include "Defines.h"
+#include "common/Thread.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Prototypes
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API TalkgroupMapping;
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief This class implements a fixed pool of threads which run the vocoder work of talkgroup
+ *  mappings.
+ *
+ *  Mappings with queued work are placed on a single ready queue; idle workers sleep on a condition
+ *  variable, so the pool costs nothing while no call is active.
+ * @ingroup bridge
+ */
+class HOST_SW_API VocoderWorkerPool {
+public:
+    /**
+     * @brief Initializes a new instance of the VocoderWorkerPool class.
+     * @param workers Number of worker threads (0 for one per CPU core).
+     */
+    VocoderWorkerPool(uint32_t workers);
+    /**
+     * @brief Finalizes a instance of the VocoderWorkerPool class.
+     */
+    ~VocoderWorkerPool();
+
+    /**
+     * @brief Starts the worker threads.
+     * @returns bool True, if the worker threads were started, otherwise false.
+     */
+    bool start();
+    /**
+     * @brief Stops and waits for the worker threads.
+     */
+    void stop();
+
+    /**
+     * @brief Places a mapping with queued work on the ready queue.
+     * @param mapping Instance of the TalkgroupMapping class.
+     */
+    void schedule(TalkgroupMapping* mapping);
+
+    /**
+     * @brief Gets the number of worker threads.
+     * @returns uint32_t Number of worker threads.
+     */
+    uint32_t workers() const { return m_workerCnt; }
+
+private:
+    /**
+     * @brief Worker thread.
+     */
+    class Worker : public Thread {
+    public:
+        /**
+         * @brief Initializes a new instance of the Worker class.
+         * @param pool Instance of the VocoderWorkerPool class.
+         */
+        Worker(VocoderWorkerPool* pool) : m_pool(pool) { /* stub */ }
+
+        /**
+         * @brief Runs the worker.
+         */
+        void entry() override;
+
+    private:
+        VocoderWorkerPool* m_pool;
+    };
+
+    uint32_t m_workerCnt;
+    std::vector<Worker*> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<TalkgroupMapping*> m_ready;
+    bool m_running;
+};
+
+#endif // __VOCODER_WORKER_POOL_H__
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "VoiceActivityDetector.h"
+
+#include <cassert>
+#include <cmath>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define SILENCE_DB -96.0f
+
+#define FLOOR_FALL_RATE 0.5f            // the floor drops quickly to a quieter background
+#define FLOOR_RISE_RATE 0.01f           // and creeps up slowly, so speech cannot drag it along
+#define FLOOR_SPEECH_RISE_RATE 0.002f   // a steady sound classed as speech becomes background after several seconds
+
+#define UNVOICED_ZCR 0.3f               // crossings per sample above which low energy sound is treated as a fricative
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the VoiceActivityDetector class. */
+
+VoiceActivityDetector::VoiceActivityDetector(float marginDb, float minLevelDb, uint32_t hangFrames) :
+    m_energy(SILENCE_DB),
+    m_noiseFloor(minLevelDb),
+    m_silentFrames(0U),
+    m_marginDb(marginDb),
+    m_minLevelDb(minLevelDb),
+    m_hangFrames(hangFrames),
+    m_hangCount(0U)
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the VoiceActivityDetector class. */
+
+VoiceActivityDetector::~VoiceActivityDetector() = default;
+
+/* Classifies a frame of audio. */
+
+bool VoiceActivityDetector::process(const short* samples, uint32_t length)
+{
+    assert(samples != nullptr);
+    assert(length > 1U);
+
+    float sum = 0.0f;
+    uint32_t crossings = 0U;
+    for (uint32_t i = 0U; i < length; i++) {
+        float sample = (float)samples[i];
+        sum += sample * sample;
+
+        if (i > 0U && ((samples[i - 1U] < 0) != (samples[i] < 0)))
+            crossings++;
+    }
+
+    float meanSquare = sum / (length * 32768.0f * 32768.0f);
+    m_energy = (meanSquare > 0.0f) ? 10.0f * ::log10f(meanSquare) : SILENCE_DB;
+    if (m_energy < SILENCE_DB)
+        m_energy = SILENCE_DB;
+
+    float zcr = (float)crossings / (length - 1U);
+
+    float aboveFloor = m_energy - m_noiseFloor;
+
+    bool speech = false;
+    if (m_energy >= m_minLevelDb) {
+        if (aboveFloor >= m_marginDb)
+            speech = true;
+        else if (aboveFloor >= (m_marginDb / 2.0f) && zcr >= UNVOICED_ZCR)
+            speech = true;
+    }
+
+    // track the background level; speech has gaps which pull the floor back down, a steady tone or hum does not
+    if (m_energy < m_noiseFloor)
+        m_noiseFloor += (m_energy - m_noiseFloor) * FLOOR_FALL_RATE;
+    else
+        m_noiseFloor += (m_energy - m_noiseFloor) * (speech ? FLOOR_SPEECH_RISE_RATE : FLOOR_RISE_RATE);
+
+    if (speech) {
+        m_hangCount = m_hangFrames;
+        m_silentFrames = 0U;
+        return true;
+    }
+
+    if (m_hangCount > 0U) {
+        m_hangCount--;
+        return true;
+    }
+
+    m_silentFrames++;
+    return false;
+}
+
+/* Resets the detector to its initial state. */
+
+void VoiceActivityDetector::reset()
+{
+    m_energy = SILENCE_DB;
+    m_noiseFloor = m_minLevelDb;
+    m_silentFrames = 0U;
+    m_hangCount = 0U;
+}
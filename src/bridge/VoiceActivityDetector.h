@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Bridge
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file VoiceActivityDetector.h
+ * @ingroup bridge
+ * @file VoiceActivityDetector.cpp
+ * @ingroup bridge
+ */
+#if !defined(__VOICE_ACTIVITY_DETECTOR_H__)
+#define __VOICE_ACTIVITY_DETECTOR_H__
+
+#include "Defines.h"
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief This class implements a lightweight frame based voice activity detector.
+ *
+ *  Each frame's energy is compared against an adaptive noise floor; frames well above the floor are
+ *  speech, and frames moderately above it are speech only if their zero-crossing rate marks them as
+ *  unvoiced (fricative) sound, which carries little energy. The floor falls quickly and rises slowly,
+ *  so a steady hum or tone eventually stops counting as speech. A hangover keeps short pauses between
+ *  words classified as speech.
+ * @ingroup bridge
+ */
+class HOST_SW_API VoiceActivityDetector {
+public:
+    /**
+     * @brief Initializes a new instance of the VoiceActivityDetector class.
+     * @param marginDb Energy above the noise floor at which a frame is speech (in dB).
+     * @param minLevelDb Energy below which a frame is never speech (in dBFS).
+     * @param hangFrames Number of frames speech is held after the last speech frame.
+     */
+    VoiceActivityDetector(float marginDb, float minLevelDb, uint32_t hangFrames);
+    /**
+     * @brief Finalizes a instance of the VoiceActivityDetector class.
+     */
+    ~VoiceActivityDetector();
+
+    /**
+     * @brief Classifies a frame of audio.
+     * @param[in] samples PCM samples.
+     * @param length Number of samples.
+     * @returns bool True, if the frame is speech (or within the hangover after speech), otherwise false.
+     */
+    bool process(const short* samples, uint32_t length);
+    /**
+     * @brief Resets the detector to its initial state.
+     */
+    void reset();
+
+public:
+    /**
+     * @brief Energy of the last frame (in dBFS).
+     */
+    __READONLY_PROPERTY_PLAIN(float, energy);
+    /**
+     * @brief Current noise floor estimate (in dBFS).
+     */
+    __READONLY_PROPERTY_PLAIN(float, noiseFloor);
+    /**
+     * @brief Number of consecutive frames classified as silence.
+     */
+    __READONLY_PROPERTY_PLAIN(uint32_t, silentFrames);
+
+private:
+    float m_marginDb;
+    float m_minLevelDb;
+    uint32_t m_hangFrames;
+
+    uint32_t m_hangCount;
+};
+
+#endif // __VOICE_ACTIVITY_DETECTOR_H__
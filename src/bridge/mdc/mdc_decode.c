@@ -85,7 +85,7 @@ mdc_decoder_t* mdc_decoder_new(int sampleRate)
 
     for(mdc_int_t i = 0; i < MDC_ND; i++)
     {
-        decoder->du[i].thu = i * 2 * (0x80000000 / MDC_ND);
+        decoder->thu[i] = i * 2 * (0x80000000 / MDC_ND);
         decoder->du[i].xorb = 0;
         decoder->du[i].invert = 0;
         decoder->du[i].shstate = -1;
@@ -357,10 +357,17 @@ int mdc_decoder_process_samples(mdc_decoder_t* decoder, mdc_sample_t* samples, i
 #else
     mdc_int_t value;
 #endif
+    mdc_u32_t wrapped;
 
     if (!decoder)
         return -1;
 
+#if defined(MDC_ONEPOINT)
+    const mdc_u32_t step = decoder->incru;
+#elif defined(MDC_FOURPOINT)
+    const mdc_u32_t step = 5 * decoder->incru;
+#endif
+
     for (mdc_int_t i = 0; i < numSamples; i++) {
         sample = samples[i];
 
@@ -384,7 +391,7 @@ int mdc_decoder_process_samples(mdc_decoder_t* decoder, mdc_sample_t* samples, i
 #elif defined(MDC_SAMPLE_FORMAT_U16)
         value = (((mdc_float_t)sample) - 32768.0)/65536.0;
 #elif defined(MDC_SAMPLE_FORMAT_S16)
-        value = ((mdc_float_t)sample) / 65536.0;
+        value = ((mdc_float_t)sample) * (1.0 / 65536.0);
 #elif defined(MDC_SAMPLE_FORMAT_FLOAT)
         value = sample;
 #else
@@ -392,13 +399,22 @@ int mdc_decoder_process_samples(mdc_decoder_t* decoder, mdc_sample_t* samples, i
 #endif // sample format
 #endif // not MDC_FIXEDMATH
 
-#if defined(MDC_ONEPOINT)
+        // advance every demodulator's phase at once (a branch free loop the compiler vectorizes), then service
+        // only the demodulators whose phase wrapped on this sample
+        wrapped = 0;
         for (mdc_int_t j = 0; j < MDC_ND; j++) {
-            mdc_u32_t lthu = decoder->du[j].thu;
-            decoder->du[j].thu += decoder->incru;
+            mdc_u32_t lthu = decoder->thu[j];
+            decoder->thu[j] = lthu + step;
+            wrapped |= (mdc_u32_t)(decoder->thu[j] < lthu) << j;
+        }
+
+        if (!wrapped)
+            continue;
 
+#if defined(MDC_ONEPOINT)
+        for (mdc_int_t j = 0; j < MDC_ND; j++) {
             // wrapped
-            if (decoder->du[j].thu < lthu) {
+            if (wrapped & (1U << j)) {
                 if (value > 0)
                     decoder->du[j].xorb = 1;
                 else
@@ -414,20 +430,14 @@ int mdc_decoder_process_samples(mdc_decoder_t* decoder, mdc_sample_t* samples, i
 #endif
         for (mdc_int_t j = 0; j < MDC_ND; j++)
         {
-            //decoder->du[j].th += (5.0 * decoder->incr);
-            mdc_u32_t lthu = decoder->du[j].thu;
-            decoder->du[j].thu += 5 * decoder->incru;
-        //  if (decoder->du[j].th >= TWOPI)
             // wrapped
-            if (decoder->du[j].thu < lthu) {
+            if (wrapped & (1U << j)) {
                 decoder->du[j].nlstep++;
                 if(decoder->du[j].nlstep > 9)
                     decoder->du[j].nlstep = 0;
                 decoder->du[j].nlevel[decoder->du[j].nlstep] = value;
 
                 _nlproc(decoder, j);
-
-                //decoder->du[j].th -= TWOPI;
             }
         }
 #else
@@ -80,7 +80,7 @@ typedef void (*mdc_decoder_callback_t)(int frameCount, // 1 or 2 - if 2 then ext
 typedef struct
 {
 //  mdc_float_t th;
-    mdc_u32_t thu;
+//  mdc_u32_t thu; - moved to mdc_decoder_t, so all demodulator phases advance together
 //  mdc_int_t zc; - deprecated
     mdc_int_t xorb;
     mdc_int_t invert;
@@ -110,6 +110,7 @@ typedef struct
  */
 typedef struct {
     mdc_decode_unit_t du[MDC_ND];
+    mdc_u32_t thu[MDC_ND];      // demodulator phases, kept contiguous so they are advanced as one vector
 //  mdc_float_t hyst;
 //  mdc_float_t incr;
     mdc_u32_t incru;
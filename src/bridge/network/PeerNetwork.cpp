@@ -141,6 +141,80 @@ void PeerNetwork::writeDMRTerminator(dmr::data::NetData& data, uint32_t* seqNo,
     dmrN = 0;
 }
 
+/* Writes DMR frame data to the network on the given call stream. */
+
+bool PeerNetwork::writeDMRStream(const dmr::data::NetData& data, uint32_t streamId, uint16_t pktSeq)
+{
+    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+        return false;
+
+    // individual slot disabling
+    uint32_t slotNo = data.getSlotNo();
+    if (slotNo == 1U && !m_slot1)
+        return false;
+    if (slotNo == 2U && !m_slot2)
+        return false;
+
+    uint32_t messageLength = 0U;
+    UInt8Array message = createDMR_Message(messageLength, streamId, data);
+    if (message == nullptr) {
+        return false;
+    }
+
+    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, message.get(), messageLength, pktSeq, streamId);
+}
+
+/* Writes P25 LDU1 frame data to the network on the given call stream. */
+
+bool PeerNetwork::writeP25LDU1Stream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data,
+    p25::defines::FrameType::E frameType, uint32_t streamId, uint16_t pktSeq)
+{
+    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+        return false;
+
+    uint32_t messageLength = 0U;
+    UInt8Array message = createP25_LDU1Message_Raw(messageLength, control, lsd, data, frameType);
+    if (message == nullptr) {
+        return false;
+    }
+
+    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, pktSeq, streamId);
+}
+
+/* Writes P25 LDU2 frame data to the network on the given call stream. */
+
+bool PeerNetwork::writeP25LDU2Stream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data,
+    uint32_t streamId, uint16_t pktSeq)
+{
+    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+        return false;
+
+    uint32_t messageLength = 0U;
+    UInt8Array message = createP25_LDU2Message_Raw(messageLength, control, lsd, data);
+    if (message == nullptr) {
+        return false;
+    }
+
+    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, pktSeq, streamId);
+}
+
+/* Writes P25 TDU frame data to the network on the given call stream. */
+
+bool PeerNetwork::writeP25TDUStream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t controlByte,
+    uint32_t streamId, uint16_t pktSeq)
+{
+    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+        return false;
+
+    uint32_t messageLength = 0U;
+    UInt8Array message = createP25_TDUMessage(messageLength, control, lsd, controlByte);
+    if (message == nullptr) {
+        return false;
+    }
+
+    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, pktSeq, streamId);
+}
+
 // ---------------------------------------------------------------------------
 //  Protected Class Members
 // ---------------------------------------------------------------------------
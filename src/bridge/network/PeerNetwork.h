@@ -85,6 +85,59 @@ namespace network
          */
         void writeDMRTerminator(dmr::data::NetData& data, uint32_t* seqNo, uint8_t* dmrN, dmr::data::EmbeddedData& embeddedData);
 
+        /**
+         * @brief Creates a new call stream ID.
+         *
+         *  This is used by callers that run several concurrent calls over the same peer connection, and
+         *  therefore must manage their own call streams (see the *Stream write functions below).
+         *
+         * @returns uint32_t Stream ID.
+         */
+        uint32_t createCallStreamId() { return createStreamId(); }
+
+        /**
+         * @brief Writes DMR frame data to the network on the given call stream.
+         * @param[in] data Instance of the dmr::data::NetData class containing the DMR message.
+         * @param streamId Call stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @returns bool True, if message was sent, otherwise false.
+         */
+        bool writeDMRStream(const dmr::data::NetData& data, uint32_t streamId, uint16_t pktSeq);
+        /**
+         * @brief Writes P25 LDU1 frame data to the network on the given call stream.
+         * @param[in] control Instance of p25::lc::LC containing link control data.
+         * @param[in] lsd Instance of p25::data::LowSpeedData containing low speed data.
+         * @param[in] data Buffer containing P25 LDU1 data to send.
+         * @param[in] frameType DVM P25 frame type.
+         * @param streamId Call stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @returns bool True, if message was sent, otherwise false.
+         */
+        bool writeP25LDU1Stream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data,
+            p25::defines::FrameType::E frameType, uint32_t streamId, uint16_t pktSeq);
+        /**
+         * @brief Writes P25 LDU2 frame data to the network on the given call stream.
+         * @param[in] control Instance of p25::lc::LC containing link control data.
+         * @param[in] lsd Instance of p25::data::LowSpeedData containing low speed data.
+         * @param[in] data Buffer containing P25 LDU2 data to send.
+         * @param streamId Call stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @returns bool True, if message was sent, otherwise false.
+         */
+        bool writeP25LDU2Stream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data,
+            uint32_t streamId, uint16_t pktSeq);
+        /**
+         * @brief Writes P25 TDU frame data to the network on the given call stream.
+         * @param[in] control Instance of p25::lc::LC containing link control data.
+         * @param[in] lsd Instance of p25::data::LowSpeedData containing low speed data.
+         * @param[in] controlByte DVM Network Control Byte.
+         * @param streamId Call stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @returns bool True, if message was sent, otherwise false.
+         */
+        bool writeP25TDUStream(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t controlByte,
+            uint32_t streamId, uint16_t pktSeq);
+
     protected:
         /**
          * @brief Writes configuration to the network.
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file BroadcastCache.h
+ * @ingroup common
+ */
+#if !defined(__BROADCAST_CACHE_H__)
+#define __BROADCAST_CACHE_H__
+
+#include "common/Defines.h"
+
+#include <cassert>
+#include <cstring>
+#include <unordered_map>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Versioned cache of pre-encoded control channel broadcasts.
+ *
+ *  Control channel broadcasts (site status, identity and system parameter messages) only change
+ *  when the site data changes, yet are transmitted many times a second. This cache holds the fully
+ *  FEC-encoded form of each broadcast, keyed by a caller chosen value, along with the version of the
+ *  data it was encoded from. Looking up (or adding) an entry with a different version flushes the
+ *  whole cache, so a broadcast is encoded once per site data change and copied otherwise.
+ * @ingroup common
+ * @tparam N Length of an encoded broadcast (bytes).
+ */
+template<uint32_t N>
+class HOST_SW_API BroadcastCache {
+public:
+    /**
+     * @brief Initializes a new instance of the BroadcastCache class.
+     */
+    BroadcastCache() :
+        m_version(0U),
+        m_entries(),
+        m_hits(0U),
+        m_misses(0U)
+    {
+        /* stub */
+    }
+
+    /**
+     * @brief Finds an encoded broadcast.
+     * @param version Version of the data the broadcast must be encoded from.
+     * @param key Broadcast key.
+     * @returns const uint8_t* Encoded broadcast, or nullptr if it is not cached for this version.
+     */
+    const uint8_t* find(uint32_t version, uint32_t key)
+    {
+        validate(version);
+
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            m_misses++;
+            return nullptr;
+        }
+
+        m_hits++;
+        return it->second.data;
+    }
+
+    /**
+     * @brief Adds (or replaces) an encoded broadcast.
+     * @param version Version of the data the broadcast was encoded from.
+     * @param key Broadcast key.
+     * @param[in] data Encoded broadcast.
+     * @returns const uint8_t* Cached copy of the encoded broadcast.
+     */
+    const uint8_t* add(uint32_t version, uint32_t key, const uint8_t* data)
+    {
+        assert(data != nullptr);
+
+        validate(version);
+
+        Entry& entry = m_entries[key];
+        ::memcpy(entry.data, data, N);
+        return entry.data;
+    }
+
+    /**
+     * @brief Removes all encoded broadcasts.
+     */
+    void clear() { m_entries.clear(); }
+
+    /**
+     * @brief Returns the number of cached broadcasts.
+     * @returns uint32_t Number of cached broadcasts.
+     */
+    uint32_t size() const { return (uint32_t)m_entries.size(); }
+    /**
+     * @brief Returns the number of lookups served from the cache.
+     * @returns uint32_t Number of cache hits.
+     */
+    uint32_t hits() const { return m_hits; }
+    /**
+     * @brief Returns the number of lookups that required the broadcast to be encoded.
+     * @returns uint32_t Number of cache misses.
+     */
+    uint32_t misses() const { return m_misses; }
+
+private:
+    /**
+     * @brief Represents an encoded broadcast.
+     */
+    struct Entry {
+        uint8_t data[N];
+    };
+
+    uint32_t m_version;
+    std::unordered_map<uint32_t, Entry> m_entries;
+
+    uint32_t m_hits;
+    uint32_t m_misses;
+
+    /**
+     * @brief Helper to flush the cache if the version changed.
+     * @param version Current version of the data broadcasts are encoded from.
+     */
+    void validate(uint32_t version)
+    {
+        if (version != m_version) {
+            m_entries.clear();
+            m_version = version;
+        }
+    }
+};
+
+#endif // __BROADCAST_CACHE_H__
@@ -144,6 +144,7 @@ typedef unsigned long long  ulong64_t;
 #define DEFAULT_LOCK_FILE "/tmp/dvm.lock"
 
 #define NULL_PORT       "null"
+#define LOOPBACK_PORT   "loopback"
 #define UART_PORT       "uart"
 #define PTY_PORT        "pty"
 
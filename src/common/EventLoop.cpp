@@ -0,0 +1,357 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "EventLoop.h"
+#include "Log.h"
+#include "Thread.h"
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define EVENT_TAG_TIMER 0U
+#define EVENT_TAG_NOTIFY 1U
+#define EVENT_TAG_WATCH 2U
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the EventLoop class. */
+
+EventLoop::EventLoop() :
+    m_epollFd(-1),
+    m_timerFd(-1),
+    m_eventFd(-1),
+    m_period(0U),
+    m_watchFd(),
+    m_windowMaxUs(0U),
+    m_windowSumUs(0U),
+    m_windowTicks(0U),
+    m_jitterMaxUs(0U),
+    m_jitterAvgUs(0U),
+    m_jitterPeakUs(0U)
+{
+    for (uint32_t i = 0U; i < EVENT_LOOP_MAX_WATCHES; i++)
+        m_watchFd[i] = -1;
+}
+
+/* Finalizes a instance of the EventLoop class. */
+
+EventLoop::~EventLoop()
+{
+    close();
+}
+
+/* Opens the event loop descriptors. */
+
+bool EventLoop::open()
+{
+#if defined(__linux__)
+    if (m_epollFd != -1)
+        return true;
+
+    m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    m_timerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    m_eventFd = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    bool ok = (m_epollFd != -1 && m_timerFd != -1 && m_eventFd != -1);
+    if (ok) {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u32 = EVENT_TAG_TIMER;
+        ok = ::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_timerFd, &ev) == 0;
+
+        ev.data.u32 = EVENT_TAG_NOTIFY;
+        ok = ok && ::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_eventFd, &ev) == 0;
+    }
+
+    if (!ok) {
+        ::LogWarning(LOG_HOST, "Unable to create event loop descriptors, errno = %d; falling back to sleeping between ticks", errno);
+        if (m_epollFd != -1)
+            ::close(m_epollFd);
+        if (m_timerFd != -1)
+            ::close(m_timerFd);
+        if (m_eventFd != -1)
+            ::close(m_eventFd);
+
+        m_epollFd = m_timerFd = m_eventFd = -1;
+        return false;
+    }
+
+    m_period = 0U;
+    for (uint32_t i = 0U; i < EVENT_LOOP_MAX_WATCHES; i++)
+        m_watchFd[i] = -1;
+
+    return true;
+#else
+    return false;
+#endif // defined(__linux__)
+}
+
+/* Closes the event loop descriptors; waits fall back to sleeping. */
+
+void EventLoop::close()
+{
+#if defined(__linux__)
+    if (m_epollFd != -1) {
+        ::close(m_epollFd);
+        ::close(m_timerFd);
+        ::close(m_eventFd);
+
+        m_epollFd = m_timerFd = m_eventFd = -1;
+    }
+#endif // defined(__linux__)
+}
+
+/* Sets the descriptor watched for readability in the given slot. */
+
+void EventLoop::watch(uint32_t slot, int fd)
+{
+    assert(slot < EVENT_LOOP_MAX_WATCHES);
+
+#if defined(__linux__)
+    if (m_epollFd != -1) {
+        struct epoll_event ev;
+        ev.events = EPOLLIN | EPOLLET;
+        ev.data.u32 = EVENT_TAG_WATCH + slot;
+
+        if (m_watchFd[slot] != fd && m_watchFd[slot] != -1) {
+            // a descriptor that has since been closed is already gone from the set; ignore the error
+            ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, m_watchFd[slot], nullptr);
+        }
+
+        // a closed descriptor silently leaves the set, and a reopened socket usually gets the same
+        // number back; so the descriptor is always (re)added, which leaves a live registration (and
+        // its pending edge) untouched
+        if (fd != -1) {
+            if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &ev) != 0 && errno != EEXIST) {
+                ::LogWarning(LOG_HOST, "Unable to watch descriptor %d, errno = %d", fd, errno);
+            }
+        }
+    }
+#endif // defined(__linux__)
+
+    m_watchFd[slot] = fd;
+}
+
+/* Wakes the loop, ending its current (or next) wait early. */
+
+void EventLoop::notify()
+{
+#if defined(__linux__)
+    if (m_eventFd != -1) {
+        uint64_t one = 1U;
+        ssize_t ret = ::write(m_eventFd, &one, sizeof(one));
+        (void)ret;
+    }
+#endif // defined(__linux__)
+}
+
+/* Waits for the next tick of the loop, or an earlier event. */
+
+void EventLoop::wait(uint32_t period)
+{
+    if (period < 1U)
+        period = 1U;
+
+#if defined(__linux__)
+    if (m_epollFd == -1) {
+        sleep(period);
+        return;
+    }
+
+    // (re)arm the cadence timer when the tick period changes
+    if (period != m_period) {
+        struct itimerspec spec;
+        spec.it_interval.tv_sec = period / 1000U;
+        spec.it_interval.tv_nsec = (period % 1000U) * 1000000L;
+        spec.it_value = spec.it_interval;
+        ::timerfd_settime(m_timerFd, 0, &spec, nullptr);
+
+        m_period = period;
+    }
+
+    // the timeout only matters should the timer fail; a tick always arrives within one period
+    struct epoll_event events[EVENT_LOOP_MAX_WATCHES + 2U];
+    int n = ::epoll_wait(m_epollFd, events, EVENT_LOOP_MAX_WATCHES + 2U, (int)period + 1);
+    if (n < 0) {
+        if (errno != EINTR) {
+            ::LogError(LOG_HOST, "Error from epoll_wait(), errno = %d", errno);
+            Thread::sleep(period);
+        }
+
+        return;
+    }
+
+    uint64_t ticks = 0U;
+    for (int i = 0; i < n; i++) {
+        uint64_t count = 0U;
+        ssize_t ret = 0;
+        switch (events[i].data.u32) {
+        case EVENT_TAG_TIMER:
+            ret = ::read(m_timerFd, &ticks, sizeof(ticks));
+            break;
+        case EVENT_TAG_NOTIFY:
+            ret = ::read(m_eventFd, &count, sizeof(count));
+            break;
+        default:
+            // watched descriptors are edge triggered, and read by the loop body
+            break;
+        }
+
+        (void)ret;
+    }
+
+    // the time remaining until the next expiry tells how long ago the last one was
+    if (ticks > 0U) {
+        struct itimerspec spec;
+        if (::timerfd_gettime(m_timerFd, &spec) == 0) {
+            uint64_t periodNs = period * 1000000ULL;
+            uint64_t remainNs = (uint64_t)spec.it_value.tv_sec * 1000000000ULL + (uint64_t)spec.it_value.tv_nsec;
+            uint64_t lateNs = (ticks - 1U) * periodNs + ((remainNs < periodNs) ? periodNs - remainNs : 0U);
+            addJitter(lateNs / 1000U);
+        }
+    }
+#else
+    sleep(period);
+#endif // defined(__linux__)
+}
+
+/* Waits until an absolute deadline, or an earlier event. */
+
+void EventLoop::waitUntil(uint64_t deadlineUs, uint32_t timeout)
+{
+    if (timeout < 1U)
+        timeout = 1U;
+
+#if defined(__linux__)
+    if (m_epollFd != -1) {
+        // a zeroed value disarms the timer, leaving only events (and the timeout) to end the wait
+        struct itimerspec spec;
+        ::memset(&spec, 0x00U, sizeof(spec));
+        spec.it_value.tv_sec = (time_t)(deadlineUs / 1000000ULL);
+        spec.it_value.tv_nsec = (long)(deadlineUs % 1000000ULL) * 1000L;
+        ::timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+        m_period = 0U;
+
+        struct epoll_event events[EVENT_LOOP_MAX_WATCHES + 2U];
+        int n = ::epoll_wait(m_epollFd, events, EVENT_LOOP_MAX_WATCHES + 2U, (int)timeout);
+        if (n < 0) {
+            if (errno != EINTR) {
+                ::LogError(LOG_HOST, "Error from epoll_wait(), errno = %d", errno);
+                Thread::sleep(1U);
+            }
+
+            return;
+        }
+
+        for (int i = 0; i < n; i++) {
+            uint64_t count = 0U;
+            ssize_t ret = 0;
+            switch (events[i].data.u32) {
+            case EVENT_TAG_TIMER:
+                ret = ::read(m_timerFd, &count, sizeof(count));
+                break;
+            case EVENT_TAG_NOTIFY:
+                ret = ::read(m_eventFd, &count, sizeof(count));
+                break;
+            default:
+                break;
+            }
+
+            (void)ret;
+        }
+
+        return;
+    }
+#endif // defined(__linux__)
+
+    // without a timer, sleep to the deadline (or the timeout) as closely as the platform allows
+    uint64_t timeoutUs = timeout * 1000ULL;
+    if (deadlineUs != 0U) {
+        uint64_t nowUs = now();
+        if (deadlineUs <= nowUs)
+            return;
+        if (deadlineUs - nowUs < timeoutUs)
+            timeoutUs = deadlineUs - nowUs;
+    }
+
+    if (timeoutUs >= 1000U)
+        Thread::sleep((uint32_t)(timeoutUs / 1000U));
+    else
+        Thread::sleep(0U, (uint32_t)timeoutUs);
+}
+
+/* Gets the current time on the steady clock used for deadlines. */
+
+uint64_t EventLoop::now()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Gets the scheduling jitter of the loop; how late each tick woke up, against its deadline. */
+
+void EventLoop::getJitter(uint32_t& maxUs, uint32_t& avgUs, uint32_t& peakUs) const
+{
+    maxUs = m_jitterMaxUs.load();
+    avgUs = m_jitterAvgUs.load();
+    peakUs = m_jitterPeakUs.load();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to sleep for a tick, when not event driven. */
+
+void EventLoop::sleep(uint32_t period)
+{
+    auto start = std::chrono::steady_clock::now();
+    Thread::sleep(period);
+    uint64_t elapsedUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t periodUs = period * 1000ULL;
+    addJitter((elapsedUs > periodUs) ? elapsedUs - periodUs : 0U);
+}
+
+/* Helper to account the lateness of a tick. */
+
+void EventLoop::addJitter(uint64_t lateUs)
+{
+    uint32_t late = (lateUs > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)lateUs;
+    if (late > m_jitterPeakUs.load())
+        m_jitterPeakUs.store(late);
+
+    if (late > m_windowMaxUs)
+        m_windowMaxUs = late;
+    m_windowSumUs += late;
+    m_windowTicks++;
+
+    if (m_windowTicks >= EVENT_LOOP_JITTER_WINDOW) {
+        m_jitterMaxUs.store(m_windowMaxUs);
+        m_jitterAvgUs.store((uint32_t)(m_windowSumUs / m_windowTicks));
+
+        m_windowMaxUs = 0U;
+        m_windowSumUs = 0U;
+        m_windowTicks = 0U;
+    }
+}
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file EventLoop.h
+ * @ingroup timers
+ * @file EventLoop.cpp
+ * @ingroup timers
+ */
+#if !defined(__EVENT_LOOP_H__)
+#define __EVENT_LOOP_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define EVENT_LOOP_MAX_WATCHES 4U
+#define EVENT_LOOP_JITTER_WINDOW 1000U
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements the wait between "ticks" of a processing loop.
+ *
+ *  On Linux a wait ends at the next tick of a periodic timerfd (which keeps an absolute cadence,
+ *  regardless of how long the loop body took), when a watched descriptor becomes readable, or when
+ *  another thread calls notify(); all through a single epoll descriptor. Elsewhere, or when disabled,
+ *  a wait is a plain sleep for the tick period.
+ *
+ *  wait() and watch() must only be called by the thread running the loop; notify() may be called from
+ *  any thread.
+ * @ingroup timers
+ */
+class HOST_SW_API EventLoop {
+public:
+    /**
+     * @brief Initializes a new instance of the EventLoop class.
+     */
+    EventLoop();
+    /**
+     * @brief Finalizes a instance of the EventLoop class.
+     */
+    ~EventLoop();
+
+    /**
+     * @brief Opens the event loop descriptors. Until opened (or if opening fails), waits are plain sleeps.
+     * @returns bool True, if the loop is event driven, otherwise false.
+     */
+    bool open();
+    /**
+     * @brief Closes the event loop descriptors; waits fall back to sleeping.
+     */
+    void close();
+
+    /**
+     * @brief Sets the descriptor watched for readability in the given slot.
+     *
+     *  Descriptors are watched edge triggered; new data wakes the loop once, data left unread is
+     *  picked up on a later tick. This is meant to be called every pass; it re-registers the slot if
+     *  the descriptor changed or was closed and reopened (e.g. a socket reconnected).
+     * @param slot Watch slot (less than EVENT_LOOP_MAX_WATCHES).
+     * @param fd Descriptor to watch, or -1 to watch nothing in this slot.
+     */
+    void watch(uint32_t slot, int fd);
+
+    /**
+     * @brief Wakes the loop, ending its current (or next) wait early.
+     */
+    void notify();
+
+    /**
+     * @brief Waits for the next tick of the loop, or an earlier event.
+     * @param period Tick period (in ms).
+     */
+    void wait(uint32_t period);
+    /**
+     * @brief Waits until an absolute deadline, or an earlier event.
+     *
+     *  Deadlines are on the std::chrono::steady_clock timeline (CLOCK_MONOTONIC), so a caller can
+     *  keep a schedule that does not drift with how late each wait returned. Any cadence set up by
+     *  wait() is cancelled, and restarted by its next call.
+     * @param deadlineUs Deadline, on the steady clock (in us); or 0 to only wait for an event.
+     * @param timeout Longest time to wait, regardless of the deadline (in ms).
+     */
+    void waitUntil(uint64_t deadlineUs, uint32_t timeout);
+
+    /**
+     * @brief Gets the current time on the steady clock used for deadlines.
+     * @returns uint64_t Current time (in us).
+     */
+    static uint64_t now();
+
+    /**
+     * @brief Flag indicating whether the loop is event driven (and not sleeping between ticks).
+     * @returns bool True, if the loop is event driven, otherwise false.
+     */
+    bool isEventDriven() const { return m_epollFd != -1; }
+
+    /**
+     * @brief Gets the scheduling jitter of the loop; how late each tick woke up, against its deadline.
+     *
+     *  Only waits that ran to the tick are measured; waits ended early by an event are not.
+     * @param[out] maxUs Largest lateness over the last complete window of EVENT_LOOP_JITTER_WINDOW ticks (in us).
+     * @param[out] avgUs Mean lateness over the last complete window of ticks (in us).
+     * @param[out] peakUs Largest lateness since the loop was created (in us).
+     */
+    void getJitter(uint32_t& maxUs, uint32_t& avgUs, uint32_t& peakUs) const;
+
+private:
+    int m_epollFd;
+    int m_timerFd;
+    int m_eventFd;
+
+    uint32_t m_period;
+    int m_watchFd[EVENT_LOOP_MAX_WATCHES];
+
+    uint32_t m_windowMaxUs;
+    uint64_t m_windowSumUs;
+    uint32_t m_windowTicks;
+    std::atomic<uint32_t> m_jitterMaxUs;
+    std::atomic<uint32_t> m_jitterAvgUs;
+    std::atomic<uint32_t> m_jitterPeakUs;
+
+    /**
+     * @brief Helper to sleep for a tick, when not event driven.
+     * @param period Tick period (in ms).
+     */
+    void sleep(uint32_t period);
+    /**
+     * @brief Helper to account the lateness of a tick.
+     * @param lateUs Lateness of the tick (in us).
+     */
+    void addJitter(uint64_t lateUs);
+};
+
+#endif // __EVENT_LOOP_H__
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file MessagePool.h
+ * @ingroup common
+ */
+#if !defined(__MESSAGE_POOL_H__)
+#define __MESSAGE_POOL_H__
+
+#include "common/Defines.h"
+
+#include <new>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Per-thread storage for decoded signalling messages.
+ *
+ *  Each thread owns exactly one instance of each message type. Borrowing an instance reconstructs
+ *  it in place (so no field carries over from the previous decode) and returns a pointer that stays
+ *  valid until the same thread borrows the same type again. The borrower must not delete, keep or
+ *  hand the instance to another thread.
+ * @ingroup common
+ * @tparam T Type of message; must be default constructible.
+ */
+template<class T>
+class HOST_SW_API MessagePool {
+public:
+    /**
+     * @brief Borrows this thread's instance of the message type, reset to its default state.
+     * @returns T* Borrowed message instance.
+     */
+    static T* borrow()
+    {
+        static thread_local T instance;
+
+        instance.~T();
+        return new (&instance) T();
+    }
+};
+
+#endif // __MESSAGE_POOL_H__
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file SPSCRingBuffer.h
+ * @ingroup common
+ */
+#if !defined(__SPSC_RING_BUFFER_H__)
+#define __SPSC_RING_BUFFER_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Wait-free single-producer single-consumer circular buffer.
+ *
+ *  Exactly one thread may call addData() and exactly one (other) thread may call get(), peek()
+ *  and clear(); neither side ever blocks, allocates or logs, which makes this buffer safe to use
+ *  from a real-time audio callback. The read and write positions are free-running counters, the
+ *  storage length is rounded up to a power of two, and data is copied in at most two contiguous
+ *  chunks.
+ *
+ *  A write that does not fit is rejected whole and counted as an overrun; a read that cannot be
+ *  satisfied is rejected whole and counted as an underrun.
+ * @ingroup common
+ * @tparam T Type of data to store in SPSCRingBuffer; must be trivially copyable.
+ */
+template<class T>
+class HOST_SW_API SPSCRingBuffer {
+    static_assert(std::is_trivially_copyable<T>::value, "SPSCRingBuffer requires a trivially copyable type");
+public:
+    /**
+     * @brief Initializes a new instance of the SPSCRingBuffer class.
+     * @param length Minimum length of ring buffer.
+     * @param name Name of buffer.
+     */
+    SPSCRingBuffer(uint32_t length, const char* name) :
+        m_length(1U),
+        m_mask(0U),
+        m_name(name),
+        m_buffer(nullptr),
+        m_iPtr(0U),
+        m_oPtr(0U),
+        m_overruns(0U),
+        m_underruns(0U)
+    {
+        assert(length > 0U && length <= 0x80000000U);
+
+        while (m_length < length)
+            m_length <<= 1;
+        m_mask = m_length - 1U;
+
+        m_buffer = new T[m_length];
+        ::memset(m_buffer, 0x00, m_length * sizeof(T));
+    }
+
+    /**
+     * @brief Finalizes a instance of the SPSCRingBuffer class.
+     */
+    ~SPSCRingBuffer()
+    {
+        delete[] m_buffer;
+    }
+
+    /**
+     * @brief Adds data to the end of the ring buffer. (Producer only.)
+     * @param buffer Data buffer.
+     * @param length Length of data in buffer.
+     * @return bool True, if data is added to ring buffer, otherwise false.
+     */
+    bool addData(const T* buffer, uint32_t length)
+    {
+        uint32_t iPtr = m_iPtr.load(std::memory_order_relaxed);
+        uint32_t oPtr = m_oPtr.load(std::memory_order_acquire);
+
+        if (length > m_length - (iPtr - oPtr)) {
+            m_overruns.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint32_t idx = iPtr & m_mask;
+        uint32_t first = m_length - idx;
+        if (first > length)
+            first = length;
+
+        ::memcpy(m_buffer + idx, buffer, first * sizeof(T));
+        ::memcpy(m_buffer, buffer + first, (length - first) * sizeof(T));
+
+        m_iPtr.store(iPtr + length, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Gets data from the ring buffer. (Consumer only.)
+     * @param buffer Buffer to write data to be retrieved.
+     * @param length Length of data to retrieve.
+     * @return bool True, if data is read from ring buffer, otherwise false.
+     */
+    bool get(T* buffer, uint32_t length)
+    {
+        if (!peek(buffer, length)) {
+            m_underruns.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+
+        m_oPtr.store(m_oPtr.load(std::memory_order_relaxed) + length, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Gets data from ring buffer without moving buffer pointers. (Consumer only.)
+     * @param buffer Buffer to write data to be retrieved.
+     * @param length Length of data to retrieve.
+     * @return bool True, if data is read from ring buffer, otherwise false.
+     */
+    bool peek(T* buffer, uint32_t length) const
+    {
+        uint32_t oPtr = m_oPtr.load(std::memory_order_relaxed);
+        uint32_t iPtr = m_iPtr.load(std::memory_order_acquire);
+
+        if (length > iPtr - oPtr)
+            return false;
+
+        uint32_t idx = oPtr & m_mask;
+        uint32_t first = m_length - idx;
+        if (first > length)
+            first = length;
+
+        ::memcpy(buffer, m_buffer + idx, first * sizeof(T));
+        ::memcpy(buffer + first, m_buffer, (length - first) * sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Discards all data currently stored in the ring buffer. (Consumer only.)
+     */
+    void clear()
+    {
+        m_oPtr.store(m_iPtr.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the currently available space in the ring buffer.
+     * @return uint32_t Space free in the ring buffer.
+     */
+    uint32_t freeSpace() const
+    {
+        return m_length - dataSize();
+    }
+
+    /**
+     * @brief Returns the size of the data currently stored in the ring buffer.
+     * @return uint32_t Size of data stored in the ring buffer.
+     */
+    uint32_t dataSize() const
+    {
+        return m_iPtr.load(std::memory_order_acquire) - m_oPtr.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the length of the ring buffer.
+     * @return uint32_t Length of ring buffer.
+     */
+    uint32_t length() const
+    {
+        return m_length;
+    }
+
+    /**
+     * @brief Gets the name of the ring buffer.
+     * @return const char* Name of the ring buffer.
+     */
+    const char* name() const
+    {
+        return m_name;
+    }
+
+    /**
+     * @brief Gets the number of writes rejected because the ring buffer was full.
+     * @return uint32_t Number of overruns.
+     */
+    uint32_t overruns() const
+    {
+        return m_overruns.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of reads rejected because the ring buffer held too little data.
+     * @return uint32_t Number of underruns.
+     */
+    uint32_t underruns() const
+    {
+        return m_underruns.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Helper to return whether the ring buffer contains data.
+     * @return bool True, if ring buffer contains data, otherwise false.
+     */
+    bool hasData() const
+    {
+        return dataSize() > 0U;
+    }
+
+    /**
+     * @brief Helper to return whether the ring buffer is empty or not.
+     * @return bool True, if the ring buffer is empty, otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return dataSize() == 0U;
+    }
+
+private:
+    uint32_t m_length;
+    uint32_t m_mask;
+
+    const char* m_name;
+
+    T* m_buffer;
+
+    // the producer and consumer positions are kept on separate cache lines so the two threads
+    // do not contend for the same line on every update
+    std::atomic<uint32_t> m_iPtr;
+    uint8_t m_iPad[64U - sizeof(std::atomic<uint32_t>)];
+    std::atomic<uint32_t> m_oPtr;
+    uint8_t m_oPad[64U - sizeof(std::atomic<uint32_t>)];
+
+    std::atomic<uint32_t> m_overruns;
+    std::atomic<uint32_t> m_underruns;
+};
+
+#endif // __SPSC_RING_BUFFER_H__
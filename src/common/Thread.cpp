@@ -10,13 +10,158 @@
  */
 #include "Thread.h"
 #include "Log.h"
+#include "yaml/Yaml.h"
 
+#include <cassert>
 #include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <signal.h>
 #if !defined(_WIN32)
+#include <sched.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif // !defined(_WIN32)
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define THREAD_PREFAULT_STACK_SIZE (256U * 1024U)
+#define THREAD_MAX_CPUS 64U
+
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Represents the scheduling of a thread group.
+ * @ingroup threading
+ */
+struct thread_sched_t {
+    bool realtime;                      //! Flag indicating the group uses a real-time policy.
+#if !defined(_WIN32)
+    int policy;                         //! Scheduling Policy.
+#endif // !defined(_WIN32)
+    int priority;                       //! Real-time Priority.
+    uint64_t cpus;                      //! CPU Affinity Mask (0 for no pinning).
+};
+
+/**
+ * @brief Represents the configuration names of a thread group.
+ * @ingroup threading
+ */
+struct thread_group_name_t {
+    const char* name;                   //! Configuration Key.
+    const char* label;                  //! Display Label.
+};
+
+// ---------------------------------------------------------------------------
+//  Global Variables
+// ---------------------------------------------------------------------------
+
+static const thread_group_name_t GROUP_NAMES[THREAD_GROUP_MAX] = {
+    { "default", "Default" },
+    { "modem", "Modem" },
+    { "protocol", "Protocol" },
+    { "network", "Network" },
+    { "rest", "REST API" }
+};
+
+
+static std::mutex s_schedMutex;
+static thread_sched_t s_sched[THREAD_GROUP_MAX];
+static uint32_t s_stackSize = 0U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the scheduling of a thread group. */
+
+static thread_sched_t getSchedule(THREAD_GROUP group)
+{
+    std::lock_guard<std::mutex> lock(s_schedMutex);
+    if (group >= THREAD_GROUP_MAX)
+        group = THREAD_GROUP_DEFAULT;
+    return s_sched[group];
+}
+
+/* Helper to parse a CPU list (e.g. "0,2-3") into an affinity mask. */
+
+static bool parseCPUList(const std::string& cpus, uint64_t& mask)
+{
+    mask = 0U;
+
+    size_t pos = 0U;
+    while (pos < cpus.length()) {
+        size_t end = cpus.find(',', pos);
+        if (end == std::string::npos)
+            end = cpus.length();
+
+        std::string item = cpus.substr(pos, end - pos);
+        pos = end + 1U;
+        if (item.empty())
+            continue;
+
+        char* next = nullptr;
+        unsigned long first = ::strtoul(item.c_str(), &next, 10);
+        unsigned long last = first;
+        if (next == item.c_str())
+            return false;
+        if (*next == '-') {
+            const char* start = next + 1;
+            last = ::strtoul(start, &next, 10);
+            if (next == start)
+                return false;
+        }
+
+        if (*next != '\0' || first > last || last >= THREAD_MAX_CPUS)
+            return false;
+
+        for (unsigned long cpu = first; cpu <= last; cpu++)
+            mask |= (1ULL << cpu);
+    }
+
+    return true;
+}
+
+#if !defined(_WIN32)
+/* Helper to prepare the attributes of a new thread for the given scheduling. */
+
+static void initThreadAttr(pthread_attr_t* attr, const thread_sched_t& sched)
+{
+    ::pthread_attr_init(attr);
+
+    if (s_stackSize > 0U)
+        ::pthread_attr_setstacksize(attr, s_stackSize);
+
+    if (sched.realtime) {
+        struct sched_param param;
+        ::memset(&param, 0x00U, sizeof(param));
+        param.sched_priority = sched.priority;
+
+        ::pthread_attr_setinheritsched(attr, PTHREAD_EXPLICIT_SCHED);
+        ::pthread_attr_setschedpolicy(attr, sched.policy);
+        ::pthread_attr_setschedparam(attr, &param);
+    }
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    if (sched.cpus != 0U) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (uint32_t cpu = 0U; cpu < THREAD_MAX_CPUS; cpu++) {
+            if ((sched.cpus & (1ULL << cpu)) != 0U)
+                CPU_SET(cpu, &set);
+        }
+
+        ::pthread_attr_setaffinity_np(attr, sizeof(set), &set);
+    }
+#endif // defined(__linux__) && defined(_GNU_SOURCE)
+}
+#endif // !defined(_WIN32)
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -49,9 +194,12 @@ bool Thread::run()
         return false;
     }
 #else
-    int err = ::pthread_create(&m_thread, NULL, helper, this);
+    pthread_attr_t attr;
+    initThreadAttr(&attr, getSchedule(THREAD_GROUP_DEFAULT));
+    int err = ::pthread_create(&m_thread, &attr, helper, this);
+    ::pthread_attr_destroy(&attr);
     if (err != 0) {
-        LogError(LOG_NET, "Error returned from pthread_create, err: %d", errno);
+        LogError(LOG_NET, "Error returned from pthread_create, err: %d", err);
         return false;
     }
 #endif // defined(_WIN32)
@@ -107,13 +255,14 @@ void Thread::detach()
 
 /* Executes the specified start routine to run as a thread. */
 
-bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thread)
+bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thread, THREAD_GROUP group)
 {
     if (thread == nullptr)
         thread = new thread_t();
 
     thread->obj = obj;
 
+    thread_sched_t sched = getSchedule(group);
 #if defined(_WIN32)
     HANDLE hnd = ::CreateThread(NULL, 0, reinterpret_cast<LPTHREAD_START_ROUTINE>((void*)startRoutine), thread, CREATE_SUSPENDED, NULL);
     if (hnd == NULL) {
@@ -122,10 +271,33 @@ bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thr
     }
 
     thread->thread = hnd;
+    if (sched.realtime)
+        ::SetThreadPriority(hnd, THREAD_PRIORITY_TIME_CRITICAL);
+    if (sched.cpus != 0U)
+        ::SetThreadAffinityMask(hnd, (DWORD_PTR)sched.cpus);
     ::ResumeThread(hnd);
 #else
-    if (::pthread_create(&thread->thread, NULL, startRoutine, thread) != 0) {
-        LogError(LOG_NET, "Error returned from pthread_create, err: %d", errno);
+    // the scheduling is set through the attributes, so it is in place before the thread runs at all
+    pthread_attr_t attr;
+    initThreadAttr(&attr, sched);
+    int err = ::pthread_create(&thread->thread, &attr, startRoutine, thread);
+    ::pthread_attr_destroy(&attr);
+
+    if (err == EPERM && sched.realtime) {
+        LogWarning(LOG_NET, "Not permitted to use real-time scheduling (needs CAP_SYS_NICE or root), thread group %u falls back to normal scheduling", group);
+        {
+            std::lock_guard<std::mutex> lock(s_schedMutex);
+            s_sched[group].realtime = false;
+        }
+
+        sched.realtime = false;
+        initThreadAttr(&attr, sched);
+        err = ::pthread_create(&thread->thread, &attr, startRoutine, thread);
+        ::pthread_attr_destroy(&attr);
+    }
+
+    if (err != 0) {
+        LogError(LOG_NET, "Error returned from pthread_create, err: %d", err);
         delete thread;
         return false;
     }
@@ -134,6 +306,159 @@ bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thr
     return true;
 }
 
+/* Sets the scheduling of a thread group. */
+
+bool Thread::setGroupSchedule(THREAD_GROUP group, const std::string& policy, int priority, const std::string& cpus)
+{
+    if (group >= THREAD_GROUP_MAX)
+        return false;
+
+    thread_sched_t sched;
+    ::memset(&sched, 0x00U, sizeof(sched));
+
+    if (policy == "fifo" || policy == "rr") {
+        sched.realtime = true;
+#if !defined(_WIN32)
+        sched.policy = (policy == "fifo") ? SCHED_FIFO : SCHED_RR;
+        if (priority < ::sched_get_priority_min(sched.policy) || priority > ::sched_get_priority_max(sched.policy)) {
+            LogError(LOG_NET, "Invalid real-time priority %d for thread group %u", priority, group);
+            return false;
+        }
+#endif // !defined(_WIN32)
+        sched.priority = priority;
+    }
+    else if (policy != "other" && !policy.empty()) {
+        LogError(LOG_NET, "Invalid scheduling policy \"%s\" for thread group %u", policy.c_str(), group);
+        return false;
+    }
+#if !defined(_WIN32)
+    else {
+        sched.policy = SCHED_OTHER;
+    }
+#endif // !defined(_WIN32)
+
+    if (!parseCPUList(cpus, sched.cpus)) {
+        LogError(LOG_NET, "Invalid CPU list \"%s\" for thread group %u", cpus.c_str(), group);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_schedMutex);
+    s_sched[group] = sched;
+    return true;
+}
+
+/* Applies the scheduling of a thread group to the calling thread. */
+
+bool Thread::applyGroupSchedule(THREAD_GROUP group)
+{
+    thread_sched_t sched = getSchedule(group);
+#if defined(_WIN32)
+    if (sched.realtime)
+        ::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+    if (sched.cpus != 0U)
+        ::SetThreadAffinityMask(::GetCurrentThread(), (DWORD_PTR)sched.cpus);
+#else
+    if (sched.realtime) {
+        struct sched_param param;
+        ::memset(&param, 0x00U, sizeof(param));
+        param.sched_priority = sched.priority;
+
+        int err = ::pthread_setschedparam(::pthread_self(), sched.policy, &param);
+        if (err != 0) {
+            LogWarning(LOG_NET, "Unable to set real-time scheduling for thread group %u, err: %d", group, err);
+            return false;
+        }
+    }
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    if (sched.cpus != 0U) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (uint32_t cpu = 0U; cpu < THREAD_MAX_CPUS; cpu++) {
+            if ((sched.cpus & (1ULL << cpu)) != 0U)
+                CPU_SET(cpu, &set);
+        }
+
+        int err = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+        if (err != 0) {
+            LogWarning(LOG_NET, "Unable to set CPU affinity for thread group %u, err: %d", group, err);
+            return false;
+        }
+    }
+#endif // defined(__linux__) && defined(_GNU_SOURCE)
+#endif // defined(_WIN32)
+
+    return true;
+}
+
+/* Locks all current and future process memory into RAM, so that page faults never stall a thread. */
+
+bool Thread::lockMemory(uint32_t stackSize)
+{
+#if defined(_WIN32)
+    LogWarning(LOG_NET, "Memory locking is not supported on this platform");
+    return false;
+#else
+    if (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        LogWarning(LOG_NET, "Unable to lock memory (needs CAP_IPC_LOCK, or a larger RLIMIT_MEMLOCK), err: %d", errno);
+        return false;
+    }
+
+    // locked thread stacks are faulted in whole when created; keep them from being needlessly large
+    if (stackSize > 0U && stackSize < PTHREAD_STACK_MIN)
+        stackSize = PTHREAD_STACK_MIN;
+    s_stackSize = stackSize;
+
+    // touch the pages below the calling thread's current stack frame, so later growth doesn't fault
+    volatile uint8_t prefault[THREAD_PREFAULT_STACK_SIZE];
+    for (uint32_t i = 0U; i < THREAD_PREFAULT_STACK_SIZE; i += 4096U)
+        prefault[i] = 0U;
+    (void)prefault[0U];
+
+    return true;
+#endif // defined(_WIN32)
+}
+
+/* Helper to configure the scheduling of thread groups, and memory locking, from a "realtime" configuration block. */
+
+bool Thread::configureSchedule(yaml::Node& rtConf, const THREAD_GROUP* groups, uint32_t count, bool& memoryLocked)
+{
+    assert(groups != nullptr);
+
+    LogInfo("Realtime Parameters");
+    for (uint32_t i = 0U; i < count; i++) {
+        THREAD_GROUP group = groups[i];
+        assert(group < THREAD_GROUP_MAX);
+
+        yaml::Node groupConf = rtConf[GROUP_NAMES[group].name];
+        std::string policy = groupConf["policy"].as<std::string>("other");
+        int priority = groupConf["priority"].as<int>(0);
+        std::string cpus = groupConf["cpus"].as<std::string>();
+        if (!setGroupSchedule(group, policy, priority, cpus))
+            return false;
+
+        const char* label = GROUP_NAMES[group].label;
+        if (policy == "fifo" || policy == "rr")
+            LogInfo("    %s Threads: %s, priority %d, CPUs: %s", label, policy.c_str(), priority, cpus.empty() ? "any" : cpus.c_str());
+        else
+            LogInfo("    %s Threads: other, CPUs: %s", label, cpus.empty() ? "any" : cpus.c_str());
+    }
+
+    bool lockMem = rtConf["lockMemory"].as<bool>(false);
+    uint32_t stackSize = rtConf["stackSize"].as<uint32_t>(2048U);
+    memoryLocked = false;
+    if (lockMem) {
+        memoryLocked = lockMemory(stackSize * 1024U);
+    }
+
+    LogInfo("    Lock Memory: %s", memoryLocked ? "yes" : "no");
+    if (memoryLocked) {
+        LogInfo("    Thread Stack Size: %uKB", stackSize);
+    }
+
+    return true;
+}
+
 /* Suspends the current thread for the specified amount of time. */
 
 void Thread::sleep(uint32_t ms, uint32_t us)
@@ -38,6 +38,26 @@
 typedef HANDLE pthread_t;
 #endif // defined(_WIN32)
 
+namespace yaml { class Node; }
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Thread groups; threads of a group share a scheduling policy, priority and CPU affinity.
+ * @ingroup threading
+ */
+enum THREAD_GROUP {
+    THREAD_GROUP_DEFAULT,                   //! Default (Inherits Scheduling)
+    THREAD_GROUP_MODEM,                     //! Modem Clocking
+    THREAD_GROUP_PROTOCOL,                  //! Protocol Processing
+    THREAD_GROUP_NETWORK,                   //! Network Processing
+    THREAD_GROUP_REST,                      //! REST API
+
+    THREAD_GROUP_MAX
+};
+
 // ---------------------------------------------------------------------------
 //  Structure Declaration
 // ---------------------------------------------------------------------------
@@ -103,9 +123,45 @@ public:
      * @param obj Instance of a object to pass to the threaded function.
      * @param startRoutine Represents the function that executes on a thread.
      * @param[out] thread Instance of the thread data.
+     * @param group Thread group whose scheduling is applied to the thread as it is created.
      * @returns bool True, if successful, otherwise error occurred.
      */
-    static bool runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thread = nullptr);
+    static bool runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thread = nullptr, THREAD_GROUP group = THREAD_GROUP_DEFAULT);
+
+    /**
+     * @brief Sets the scheduling of a thread group.
+     * @param group Thread group.
+     * @param policy Scheduling policy; "other" (normal time-sharing), "fifo" or "rr".
+     * @param priority Real-time priority (1 - 99) for the "fifo" and "rr" policies.
+     * @param cpus List of CPUs the group's threads are pinned to (e.g. "2", "0,2" or "2-3"); empty for no pinning.
+     * @returns bool True, if the scheduling was valid and set, otherwise false.
+     */
+    static bool setGroupSchedule(THREAD_GROUP group, const std::string& policy, int priority, const std::string& cpus);
+    /**
+     * @brief Applies the scheduling of a thread group to the calling thread.
+     * @param group Thread group.
+     * @returns bool True, if the scheduling was applied, otherwise false.
+     */
+    static bool applyGroupSchedule(THREAD_GROUP group);
+    /**
+     * @brief Locks all current and future process memory into RAM, so that page faults never stall a thread.
+     *
+     *  Thread stacks created afterwards are sized to the given stack size, and (being locked) are faulted
+     *  in when they are created; the calling thread's stack is pre-faulted as well.
+     * @param stackSize Thread stack size (in bytes).
+     * @returns bool True, if memory was locked, otherwise false.
+     */
+    static bool lockMemory(uint32_t stackSize);
+    /**
+     * @brief Helper to configure the scheduling of thread groups, and memory locking, from a "realtime"
+     *  configuration block, logging the resulting parameters.
+     * @param rtConf "realtime" configuration block.
+     * @param groups Thread groups to configure.
+     * @param count Number of thread groups.
+     * @param[out] memoryLocked Flag indicating whether memory was locked.
+     * @returns bool True, if the configuration was valid and set, otherwise false.
+     */
+    static bool configureSchedule(yaml::Node& rtConf, const THREAD_GROUP* groups, uint32_t count, bool& memoryLocked);
 
     /**
      * @brief Suspends the current thread for the specified amount of time.
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "TimerQueue.h"
+
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t TIMER_QUEUE_COMPACT_MIN = 64U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TimerQueue class. */
+
+TimerQueue::TimerQueue() :
+    m_now(0U),
+    m_timers(),
+    m_heap()
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the TimerQueue class. */
+
+TimerQueue::~TimerQueue() = default;
+
+/* Starts (or restarts) the timer for the given key. */
+
+void TimerQueue::start(uint32_t key, uint32_t secs)
+{
+    if (secs == 0U) {
+        stop(key);
+        return;
+    }
+
+    auto it = m_timers.find(key);
+    if (it == m_timers.end()) {
+        it = m_timers.emplace(key, Entry{ 0U, 0U, 0U, 0U }).first;
+    }
+
+    Entry& entry = it->second;
+    entry.timeout = secs * 1000U;
+    entry.started = m_now;
+    entry.deadline = m_now + entry.timeout;
+
+    // an entry already in the heap at (or before) the new deadline will reschedule itself
+    if (entry.queued == 0U || entry.deadline < entry.queued) {
+        push(key, entry.deadline);
+    }
+}
+
+/* Restarts the timer for the given key with its current timeout, if it is running. */
+
+void TimerQueue::start(uint32_t key)
+{
+    auto it = m_timers.find(key);
+    if (it == m_timers.end())
+        return;
+
+    Entry& entry = it->second;
+    entry.started = m_now;
+    entry.deadline = m_now + entry.timeout;
+}
+
+/* Stops the timer for the given key. */
+
+void TimerQueue::stop(uint32_t key)
+{
+    if (m_timers.erase(key) > 0U) {
+        compact();
+    }
+}
+
+/* Stops all timers. */
+
+void TimerQueue::clear()
+{
+    m_timers.clear();
+    m_heap.clear();
+}
+
+/* Flag indicating whether the timer for the given key is running. */
+
+bool TimerQueue::isRunning(uint32_t key) const
+{
+    return m_timers.find(key) != m_timers.end();
+}
+
+/* Gets the timeout for the timer for the given key. */
+
+uint32_t TimerQueue::getTimeout(uint32_t key) const
+{
+    auto it = m_timers.find(key);
+    if (it == m_timers.end())
+        return 0U;
+
+    return it->second.timeout / 1000U;
+}
+
+/* Gets the current time for the timer for the given key. */
+
+uint32_t TimerQueue::getTimer(uint32_t key) const
+{
+    auto it = m_timers.find(key);
+    if (it == m_timers.end())
+        return 0U;
+
+    return (uint32_t)((m_now - it->second.started) / 1000U);
+}
+
+/* Updates the timers by the passed number of milliseconds. */
+
+void TimerQueue::clock(uint32_t ms, std::vector<uint32_t>& expired)
+{
+    m_now += ms;
+
+    while (!m_heap.empty() && m_heap.front().deadline <= m_now) {
+        Deadline due = m_heap.front();
+        std::pop_heap(m_heap.begin(), m_heap.end(), later);
+        m_heap.pop_back();
+
+        // discard entries left behind by stopped (or restarted earlier) timers
+        auto it = m_timers.find(due.key);
+        if (it == m_timers.end() || it->second.queued != due.deadline)
+            continue;
+
+        Entry& entry = it->second;
+        entry.queued = 0U;
+
+        if (entry.deadline <= m_now) {
+            expired.push_back(due.key);
+            m_timers.erase(it);
+        }
+        else {
+            // the timer was restarted since this entry was queued
+            push(due.key, entry.deadline);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to add an entry to the deadline heap. */
+
+void TimerQueue::push(uint32_t key, ulong64_t deadline)
+{
+    m_timers[key].queued = deadline;
+
+    m_heap.push_back(Deadline{ deadline, key });
+    std::push_heap(m_heap.begin(), m_heap.end(), later);
+}
+
+/* Helper to rebuild the deadline heap once stale entries outnumber the running timers. */
+
+void TimerQueue::compact()
+{
+    if (m_heap.size() < TIMER_QUEUE_COMPACT_MIN || m_heap.size() <= m_timers.size() * 2U)
+        return;
+
+    m_heap.clear();
+    for (auto& timer : m_timers) {
+        timer.second.queued = timer.second.deadline;
+        m_heap.push_back(Deadline{ timer.second.deadline, timer.first });
+    }
+
+    std::make_heap(m_heap.begin(), m_heap.end(), later);
+}
+
+/* Helper to order the deadline heap, earliest deadline first. */
+
+bool TimerQueue::later(const Deadline& a, const Deadline& b)
+{
+    return a.deadline > b.deadline;
+}
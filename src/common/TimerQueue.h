@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TimerQueue.h
+ * @ingroup timers
+ * @file TimerQueue.cpp
+ * @ingroup timers
+ */
+#if !defined(__TIMER_QUEUE_H__)
+#define __TIMER_QUEUE_H__
+
+#include "common/Defines.h"
+
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Set of keyed timeouts, expired in deadline order.
+ *
+ *  This is the keyed equivalent of holding a Timer per key (e.g. per radio or talkgroup ID) and
+ *  clocking every one of them; instead each running timer has a deadline and the deadlines are kept
+ *  in a min-heap, so clocking only touches the timers that are due.
+ *
+ *  Restarting a running timer only moves its deadline and never touches the heap; when the stale
+ *  heap entry comes due it is pushed back at the real deadline. Stopped timers leave their heap entry
+ *  behind, which is discarded when it comes due (or when the heap is compacted).
+ * @ingroup timers
+ */
+class HOST_SW_API TimerQueue {
+public:
+    /**
+     * @brief Initializes a new instance of the TimerQueue class.
+     */
+    TimerQueue();
+    /**
+     * @brief Finalizes a instance of the TimerQueue class.
+     */
+    ~TimerQueue();
+
+    /**
+     * @brief Starts (or restarts) the timer for the given key.
+     * @param key Timer key.
+     * @param secs Number of seconds until the timer expires; a zero timeout stops the timer.
+     */
+    void start(uint32_t key, uint32_t secs);
+    /**
+     * @brief Restarts the timer for the given key with its current timeout, if it is running.
+     * @param key Timer key.
+     */
+    void start(uint32_t key);
+    /**
+     * @brief Stops the timer for the given key.
+     * @param key Timer key.
+     */
+    void stop(uint32_t key);
+    /**
+     * @brief Stops all timers.
+     */
+    void clear();
+
+    /**
+     * @brief Flag indicating whether the timer for the given key is running.
+     * @param key Timer key.
+     * @returns bool True, if the timer is running, otherwise false.
+     */
+    bool isRunning(uint32_t key) const;
+    /**
+     * @brief Gets the timeout for the timer for the given key.
+     * @param key Timer key.
+     * @returns uint32_t Timeout (in seconds), or 0 if the timer is not running.
+     */
+    uint32_t getTimeout(uint32_t key) const;
+    /**
+     * @brief Gets the current time for the timer for the given key.
+     * @param key Timer key.
+     * @returns uint32_t Time since the timer was (re)started (in seconds), or 0 if the timer is not running.
+     */
+    uint32_t getTimer(uint32_t key) const;
+    /**
+     * @brief Gets the count of running timers.
+     * @returns uint32_t Count of running timers.
+     */
+    uint32_t size() const { return (uint32_t)m_timers.size(); }
+
+    /**
+     * @brief Updates the timers by the passed number of milliseconds.
+     *  Expired timers are stopped, and their keys returned in deadline order.
+     * @param ms Number of milliseconds.
+     * @param[out] expired Keys of the timers that expired.
+     */
+    void clock(uint32_t ms, std::vector<uint32_t>& expired);
+
+private:
+    /**
+     * @brief Represents a running timer.
+     */
+    struct Entry {
+        ulong64_t started;                  //! Time Started (ms)
+        ulong64_t deadline;                 //! Time of Expiry (ms)
+        ulong64_t queued;                   //! Deadline of the Heap Entry (ms)
+        uint32_t timeout;                   //! Timeout (ms)
+    };
+
+    /**
+     * @brief Represents a heap entry.
+     */
+    struct Deadline {
+        ulong64_t deadline;                 //! Deadline (ms)
+        uint32_t key;                       //! Timer Key
+    };
+
+    ulong64_t m_now;
+
+    std::unordered_map<uint32_t, Entry> m_timers;
+    std::vector<Deadline> m_heap;
+
+    /**
+     * @brief Helper to add an entry to the deadline heap.
+     * @param key Timer key.
+     * @param deadline Deadline (ms).
+     */
+    void push(uint32_t key, ulong64_t deadline);
+    /**
+     * @brief Helper to rebuild the deadline heap once stale entries outnumber the running timers.
+     */
+    void compact();
+    /**
+     * @brief Helper to order the deadline heap, earliest deadline first.
+     * @param a Deadline.
+     * @param b Deadline.
+     * @returns bool True, if a is due after b, otherwise false.
+     */
+    static bool later(const Deadline& a, const Deadline& b);
+};
+
+#endif // __TIMER_QUEUE_H__
@@ -293,10 +293,23 @@ uint32_t Utils::getBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_
     assert(in != nullptr);
     assert(out != nullptr);
 
-    uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++, n++) {
-        bool b = READ_BIT(in, i);
-        WRITE_BIT(out, n, b);
+    if (stop <= start)
+        return 0U;
+
+    uint32_t n = stop - start;
+    uint32_t pos = 0U;
+
+    // byte aligned source -- copy whole bytes directly
+    if ((start & 7U) == 0U) {
+        pos = n & ~7U;
+        ::memcpy(out, in + (start >> 3), pos >> 3);
+    }
+
+    // move the remainder in (at most) 56-bit words
+    while (pos < n) {
+        uint32_t len = (n - pos > 56U) ? 56U : n - pos;
+        writeBits(out, pos, readBits(in, start + pos, len), len);
+        pos += len;
     }
 
     return n;
@@ -316,10 +329,23 @@ uint32_t Utils::setBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_
     assert(in != nullptr);
     assert(out != nullptr);
 
-    uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++, n++) {
-        bool b = READ_BIT(in, n);
-        WRITE_BIT(out, i, b);
+    if (stop <= start)
+        return 0U;
+
+    uint32_t n = stop - start;
+    uint32_t pos = 0U;
+
+    // byte aligned destination -- copy whole bytes directly
+    if ((start & 7U) == 0U) {
+        pos = n & ~7U;
+        ::memcpy(out + (start >> 3), in, pos >> 3);
+    }
+
+    // move the remainder in (at most) 56-bit words
+    while (pos < n) {
+        uint32_t len = (n - pos > 56U) ? 56U : n - pos;
+        writeBits(out, start + pos, readBits(in, pos, len), len);
+        pos += len;
     }
 
     return n;
@@ -332,32 +358,108 @@ uint32_t Utils::setBitRange(const uint8_t* in, uint8_t* out, uint32_t start, uin
     return setBits(in, out, start, start + length);
 }
 
-/* Helper to convert a binary input buffer into representative 6-bit byte. */
+/* Helper to read an arbitrary length bit field (MSB first) from an input buffer as a single word. */
 
-uint8_t Utils::bin2Hex(const uint8_t* input, uint32_t offset)
+uint64_t Utils::readBits(const uint8_t* in, uint32_t offset, uint32_t length)
+{
+    assert(in != nullptr);
+    assert(length <= 64U);
+
+    if (length == 0U)
+        return 0U;
+
+    // a field longer than 56 bits may span 9 bytes, split it into two words
+    if (length > 56U) {
+        uint32_t hiLen = length - 32U;
+        return (readBits(in, offset, hiLen) << 32) | readBits(in, offset + hiLen, 32U);
+    }
+
+    const uint8_t* p = in + (offset >> 3);
+    uint32_t shift = offset & 7U;
+    uint32_t nBytes = (shift + length + 7U) >> 3;
+
+    // only touch the bytes that actually contain the field
+    uint64_t word = 0U;
+    for (uint32_t i = 0U; i < nBytes; i++)
+        word = (word << 8) | p[i];
+
+    word >>= (nBytes << 3) - shift - length;
+    return word & ((1ULL << length) - 1U);
+}
+
+/* Helper to write an arbitrary length bit field (MSB first) into an output buffer from a single word. */
+
+void Utils::writeBits(uint8_t* out, uint32_t offset, uint64_t value, uint32_t length)
+{
+    assert(out != nullptr);
+    assert(length <= 64U);
+
+    if (length == 0U)
+        return;
+
+    // a field longer than 56 bits may span 9 bytes, split it into two words
+    if (length > 56U) {
+        uint32_t hiLen = length - 32U;
+        writeBits(out, offset, value >> 32, hiLen);
+        writeBits(out, offset + hiLen, value & 0xFFFFFFFFU, 32U);
+        return;
+    }
+
+    uint8_t* p = out + (offset >> 3);
+    uint32_t shift = offset & 7U;
+    uint32_t nBytes = (shift + length + 7U) >> 3;
+    uint32_t pad = (nBytes << 3) - shift - length;
+
+    uint64_t mask = ((1ULL << length) - 1U) << pad;
+    value = (value << pad) & mask;
+
+    // only the first and last byte can carry bits that must be preserved
+    uint64_t word = 0U;
+    if (mask != ((nBytes == 8U) ? ~0ULL : (1ULL << (nBytes << 3)) - 1U)) {
+        for (uint32_t i = 0U; i < nBytes; i++)
+            word = (word << 8) | p[i];
+    }
+
+    word = (word & ~mask) | value;
+    for (uint32_t i = nBytes; i > 0U; i--) {
+        p[i - 1U] = (uint8_t)(word & 0xFFU);
+        word >>= 8;
+    }
+}
+
+/* Helper to gather bits from an input buffer through a permutation table. */
+
+void Utils::permuteBits(const uint8_t* in, uint32_t inOffset, uint8_t* out, uint32_t outOffset, const uint16_t* table, uint32_t length)
 {
-    uint8_t output = 0x00U;
+    assert(in != nullptr);
+    assert(out != nullptr);
+    assert(table != nullptr);
+
+    for (uint32_t i = 0U; i < length; i += 32U) {
+        uint32_t n = ((length - i) < 32U) ? (length - i) : 32U;
 
-    output |= READ_BIT(input, offset + 0U) ? 0x20U : 0x00U;
-    output |= READ_BIT(input, offset + 1U) ? 0x10U : 0x00U;
-    output |= READ_BIT(input, offset + 2U) ? 0x08U : 0x00U;
-    output |= READ_BIT(input, offset + 3U) ? 0x04U : 0x00U;
-    output |= READ_BIT(input, offset + 4U) ? 0x02U : 0x00U;
-    output |= READ_BIT(input, offset + 5U) ? 0x01U : 0x00U;
+        uint32_t word = 0U;
+        for (uint32_t j = 0U; j < n; j++) {
+            uint32_t pos = inOffset + table[i + j];
+            word = (word << 1) | ((in[pos >> 3] >> (7U - (pos & 7U))) & 1U);
+        }
 
-    return output;
+        writeBits(out, outOffset + i, word, n);
+    }
+}
+
+/* Helper to convert a binary input buffer into representative 6-bit byte. */
+
+uint8_t Utils::bin2Hex(const uint8_t* input, uint32_t offset)
+{
+    return (uint8_t)readBits(input, offset, 6U);
 }
 
 /* Helper to convert 6-bit input byte into representative binary buffer. */
 
 void Utils::hex2Bin(const uint8_t input, uint8_t* output, uint32_t offset)
 {
-    WRITE_BIT(output, offset + 0U, input & 0x20U);
-    WRITE_BIT(output, offset + 1U, input & 0x10U);
-    WRITE_BIT(output, offset + 2U, input & 0x08U);
-    WRITE_BIT(output, offset + 3U, input & 0x04U);
-    WRITE_BIT(output, offset + 4U, input & 0x02U);
-    WRITE_BIT(output, offset + 5U, input & 0x01U);
+    writeBits(output, offset, input & 0x3FU, 6U);
 }
 
 /* Returns the count of bits in the passed 8 byte value. */
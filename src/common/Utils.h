@@ -262,6 +262,40 @@ typedef std::unique_ptr<uint8_t[]> UInt8Array;
  */
 typedef std::unique_ptr<char[]> CharArray;
 
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Compile-time generated block interleaver permutation tables.
+ *  The interleaver writes the N bits of a block row-wise into COLS columns and transmits them column-wise;
+ *  both directions are held as gather tables for Utils::permuteBits().
+ * @ingroup utils
+ * @tparam N Number of bits in a block.
+ * @tparam COLS Number of interleaver columns.
+ */
+template <uint32_t N, uint32_t COLS>
+struct alignas(64) BlockInterleaveTable {
+    static_assert(N % COLS == 0U, "BlockInterleaveTable, block length must be a multiple of the column count");
+
+    uint16_t deinterleave[N];           //! Transmitted bit position of each deinterleaved bit.
+    uint16_t interleave[N];             //! Deinterleaved bit of each transmitted bit position.
+
+    /**
+     * @brief Initializes a new instance of the BlockInterleaveTable struct.
+     */
+    constexpr BlockInterleaveTable() :
+        deinterleave(),
+        interleave()
+    {
+        for (uint32_t i = 0U; i < N; i++) {
+            uint32_t n = ((i % COLS) * (N / COLS)) + (i / COLS);
+            deinterleave[i] = n;
+            interleave[n] = i;
+        }
+    }
+};
+
 // ---------------------------------------------------------------------------
 //  Class Declaration
 // ---------------------------------------------------------------------------
@@ -394,6 +428,36 @@ public:
      */
     static uint32_t setBitRange(const uint8_t* in, uint8_t* out, uint32_t start, uint32_t length);
 
+    /**
+     * @brief Helper to read an arbitrary length bit field (MSB first) from an input buffer as a single word.
+     * @param in Input buffer.
+     * @param offset Starting bit offset in input buffer to read from.
+     * @param length Number of bits to read (maximum 64).
+     * @returns uint64_t Right-aligned bit field.
+     */
+    static uint64_t readBits(const uint8_t* in, uint32_t offset, uint32_t length);
+    /**
+     * @brief Helper to write an arbitrary length bit field (MSB first) into an output buffer from a single word.
+     *  Bits outside of the written field are preserved.
+     * @param out Output buffer.
+     * @param offset Starting bit offset in output buffer to write to.
+     * @param value Right-aligned bit field to write.
+     * @param length Number of bits to write (maximum 64).
+     */
+    static void writeBits(uint8_t* out, uint32_t offset, uint64_t value, uint32_t length);
+    /**
+     * @brief Helper to gather bits from an input buffer through a permutation table.
+     *  Output bit (outOffset + i) is input bit (inOffset + table[i]); the output is assembled and written
+     *  32 bits at a time, bits outside of the written range are preserved. The buffers must not overlap.
+     * @param in Input buffer.
+     * @param inOffset Bit offset in input buffer the table positions are relative to.
+     * @param out Output buffer.
+     * @param outOffset Starting bit offset in output buffer to write to.
+     * @param table Permutation table (input bit position of each output bit).
+     * @param length Number of bits to permute.
+     */
+    static void permuteBits(const uint8_t* in, uint32_t inOffset, uint8_t* out, uint32_t outOffset, const uint16_t* table, uint32_t length);
+
     /**
      * @brief Helper to convert a binary input buffer into representative 6-bit byte.
      * @param input Input buffer.
@@ -151,6 +151,25 @@ namespace dmr
             return *this;
         }
 
+        /**
+         * @brief Equality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data is the same, otherwise false.
+         */
+        bool operator==(const SiteData& data) const
+        {
+            return m_siteModel == data.m_siteModel &&
+                m_netId == data.m_netId && m_siteId == data.m_siteId &&
+                m_requireReg == data.m_requireReg &&
+                m_netActive == data.m_netActive;
+        }
+        /**
+         * @brief Inequality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data differs, otherwise false.
+         */
+        bool operator!=(const SiteData& data) const { return !(*this == data); }
+
     public:
         /** @name Site Data */
         /**
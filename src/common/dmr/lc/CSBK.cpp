@@ -28,6 +28,7 @@ using namespace dmr::lc;
 bool CSBK::m_verbose = false;
 
 SiteData CSBK::m_siteData = SiteData();
+uint32_t CSBK::m_siteDataVersion = 0U;
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -67,18 +68,15 @@ CSBK::CSBK() :
     m_logicalCh2(DMR_CHNULL),
     m_slotNo(0U),
     m_siteIdenEntry(::lookups::IdenTable()),
-    m_raw(nullptr)
+    m_raw(),
+    m_rawDecoded(false)
 {
     /* stub */
 }
 
 /* Finalizes a instance of the CSBK class. */
 
-CSBK::~CSBK()
-{
-    if (m_raw != nullptr)
-        delete[] m_raw;
-}
+CSBK::~CSBK() = default;
 
 /* Returns a string that represents the current CSBK. */
 
@@ -89,9 +87,21 @@ std::string CSBK::toString()
 
 /* Returns a copy of the raw decoded CSBK bytes. */
 
-uint8_t* CSBK::getDecodedRaw() const
+const uint8_t* CSBK::getDecodedRaw() const
 {
-    return m_raw;
+    return (m_rawDecoded) ? m_raw : nullptr;
+}
+
+/* Sets the local site data. */
+
+void CSBK::setSiteData(SiteData siteData)
+{
+    // both slots share (and push) the same site data; don't invalidate broadcasts for an unchanged push
+    if (siteData == m_siteData)
+        return;
+
+    m_siteData = siteData;
+    m_siteDataVersion++;
 }
 
 /* Regenerate a DMR CSBK without decoding. */
@@ -203,10 +213,9 @@ ulong64_t CSBK::toValue(const uint8_t* payload)
 
 /* Internal helper to convert a 64-bit long value to payload bytes. */
 
-UInt8Array CSBK::fromValue(const ulong64_t value)
+void CSBK::fromValue(const ulong64_t value, uint8_t* payload)
 {
-    UInt8Array payload = std::unique_ptr<uint8_t[]>(new uint8_t[DMR_CSBK_LENGTH_BYTES - 4U]);
-    ::memset(payload.get(), 0x00U, DMR_CSBK_LENGTH_BYTES - 4U);
+    assert(payload != nullptr);
 
     // split ulong64_t (8 byte) value into bytes
     payload[0U] = (uint8_t)((value >> 56) & 0xFFU);
@@ -217,8 +226,6 @@ UInt8Array CSBK::fromValue(const ulong64_t value)
     payload[5U] = (uint8_t)((value >> 16) & 0xFFU);
     payload[6U] = (uint8_t)((value >> 8) & 0xFFU);
     payload[7U] = (uint8_t)((value >> 0) & 0xFFU);
-
-    return payload;
 }
 
 /* Internal helper to decode a control signalling block. */
@@ -275,8 +282,8 @@ bool CSBK::decode(const uint8_t* data, uint8_t* payload)
         Utils::dump(2U, "Decoded CSBK", csbk, DMR_CSBK_LENGTH_BYTES);
     }
 
-    m_raw = new uint8_t[DMR_CSBK_LENGTH_BYTES];
     ::memcpy(m_raw, csbk, DMR_CSBK_LENGTH_BYTES);
+    m_rawDecoded = true;
 
     m_CSBKO = csbk[0U] & 0x3FU;                                                     // CSBKO
     m_lastBlock = (csbk[0U] & 0x80U) == 0x80U;                                      // Last Block Marker
@@ -75,9 +75,9 @@ namespace dmr
             /**
              * @brief Returns a copy of the raw decoded CSBK bytes.
              * This will only return data for a *decoded* CSBK, not a created or copied CSBK.
-             * @returns uint8_t* Raw decoded CSBK bytes.
+             * @returns const uint8_t* Raw decoded CSBK bytes.
              */
-            uint8_t* getDecodedRaw() const;
+            const uint8_t* getDecodedRaw() const;
 
             /**
              * @brief Regenerate a DMR CSBK without decoding.
@@ -109,7 +109,14 @@ namespace dmr
              * @brief Sets the local site data.
              * @param siteData Site data to set for the CSBK class.
              */
-            static void setSiteData(SiteData siteData) { m_siteData = siteData; }
+            static void setSiteData(SiteData siteData);
+            /**
+             * @brief Gets the version of the local site data.
+             *  The version changes whenever the site data changes; pre-encoded broadcasts are only valid for the
+             *  version they were encoded with.
+             * @returns uint32_t Version of the local site data.
+             */
+            static uint32_t getSiteDataVersion() { return m_siteDataVersion; }
             /** @} */
 
         public:
@@ -234,6 +241,7 @@ namespace dmr
 
             // Local Site data
             static SiteData m_siteData;
+            static uint32_t m_siteDataVersion;
 
             /**
              * @brief Internal helper to convert payload bytes to a 64-bit long value.
@@ -244,9 +252,9 @@ namespace dmr
             /**
              * @brief Internal helper to convert a 64-bit long value to payload bytes.
              * @param[in] value 64-bit packed value.
-             * @returns UInt8Array Buffer containing the unpacked payload.
+             * @param[out] payload Buffer to unpack the payload into.
              */
-            static UInt8Array fromValue(const ulong64_t value);
+            static void fromValue(const ulong64_t value, uint8_t* payload);
 
             /**
              * @brief Internal helper to decode a control signalling block.
@@ -264,7 +272,8 @@ namespace dmr
             __PROTECTED_COPY(CSBK);
 
         private:
-            uint8_t* m_raw;
+            uint8_t m_raw[defines::DMR_CSBK_LENGTH_BYTES];
+            bool m_rawDecoded;
         };
     } // namespace lc
 } // namespace dmr
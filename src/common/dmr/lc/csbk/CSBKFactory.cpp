@@ -36,6 +36,24 @@ CSBKFactory::~CSBKFactory() = default;
 /* Create an instance of a CSBK. */
 
 std::unique_ptr<CSBK> CSBKFactory::createCSBK(const uint8_t* data, DataType::E dataType)
+{
+    return std::unique_ptr<CSBK>(create(data, dataType, false));
+}
+
+/* Decode a CSBK into this thread's reusable instance of its type. */
+
+CSBK* CSBKFactory::decodeCSBK(const uint8_t* data, DataType::E dataType)
+{
+    return create(data, dataType, true);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Create (or borrow) and decode an instance of a CSBK. */
+
+CSBK* CSBKFactory::create(const uint8_t* data, DataType::E dataType, bool pooled)
 {
     assert(data != nullptr);
 
@@ -86,34 +104,34 @@ std::unique_ptr<CSBK> CSBKFactory::createCSBK(const uint8_t* data, DataType::E d
 
     switch (CSBKO) {
     case CSBKO::BSDWNACT:
-        return decode(new CSBK_BSDWNACT(), data);
+        return decode(instance<CSBK_BSDWNACT>(pooled), data, pooled);
     case CSBKO::UU_V_REQ:
-        return decode(new CSBK_UU_V_REQ(), data);
+        return decode(instance<CSBK_UU_V_REQ>(pooled), data, pooled);
     case CSBKO::UU_ANS_RSP:
-        return decode(new CSBK_UU_ANS_RSP(), data);
+        return decode(instance<CSBK_UU_ANS_RSP>(pooled), data, pooled);
     case CSBKO::PRECCSBK:
-        return decode(new CSBK_PRECCSBK(), data);
+        return decode(instance<CSBK_PRECCSBK>(pooled), data, pooled);
     case CSBKO::RAND: // CSBKO::CALL_ALRT when FID == FID_DMRA
         switch (FID)
         {
         case FID_DMRA:
-            return decode(new CSBK_CALL_ALRT(), data);
+            return decode(instance<CSBK_CALL_ALRT>(pooled), data, pooled);
         case FID_ETSI:
         default:
-            return decode(new CSBK_RAND(), data);
+            return decode(instance<CSBK_RAND>(pooled), data, pooled);
         }
     case CSBKO::EXT_FNCT:
-        return decode(new CSBK_EXT_FNCT(), data);
+        return decode(instance<CSBK_EXT_FNCT>(pooled), data, pooled);
     case CSBKO::NACK_RSP:
-        return decode(new CSBK_NACK_RSP(), data);
+        return decode(instance<CSBK_NACK_RSP>(pooled), data, pooled);
 
     /** Tier 3 */
     case CSBKO::ACK_RSP:
-        return decode(new CSBK_ACK_RSP(), data);
+        return decode(instance<CSBK_ACK_RSP>(pooled), data, pooled);
     case CSBKO::BROADCAST:
-        return decode(new CSBK_BROADCAST(), data);
+        return decode(instance<CSBK_BROADCAST>(pooled), data, pooled);
     case CSBKO::MAINT:
-        return decode(new CSBK_MAINT(), data);
+        return decode(instance<CSBK_MAINT>(pooled), data, pooled);
 
     default:
         LogError(LOG_DMR, "CSBKFactory::create(), unknown CSBK type, csbko = $%02X", CSBKO);
@@ -123,20 +141,18 @@ std::unique_ptr<CSBK> CSBKFactory::createCSBK(const uint8_t* data, DataType::E d
     return nullptr;
 }
 
-// ---------------------------------------------------------------------------
-//  Private Class Members
-// ---------------------------------------------------------------------------
-
 /* Decode a CSBK. */
 
-std::unique_ptr<CSBK> CSBKFactory::decode(CSBK* csbk, const uint8_t* data)
+CSBK* CSBKFactory::decode(CSBK* csbk, const uint8_t* data, bool pooled)
 {
     assert(csbk != nullptr);
     assert(data != nullptr);
 
     if (!csbk->decode(data)) {
+        if (!pooled)
+            delete csbk;
         return nullptr;
     }
 
-    return std::unique_ptr<CSBK>(csbk);
+    return csbk;
 }
@@ -24,6 +24,7 @@
 #define  __DMR_LC__CSBK_FACTORY_H__
 
 #include "common/Defines.h"
+#include "common/MessagePool.h"
 
 #include "common/dmr/DMRDefines.h"
 #include "common/dmr/lc/CSBK.h"
@@ -79,15 +80,43 @@ namespace dmr
                  * @returns CSBK* Instance of a CSBK representing the decoded data.
                  */
                 static std::unique_ptr<CSBK> createCSBK(const uint8_t* data, defines::DataType::E dataType);
+                /**
+                 * @brief Decode a CSBK into this thread's reusable instance of its type.
+                 *
+                 *  No memory is allocated; the returned CSBK is borrowed and only remains valid until this
+                 *  thread next decodes a CSBK of the same type. It must not be deleted or retained.
+                 * @param[in] data Buffer containing CSBK packet data to decode.
+                 * @param dataType Data Type.
+                 * @returns CSBK* Borrowed instance of a CSBK representing the decoded data.
+                 */
+                static CSBK* decodeCSBK(const uint8_t* data, defines::DataType::E dataType);
 
             private:
+                /**
+                 * @brief Helper to allocate (or borrow) an instance of a CSBK type.
+                 * @tparam T CSBK type.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 * @returns CSBK* Instance of the CSBK type.
+                 */
+                template<class T>
+                static CSBK* instance(bool pooled) { return (pooled) ? MessagePool<T>::borrow() : new T(); }
+
+                /**
+                 * @brief Create (or borrow) and decode an instance of a CSBK.
+                 * @param[in] data Buffer containing CSBK packet data to decode.
+                 * @param dataType Data Type.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 * @returns CSBK* Instance of a CSBK representing the decoded data.
+                 */
+                static CSBK* create(const uint8_t* data, defines::DataType::E dataType, bool pooled);
                 /**
                  * @brief Decode a CSBK.
                  * @param csbk Instance of a CSBK.
                  * @param[in] data Buffer containing CSBK packet data to decode.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
                  * @returns CSBK* Instance of a CSBK representing the decoded data.
                  */
-                static std::unique_ptr<CSBK> decode(CSBK* csbk, const uint8_t* data);
+                static CSBK* decode(CSBK* csbk, const uint8_t* data, bool pooled);
             };
         } // namespace csbk
     } // namespace lc
@@ -155,8 +155,9 @@ void CSBK_BROADCAST::encode(uint8_t* data)
         break;
     }
 
-    std::unique_ptr<uint8_t[]> csbk = CSBK::fromValue(csbkValue);
-    CSBK::encode(data, csbk.get());
+    uint8_t csbk[DMR_CSBK_LENGTH_BYTES - 4U];
+    CSBK::fromValue(csbkValue, csbk);
+    CSBK::encode(data, csbk);
 }
 
 /* Returns a string that represents the current CSBK. */
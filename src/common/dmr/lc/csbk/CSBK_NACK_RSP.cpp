@@ -68,8 +68,9 @@ void CSBK_NACK_RSP::encode(uint8_t* data)
     csbkValue = (csbkValue << 24) + m_srcId;                                        // Source Radio Address
     csbkValue = (csbkValue << 24) + m_dstId;                                        // Target Radio Address
 
-    std::unique_ptr<uint8_t[]> csbk = CSBK::fromValue(csbkValue);
-    CSBK::encode(data, csbk.get());
+    uint8_t csbk[DMR_CSBK_LENGTH_BYTES - 4U];
+    CSBK::fromValue(csbkValue, csbk);
+    CSBK::encode(data, csbk);
 }
 
 /* Returns a string that represents the current CSBK. */
@@ -55,8 +55,9 @@ void CSBK_PD_GRANT::encode(uint8_t* data)
     csbkValue = (csbkValue << 24) + m_dstId;                                        // Talkgroup ID
     csbkValue = (csbkValue << 24) + m_srcId;                                        // Source Radio Address
 
-    std::unique_ptr<uint8_t[]> csbk = CSBK::fromValue(csbkValue);
-    CSBK::encode(data, csbk.get());
+    uint8_t csbk[DMR_CSBK_LENGTH_BYTES - 4U];
+    CSBK::fromValue(csbkValue, csbk);
+    CSBK::encode(data, csbk);
 }
 
 /* Returns a string that represents the current CSBK. */
@@ -6,21 +6,244 @@
  *
  *  Copyright (C) 2010,2014,2016,2021 Jonathan Naylor, G4KLX
  *  Copyright (C) 2016 Mathias Weyland, HB9FRV
- *  Copyright (C) 2018-2022 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2018-2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
 #include "edac/AMBEFEC.h"
 #include "edac/Golay24128.h"
-#include "edac/Hamming.h"
 #include "Log.h"
 #include "Utils.h"
 
 using namespace edac;
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/*
+** The IMBE interleaver moves every deinterleaved bit i (row i / 24, column i % 24) to the same spot
+** of a 24 bit group; group n holding columns 4n - 4n+3 of every row. A group (3 bytes) is therefore
+** deinterleaved by byte lookups into six row nibbles, and interleaved again by the inverse lookups.
+*/
+
+const uint32_t IMBE_ROWS = 6U;
+const uint32_t IMBE_GROUPS = 6U;
+
+/* Offset and length of the deinterleaved IMBE code words. */
+const uint32_t IMBE_GOLAY_START = 0U;
+const uint32_t IMBE_GOLAY_STOP = 92U;
+const uint32_t IMBE_GOLAY_LENGTH = 23U;
+const uint32_t IMBE_HAMMING_STOP = 137U;
+const uint32_t IMBE_HAMMING_LENGTH = 15U;
+
+/* The PN sequence covers deinterleaved bits 23 - 136, which all fall into bytes 2 - 17. */
+const uint32_t IMBE_PN_START = 2U;
+const uint32_t IMBE_PN_LENGTH = 16U;
+
+/* Hamming (15,11,3) syndrome contributed by each bit of a c4 - c6 code word (first bit first). */
+const uint8_t IMBE_HAMMING_15113_H[] = { 0x0FU, 0x07U, 0x0BU, 0x03U, 0x0DU, 0x05U, 0x09U, 0x0EU, 0x06U, 0x0AU, 0x0CU, 0x01U, 0x02U, 0x04U, 0x08U };
+
+/*
+** An AMBE frame is 72 bits; frame bit p belongs to lane p % 4. The A word is lane 0 followed by the
+** first 6 bits of lane 1, B is the rest of lane 1 followed by the first 11 bits of lane 2, and C
+** is the rest of lane 2 followed by lane 3 (see AMBE_A_TABLE, AMBE_B_TABLE and AMBE_C_TABLE).
+*/
+
+const uint32_t AMBE_FRAME_LENGTH_BYTES = 9U;
+const uint32_t AMBE_LANE_MASK = 0x3FFFFU;
+
+/**
+ * @brief Compile-time generated lookup tables for the AMBE/IMBE FEC.
+ */
+struct alignas(64) AMBEFECTables {
+    uint32_t imbeDeinterleave[3U][256U];    //! Row nibbles for each byte of an interleaved IMBE group.
+    uint32_t imbeInterleave[3U][256U];      //! Interleaved IMBE group bits for each byte of the row nibbles.
+    uint8_t imbePN[4096U][16U];             //! PN whitening bytes (2 - 17) for each c0 data value.
+    uint8_t hammingSyndromeHi[128U];        //! Hamming (15,11,3) syndrome for bits 14 - 8 of a code word.
+    uint8_t hammingSyndromeLo[256U];        //! Hamming (15,11,3) syndrome for bits 7 - 0 of a code word.
+    uint16_t hammingCorrect[16U];           //! Code word bit to flip for a given Hamming (15,11,3) syndrome.
+    uint8_t ambeLanes[256U];                //! 2 bits of each AMBE lane (lane 0 highest) for a frame byte.
+    uint8_t ambeUnlanes[256U];              //! Frame byte for 2 bits of each AMBE lane.
+
+    /**
+     * @brief Initializes a new instance of the AMBEFECTables struct.
+     */
+    constexpr AMBEFECTables() :
+        imbeDeinterleave(),
+        imbeInterleave(),
+        imbePN(),
+        hammingSyndromeHi(),
+        hammingSyndromeLo(),
+        hammingCorrect(),
+        ambeLanes(),
+        ambeUnlanes()
+    {
+        // the first group of the interleaved frame (bit 23 of a group is interleaved bit 0)
+        uint32_t groupBit[24U] = { };
+        for (uint32_t i = 0U; i < 144U; i++) {
+            uint32_t pos = IMBE_INTERLEAVE[i];
+            if (pos < 24U)
+                groupBit[(4U * (IMBE_ROWS - 1U - (i / 24U))) + (3U - (i % 24U))] = 23U - pos;
+        }
+
+        for (uint32_t n = 0U; n < 24U; n++) {
+            uint32_t from = 2U - (groupBit[n] >> 3);
+            uint32_t to = 2U - (n >> 3);
+            for (uint32_t v = 0U; v < 256U; v++) {
+                if ((v & (1U << (groupBit[n] & 7U))) != 0U)
+                    imbeDeinterleave[from][v] |= 1U << n;
+                if ((v & (1U << (n & 7U))) != 0U)
+                    imbeInterleave[to][v] |= 1U << groupBit[n];
+            }
+        }
+
+        for (uint32_t c0 = 0U; c0 < 4096U; c0++) {
+            uint32_t p = 16U * c0;
+            for (uint32_t i = 0U; i < 114U; i++) {
+                p = (173U * p + 13849U) % 65536U;
+                if (p >= 32768U) {
+                    uint32_t n = IMBE_GOLAY_LENGTH + i - (IMBE_PN_START * 8U);
+                    imbePN[c0][n >> 3] |= (uint8_t)(0x80U >> (n & 7U));
+                }
+            }
+        }
+
+        for (uint32_t v = 0U; v < 256U; v++) {
+            for (uint32_t b = 0U; b < 8U; b++) {
+                if (b < 7U && (v & (0x40U >> b)) != 0U && v < 128U)
+                    hammingSyndromeHi[v] ^= IMBE_HAMMING_15113_H[b];
+                if ((v & (0x80U >> b)) != 0U)
+                    hammingSyndromeLo[v] ^= IMBE_HAMMING_15113_H[7U + b];
+            }
+        }
+
+        for (uint32_t b = 0U; b < 15U; b++)
+            hammingCorrect[IMBE_HAMMING_15113_H[b]] = (uint16_t)(0x4000U >> b);
+
+        for (uint32_t v = 0U; v < 256U; v++) {
+            uint32_t lanes = 0U;
+            for (uint32_t b = 0U; b < 8U; b++) {
+                if ((v & (0x80U >> b)) != 0U)
+                    lanes |= 1U << ((2U * (3U - (b & 3U))) + (1U - (b >> 2)));
+            }
+
+            ambeLanes[v] = (uint8_t)lanes;
+            ambeUnlanes[lanes] = (uint8_t)v;
+        }
+    }
+};
+
+static constexpr AMBEFECTables AMBEFEC_TABLES{};
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to deinterleave a IMBE frame into its 6 rows (3 bytes each). */
+
+static void deinterleaveIMBE(const uint8_t* in, uint8_t* out)
+{
+    uint32_t rows[IMBE_ROWS] = { 0U, 0U, 0U, 0U, 0U, 0U };
+
+    for (uint32_t n = 0U; n < IMBE_GROUPS; n++, in += 3U) {
+        uint32_t nibbles = AMBEFEC_TABLES.imbeDeinterleave[0U][in[0U]] | AMBEFEC_TABLES.imbeDeinterleave[1U][in[1U]] |
+            AMBEFEC_TABLES.imbeDeinterleave[2U][in[2U]];
+        for (uint32_t r = 0U; r < IMBE_ROWS; r++)
+            rows[r] = (rows[r] << 4) | ((nibbles >> (20U - (4U * r))) & 0x0FU);
+    }
+
+    for (uint32_t r = 0U; r < IMBE_ROWS; r++, out += 3U) {
+        out[0U] = (uint8_t)(rows[r] >> 16);
+        out[1U] = (uint8_t)(rows[r] >> 8);
+        out[2U] = (uint8_t)(rows[r] >> 0);
+    }
+}
+
+/* Helper to interleave the 6 rows (3 bytes each) of a IMBE frame. */
+
+static void interleaveIMBE(const uint8_t* in, uint8_t* out)
+{
+    uint32_t rows[IMBE_ROWS];
+    for (uint32_t r = 0U; r < IMBE_ROWS; r++, in += 3U)
+        rows[r] = (in[0U] << 16) | (in[1U] << 8) | (in[2U] << 0);
+
+    for (uint32_t n = 0U; n < IMBE_GROUPS; n++, out += 3U) {
+        uint32_t nibbles = 0U;
+        for (uint32_t r = 0U; r < IMBE_ROWS; r++)
+            nibbles |= ((rows[r] >> (20U - (4U * n))) & 0x0FU) << (20U - (4U * r));
+
+        uint32_t group = AMBEFEC_TABLES.imbeInterleave[0U][(nibbles >> 16) & 0xFFU] | AMBEFEC_TABLES.imbeInterleave[1U][(nibbles >> 8) & 0xFFU] |
+            AMBEFEC_TABLES.imbeInterleave[2U][nibbles & 0xFFU];
+        out[0U] = (uint8_t)(group >> 16);
+        out[1U] = (uint8_t)(group >> 8);
+        out[2U] = (uint8_t)(group >> 0);
+    }
+}
+
+/* Helper to split a AMBE frame into its A, B and C words. */
+
+static void unpackAMBE(const uint8_t* in, uint32_t& a, uint32_t& b, uint32_t& c)
+{
+    uint32_t l0 = 0U, l1 = 0U, l2 = 0U, l3 = 0U;
+    for (uint32_t i = 0U; i < AMBE_FRAME_LENGTH_BYTES; i++) {
+        uint32_t lanes = AMBEFEC_TABLES.ambeLanes[in[i]];
+        l0 = (l0 << 2) | ((lanes >> 6) & 0x03U);
+        l1 = (l1 << 2) | ((lanes >> 4) & 0x03U);
+        l2 = (l2 << 2) | ((lanes >> 2) & 0x03U);
+        l3 = (l3 << 2) | ((lanes >> 0) & 0x03U);
+    }
+
+    a = (l0 << 6) | (l1 >> 12);
+    b = ((l1 & 0xFFFU) << 11) | (l2 >> 7);
+    c = ((l2 & 0x7FU) << 18) | l3;
+}
+
+/* Helper to join the A, B and C words back into a AMBE frame. */
+
+static void packAMBE(uint8_t* out, uint32_t a, uint32_t b, uint32_t c)
+{
+    uint32_t l0 = (a >> 6) & AMBE_LANE_MASK;
+    uint32_t l1 = ((a & 0x3FU) << 12) | ((b >> 11) & 0xFFFU);
+    uint32_t l2 = ((b & 0x7FFU) << 7) | ((c >> 18) & 0x7FU);
+    uint32_t l3 = c & AMBE_LANE_MASK;
+
+    for (uint32_t i = 0U; i < AMBE_FRAME_LENGTH_BYTES; i++) {
+        uint32_t shift = 16U - (2U * i);
+        uint32_t lanes = (((l0 >> shift) & 0x03U) << 6) | (((l1 >> shift) & 0x03U) << 4) |
+            (((l2 >> shift) & 0x03U) << 2) | ((l3 >> shift) & 0x03U);
+        out[i] = AMBEFEC_TABLES.ambeUnlanes[lanes];
+    }
+}
+
+/* Helper to gather the three AMBE frames of a DMR voice burst. */
+
+static void gatherDMR(const uint8_t* bytes, uint8_t* frames)
+{
+    // the second frame is split by the 48 bit sync (or embedded signalling) in the middle of the burst
+    ::memcpy(frames, bytes, AMBE_FRAME_LENGTH_BYTES);
+    ::memcpy(frames + 9U, bytes + 9U, 4U);
+    frames[13U] = (bytes[13U] & 0xF0U) | (bytes[19U] & 0x0FU);
+    ::memcpy(frames + 14U, bytes + 20U, 4U);
+    ::memcpy(frames + 18U, bytes + 24U, AMBE_FRAME_LENGTH_BYTES);
+}
+
+/* Helper to scatter the three AMBE frames of a DMR voice burst. */
+
+static void scatterDMR(const uint8_t* frames, uint8_t* bytes)
+{
+    ::memcpy(bytes, frames, AMBE_FRAME_LENGTH_BYTES);
+    ::memcpy(bytes + 9U, frames + 9U, 4U);
+    bytes[13U] = (bytes[13U] & 0x0FU) | (frames[13U] & 0xF0U);
+    bytes[19U] = (bytes[19U] & 0xF0U) | (frames[13U] & 0x0FU);
+    ::memcpy(bytes + 20U, frames + 14U, 4U);
+    ::memcpy(bytes + 24U, frames + 18U, AMBE_FRAME_LENGTH_BYTES);
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -37,104 +260,35 @@ AMBEFEC::~AMBEFEC() = default;
 
 uint32_t AMBEFEC::regenerateDMR(uint8_t* bytes) const
 {
-    assert(bytes != nullptr);
+    return regenerateDMR(bytes, nullptr);
+}
 
-    uint32_t a1 = 0U, a2 = 0U, a3 = 0U;
-    uint32_t b1 = 0U, b2 = 0U, b3 = 0U;
-    uint32_t c1 = 0U, c2 = 0U, c3 = 0U;
-
-    uint32_t MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t a1Pos = AMBE_A_TABLE[i];
-        uint32_t a2Pos = a1Pos + 72U;
-        if (a2Pos >= 108U)
-            a2Pos += 48U;
-        uint32_t a3Pos = a1Pos + 192U;
-
-        if (READ_BIT(bytes, a1Pos))
-            a1 |= MASK;
-        if (READ_BIT(bytes, a2Pos))
-            a2 |= MASK;
-        if (READ_BIT(bytes, a3Pos))
-            a3 |= MASK;
-    }
+/* Regenerates the DMR AMBE FEC for all three AMBE frames of a DMR voice burst. */
 
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t b1Pos = AMBE_B_TABLE[i];
-        uint32_t b2Pos = b1Pos + 72U;
-        if (b2Pos >= 108U)
-            b2Pos += 48U;
-        uint32_t b3Pos = b1Pos + 192U;
-
-        if (READ_BIT(bytes, b1Pos))
-            b1 |= MASK;
-        if (READ_BIT(bytes, b2Pos))
-            b2 |= MASK;
-        if (READ_BIT(bytes, b3Pos))
-            b3 |= MASK;
-    }
+uint32_t AMBEFEC::regenerateDMR(uint8_t* bytes, uint32_t* errors) const
+{
+    assert(bytes != nullptr);
 
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t c1Pos = AMBE_C_TABLE[i];
-        uint32_t c2Pos = c1Pos + 72U;
-        if (c2Pos >= 108U)
-            c2Pos += 48U;
-        uint32_t c3Pos = c1Pos + 192U;
-
-        if (READ_BIT(bytes, c1Pos))
-            c1 |= MASK;
-        if (READ_BIT(bytes, c2Pos))
-            c2 |= MASK;
-        if (READ_BIT(bytes, c3Pos))
-            c3 |= MASK;
-    }
+    uint8_t frames[DMR_AMBE_FRAMES * AMBE_FRAME_LENGTH_BYTES];
+    gatherDMR(bytes, frames);
 
-    uint32_t errors = regenerate(a1, b1, c1);
-    errors += regenerate(a2, b2, c2);
-    errors += regenerate(a3, b3, c3);
-
-    MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t a1Pos = AMBE_A_TABLE[i];
-        uint32_t a2Pos = a1Pos + 72U;
-        if (a2Pos >= 108U)
-            a2Pos += 48U;
-        uint32_t a3Pos = a1Pos + 192U;
-
-        WRITE_BIT(bytes, a1Pos, a1 & MASK);
-        WRITE_BIT(bytes, a2Pos, a2 & MASK);
-        WRITE_BIT(bytes, a3Pos, a3 & MASK);
-    }
+    uint32_t total = 0U;
+    for (uint32_t n = 0U; n < DMR_AMBE_FRAMES; n++) {
+        uint8_t* frame = frames + (n * AMBE_FRAME_LENGTH_BYTES);
 
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t b1Pos = AMBE_B_TABLE[i];
-        uint32_t b2Pos = b1Pos + 72U;
-        if (b2Pos >= 108U)
-            b2Pos += 48U;
-        uint32_t b3Pos = b1Pos + 192U;
-
-        WRITE_BIT(bytes, b1Pos, b1 & MASK);
-        WRITE_BIT(bytes, b2Pos, b2 & MASK);
-        WRITE_BIT(bytes, b3Pos, b3 & MASK);
-    }
+        uint32_t a, b, c;
+        unpackAMBE(frame, a, b, c);
 
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t c1Pos = AMBE_C_TABLE[i];
-        uint32_t c2Pos = c1Pos + 72U;
-        if (c2Pos >= 108U)
-            c2Pos += 48U;
-        uint32_t c3Pos = c1Pos + 192U;
-
-        WRITE_BIT(bytes, c1Pos, c1 & MASK);
-        WRITE_BIT(bytes, c2Pos, c2 & MASK);
-        WRITE_BIT(bytes, c3Pos, c3 & MASK);
+        uint32_t errs = regenerate(a, b, c);
+        if (errors != nullptr)
+            errors[n] = errs;
+        total += errs;
+
+        packAMBE(frame, a, b, c);
     }
 
-    return errors;
+    scatterDMR(frames, bytes);
+    return total;
 }
 
 /* Returns the number of errors on the DMR BER input bytes. */
@@ -143,62 +297,16 @@ uint32_t AMBEFEC::measureDMRBER(const uint8_t* bytes) const
 {
     assert(bytes != nullptr);
 
-    uint32_t a1 = 0U, a2 = 0U, a3 = 0U;
-    uint32_t b1 = 0U, b2 = 0U, b3 = 0U;
-    uint32_t c1 = 0U, c2 = 0U, c3 = 0U;
-
-    uint32_t MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t a1Pos = AMBE_A_TABLE[i];
-        uint32_t a2Pos = a1Pos + 72U;
-        if (a2Pos >= 108U)
-            a2Pos += 48U;
-        uint32_t a3Pos = a1Pos + 192U;
-
-        if (READ_BIT(bytes, a1Pos))
-            a1 |= MASK;
-        if (READ_BIT(bytes, a2Pos))
-            a2 |= MASK;
-        if (READ_BIT(bytes, a3Pos))
-            a3 |= MASK;
-    }
-
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t b1Pos = AMBE_B_TABLE[i];
-        uint32_t b2Pos = b1Pos + 72U;
-        if (b2Pos >= 108U)
-            b2Pos += 48U;
-        uint32_t b3Pos = b1Pos + 192U;
-
-        if (READ_BIT(bytes, b1Pos))
-            b1 |= MASK;
-        if (READ_BIT(bytes, b2Pos))
-            b2 |= MASK;
-        if (READ_BIT(bytes, b3Pos))
-            b3 |= MASK;
-    }
+    uint8_t frames[DMR_AMBE_FRAMES * AMBE_FRAME_LENGTH_BYTES];
+    gatherDMR(bytes, frames);
 
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t c1Pos = AMBE_C_TABLE[i];
-        uint32_t c2Pos = c1Pos + 72U;
-        if (c2Pos >= 108U)
-            c2Pos += 48U;
-        uint32_t c3Pos = c1Pos + 192U;
-
-        if (READ_BIT(bytes, c1Pos))
-            c1 |= MASK;
-        if (READ_BIT(bytes, c2Pos))
-            c2 |= MASK;
-        if (READ_BIT(bytes, c3Pos))
-            c3 |= MASK;
+    uint32_t errors = 0U;
+    for (uint32_t n = 0U; n < DMR_AMBE_FRAMES; n++) {
+        uint32_t a, b, c;
+        unpackAMBE(frames + (n * AMBE_FRAME_LENGTH_BYTES), a, b, c);
+        errors += regenerate(a, b, c);
     }
 
-    uint32_t errors = regenerate(a1, b1, c1);
-    errors += regenerate(a2, b2, c2);
-    errors += regenerate(a3, b3, c3);
-
     return errors;
 }
 
@@ -208,150 +316,77 @@ uint32_t AMBEFEC::regenerateIMBE(uint8_t* bytes) const
 {
     assert(bytes != nullptr);
 
-    bool orig[144U];
-    bool temp[144U];
+    return processIMBE(bytes, bytes);
+}
 
-    // De-interleave
-    for (uint32_t i = 0U; i < 144U; i++) {
-        uint32_t n = IMBE_INTERLEAVE[i];
-        orig[i] = temp[i] = READ_BIT(bytes, n);
-    }
+/* Regenerates the P25 IMBE FEC for a run of consecutive IMBE frames. */
 
-    // now ..
+uint32_t AMBEFEC::regenerateIMBE(uint8_t* bytes, uint32_t count, uint32_t* errors) const
+{
+    assert(bytes != nullptr);
 
-    // 12 voice bits     0
-    // 11 golay bits     12
-    //
-    // 12 voice bits     23
-    // 11 golay bits     35
-    //
-    // 12 voice bits     46
-    // 11 golay bits     58
-    //
-    // 12 voice bits     69
-    // 11 golay bits     81
-    //
-    // 11 voice bits     92
-    //  4 hamming bits   103
-    //
-    // 11 voice bits     107
-    //  4 hamming bits   118
-    //
-    // 11 voice bits     122
-    //  4 hamming bits   133
-    //
-    //  7 voice bits     137
+    uint32_t total = 0U;
+    for (uint32_t n = 0U; n < count; n++, bytes += IMBE_FEC_LENGTH_BYTES) {
+        uint32_t errs = processIMBE(bytes, bytes);
+        if (errors != nullptr)
+            errors[n] = errs;
+        total += errs;
+    }
 
-    // Process the c0 section first to allow the de-whitening to be accurate
+    return total;
+}
 
-    // Check/Fix FEC
-    bool* bit = temp;
+/* Returns the number of errors on the P25 BER input bytes. */
 
-    // c0
-    uint32_t g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c0data = Golay24128::decode23127(g1);
-    uint32_t g2 = Golay24128::encode23127(c0data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
+uint32_t AMBEFEC::measureP25BER(const uint8_t* bytes) const
+{
+    assert(bytes != nullptr);
 
-    bool prn[114U];
+    return processIMBE(bytes, nullptr);
+}
 
-    // Create the whitening vector and save it for future use
-    uint32_t p = 16U * c0data;
-    for (uint32_t i = 0U; i < 114U; i++) {
-        p = (173U * p + 13849U) % 65536U;
-        prn[i] = p >= 32768U;
-    }
+/* Regenerates the NXDN AMBE FEC for the input bytes. */
 
-    // De-whiten some bits
-    for (uint32_t i = 0U; i < 114U; i++)
-        temp[i + 23U] ^= prn[i];
-
-    // c1
-    g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c1data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c1data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
-
-    // c2
-    g1 = 0;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c2data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c2data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
-
-    // c3
-    g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c3data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c3data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
+uint32_t AMBEFEC::regenerateNXDN(uint8_t* bytes) const
+{
+    assert(bytes != nullptr);
 
-    // c4
-    Hamming::decode15113_1(bit);
-    bit += 15U;
+    uint32_t a, b, c;
+    unpackAMBE(bytes, a, b, c);
 
-    // c5
-    Hamming::decode15113_1(bit);
-    bit += 15U;
+    uint32_t errors = regenerate(a, b, c);
 
-    // c6
-    Hamming::decode15113_1(bit);
+    packAMBE(bytes, a, b, c);
+    return errors;
+}
 
-    // Whiten some bits
-    for (uint32_t i = 0U; i < 114U; i++)
-        temp[i + 23U] ^= prn[i];
+/* Returns the number of errors on the NXDN BER input bytes. */
 
-    uint32_t errors = 0U;
-    for (uint32_t i = 0U; i < 144U; i++) {
-        if (orig[i] != temp[i])
-            errors++;
-    }
+uint32_t AMBEFEC::measureNXDNBER(uint8_t* bytes) const
+{
+    assert(bytes != nullptr);
 
-    // Interleave
-    for (uint32_t i = 0U; i < 144U; i++) {
-        uint32_t n = IMBE_INTERLEAVE[i];
-        WRITE_BIT(bytes, n, temp[i]);
-    }
+    uint32_t a, b, c;
+    unpackAMBE(bytes, a, b, c);
 
+    uint32_t errors = regenerate(a, b, c);
     return errors;
 }
 
-/* Returns the number of errors on the P25 BER input bytes. */
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
 
-uint32_t AMBEFEC::measureP25BER(const uint8_t* bytes) const
-{
-    assert(bytes != nullptr);
+/* Regenerates the P25 IMBE FEC for a single IMBE frame. */
 
-    bool orig[144U];
-    bool temp[144U];
+uint32_t AMBEFEC::processIMBE(const uint8_t* in, uint8_t* out) const
+{
+    uint8_t orig[IMBE_FEC_LENGTH_BYTES];
+    uint8_t temp[IMBE_FEC_LENGTH_BYTES];
 
     // De-interleave
-    for (uint32_t i = 0U; i < 144U; i++) {
-        uint32_t n = IMBE_INTERLEAVE[i];
-        orig[i] = temp[i] = READ_BIT(bytes, n);
-    }
+    deinterleaveIMBE(in, orig);
+    ::memcpy(temp, orig, IMBE_FEC_LENGTH_BYTES);
 
     // now ..
 
@@ -380,185 +415,44 @@ uint32_t AMBEFEC::measureP25BER(const uint8_t* bytes) const
 
     // Process the c0 section first to allow the de-whitening to be accurate
 
-    // Check/Fix FEC
-    bool* bit = temp;
-
     // c0
-    uint32_t g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c0data = Golay24128::decode23127(g1);
-    uint32_t g2 = Golay24128::encode23127(c0data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
+    uint32_t c0data = Golay24128::decode23127((uint32_t)Utils::readBits(temp, IMBE_GOLAY_START, IMBE_GOLAY_LENGTH));
+    Utils::writeBits(temp, IMBE_GOLAY_START, Golay24128::encode23127(c0data) >> 1, IMBE_GOLAY_LENGTH);
 
-    bool prn[114U];
+    // De-whiten some bits
+    const uint8_t* prn = AMBEFEC_TABLES.imbePN[c0data & 0xFFFU];
+    for (uint32_t i = 0U; i < IMBE_PN_LENGTH; i++)
+        temp[IMBE_PN_START + i] ^= prn[i];
 
-    // Create the whitening vector and save it for future use
-    uint32_t p = 16U * c0data;
-    for (uint32_t i = 0U; i < 114U; i++) {
-        p = (173U * p + 13849U) % 65536U;
-        prn[i] = p >= 32768U;
+    // c1 - c3
+    for (uint32_t offset = IMBE_GOLAY_LENGTH; offset < IMBE_GOLAY_STOP; offset += IMBE_GOLAY_LENGTH) {
+        uint32_t data = Golay24128::decode23127((uint32_t)Utils::readBits(temp, offset, IMBE_GOLAY_LENGTH));
+        Utils::writeBits(temp, offset, Golay24128::encode23127(data) >> 1, IMBE_GOLAY_LENGTH);
     }
 
-    // De-whiten some bits
-    for (uint32_t i = 0U; i < 114U; i++)
-        temp[i + 23U] ^= prn[i];
-
-    // c1
-    g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c1data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c1data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
-
-    // c2
-    g1 = 0;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c2data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c2data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
-    }
-    bit += 23U;
-
-    // c3
-    g1 = 0U;
-    for (uint32_t i = 0U; i < 23U; i++)
-        g1 = (g1 << 1) | (bit[i] ? 0x01U : 0x00U);
-    uint32_t c3data = Golay24128::decode23127(g1);
-    g2 = Golay24128::encode23127(c3data);
-    for (int i = 23; i >= 0; i--) {
-        bit[i] = (g2 & 0x01U) == 0x01U;
-        g2 >>= 1;
+    // c4 - c6
+    for (uint32_t offset = IMBE_GOLAY_STOP; offset < IMBE_HAMMING_STOP; offset += IMBE_HAMMING_LENGTH) {
+        uint32_t code = (uint32_t)Utils::readBits(temp, offset, IMBE_HAMMING_LENGTH);
+        uint8_t syndrome = AMBEFEC_TABLES.hammingSyndromeHi[code >> 8] ^ AMBEFEC_TABLES.hammingSyndromeLo[code & 0xFFU];
+        if (syndrome != 0U)
+            Utils::writeBits(temp, offset, code ^ AMBEFEC_TABLES.hammingCorrect[syndrome], IMBE_HAMMING_LENGTH);
     }
-    bit += 23U;
-
-    // c4
-    Hamming::decode15113_1(bit);
-    bit += 15U;
-
-    // c5
-    Hamming::decode15113_1(bit);
-    bit += 15U;
-
-    // c6
-    Hamming::decode15113_1(bit);
 
     // Whiten some bits
-    for (uint32_t i = 0U; i < 114U; i++)
-        temp[i + 23U] ^= prn[i];
+    for (uint32_t i = 0U; i < IMBE_PN_LENGTH; i++)
+        temp[IMBE_PN_START + i] ^= prn[i];
 
     uint32_t errors = 0U;
-    for (uint32_t i = 0U; i < 144U; i++) {
-        if (orig[i] != temp[i])
-            errors++;
-    }
-
-    return errors;
-}
-
-/* Regenerates the NXDN AMBE FEC for the input bytes. */
-
-uint32_t AMBEFEC::regenerateNXDN(uint8_t* bytes) const
-{
-    assert(bytes != nullptr);
-
-    uint32_t a = 0U;
-    uint32_t MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t aPos = AMBE_A_TABLE[i];
-        if (READ_BIT(bytes, aPos))
-            a |= MASK;
-    }
-
-    uint32_t b = 0U;
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t bPos = AMBE_B_TABLE[i];
-        if (READ_BIT(bytes, bPos))
-            b |= MASK;
-    }
-
-    uint32_t c = 0U;
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t cPos = AMBE_C_TABLE[i];
-        if (READ_BIT(bytes, cPos))
-            c |= MASK;
-    }
-
-    uint32_t errors = regenerate(a, b, c);
+    for (uint32_t i = 0U; i < IMBE_FEC_LENGTH_BYTES; i++)
+        errors += Utils::countBits8(orig[i] ^ temp[i]);
 
-    MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t aPos = AMBE_A_TABLE[i];
-        WRITE_BIT(bytes, aPos, a & MASK);
-    }
-
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t bPos = AMBE_B_TABLE[i];
-        WRITE_BIT(bytes, bPos, b & MASK);
-    }
-
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t cPos = AMBE_C_TABLE[i];
-        WRITE_BIT(bytes, cPos, c & MASK);
-    }
-
-    return errors;
-}
-
-/* Returns the number of errors on the NXDN BER input bytes. */
-
-uint32_t AMBEFEC::measureNXDNBER(uint8_t* bytes) const
-{
-    assert(bytes != nullptr);
-
-    uint32_t a = 0U;
-    uint32_t MASK = 0x800000U;
-    for (uint32_t i = 0U; i < 24U; i++, MASK >>= 1) {
-        uint32_t aPos = AMBE_A_TABLE[i];
-        if (READ_BIT(bytes, aPos))
-            a |= MASK;
-    }
-
-    uint32_t b = 0U;
-    MASK = 0x400000U;
-    for (uint32_t i = 0U; i < 23U; i++, MASK >>= 1) {
-        uint32_t bPos = AMBE_B_TABLE[i];
-        if (READ_BIT(bytes, bPos))
-            b |= MASK;
-    }
-
-    uint32_t c = 0U;
-    MASK = 0x1000000U;
-    for (uint32_t i = 0U; i < 25U; i++, MASK >>= 1) {
-        uint32_t cPos = AMBE_C_TABLE[i];
-        if (READ_BIT(bytes, cPos))
-            c |= MASK;
-    }
+    // Interleave
+    if (out != nullptr && errors > 0U)
+        interleaveIMBE(temp, out);
 
-    uint32_t errors = regenerate(a, b, c);
     return errors;
 }
 
-// ---------------------------------------------------------------------------
-//  Private Class Members
-// ---------------------------------------------------------------------------
-
 /* */
 
 uint32_t AMBEFEC::regenerate(uint32_t& a, uint32_t& b, uint32_t& c) const
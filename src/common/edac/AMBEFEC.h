@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2010,2014,2016,2021 Jonathan Naylor, G4KLX
- *  Copyright (C) 2018-2022 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2018-2024 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -447,6 +447,9 @@ namespace edac
         46U, 50U, 54U, 58U, 62U, 66U, 70U,  3U,  7U, 11U, 15U, 19U,
         23U, 27U, 31U, 35U, 39U, 43U, 47U, 51U, 55U, 59U, 63U, 67U, 71U };
 
+    const uint32_t DMR_AMBE_FRAMES = 3U;
+    const uint32_t IMBE_FEC_LENGTH_BYTES = 18U;
+
     const uint32_t IMBE_INTERLEAVE[] = {
         0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
         1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
@@ -481,6 +484,13 @@ namespace edac
          * @returns uint32_t Count of errors.
          */
         uint32_t regenerateDMR(uint8_t* bytes) const;
+        /**
+         * @brief Regenerates the DMR AMBE FEC for all three AMBE frames of a DMR voice burst.
+         * @param bytes AMBE bytes.
+         * @param[out] errors Count of errors for each AMBE frame (may be nullptr).
+         * @returns uint32_t Total count of errors.
+         */
+        uint32_t regenerateDMR(uint8_t* bytes, uint32_t* errors) const;
         /**
          * @brief Returns the number of errors on the DMR BER input bytes.
          * @param[in] bytes AMBE bytes.
@@ -494,6 +504,14 @@ namespace edac
          * @returns Count of errors.
          */
         uint32_t regenerateIMBE(uint8_t* bytes) const;
+        /**
+         * @brief Regenerates the P25 IMBE FEC for a run of consecutive IMBE frames (i.e. the 9 frames of a LDU).
+         * @param bytes IMBE bytes (18 bytes per frame).
+         * @param count Number of IMBE frames.
+         * @param[out] errors Count of errors for each IMBE frame (may be nullptr).
+         * @returns uint32_t Total count of errors.
+         */
+        uint32_t regenerateIMBE(uint8_t* bytes, uint32_t count, uint32_t* errors) const;
         /**
          * @brief Returns the number of errors on the P25 BER input bytes.
          * @param[in] bytes AMBE bytes.
@@ -515,6 +533,13 @@ namespace edac
         uint32_t measureNXDNBER(uint8_t* bytes) const;
 
     private:
+        /**
+         * @brief Regenerates the P25 IMBE FEC for a single IMBE frame.
+         * @param[in] in IMBE bytes.
+         * @param[out] out Regenerated IMBE bytes (nullptr to only count errors).
+         * @returns uint32_t Count of errors.
+         */
+        uint32_t processIMBE(const uint8_t* in, uint8_t* out) const;
         /**
          * @brief 
          * @param a 
@@ -6,16 +6,136 @@
  *
  *  Copyright (C) 2012 Ian Wraith
  *  Copyright (C) 2015 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
 #include "edac/BPTC19696.h"
-#include "edac/Hamming.h"
-#include "Utils.h"
 
 using namespace edac;
 
 #include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/*
+** The 196 bit matrix is held as 13 rows of 15 bits; bit 14 of a row word is column 0 (matrix
+** position (row * 15) + 1), bit 0 is column 14. Matrix position 0 is R(3) which is not used.
+**
+** The interleaver maps matrix position a to raw bit (a * 181) % 196. As 13 * 181 = 1 (mod 196),
+** the matrix positions 13k + j (k = 0 - 15) for a given j are the contiguous raw bits starting at
+** (196 - 15j) % 196; so the whole permutation is 13 word reads (or writes) and a bit transpose.
+*/
+
+const uint32_t BPTC_ROWS = 13U;
+const uint32_t BPTC_DATA_ROWS = 9U;
+const uint32_t BPTC_COLUMNS = 15U;
+const uint32_t BPTC_BITS = 196U;
+
+const uint16_t BPTC_ROW_MASK = 0x7FFFU;
+
+const uint32_t BPTC_STRIDE = 13U;
+/* Raw bit offset of the matrix positions 13k + j, for each j. */
+const uint8_t BPTC_STRIDE_OFFSET[] = { 0U, 181U, 166U, 151U, 136U, 121U, 106U, 91U, 76U, 61U, 46U, 31U, 16U };
+
+/*
+** Hamming (15,11,3) syndrome contributed by each bit of a row (column 0 first). The syndrome bits are
+** ordered so that the syndrome of the data bits alone is the row parity (columns 11 - 14) itself.
+*/
+const uint8_t HAMMING_15113_H[] = { 0x09U, 0x0DU, 0x0FU, 0x0EU, 0x07U, 0x0AU, 0x05U, 0x0BU, 0x0CU, 0x06U, 0x03U, 0x08U, 0x04U, 0x02U, 0x01U };
+/* Hamming (13,9,3) syndrome contributed by each bit of a column (row 0 first). */
+const uint8_t HAMMING_1393_H[] = { 0x0FU, 0x07U, 0x0EU, 0x05U, 0x0AU, 0x0DU, 0x03U, 0x06U, 0x0CU, 0x01U, 0x02U, 0x04U, 0x08U };
+
+/**
+ * @brief Compile-time generated lookup tables for the BPTC (196,96) codec.
+ */
+struct alignas(64) BPTC19696Tables {
+    uint8_t rowSyndromeHi[128U];        //! Hamming (15,11,3) syndrome for bits 14 - 8 of a row.
+    uint8_t rowSyndromeLo[256U];        //! Hamming (15,11,3) syndrome for bits 7 - 0 of a row.
+    uint16_t rowCorrect[16U];           //! Row bit to flip for a given Hamming (15,11,3) syndrome.
+
+    /**
+     * @brief Initializes a new instance of the BPTC19696Tables struct.
+     */
+    constexpr BPTC19696Tables() :
+        rowSyndromeHi(),
+        rowSyndromeLo(),
+        rowCorrect()
+    {
+        for (uint32_t v = 0U; v < 256U; v++) {
+            for (uint32_t b = 0U; b < 8U; b++) {
+                if (b < 7U && (v & (0x40U >> b)) != 0U && v < 128U)
+                    rowSyndromeHi[v] ^= HAMMING_15113_H[b];
+                if ((v & (0x80U >> b)) != 0U)
+                    rowSyndromeLo[v] ^= HAMMING_15113_H[7U + b];
+            }
+        }
+
+        for (uint32_t c = 0U; c < BPTC_COLUMNS; c++)
+            rowCorrect[HAMMING_15113_H[c]] = (uint16_t)(0x4000U >> c);
+    }
+};
+
+constexpr BPTC19696Tables BPTC_TABLES{};
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/*
+** Transpose a 16x16 bit matrix held as four 64-bit words of four 16-bit rows each (row 0 in the
+** most significant bits of word 0, bit 15 of a row is column 0).
+*/
+
+static inline void transpose16x16(uint64_t* w)
+{
+    uint64_t t;
+
+    // swap 8x8 blocks
+    for (uint32_t i = 0U; i < 2U; i++) {
+        t = (w[i] ^ (w[i + 2U] >> 8)) & 0x00FF00FF00FF00FFULL;
+        w[i] ^= t;
+        w[i + 2U] ^= t << 8;
+    }
+
+    // swap 4x4 blocks
+    for (uint32_t i = 0U; i < 4U; i += 2U) {
+        t = (w[i] ^ (w[i + 1U] >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        w[i] ^= t;
+        w[i + 1U] ^= t << 4;
+    }
+
+    // swap 2x2 blocks and single bits
+    for (uint32_t i = 0U; i < 4U; i++) {
+        t = (w[i] ^ (w[i] >> 30)) & 0x00000000CCCCCCCCULL;
+        w[i] ^= t ^ (t << 30);
+        t = (w[i] ^ (w[i] >> 15)) & 0x0000AAAA0000AAAAULL;
+        w[i] ^= t ^ (t << 15);
+    }
+}
+
+/* Helper to transpose a 16x16 bit matrix held one row per word (bit 15 is column 0). */
+
+static inline void transpose16x16(const uint16_t* in, uint16_t* out)
+{
+    uint64_t w[4U];
+    for (uint32_t i = 0U; i < 4U; i++) {
+        w[i] = ((uint64_t)in[(i << 2) + 0U] << 48) | ((uint64_t)in[(i << 2) + 1U] << 32) |
+               ((uint64_t)in[(i << 2) + 2U] << 16) | (uint64_t)in[(i << 2) + 3U];
+    }
+
+    transpose16x16(w);
+
+    for (uint32_t i = 0U; i < 4U; i++) {
+        out[(i << 2) + 0U] = (uint16_t)(w[i] >> 48);
+        out[(i << 2) + 1U] = (uint16_t)(w[i] >> 32);
+        out[(i << 2) + 2U] = (uint16_t)(w[i] >> 16);
+        out[(i << 2) + 3U] = (uint16_t)w[i];
+    }
+}
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -24,20 +144,14 @@ using namespace edac;
 /* Initializes a new instance of the BPTC19696 class. */
 
 BPTC19696::BPTC19696() :
-    m_rawData(nullptr),
-    m_deInterData(nullptr)
+    m_deInterData()
 {
-    m_rawData = new bool[196];
-    m_deInterData = new bool[196];
+    /* stub */
 }
 
 /* Finalizes a instance of the BPTC19696 class. */
 
-BPTC19696::~BPTC19696()
-{
-    delete[] m_rawData;
-    delete[] m_deInterData;
-}
+BPTC19696::~BPTC19696() = default;
 
 /* Decode BPTC (196,96) FEC. */
 
@@ -46,11 +160,8 @@ void BPTC19696::decode(const uint8_t* in, uint8_t* out)
     assert(in != nullptr);
     assert(out != nullptr);
 
-    // get the raw binary
-    decodeExtractBinary(in);
-
-    // deinterleave
-    decodeDeInterleave();
+    // get the raw binary and deinterleave
+    decodeDeInterleave(in);
 
     // error check
     decodeErrorCheck();
@@ -72,290 +183,203 @@ void BPTC19696::encode(const uint8_t* in, uint8_t* out)
     // error check
     encodeErrorCheck();
 
-    // interleave
-    encodeInterleave();
-
-    // get the raw binary
-    encodeExtractBinary(out);
+    // interleave and get the raw binary
+    encodeInterleave(out);
 }
 
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
-/* */
+/* Extracts the 196 interleaved bits from the input and deinterleaves them into the 13 row words of the product code matrix. */
 
-void BPTC19696::decodeExtractBinary(const uint8_t* in)
+void BPTC19696::decodeDeInterleave(const uint8_t* in)
 {
-    // first block
-    Utils::byteToBitsBE(in[0U], m_rawData + 0U);
-    Utils::byteToBitsBE(in[1U], m_rawData + 8U);
-    Utils::byteToBitsBE(in[2U], m_rawData + 16U);
-    Utils::byteToBitsBE(in[3U], m_rawData + 24U);
-    Utils::byteToBitsBE(in[4U], m_rawData + 32U);
-    Utils::byteToBitsBE(in[5U], m_rawData + 40U);
-    Utils::byteToBitsBE(in[6U], m_rawData + 48U);
-    Utils::byteToBitsBE(in[7U], m_rawData + 56U);
-    Utils::byteToBitsBE(in[8U], m_rawData + 64U);
-    Utils::byteToBitsBE(in[9U], m_rawData + 72U);
-    Utils::byteToBitsBE(in[10U], m_rawData + 80U);
-    Utils::byteToBitsBE(in[11U], m_rawData + 88U);
-    Utils::byteToBitsBE(in[12U], m_rawData + 96U);
-
-    // handle the two bits
-    bool bits[8U];
-    Utils::byteToBitsBE(in[20U], bits);
-    m_rawData[98U] = bits[6U];
-    m_rawData[99U] = bits[7U];
-
-    // second block
-    Utils::byteToBitsBE(in[21U], m_rawData + 100U);
-    Utils::byteToBitsBE(in[22U], m_rawData + 108U);
-    Utils::byteToBitsBE(in[23U], m_rawData + 116U);
-    Utils::byteToBitsBE(in[24U], m_rawData + 124U);
-    Utils::byteToBitsBE(in[25U], m_rawData + 132U);
-    Utils::byteToBitsBE(in[26U], m_rawData + 140U);
-    Utils::byteToBitsBE(in[27U], m_rawData + 148U);
-    Utils::byteToBitsBE(in[28U], m_rawData + 156U);
-    Utils::byteToBitsBE(in[29U], m_rawData + 164U);
-    Utils::byteToBitsBE(in[30U], m_rawData + 172U);
-    Utils::byteToBitsBE(in[31U], m_rawData + 180U);
-    Utils::byteToBitsBE(in[32U], m_rawData + 188U);
-}
-
-/* */
+    // gather the two blocks (98 bits each) into one contiguous raw bit buffer
+    uint8_t raw[25U];
+    ::memcpy(raw, in, 12U);
+    raw[12U] = (in[12U] & 0xC0U) | ((in[20U] & 0x03U) << 4) | (in[21U] >> 4);
+    for (uint32_t i = 0U; i < 11U; i++)
+        raw[13U + i] = (uint8_t)(in[21U + i] << 4) | (in[22U + i] >> 4);
+    raw[24U] = (uint8_t)(in[32U] << 4);
+
+    // read the 13 contiguous raw runs, one per stride-13 column of the matrix
+    uint16_t stride[16U];
+    for (uint32_t j = 0U; j < BPTC_STRIDE; j++) {
+        uint32_t offset = BPTC_STRIDE_OFFSET[j];
+        const uint8_t* p = raw + (offset >> 3);
+        uint32_t word = (p[0U] << 16) | (p[1U] << 8) | p[2U];
+        stride[j] = (uint16_t)(word >> (8U - (offset & 7U)));
+    }
+    stride[13U] = stride[14U] = stride[15U] = 0U;
 
-void BPTC19696::decodeDeInterleave()
-{
-    for (uint32_t i = 0U; i < 196U; i++)
-        m_deInterData[i] = false;
+    // transposing gives the linear matrix in 13 bit pieces
+    uint16_t linear[16U];
+    transpose16x16(stride, linear);
 
     // the first bit is R(3) which is not used so can be ignored
-    for (uint32_t a = 0U; a < 196U; a++) {
-        // calculate the interleave sequence
-        uint32_t interleaveSequence = (a * 181U) % 196U;
-        // shuffle the data
-        m_deInterData[a] = m_rawData[interleaveSequence];
+    uint64_t acc = linear[0U] >> 3;
+    uint32_t bits = 12U;
+    uint32_t k = 1U;
+    for (uint32_t r = 0U; r < BPTC_ROWS; r++) {
+        while (bits < BPTC_COLUMNS) {
+            acc = (acc << BPTC_STRIDE) | (linear[k++] >> 3);
+            bits += BPTC_STRIDE;
+        }
+
+        bits -= BPTC_COLUMNS;
+        m_deInterData[r] = (uint16_t)((acc >> bits) & BPTC_ROW_MASK);
     }
 }
 
-/* */
+/* Iteratively runs the Hamming (13,9,3) column and Hamming (15,11,3) row checks. */
 
 void BPTC19696::decodeErrorCheck()
 {
+    uint16_t* d = m_deInterData;
+
     bool fixing;
     uint32_t count = 0U;
     do {
         fixing = false;
 
-        // run through each of the 15 columns
-        bool col[13U];
-        for (uint32_t c = 0U; c < 15U; c++) {
-            uint32_t pos = c + 1U;
-            for (uint32_t a = 0U; a < 13U; a++) {
-                col[a] = m_deInterData[pos];
-                pos = pos + 15U;
-            }
-
-            if (Hamming::decode1393(col)) {
-                uint32_t pos = c + 1U;
-                for (uint32_t a = 0U; a < 13U; a++) {
-                    m_deInterData[pos] = col[a];
-                    pos = pos + 15U;
+        // run through all 15 columns at once; each bit of the syndrome words belongs to one column
+        uint16_t s0 = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6] ^ d[9];
+        uint16_t s1 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+        uint16_t s2 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8] ^ d[11];
+        uint16_t s3 = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8] ^ d[12];
+
+        if ((s0 | s1 | s2 | s3) != 0U) {
+            for (uint32_t a = 0U; a < BPTC_ROWS; a++) {
+                uint8_t h = HAMMING_1393_H[a];
+
+                // columns whose syndrome points at this row
+                uint16_t fix = ((h & 0x01U) ? s0 : ~s0) & ((h & 0x02U) ? s1 : ~s1) &
+                               ((h & 0x04U) ? s2 : ~s2) & ((h & 0x08U) ? s3 : ~s3) & BPTC_ROW_MASK;
+                if (fix != 0U) {
+                    d[a] ^= fix;
+                    fixing = true;
                 }
-
-                fixing = true;
             }
         }
 
         // run through each of the 9 rows containing data
-        for (uint32_t r = 0U; r < 9U; r++) {
-            uint32_t pos = (r * 15U) + 1U;
-            if (Hamming::decode15113_2(m_deInterData + pos))
+        for (uint32_t r = 0U; r < BPTC_DATA_ROWS; r++) {
+            uint8_t syndrome = BPTC_TABLES.rowSyndromeHi[d[r] >> 8] ^ BPTC_TABLES.rowSyndromeLo[d[r] & 0xFFU];
+            if (syndrome != 0U) {
+                d[r] ^= BPTC_TABLES.rowCorrect[syndrome];
                 fixing = true;
+            }
         }
 
         count++;
     } while (fixing && count < 5U);
 }
 
-/* */
+/* Extracts the 96 data bits from the product code matrix. */
 
 void BPTC19696::decodeExtractData(uint8_t* data) const
 {
-    bool bData[96U];
-    uint32_t pos = 0U;
-    for (uint32_t a = 4U; a <= 11U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 16U; a <= 26U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 31U; a <= 41U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 46U; a <= 56U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 61U; a <= 71U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 76U; a <= 86U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 91U; a <= 101U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 106U; a <= 116U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    for (uint32_t a = 121U; a <= 131U; a++, pos++)
-        bData[pos] = m_deInterData[a];
-
-    Utils::bitsToByteBE(bData + 0U, data[0U]);
-    Utils::bitsToByteBE(bData + 8U, data[1U]);
-    Utils::bitsToByteBE(bData + 16U, data[2U]);
-    Utils::bitsToByteBE(bData + 24U, data[3U]);
-    Utils::bitsToByteBE(bData + 32U, data[4U]);
-    Utils::bitsToByteBE(bData + 40U, data[5U]);
-    Utils::bitsToByteBE(bData + 48U, data[6U]);
-    Utils::bitsToByteBE(bData + 56U, data[7U]);
-    Utils::bitsToByteBE(bData + 64U, data[8U]);
-    Utils::bitsToByteBE(bData + 72U, data[9U]);
-    Utils::bitsToByteBE(bData + 80U, data[10U]);
-    Utils::bitsToByteBE(bData + 88U, data[11U]);
+    // the first row carries 8 data bits (columns 3 - 10), the remaining 8 rows 11 data bits (columns 0 - 10)
+    uint64_t acc = (m_deInterData[0U] >> 4) & 0xFFU;
+    uint32_t bits = 8U;
+    uint32_t n = 0U;
+    for (uint32_t r = 1U; r < BPTC_DATA_ROWS; r++) {
+        acc = (acc << 11) | (m_deInterData[r] >> 4);
+        bits += 11U;
+
+        while (bits >= 8U) {
+            bits -= 8U;
+            data[n++] = (uint8_t)(acc >> bits);
+        }
+    }
 }
 
-/* */
+/* Places the 96 data bits into the product code matrix. */
 
-void BPTC19696::encodeExtractData(const uint8_t* in) const
+void BPTC19696::encodeExtractData(const uint8_t* in)
 {
-    bool bData[96U];
-    Utils::byteToBitsBE(in[0U], bData + 0U);
-    Utils::byteToBitsBE(in[1U], bData + 8U);
-    Utils::byteToBitsBE(in[2U], bData + 16U);
-    Utils::byteToBitsBE(in[3U], bData + 24U);
-    Utils::byteToBitsBE(in[4U], bData + 32U);
-    Utils::byteToBitsBE(in[5U], bData + 40U);
-    Utils::byteToBitsBE(in[6U], bData + 48U);
-    Utils::byteToBitsBE(in[7U], bData + 56U);
-    Utils::byteToBitsBE(in[8U], bData + 64U);
-    Utils::byteToBitsBE(in[9U], bData + 72U);
-    Utils::byteToBitsBE(in[10U], bData + 80U);
-    Utils::byteToBitsBE(in[11U], bData + 88U);
-
-    for (uint32_t i = 0U; i < 196U; i++)
-        m_deInterData[i] = false;
-
-    uint32_t pos = 0U;
-    for (uint32_t a = 4U; a <= 11U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 16U; a <= 26U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 31U; a <= 41U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 46U; a <= 56U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 61U; a <= 71U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 76U; a <= 86U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 91U; a <= 101U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 106U; a <= 116U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-
-    for (uint32_t a = 121U; a <= 131U; a++, pos++)
-        m_deInterData[a] = bData[pos];
-}
-
-/* */
+    ::memset(m_deInterData, 0x00U, sizeof(m_deInterData));
 
-void BPTC19696::encodeErrorCheck()
-{
-    // run through each of the 9 rows containing data
-    for (uint32_t r = 0U; r < 9U; r++) {
-        uint32_t pos = (r * 15U) + 1U;
-        Hamming::encode15113_2(m_deInterData + pos);
-    }
+    m_deInterData[0U] = (uint16_t)(in[0U] << 4);
 
-    // run through each of the 15 columns
-    bool col[13U];
-    for (uint32_t c = 0U; c < 15U; c++) {
-        uint32_t pos = c + 1U;
-        for (uint32_t a = 0U; a < 13U; a++) {
-            col[a] = m_deInterData[pos];
-            pos = pos + 15U;
+    uint64_t acc = 0U;
+    uint32_t bits = 0U;
+    uint32_t n = 1U;
+    for (uint32_t r = 1U; r < BPTC_DATA_ROWS; r++) {
+        while (bits < 11U) {
+            acc = (acc << 8) | in[n++];
+            bits += 8U;
         }
 
-        Hamming::encode1393(col);
-
-        pos = c + 1U;
-        for (uint32_t a = 0U; a < 13U; a++) {
-            m_deInterData[pos] = col[a];
-            pos = pos + 15U;
-        }
+        bits -= 11U;
+        m_deInterData[r] = (uint16_t)(((acc >> bits) & 0x7FFU) << 4);
     }
 }
 
-/* */
+/* Calculates the Hamming (15,11,3) row and Hamming (13,9,3) column parity. */
 
-void BPTC19696::encodeInterleave()
+void BPTC19696::encodeErrorCheck()
 {
-    for (uint32_t i = 0U; i < 196U; i++)
-        m_rawData[i] = false;
+    uint16_t* d = m_deInterData;
 
-    // the first bit is R(3) which is not used so can be ignored
-    for (uint32_t a = 0U; a < 196U; a++) {
-        // calculate the interleave sequence
-        uint32_t interleaveSequence = (a * 181U) % 196U;
-        // unshuffle the data
-        m_rawData[interleaveSequence] = m_deInterData[a];
+    // run through each of the 9 rows containing data
+    for (uint32_t r = 0U; r < BPTC_DATA_ROWS; r++) {
+        uint16_t row = d[r] & 0x7FF0U;
+        uint8_t parity = BPTC_TABLES.rowSyndromeHi[row >> 8] ^ BPTC_TABLES.rowSyndromeLo[row & 0xFFU];
+        d[r] = row | parity;
     }
+
+    // run through all 15 columns at once
+    d[9U] = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
+    d[10U] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
+    d[11U] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+    d[12U] = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
 }
 
-/* */
+/* Interleaves the product code matrix into the output. */
 
-void BPTC19696::encodeExtractBinary(uint8_t* data)
+void BPTC19696::encodeInterleave(uint8_t* data) const
 {
+    // split the linear matrix into 13 bit pieces, the first bit is R(3) which is always 0
+    uint16_t linear[16U];
+    uint64_t acc = 0U;
+    uint32_t bits = 1U;
+    uint32_t k = 0U;
+    for (uint32_t r = 0U; r < BPTC_ROWS; r++) {
+        acc = (acc << BPTC_COLUMNS) | m_deInterData[r];
+        bits += BPTC_COLUMNS;
+
+        while (bits >= BPTC_STRIDE) {
+            bits -= BPTC_STRIDE;
+            linear[k++] = (uint16_t)(((acc >> bits) & 0x1FFFU) << 3);
+        }
+    }
+    linear[k] = (uint16_t)(((acc << (BPTC_STRIDE - bits)) & 0x1FFFU) << 3);
+
+    // transposing gives the 13 contiguous raw runs, one per stride-13 column of the matrix
+    uint16_t stride[16U];
+    transpose16x16(linear, stride);
+
+    uint8_t raw[25U];
+    ::memset(raw, 0x00U, sizeof(raw));
+    for (uint32_t j = 0U; j < BPTC_STRIDE; j++) {
+        uint32_t offset = BPTC_STRIDE_OFFSET[j];
+        uint8_t* p = raw + (offset >> 3);
+        uint32_t word = (uint32_t)stride[j] << (8U - (offset & 7U));
+        p[0U] |= (uint8_t)(word >> 16);
+        p[1U] |= (uint8_t)(word >> 8);
+        p[2U] |= (uint8_t)word;
+    }
+
     // first block
-    Utils::bitsToByteBE(m_rawData + 0U, data[0U]);
-    Utils::bitsToByteBE(m_rawData + 8U, data[1U]);
-    Utils::bitsToByteBE(m_rawData + 16U, data[2U]);
-    Utils::bitsToByteBE(m_rawData + 24U, data[3U]);
-    Utils::bitsToByteBE(m_rawData + 32U, data[4U]);
-    Utils::bitsToByteBE(m_rawData + 40U, data[5U]);
-    Utils::bitsToByteBE(m_rawData + 48U, data[6U]);
-    Utils::bitsToByteBE(m_rawData + 56U, data[7U]);
-    Utils::bitsToByteBE(m_rawData + 64U, data[8U]);
-    Utils::bitsToByteBE(m_rawData + 72U, data[9U]);
-    Utils::bitsToByteBE(m_rawData + 80U, data[10U]);
-    Utils::bitsToByteBE(m_rawData + 88U, data[11U]);
+    ::memcpy(data, raw, 12U);
 
     // handle the two bits
-    uint8_t byte;
-    Utils::bitsToByteBE(m_rawData + 96U, byte);
-    data[12U] = (data[12U] & 0x3FU) | ((byte >> 0) & 0xC0U);
-    data[20U] = (data[20U] & 0xFCU) | ((byte >> 4) & 0x03U);
+    data[12U] = (data[12U] & 0x3FU) | (raw[12U] & 0xC0U);
+    data[20U] = (data[20U] & 0xFCU) | ((raw[12U] >> 4) & 0x03U);
 
     // second block
-    Utils::bitsToByteBE(m_rawData + 100U, data[21U]);
-    Utils::bitsToByteBE(m_rawData + 108U, data[22U]);
-    Utils::bitsToByteBE(m_rawData + 116U, data[23U]);
-    Utils::bitsToByteBE(m_rawData + 124U, data[24U]);
-    Utils::bitsToByteBE(m_rawData + 132U, data[25U]);
-    Utils::bitsToByteBE(m_rawData + 140U, data[26U]);
-    Utils::bitsToByteBE(m_rawData + 148U, data[27U]);
-    Utils::bitsToByteBE(m_rawData + 156U, data[28U]);
-    Utils::bitsToByteBE(m_rawData + 164U, data[29U]);
-    Utils::bitsToByteBE(m_rawData + 172U, data[30U]);
-    Utils::bitsToByteBE(m_rawData + 180U, data[31U]);
-    Utils::bitsToByteBE(m_rawData + 188U, data[32U]);
+    for (uint32_t i = 0U; i < 12U; i++)
+        data[21U + i] = (uint8_t)(raw[12U + i] << 4) | (raw[13U + i] >> 4);
 }
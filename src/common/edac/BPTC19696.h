@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2015 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -53,45 +54,38 @@ namespace edac
         void encode(const uint8_t* in, uint8_t* out);
 
     private:
-        bool* m_rawData;
-        bool* m_deInterData;
+        uint16_t m_deInterData[13U];
 
         /**
-         * @brief 
-         * @param in
+         * @brief Extracts the 196 interleaved bits from the input and deinterleaves them into the
+         *  13 row words of the product code matrix.
+         * @param in Input data.
          */
-        void decodeExtractBinary(const uint8_t* in);
+        void decodeDeInterleave(const uint8_t* in);
         /**
-         * @brief 
+         * @brief Iteratively runs the Hamming (13,9,3) column and Hamming (15,11,3) row checks.
          */
         void decodeErrorCheck();
         /**
-         * @brief 
-         */
-        void decodeDeInterleave();
-        /**
-         * @brief 
-         * @param data 
+         * @brief Extracts the 96 data bits from the product code matrix.
+         * @param data Output data.
          */
         void decodeExtractData(uint8_t* data) const;
 
         /**
-         * @brief 
-         */
-        void encodeExtractData(const uint8_t* in) const;
-        /**
-         * @brief 
+         * @brief Places the 96 data bits into the product code matrix.
+         * @param in Input data.
          */
-        void encodeInterleave();
+        void encodeExtractData(const uint8_t* in);
         /**
-         * @brief 
+         * @brief Calculates the Hamming (15,11,3) row and Hamming (13,9,3) column parity.
          */
         void encodeErrorCheck();
         /**
-         * @brief 
-         * @param data 
+         * @brief Interleaves the product code matrix into the output.
+         * @param data Output data.
          */
-        void encodeExtractBinary(uint8_t* data);
+        void encodeInterleave(uint8_t* data) const;
     };
 } // namespace edac
 
@@ -113,6 +113,40 @@ const uint16_t CCITT16_TABLE2[] = {
     0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
     0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0 };
 
+const uint16_t CRC9_TABLE[] = {
+    0x0000, 0x0059, 0x00B2, 0x00EB, 0x0164, 0x013D, 0x01D6, 0x018F,
+    0x0091, 0x00C8, 0x0023, 0x007A, 0x01F5, 0x01AC, 0x0147, 0x011E,
+    0x0122, 0x017B, 0x0190, 0x01C9, 0x0046, 0x001F, 0x00F4, 0x00AD,
+    0x01B3, 0x01EA, 0x0101, 0x0158, 0x00D7, 0x008E, 0x0065, 0x003C,
+    0x001D, 0x0044, 0x00AF, 0x00F6, 0x0179, 0x0120, 0x01CB, 0x0192,
+    0x008C, 0x00D5, 0x003E, 0x0067, 0x01E8, 0x01B1, 0x015A, 0x0103,
+    0x013F, 0x0166, 0x018D, 0x01D4, 0x005B, 0x0002, 0x00E9, 0x00B0,
+    0x01AE, 0x01F7, 0x011C, 0x0145, 0x00CA, 0x0093, 0x0078, 0x0021,
+    0x003A, 0x0063, 0x0088, 0x00D1, 0x015E, 0x0107, 0x01EC, 0x01B5,
+    0x00AB, 0x00F2, 0x0019, 0x0040, 0x01CF, 0x0196, 0x017D, 0x0124,
+    0x0118, 0x0141, 0x01AA, 0x01F3, 0x007C, 0x0025, 0x00CE, 0x0097,
+    0x0189, 0x01D0, 0x013B, 0x0162, 0x00ED, 0x00B4, 0x005F, 0x0006,
+    0x0027, 0x007E, 0x0095, 0x00CC, 0x0143, 0x011A, 0x01F1, 0x01A8,
+    0x00B6, 0x00EF, 0x0004, 0x005D, 0x01D2, 0x018B, 0x0160, 0x0139,
+    0x0105, 0x015C, 0x01B7, 0x01EE, 0x0061, 0x0038, 0x00D3, 0x008A,
+    0x0194, 0x01CD, 0x0126, 0x017F, 0x00F0, 0x00A9, 0x0042, 0x001B,
+    0x0074, 0x002D, 0x00C6, 0x009F, 0x0110, 0x0149, 0x01A2, 0x01FB,
+    0x00E5, 0x00BC, 0x0057, 0x000E, 0x0181, 0x01D8, 0x0133, 0x016A,
+    0x0156, 0x010F, 0x01E4, 0x01BD, 0x0032, 0x006B, 0x0080, 0x00D9,
+    0x01C7, 0x019E, 0x0175, 0x012C, 0x00A3, 0x00FA, 0x0011, 0x0048,
+    0x0069, 0x0030, 0x00DB, 0x0082, 0x010D, 0x0154, 0x01BF, 0x01E6,
+    0x00F8, 0x00A1, 0x004A, 0x0013, 0x019C, 0x01C5, 0x012E, 0x0177,
+    0x014B, 0x0112, 0x01F9, 0x01A0, 0x002F, 0x0076, 0x009D, 0x00C4,
+    0x01DA, 0x0183, 0x0168, 0x0131, 0x00BE, 0x00E7, 0x000C, 0x0055,
+    0x004E, 0x0017, 0x00FC, 0x00A5, 0x012A, 0x0173, 0x0198, 0x01C1,
+    0x00DF, 0x0086, 0x006D, 0x0034, 0x01BB, 0x01E2, 0x0109, 0x0150,
+    0x016C, 0x0135, 0x01DE, 0x0187, 0x0008, 0x0051, 0x00BA, 0x00E3,
+    0x01FD, 0x01A4, 0x014F, 0x0116, 0x0099, 0x00C0, 0x002B, 0x0072,
+    0x0053, 0x000A, 0x00E1, 0x00B8, 0x0137, 0x016E, 0x0185, 0x01DC,
+    0x00C2, 0x009B, 0x0070, 0x0029, 0x01A6, 0x01FF, 0x0114, 0x014D,
+    0x0171, 0x0128, 0x01C3, 0x019A, 0x0015, 0x004C, 0x00A7, 0x00FE,
+    0x01E0, 0x01B9, 0x0152, 0x010B, 0x0084, 0x00DD, 0x0036, 0x006F };
+
 const uint32_t CRC32_TABLE[] = {
     0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
     0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
@@ -578,7 +612,14 @@ uint16_t CRC::createCRC9(const uint8_t* in, uint32_t bitLength)
 {
     uint16_t crc = 0U;
 
-    for (uint32_t i = 0U; i < bitLength; i++) {
+    // whole bytes a byte at a time
+    uint32_t bytes = bitLength / 8U;
+    for (uint32_t i = 0U; i < bytes; i++) {
+        crc = ((crc << 8) ^ CRC9_TABLE[((crc >> 1) ^ in[i]) & 0xFFU]) & 0x1FFU;
+    }
+
+    // remaining bits a bit at a time
+    for (uint32_t i = bytes * 8U; i < bitLength; i++) {
         bool bit1 = READ_BIT(in, i) != 0x00U;
         bool bit2 = (crc & 0x100U) == 0x100U;
 
@@ -6,7 +6,7 @@
  *
  *  Copyright (C) 2002 by Robert H. Morelos-Zaragoza., All rights reserved.
  *  Copyright (C) 2010,2016 Jonathan Naylor, G4KLX
- *  Copyright (C) 2017 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2017,2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
@@ -1054,9 +1054,54 @@ static const uint32_t DECODING_TABLE_23127[] = {
 
 #define X22             0x00400000   /* vector representation of X^{22} */
 #define X11             0x00000800   /* vector representation of X^{11} */
-#define MASK12          0xfffff800   /* auxiliary vector for testing */
 #define GENPOL          0x00000c75   /* generator polynomial, g(x) */
 
+/**
+ * @brief Compile-time generated Golay (23,12,7) syndrome lookup tables.
+ */
+struct alignas(64) Golay23127Tables {
+    uint16_t syndromeHi[128U];          //! Syndrome for bits 22 - 16 of a code word.
+    uint16_t syndromeMid[256U];         //! Syndrome for bits 15 - 8 of a code word.
+    uint16_t syndromeLo[256U];          //! Syndrome for bits 7 - 0 of a code word.
+
+    /**
+     * @brief Initializes a new instance of the Golay23127Tables struct.
+     */
+    constexpr Golay23127Tables() :
+        syndromeHi(),
+        syndromeMid(),
+        syndromeLo()
+    {
+        for (uint32_t v = 0U; v < 256U; v++) {
+            if (v < 128U)
+                syndromeHi[v] = (uint16_t)remainder(v << 16);
+            syndromeMid[v] = (uint16_t)remainder(v << 8);
+            syndromeLo[v] = (uint16_t)remainder(v);
+        }
+    }
+
+    /**
+     * @brief Remainder of the given pattern divided by the generator polynomial.
+     * @param pattern 
+     * @returns uint32_t 
+     */
+    static constexpr uint32_t remainder(uint32_t pattern)
+    {
+        for (uint32_t aux = X22; aux >= X11; aux >>= 1) {
+            if ((pattern & aux) != 0U)
+                pattern ^= (aux / X11) * GENPOL;
+        }
+
+        return pattern;
+    }
+};
+
+/*
+** The syndrome (remainder) is linear in the received pattern, so it is the XOR of the syndromes
+** of its bytes.
+*/
+static constexpr Golay23127Tables GOLAY_23127_TABLES{};
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
@@ -1241,16 +1286,6 @@ void Golay24128::encode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen)
 
 uint32_t Golay24128::getSyndrome23127(uint32_t pattern)
 {
-    uint32_t aux = X22;
-
-    if (pattern >= X11) {
-        while (pattern & MASK12) {
-            while (!(aux & pattern))
-                aux = aux >> 1;
-
-            pattern ^= (aux / X11) * GENPOL;
-        }
-    }
-
-    return pattern;
+    return GOLAY_23127_TABLES.syndromeHi[(pattern >> 16) & 0x7FU] ^ GOLAY_23127_TABLES.syndromeMid[(pattern >> 8) & 0xFFU] ^
+        GOLAY_23127_TABLES.syndromeLo[pattern & 0xFFU];
 }
@@ -16,16 +16,66 @@
 using namespace edac;
 
 #include <cassert>
+#include <cstring>
 
 // ---------------------------------------------------------------------------
 //  Constants
 // ---------------------------------------------------------------------------
 
-const uint32_t INTERLEAVE_TABLE[] = {
-    0U, 1U, 8U,   9U, 16U, 17U, 24U, 25U, 32U, 33U, 40U, 41U, 48U, 49U, 56U, 57U, 64U, 65U, 72U, 73U, 80U, 81U, 88U, 89U, 96U, 97U,
-    2U, 3U, 10U, 11U, 18U, 19U, 26U, 27U, 34U, 35U, 42U, 43U, 50U, 51U, 58U, 59U, 66U, 67U, 74U, 75U, 82U, 83U, 90U, 91U,
-    4U, 5U, 12U, 13U, 20U, 21U, 28U, 29U, 36U, 37U, 44U, 45U, 52U, 53U, 60U, 61U, 68U, 69U, 76U, 77U, 84U, 85U, 92U, 93U,
-    6U, 7U, 14U, 15U, 22U, 23U, 30U, 31U, 38U, 39U, 46U, 47U, 54U, 55U, 62U, 63U, 70U, 71U, 78U, 79U, 86U, 87U, 94U, 95U };
+/*
+** The 98 dibits of a burst form 49 constellation points of two dibits each, so every point is carried
+** as a 4 bit symbol. Points are interleaved column-wise over 4 columns (13 points in the first column,
+** 12 in the remainder). When skipping symbols (DMR), the second half of the burst (from bit 98) follows
+** the 68 bits of slot type and sync.
+*/
+const uint32_t TRELLIS_POINTS = 49U;
+const uint32_t TRELLIS_BITS = 196U;
+const uint32_t TRELLIS_BYTES = 25U;
+const uint32_t TRELLIS_HALF_BITS = 98U;
+const uint32_t TRELLIS_SKIP_BITS = 68U;
+
+/* Dibit pair (constellation) of each Trellis constellation point. */
+const int8_t CONSTELLATION[16U][2U] = {
+    { +1, -1 }, { -1, -1 }, { +3, -3 }, { -3, -3 }, { -3, -1 }, { +3, -1 }, { -1, -3 }, { +1, -3 },
+    { -3, +3 }, { +3, +3 }, { -1, +1 }, { +1, +1 }, { +1, +3 }, { -1, +3 }, { +3, +1 }, { -3, +1 } };
+
+/**
+ * @brief Compile-time generated lookup tables for the Trellis codec.
+ */
+struct alignas(64) TrellisTables {
+    uint8_t pointIndex[TRELLIS_POINTS]; //! Constellation point carried by each transmitted 4 bit symbol.
+    uint8_t symbolToPoint[16U];         //! Constellation point of a 4 bit symbol.
+    uint8_t pointToSymbol[16U];         //! 4 bit symbol of a constellation point.
+
+    /**
+     * @brief Initializes a new instance of the TrellisTables struct.
+     */
+    constexpr TrellisTables() :
+        pointIndex(),
+        symbolToPoint(),
+        pointToSymbol()
+    {
+        uint32_t n = 0U;
+        for (uint32_t col = 0U; col < 4U; col++) {
+            for (uint32_t p = col; p < TRELLIS_POINTS; p += 4U)
+                pointIndex[n++] = p;
+        }
+
+        // dibits map to bits as; +3 = 01, +1 = 00, -1 = 10, -3 = 11
+        for (uint32_t p = 0U; p < 16U; p++) {
+            uint8_t symbol = 0U;
+            for (uint32_t i = 0U; i < 2U; i++) {
+                int8_t dibit = CONSTELLATION[p][i];
+                uint8_t bits = (dibit == +3) ? 0x01U : (dibit == +1) ? 0x00U : (dibit == -1) ? 0x02U : 0x03U;
+                symbol = (symbol << 2) | bits;
+            }
+
+            pointToSymbol[p] = symbol;
+            symbolToPoint[symbol] = p;
+        }
+    }
+};
+static constexpr TrellisTables TRELLIS_TABLES{};
 
 const uint8_t ENCODE_TABLE_34[] = {
     0U,  8U, 4U, 12U, 2U, 10U, 6U, 14U,
@@ -62,11 +112,8 @@ bool Trellis::decode34(const uint8_t* data, uint8_t* payload, bool skipSymbols)
     assert(data != nullptr);
     assert(payload != nullptr);
 
-    int8_t dibits[98U];
-    deinterleave(data, dibits, skipSymbols);
-
     uint8_t points[49U];
-    dibitsToPoints(dibits, points);
+    deinterleave(data, points, skipSymbols);
 
     // Check the original code
     uint8_t tribits[49U];
@@ -112,10 +159,7 @@ void Trellis::encode34(const uint8_t* payload, uint8_t* data, bool skipSymbols)
         state = tribit;
     }
 
-    int8_t dibits[98U];
-    pointsToDibits(points, dibits);
-
-    interleave(dibits, data, skipSymbols);
+    interleave(points, data, skipSymbols);
 }
 
 /* Decodes 1/2 rate Trellis. */
@@ -125,11 +169,8 @@ bool Trellis::decode12(const uint8_t* data, uint8_t* payload)
     assert(data != nullptr);
     assert(payload != nullptr);
 
-    int8_t dibits[98U];
-    deinterleave(data, dibits);
-
     uint8_t points[49U];
-    dibitsToPoints(dibits, points);
+    deinterleave(data, points);
 
     // Check the original code
     uint8_t bits[49U];
@@ -175,192 +216,50 @@ void Trellis::encode12(const uint8_t* payload, uint8_t* data)
         state = bit;
     }
 
-    int8_t dibits[98U];
-    pointsToDibits(points, dibits);
-
-    interleave(dibits, data);
+    interleave(points, data);
 }
 
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
-/* Helper to deinterleave the input symbols into dibits. */
+/* Helper to deinterleave the input symbols into constellation points. */
 
-void Trellis::deinterleave(const uint8_t* data, int8_t* dibits, bool skipSymbols) const
+void Trellis::deinterleave(const uint8_t* data, uint8_t* points, bool skipSymbols) const
 {
-    for (uint32_t i = 0U; i < 98U; i++) {
-        uint32_t n = i * 2U + 0U;
-        if (skipSymbols && n >= 98U) n += 68U;
-        bool b1 = READ_BIT(data, n) != 0x00U;
-
-        n = i * 2U + 1U;
-        if (skipSymbols && n >= 98U) n += 68U;
-        bool b2 = READ_BIT(data, n) != 0x00U;
-
-        int8_t dibit;
-        if (!b1 && b2)
-            dibit = +3;
-        else if (!b1 && !b2)
-            dibit = +1;
-        else if (b1 && !b2)
-            dibit = -1;
-        else
-            dibit = -3;
-
-        n = INTERLEAVE_TABLE[i];
-        dibits[n] = dibit;
+    // gather the symbols (closing up the slot type and sync gap) a half burst at a time
+    uint8_t buffer[TRELLIS_BYTES];
+    ::memset(buffer, 0x00U, TRELLIS_BYTES);
+
+    uint32_t gap = skipSymbols ? TRELLIS_SKIP_BITS : 0U;
+    for (uint32_t i = 0U; i < TRELLIS_BITS; i += TRELLIS_POINTS) {
+        uint32_t n = (i < TRELLIS_HALF_BITS) ? i : i + gap;
+        Utils::writeBits(buffer, i, Utils::readBits(data, n, TRELLIS_POINTS), TRELLIS_POINTS);
     }
-}
-
-/* Helper to interleave the input dibits into symbols. */
 
-void Trellis::interleave(const int8_t* dibits, uint8_t* data, bool skipSymbols) const
-{
-    for (uint32_t i = 0U; i < 98U; i++) {
-        uint32_t n = INTERLEAVE_TABLE[i];
-
-        bool b1, b2;
-        switch (dibits[n]) {
-            case +3:
-                b1 = false;
-                b2 = true;
-                break;
-            case +1:
-                b1 = false;
-                b2 = false;
-                break;
-            case -1:
-                b1 = true;
-                b2 = false;
-                break;
-            default:
-                b1 = true;
-                b2 = true;
-                break;
-        }
-
-        n = i * 2U + 0U;
-        if (skipSymbols && n >= 98U) n += 68U;
-        WRITE_BIT(data, n, b1);
-
-        n = i * 2U + 1U;
-        if (skipSymbols && n >= 98U) n += 68U;
-        WRITE_BIT(data, n, b2);
+    for (uint32_t i = 0U; i < TRELLIS_POINTS; i++) {
+        uint8_t symbol = ((i & 1U) == 0U) ? (buffer[i >> 1] >> 4) : (buffer[i >> 1] & 0x0FU);
+        points[TRELLIS_TABLES.pointIndex[i]] = TRELLIS_TABLES.symbolToPoint[symbol];
     }
 }
 
-/* Helper to map dibits to 4FSK constellation points. */
+/* Helper to interleave the input constellation points into symbols. */
 
-void Trellis::dibitsToPoints(const int8_t* dibits, uint8_t* points) const
+void Trellis::interleave(const uint8_t* points, uint8_t* data, bool skipSymbols) const
 {
-    for (uint32_t i = 0U; i < 49U; i++) {
-        if (dibits[i * 2U + 0U] == +1 && dibits[i * 2U + 1U] == -1)
-            points[i] = 0U;
-        else if (dibits[i * 2U + 0U] == -1 && dibits[i * 2U + 1U] == -1)
-            points[i] = 1U;
-        else if (dibits[i * 2U + 0U] == +3 && dibits[i * 2U + 1U] == -3)
-            points[i] = 2U;
-        else if (dibits[i * 2U + 0U] == -3 && dibits[i * 2U + 1U] == -3)
-            points[i] = 3U;
-        else if (dibits[i * 2U + 0U] == -3 && dibits[i * 2U + 1U] == -1)
-            points[i] = 4U;
-        else if (dibits[i * 2U + 0U] == +3 && dibits[i * 2U + 1U] == -1)
-            points[i] = 5U;
-        else if (dibits[i * 2U + 0U] == -1 && dibits[i * 2U + 1U] == -3)
-            points[i] = 6U;
-        else if (dibits[i * 2U + 0U] == +1 && dibits[i * 2U + 1U] == -3)
-            points[i] = 7U;
-        else if (dibits[i * 2U + 0U] == -3 && dibits[i * 2U + 1U] == +3)
-            points[i] = 8U;
-        else if (dibits[i * 2U + 0U] == +3 && dibits[i * 2U + 1U] == +3)
-            points[i] = 9U;
-        else if (dibits[i * 2U + 0U] == -1 && dibits[i * 2U + 1U] == +1)
-            points[i] = 10U;
-        else if (dibits[i * 2U + 0U] == +1 && dibits[i * 2U + 1U] == +1)
-            points[i] = 11U;
-        else if (dibits[i * 2U + 0U] == +1 && dibits[i * 2U + 1U] == +3)
-            points[i] = 12U;
-        else if (dibits[i * 2U + 0U] == -1 && dibits[i * 2U + 1U] == +3)
-            points[i] = 13U;
-        else if (dibits[i * 2U + 0U] == +3 && dibits[i * 2U + 1U] == +1)
-            points[i] = 14U;
-        else if (dibits[i * 2U + 0U] == -3 && dibits[i * 2U + 1U] == +1)
-            points[i] = 15U;
-    }
-}
+    uint8_t buffer[TRELLIS_BYTES];
+    ::memset(buffer, 0x00U, TRELLIS_BYTES);
 
-/* Helper to map 4FSK constellation points to dibits. */
+    for (uint32_t i = 0U; i < TRELLIS_POINTS; i++) {
+        uint8_t symbol = TRELLIS_TABLES.pointToSymbol[points[TRELLIS_TABLES.pointIndex[i]] & 0x0FU];
+        buffer[i >> 1] |= ((i & 1U) == 0U) ? (symbol << 4) : symbol;
+    }
 
-void Trellis::pointsToDibits(const uint8_t* points, int8_t* dibits) const
-{
-    for (uint32_t i = 0U; i < 49U; i++) {
-        switch (points[i]) {
-            case 0U:
-                dibits[i * 2U + 0U] = +1;
-                dibits[i * 2U + 1U] = -1;
-                break;
-            case 1U:
-                dibits[i * 2U + 0U] = -1;
-                dibits[i * 2U + 1U] = -1;
-                break;
-            case 2U:
-                dibits[i * 2U + 0U] = +3;
-                dibits[i * 2U + 1U] = -3;
-                break;
-            case 3U:
-                dibits[i * 2U + 0U] = -3;
-                dibits[i * 2U + 1U] = -3;
-                break;
-            case 4U:
-                dibits[i * 2U + 0U] = -3;
-                dibits[i * 2U + 1U] = -1;
-                break;
-            case 5U:
-                dibits[i * 2U + 0U] = +3;
-                dibits[i * 2U + 1U] = -1;
-                break;
-            case 6U:
-                dibits[i * 2U + 0U] = -1;
-                dibits[i * 2U + 1U] = -3;
-                break;
-            case 7U:
-                dibits[i * 2U + 0U] = +1;
-                dibits[i * 2U + 1U] = -3;
-                break;
-            case 8U:
-                dibits[i * 2U + 0U] = -3;
-                dibits[i * 2U + 1U] = +3;
-                break;
-            case 9U:
-                dibits[i * 2U + 0U] = +3;
-                dibits[i * 2U + 1U] = +3;
-                break;
-            case 10U:
-                dibits[i * 2U + 0U] = -1;
-                dibits[i * 2U + 1U] = +1;
-                break;
-            case 11U:
-                dibits[i * 2U + 0U] = +1;
-                dibits[i * 2U + 1U] = +1;
-                break;
-            case 12U:
-                dibits[i * 2U + 0U] = +1;
-                dibits[i * 2U + 1U] = +3;
-                break;
-            case 13U:
-                dibits[i * 2U + 0U] = -1;
-                dibits[i * 2U + 1U] = +3;
-                break;
-            case 14U:
-                dibits[i * 2U + 0U] = +3;
-                dibits[i * 2U + 1U] = +1;
-                break;
-            default:
-                dibits[i * 2U + 0U] = -3;
-                dibits[i * 2U + 1U] = +1;
-                break;
-        }
+    // scatter the symbols (leaving the slot type and sync gap untouched) a half burst at a time
+    uint32_t gap = skipSymbols ? TRELLIS_SKIP_BITS : 0U;
+    for (uint32_t i = 0U; i < TRELLIS_BITS; i += TRELLIS_POINTS) {
+        uint32_t n = (i < TRELLIS_HALF_BITS) ? i : i + gap;
+        Utils::writeBits(data, n, Utils::readBits(buffer, i, TRELLIS_POINTS), TRELLIS_POINTS);
     }
 }
 
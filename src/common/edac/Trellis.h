@@ -72,31 +72,19 @@ namespace edac
 
     private:
         /**
-         * @brief Helper to deinterleave the input symbols into dibits.
+         * @brief Helper to deinterleave the input symbols into constellation points.
          * @param[in] data Trellis symbol bytes.
-         * @param[out] dibits Dibits.
+         * @param[out] points Trellis constellation points.
          * @param skipSymbols Flag indicating symbols should be skipped (this is used for DMR).
          */
-        void deinterleave(const uint8_t* in, int8_t* dibits, bool skipSymbols = false) const;
+        void deinterleave(const uint8_t* data, uint8_t* points, bool skipSymbols = false) const;
         /**
-         * @brief Helper to interleave the input dibits into symbols.
-         * @param[in] dibits Dibits.
+         * @brief Helper to interleave the input constellation points into symbols.
+         * @param[in] points Trellis constellation points.
          * @param[out] data Trellis symbol bytes.
          * @param skipSymbols Flag indicating symbols should be skipped (this is used for DMR).
          */
-        void interleave(const int8_t* dibits, uint8_t* out, bool skipSymbols = false) const;
-        /**
-         * @brief Helper to map dibits to trellis constellation points.
-         * @param[in] dibits Dibits.
-         * @param[out] points Trellis constellation points.
-         */
-        void dibitsToPoints(const int8_t* dibits, uint8_t* points) const;
-        /**
-         * @brief Helper to map trellis constellation points to dibits.
-         * @param[in] points Trellis Constellation points.
-         * @param[out] dibits Dibits.
-         */
-        void pointsToDibits(const uint8_t* points, int8_t* dibits) const;
+        void interleave(const uint8_t* points, uint8_t* data, bool skipSymbols = false) const;
         /**
          * @brief Helper to convert a byte payload into tribits.
          * @param[in] payload Byte payload.
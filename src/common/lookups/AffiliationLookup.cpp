@@ -67,10 +67,8 @@ void AffiliationLookup::unitReg(uint32_t srcId)
         return;
     }
 
-    m_unitRegTable.push_back(srcId);
-
-    m_unitRegTimers[srcId] = Timer(1000U, UNIT_REG_TIMEOUT);
-    m_unitRegTimers[srcId].start();
+    m_unitRegTable.insert(srcId);
+    m_unitRegTimers.start(srcId, UNIT_REG_TIMEOUT);
 
     if (m_verbose) {
         LogMessage(LOG_HOST, "%s, unit registration, srcId = %u",
@@ -95,12 +93,10 @@ bool AffiliationLookup::unitDereg(uint32_t srcId, bool automatic)
 
     groupUnaff(srcId);
 
-    m_unitRegTimers[srcId].stop();
+    m_unitRegTimers.stop(srcId);
 
     // remove dynamic unit registration table entry
-    if (std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId) != m_unitRegTable.end()) {
-        auto it = std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId);
-        m_unitRegTable.erase(it);
+    if (m_unitRegTable.erase(srcId) > 0U) {
         ret = true;
     }
 
@@ -122,7 +118,7 @@ void AffiliationLookup::touchUnitReg(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        m_unitRegTimers[srcId].start();
+        m_unitRegTimers.start(srcId);
     }
 }
 
@@ -135,7 +131,7 @@ uint32_t AffiliationLookup::unitRegTimeout(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimeout();
+        return m_unitRegTimers.getTimeout(srcId);
     }
 
     return 0U;
@@ -150,7 +146,7 @@ uint32_t AffiliationLookup::unitRegTimer(uint32_t srcId)
     }
 
     if (isUnitReg(srcId)) {
-        return m_unitRegTimers[srcId].getTimer();
+        return m_unitRegTimers.getTimer(srcId);
     }
 
     return 0U;
@@ -161,7 +157,7 @@ uint32_t AffiliationLookup::unitRegTimer(uint32_t srcId)
 bool AffiliationLookup::isUnitReg(uint32_t srcId) const
 {
     // lookup dynamic unit registration table entry
-    if (std::find(m_unitRegTable.begin(), m_unitRegTable.end(), srcId) != m_unitRegTable.end()) {
+    if (m_unitRegTable.find(srcId) != m_unitRegTable.end()) {
         return true;
     }
     else {
@@ -176,6 +172,7 @@ void AffiliationLookup::clearUnitReg()
     std::vector<uint32_t> srcToRel = std::vector<uint32_t>();
     LogWarning(LOG_HOST, "%s, releasing all unit registrations", m_name.c_str());
     m_unitRegTable.clear();
+    m_unitRegTimers.clear();
 }
 
 /* Helper to group affiliate a source ID. */
@@ -307,8 +304,7 @@ bool AffiliationLookup::grantCh(uint32_t dstId, uint32_t srcId, uint32_t grantTi
     m_uuGrantedTable[dstId] = !grp;
     m_netGrantedTable[dstId] = netGranted;
 
-    m_grantTimers[dstId] = Timer(1000U, grantTimeout);
-    m_grantTimers[dstId].start();
+    m_grantTimers.start(dstId, grantTimeout);
 
     if (m_verbose) {
         LogMessage(LOG_HOST, "%s, granting channel, chNo = %u, dstId = %u, srcId = %u, group = %u",
@@ -327,7 +323,7 @@ void AffiliationLookup::touchGrant(uint32_t dstId)
     }
 
     if (isGranted(dstId)) {
-        m_grantTimers[dstId].start();
+        m_grantTimers.start(dstId);
     }
 }
 
@@ -382,7 +378,7 @@ bool AffiliationLookup::releaseGrant(uint32_t dstId, bool releaseAll)
             m_rfGrantChCnt = 0U;
         }
 
-        m_grantTimers[dstId].stop();
+        m_grantTimers.stop(dstId);
         return true;
     }
 
@@ -527,16 +523,9 @@ uint32_t AffiliationLookup::getGrantedSrcId(uint32_t dstId)
 
 void AffiliationLookup::clock(uint32_t ms)
 {
-    // clock all the grant timers
+    // clock the grant timers (only grants that have timed out are visited)
     std::vector<uint32_t> gntsToRel = std::vector<uint32_t>();
-    for (auto entry : m_grantChTable) {
-        uint32_t dstId = entry.first;
-
-        m_grantTimers[dstId].clock(ms);
-        if (m_grantTimers[dstId].isRunning() && m_grantTimers[dstId].hasExpired()) {
-            gntsToRel.push_back(dstId);
-        }
-    }
+    m_grantTimers.clock(ms, gntsToRel);
 
     // release grants that have timed out
     for (uint32_t dstId : gntsToRel) {
@@ -544,14 +533,9 @@ void AffiliationLookup::clock(uint32_t ms)
     }
 
     if (!m_disableUnitRegTimeout) {
-        // clock all the unit registration timers
+        // clock the unit registration timers (only registrations that have timed out are visited)
         std::vector<uint32_t> unitsToDereg = std::vector<uint32_t>();
-        for (uint32_t srcId : m_unitRegTable) {
-            m_unitRegTimers[srcId].clock(ms);
-            if (m_unitRegTimers[srcId].isRunning() && m_unitRegTimers[srcId].hasExpired()) {
-                unitsToDereg.push_back(srcId);
-            }
-        }
+        m_unitRegTimers.clock(ms, unitsToDereg);
 
         // release units registrations that have timed out
         for (uint32_t srcId : unitsToDereg) {
@@ -22,10 +22,11 @@
 
 #include "common/Defines.h"
 #include "common/lookups/ChannelLookup.h"
-#include "common/Timer.h"
+#include "common/TimerQueue.h"
 
 #include <cstdio>
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
 #include <vector>
 #include <functional>
@@ -60,12 +61,12 @@ namespace lookups
          * @brief Gets the count of unit registrations.
          * @returns uint32_t Total count of unit registrations.
          */
-        uint32_t unitRegSize() const { return m_unitRegTable.size(); }
+        uint32_t unitRegSize() const { return (uint32_t)m_unitRegTable.size(); }
         /**
          * @brief Gets the unit registration table.
          * @returns std::vector<uint32> Unit Registration Table.
          */
-        std::vector<uint32_t> unitRegTable() const { return m_unitRegTable; }
+        std::vector<uint32_t> unitRegTable() const { return std::vector<uint32_t>(m_unitRegTable.begin(), m_unitRegTable.end()); }
         /**
          * @brief Helper to register a source ID.
          * @param srcId Source Radio ID.
@@ -277,15 +278,15 @@ namespace lookups
     protected:
         uint8_t m_rfGrantChCnt;
 
-        std::vector<uint32_t> m_unitRegTable;
-        std::unordered_map<uint32_t, Timer> m_unitRegTimers;
+        std::unordered_set<uint32_t> m_unitRegTable;
+        TimerQueue m_unitRegTimers;
         std::unordered_map<uint32_t, uint32_t> m_grpAffTable;
 
         std::unordered_map<uint32_t, uint32_t> m_grantChTable;
         std::unordered_map<uint32_t, uint32_t> m_grantSrcIdTable;
         std::unordered_map<uint32_t, bool> m_uuGrantedTable;
         std::unordered_map<uint32_t, bool> m_netGrantedTable;
-        std::unordered_map<uint32_t, Timer> m_grantTimers;
+        TimerQueue m_grantTimers;
 
         //                 chNo      dstId     slot
         std::function<void(uint32_t, uint32_t, uint8_t)> m_releaseGrant;
@@ -24,6 +24,7 @@
 #include "common/Defines.h"
 #include "common/lookups/LookupTable.h"
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -144,6 +145,12 @@ namespace lookups
          * @returns std::vector<IdenTable> List of all entries in the lookup table.
          */
         std::vector<IdenTable> list();
+        /**
+         * @brief Returns the version of this lookup table.
+         *  The version changes whenever the table is (re)loaded or cleared.
+         * @returns uint32_t Version of the lookup table.
+         */
+        uint32_t version() const { return m_version.load(); }
 
     protected:
         /**
@@ -160,6 +167,7 @@ namespace lookups
 
     private:
         static std::mutex m_mutex;
+        std::atomic<uint32_t> m_version;
     };
 } // namespace lookups
 
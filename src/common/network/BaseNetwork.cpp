@@ -679,6 +679,16 @@ bool BaseNetwork::hasNXDNData() const
     return true;
 }
 
+/* Gets the descriptor of the network socket (e.g. for readiness polling). */
+
+int BaseNetwork::getDescriptor() const
+{
+    if (m_socket == nullptr)
+        return -1;
+
+    return m_socket->getDescriptor();
+}
+
 // ---------------------------------------------------------------------------
 //  Protected Class Members
 // ---------------------------------------------------------------------------
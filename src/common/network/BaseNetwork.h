@@ -421,6 +421,12 @@ namespace network
          */
         bool hasNXDNData() const;
 
+        /**
+         * @brief Gets the descriptor of the network socket (e.g. for readiness polling).
+         * @returns int Socket descriptor, or -1 if the socket is not open.
+         */
+        int getDescriptor() const;
+
     public:
         /**
          * @brief Gets the peer ID of the network.
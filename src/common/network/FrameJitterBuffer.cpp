@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/FrameJitterBuffer.h"
+#include "network/RTPFNEHeader.h"
+
+using namespace network;
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define JITTER_DELAY_MULT 4.0f          // playout delay in multiples of the jitter estimate
+#define MAX_FRAME_SPACING_MS 1000U      // a gap longer than this is a pause in the stream, not jitter
+#define STREAM_IDLE_MS 1000U            // an empty stream is retired after this long without frames
+
+const uint32_t EXT_SEQ_START = 0x100000U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the distance between two RTP sequence numbers; the DVM sequence wraps before RTP_END_OF_CALL_SEQ. */
+
+static int32_t seqOffset(uint16_t seq, uint16_t ref)
+{
+    int32_t offset = (int32_t)seq - (int32_t)ref;
+    if (offset > (RTP_END_OF_CALL_SEQ / 2))
+        offset -= RTP_END_OF_CALL_SEQ;
+    if (offset < -(RTP_END_OF_CALL_SEQ / 2))
+        offset += RTP_END_OF_CALL_SEQ;
+
+    return offset;
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the FrameJitterBuffer class. */
+
+FrameJitterBuffer::FrameJitterBuffer(const std::string& name, uint32_t minDelay, uint32_t maxDelay) :
+    m_name(name),
+    m_minDelay(minDelay),
+    m_maxDelay(maxDelay),
+    m_streams(),
+    m_meanSpacing(0.0f),
+    m_jitter(0.0f),
+    m_totals(),
+    m_mutex()
+{
+    if (m_maxDelay < m_minDelay)
+        m_maxDelay = m_minDelay;
+}
+
+/* Finalizes a instance of the FrameJitterBuffer class. */
+
+FrameJitterBuffer::~FrameJitterBuffer() = default;
+
+/* Adds a received frame to the buffer. */
+
+bool FrameJitterBuffer::addFrame(uint32_t streamId, uint16_t seq, const uint8_t* data, uint32_t length, uint64_t arrivalMs)
+{
+    assert(data != nullptr);
+
+    if (length == 0U || length > JITTER_BUFFER_FRAME_LEN)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_streams.find(streamId);
+    if (it == m_streams.end()) {
+        std::unique_ptr<Stream> stream = std::unique_ptr<Stream>(new Stream());
+        stream->meanSpacing = m_meanSpacing;
+        stream->jitter = m_jitter;
+        stream->stats.streamId = streamId;
+
+        it = m_streams.emplace(streamId, std::move(stream)).first;
+    }
+
+    Stream& stream = *it->second;
+    stream.lastArrival = arrivalMs;
+
+    // frames without a sequence follow whatever was sequenced before them
+    if (seq == RTP_END_OF_CALL_SEQ) {
+        Unsequenced frame = Unsequenced();
+        frame.after = stream.highSeq;
+        frame.data.assign(data, data + length);
+        stream.unsequenced.push_back(frame);
+
+        stream.stats.received++;
+        return true;
+    }
+
+    if (!stream.synced) {
+        stream.baseSeq = EXT_SEQ_START;
+        stream.nextSeq = EXT_SEQ_START;
+        stream.highSeq = EXT_SEQ_START;
+        stream.highRawSeq = seq;
+        stream.firstArrival = arrivalMs;
+        stream.synced = true;
+    }
+
+    uint32_t ext = stream.highSeq + seqOffset(seq, stream.highRawSeq);
+
+    int32_t offset = (int32_t)(ext - stream.nextSeq);
+    if (offset < 0) {
+        // a frame just behind the first frame while still holding the stream is the real start
+        // of the stream, whose first frames arrived out of order; anything else has missed its
+        // playout point
+        if (!stream.started && (stream.highSeq - ext) < JITTER_BUFFER_SLOTS) {
+            stream.nextSeq = ext;
+            offset = 0;
+        }
+        else {
+            stream.stats.late++;
+            return false;
+        }
+    }
+
+    // too far ahead of the playout point to fit; the sender restarted or we lost a great deal, resync
+    if (offset >= (int32_t)JITTER_BUFFER_SLOTS) {
+        for (uint32_t i = 0U; i < JITTER_BUFFER_SLOTS; i++) {
+            if (stream.slots[i].valid) {
+                stream.slots[i].valid = false;
+                stream.stats.lost++;
+            }
+        }
+
+        stream.count = 0U;
+        stream.baseSeq = ext;
+        stream.nextSeq = ext;
+        stream.highSeq = ext;
+        stream.highRawSeq = seq;
+        stream.firstArrival = arrivalMs;
+        stream.lastSpacedSeq = 0U;
+        stream.haveTransit = false;
+    }
+
+    Slot& slot = stream.slots[ext % JITTER_BUFFER_SLOTS];
+    if (slot.valid && slot.seq == ext) {
+        stream.stats.duplicates++;
+        return false;
+    }
+
+    ::memcpy(slot.data, data, length);
+    slot.length = length;
+    slot.seq = ext;
+    slot.arrival = arrivalMs;
+    slot.valid = true;
+    stream.count++;
+    stream.stats.received++;
+
+    if (ext < stream.highSeq) {
+        stream.stats.reordered++;
+    }
+    else {
+        stream.highSeq = ext;
+        stream.highRawSeq = seq;
+    }
+
+    // measure the mean frame spacing from frames arriving in order
+    if (ext > stream.lastSpacedSeq) {
+        if (stream.lastSpacedSeq != 0U) {
+            float spacing = (float)(arrivalMs - stream.lastSpacedArrival) / (float)(ext - stream.lastSpacedSeq);
+            if (spacing < MAX_FRAME_SPACING_MS) {
+                if (stream.meanSpacing == 0.0f)
+                    stream.meanSpacing = spacing;
+                else
+                    stream.meanSpacing += (spacing - stream.meanSpacing) / 16.0f;
+            }
+        }
+
+        stream.lastSpacedSeq = ext;
+        stream.lastSpacedArrival = arrivalMs;
+    }
+
+    // RFC 3550 A.8 interarrival jitter, against the media clock rebuilt from the sequence
+    if (stream.meanSpacing > 0.0f) {
+        double transit = (double)(arrivalMs - stream.firstArrival) - ((double)((int32_t)(ext - stream.baseSeq)) * stream.meanSpacing);
+        if (stream.haveTransit) {
+            double d = std::fabs(transit - stream.lastTransit);
+            if (d < MAX_FRAME_SPACING_MS)
+                stream.jitter += ((float)d - stream.jitter) / 16.0f;
+        }
+
+        stream.lastTransit = transit;
+        stream.haveTransit = true;
+    }
+
+    return true;
+}
+
+/* Gets the next frame due for release. */
+
+bool FrameJitterBuffer::getFrame(uint64_t nowMs, uint8_t* data, uint32_t& length)
+{
+    assert(data != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_streams.begin(); it != m_streams.end();) {
+        Stream& stream = *it->second;
+        if (releaseFrame(stream, nowMs, data, length))
+            return true;
+
+        // retire streams that have drained and gone quiet
+        if (stream.count == 0U && stream.unsequenced.empty() && (nowMs - stream.lastArrival) >= (m_maxDelay + STREAM_IDLE_MS)) {
+            retire(stream);
+            it = m_streams.erase(it);
+            continue;
+        }
+
+        ++it;
+    }
+
+    return false;
+}
+
+/* Discards all buffered frames and streams. */
+
+void FrameJitterBuffer::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& entry : m_streams) {
+        retire(*entry.second);
+    }
+
+    m_streams.clear();
+}
+
+/* Gets the statistics of the buffer. */
+
+void FrameJitterBuffer::getStats(std::vector<JitterBufferStats>& streams, JitterBufferStats& totals) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    streams.clear();
+    totals = m_totals;
+    totals.streamId = 0U;
+    totals.depth = 0U;
+    totals.delayMs = delay(m_jitter);
+    totals.jitterMs = (uint32_t)m_jitter;
+
+    for (auto& entry : m_streams) {
+        const Stream& stream = *entry.second;
+
+        JitterBufferStats stats = stream.stats;
+        stats.depth = stream.count + (uint32_t)stream.unsequenced.size();
+        stats.delayMs = delay(stream.jitter);
+        stats.jitterMs = (uint32_t)stream.jitter;
+        streams.push_back(stats);
+
+        totals.depth += stats.depth;
+        totals.received += stats.received;
+        totals.released += stats.released;
+        totals.reordered += stats.reordered;
+        totals.late += stats.late;
+        totals.duplicates += stats.duplicates;
+        totals.lost += stats.lost;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to release the next due frame of a stream. */
+
+bool FrameJitterBuffer::releaseFrame(Stream& stream, uint64_t nowMs, uint8_t* data, uint32_t& length)
+{
+    // frames without a sequence go once everything sequenced before them has
+    if (!stream.unsequenced.empty()) {
+        const Unsequenced& frame = stream.unsequenced.front();
+        if (!stream.synced || frame.after < stream.nextSeq) {
+            length = (uint32_t)frame.data.size();
+            ::memcpy(data, frame.data.data(), length);
+
+            stream.unsequenced.pop_front();
+            stream.stats.released++;
+            return true;
+        }
+    }
+
+    if (stream.count == 0U)
+        return false;
+
+    uint32_t playoutDelay = delay(stream.jitter);
+    if (!stream.started) {
+        if ((nowMs - stream.firstArrival) < playoutDelay)
+            return false;
+
+        stream.started = true;
+    }
+
+    Slot* slot = &stream.slots[stream.nextSeq % JITTER_BUFFER_SLOTS];
+    if (!slot->valid || slot->seq != stream.nextSeq) {
+        // find the oldest frame buffered behind the gap
+        slot = nullptr;
+        for (uint32_t n = 1U; n < JITTER_BUFFER_SLOTS; n++) {
+            Slot& next = stream.slots[(stream.nextSeq + n) % JITTER_BUFFER_SLOTS];
+            if (next.valid && next.seq == stream.nextSeq + n) {
+                slot = &next;
+                break;
+            }
+        }
+
+        if (slot == nullptr)
+            return false;
+
+        // give up on the missing frames once the frame behind them has waited the playout delay
+        if ((nowMs - slot->arrival) < playoutDelay)
+            return false;
+
+        stream.stats.lost += slot->seq - stream.nextSeq;
+        stream.nextSeq = slot->seq;
+    }
+
+    length = slot->length;
+    ::memcpy(data, slot->data, length);
+
+    slot->valid = false;
+    stream.count--;
+    stream.nextSeq++;
+    stream.stats.released++;
+    return true;
+}
+
+/* Helper to retire a stream, folding its statistics into the buffer totals. */
+
+void FrameJitterBuffer::retire(const Stream& stream)
+{
+    m_totals.received += stream.stats.received;
+    m_totals.released += stream.stats.released;
+    m_totals.reordered += stream.stats.reordered;
+    m_totals.late += stream.stats.late;
+    m_totals.duplicates += stream.stats.duplicates;
+    m_totals.lost += stream.stats.lost;
+
+    // the next stream starts from what this stream measured
+    if (stream.meanSpacing > 0.0f) {
+        m_meanSpacing = stream.meanSpacing;
+        m_jitter = stream.jitter;
+    }
+}
+
+/* Helper to calculate the playout delay for the given jitter estimate. */
+
+uint32_t FrameJitterBuffer::delay(float jitter) const
+{
+    uint32_t delay = (uint32_t)::ceilf(jitter * JITTER_DELAY_MULT);
+    if (delay < m_minDelay)
+        delay = m_minDelay;
+    if (delay > m_maxDelay)
+        delay = m_maxDelay;
+
+    return delay;
+}
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file FrameJitterBuffer.h
+ * @ingroup network_core
+ * @file FrameJitterBuffer.cpp
+ * @ingroup network_core
+ */
+#if !defined(__FRAME_JITTER_BUFFER_H__)
+#define __FRAME_JITTER_BUFFER_H__
+
+#include "common/Defines.h"
+
+#include <string>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t JITTER_BUFFER_SLOTS = 64U;
+    const uint32_t JITTER_BUFFER_FRAME_LEN = 255U;
+
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Statistics for a network jitter buffer stream.
+     * @ingroup network_core
+     */
+    struct JitterBufferStats {
+        uint32_t streamId;                  //! Stream ID (0 for the buffer totals)
+        uint32_t depth;                     //! Frames Currently Buffered
+        uint32_t delayMs;                   //! Current Playout Delay (ms)
+        uint32_t jitterMs;                  //! Interarrival Jitter (ms)
+        uint32_t received;                  //! Frames Buffered
+        uint32_t released;                  //! Frames Released
+        uint32_t reordered;                 //! Frames Received Out of Order (and put back in order)
+        uint32_t late;                      //! Frames Dropped After Their Playout Point
+        uint32_t duplicates;                //! Frames Dropped As Duplicates
+        uint32_t lost;                      //! Frames Never Received (skipped over)
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements an adaptive playout buffer for network protocol frames, per stream.
+     *
+     *  Each stream ID gets its own window of frames slotted by RTP sequence number, so reordered
+     *  frames are put back in order and duplicate or late frames are discarded. A stream is held
+     *  for the playout delay before its first frame is released, which gives the downstream
+     *  (modem) queue that much cushion against late frames; after that, frames are released as
+     *  soon as they are next in sequence. A frame that is still missing once a frame behind it
+     *  has waited the playout delay is given up on and skipped.
+     *
+     *  The playout delay follows the RFC 3550 interarrival jitter estimate, bounded by the
+     *  configured minimum and maximum delay. As the DVM RTP timestamp advances by a fixed step
+     *  per packet rather than by media time, the media clock the estimate needs is rebuilt from
+     *  the sequence number and the mean frame spacing of the stream. New streams start from the
+     *  estimate of the last stream.
+     *
+     *  Frames sent without a sequence (RTP_END_OF_CALL_SEQ; terminators and signalling) are
+     *  released behind every sequenced frame received before them.
+     *
+     *  All methods are safe to call from multiple threads.
+     * @ingroup network_core
+     */
+    class HOST_SW_API FrameJitterBuffer {
+    public:
+        /**
+         * @brief Initializes a new instance of the FrameJitterBuffer class.
+         * @param name Name of the buffer.
+         * @param minDelay Minimum playout delay (in milliseconds).
+         * @param maxDelay Maximum playout delay (in milliseconds).
+         */
+        FrameJitterBuffer(const std::string& name, uint32_t minDelay, uint32_t maxDelay);
+        /**
+         * @brief Finalizes a instance of the FrameJitterBuffer class.
+         */
+        ~FrameJitterBuffer();
+
+        /**
+         * @brief Adds a received frame to the buffer.
+         * @param streamId Stream ID of the frame.
+         * @param seq RTP sequence number of the frame.
+         * @param[in] data Frame data.
+         * @param length Length of the frame data.
+         * @param arrivalMs Local arrival time of the frame (in milliseconds).
+         * @returns bool True, if the frame was buffered, otherwise false (late, duplicate or oversized).
+         */
+        bool addFrame(uint32_t streamId, uint16_t seq, const uint8_t* data, uint32_t length, uint64_t arrivalMs);
+        /**
+         * @brief Gets the next frame due for release. This should be called until it returns false.
+         * @param nowMs Current time (in milliseconds).
+         * @param[out] data Buffer to write the frame data to (at least JITTER_BUFFER_FRAME_LEN bytes).
+         * @param[out] length Length of the frame data.
+         * @returns bool True, if a frame was written, otherwise false.
+         */
+        bool getFrame(uint64_t nowMs, uint8_t* data, uint32_t& length);
+
+        /**
+         * @brief Discards all buffered frames and streams.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the statistics of the buffer.
+         * @param[out] streams Statistics of each active stream.
+         * @param[out] totals Statistics of the buffer over all streams.
+         */
+        void getStats(std::vector<JitterBufferStats>& streams, JitterBufferStats& totals) const;
+
+        /**
+         * @brief Gets the name of the buffer.
+         * @returns std::string Name of the buffer.
+         */
+        std::string name() const { return m_name; }
+
+    private:
+        /**
+         * @brief Represents a buffered frame.
+         */
+        struct Slot {
+            uint8_t data[JITTER_BUFFER_FRAME_LEN];  //! Frame Data
+            uint32_t length;                        //! Frame Length
+            uint32_t seq;                           //! Extended Sequence
+            uint64_t arrival;                       //! Arrival Time (ms)
+            bool valid;                             //! Slot Holds A Frame
+        };
+
+        /**
+         * @brief Represents a frame sent without a sequence.
+         */
+        struct Unsequenced {
+            uint32_t after;                         //! Extended Sequence Released Before This Frame
+            std::vector<uint8_t> data;              //! Frame Data
+        };
+
+        /**
+         * @brief Represents a stream.
+         */
+        struct Stream {
+            Slot slots[JITTER_BUFFER_SLOTS];
+            uint32_t count;
+
+            bool synced;
+            bool started;
+            uint64_t firstArrival;
+            uint64_t lastArrival;
+
+            uint32_t baseSeq;
+            uint32_t nextSeq;
+            uint32_t highSeq;
+            uint16_t highRawSeq;
+
+            uint32_t lastSpacedSeq;
+            uint64_t lastSpacedArrival;
+            float meanSpacing;
+
+            bool haveTransit;
+            double lastTransit;
+            float jitter;
+
+            std::deque<Unsequenced> unsequenced;
+
+            JitterBufferStats stats;
+        };
+
+        std::string m_name;
+        uint32_t m_minDelay;
+        uint32_t m_maxDelay;
+
+        std::unordered_map<uint32_t, std::unique_ptr<Stream>> m_streams;
+
+        float m_meanSpacing;
+        float m_jitter;
+        JitterBufferStats m_totals;
+
+        mutable std::mutex m_mutex;
+
+        /**
+         * @brief Helper to release the next due frame of a stream.
+         * @param stream Stream.
+         * @param nowMs Current time (in milliseconds).
+         * @param[out] data Buffer to write the frame data to.
+         * @param[out] length Length of the frame data.
+         * @returns bool True, if a frame was written, otherwise false.
+         */
+        bool releaseFrame(Stream& stream, uint64_t nowMs, uint8_t* data, uint32_t& length);
+        /**
+         * @brief Helper to retire a stream, folding its statistics into the buffer totals.
+         * @param stream Stream.
+         */
+        void retire(const Stream& stream);
+        /**
+         * @brief Helper to calculate the playout delay for the given jitter estimate.
+         * @param jitter Interarrival jitter (in milliseconds).
+         * @returns uint32_t Playout delay (in milliseconds).
+         */
+        uint32_t delay(float jitter) const;
+    };
+} // namespace network
+
+#endif // __FRAME_JITTER_BUFFER_H__
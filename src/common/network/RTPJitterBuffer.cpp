@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/RTPJitterBuffer.h"
+
+using namespace network;
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define MAX_CONCEALED_FRAMES 3U         // beyond 60ms of repeated audio the result is worse than silence
+#define CONCEALMENT_FADE 0.5f
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the RTPJitterBuffer class. */
+
+RTPJitterBuffer::RTPJitterBuffer(uint32_t frameLength, uint32_t minDelay, uint32_t maxDelay, uint32_t clockRate) :
+    m_playing(false),
+    m_targetDelay(minDelay),
+    m_late(0U),
+    m_duplicates(0U),
+    m_concealed(0U),
+    m_frameLength(frameLength),
+    m_minDelay(minDelay),
+    m_maxDelay(maxDelay),
+    m_clockRate(clockRate),
+    m_slots(0U),
+    m_buffer(),
+    m_valid(),
+    m_seq(),
+    m_count(0U),
+    m_synced(false),
+    m_nextSeq(0U),
+    m_highSeq(0U),
+    m_lastFrame(),
+    m_lossRun(0U),
+    m_haveTransit(false),
+    m_lastTransit(0),
+    m_jitter(0.0f)
+{
+    assert(frameLength > 0U);
+    assert(clockRate > 0U);
+
+    if (m_minDelay < 1U)
+        m_minDelay = 1U;
+    if (m_maxDelay < m_minDelay)
+        m_maxDelay = m_minDelay;
+    m_targetDelay = m_minDelay;
+
+    // room for the deepest playout delay, plus as much again of frames arriving early; rounded up to a
+    // power of two so the slot index of a sequence number stays consistent across sequence wraparound
+    m_slots = 1U;
+    while (m_slots < m_maxDelay * 2U)
+        m_slots <<= 1;
+
+    m_buffer.resize(m_slots * m_frameLength, 0);
+    m_valid.resize(m_slots, false);
+    m_seq.resize(m_slots, 0U);
+    m_lastFrame.resize(m_frameLength, 0);
+}
+
+/* Finalizes a instance of the RTPJitterBuffer class. */
+
+RTPJitterBuffer::~RTPJitterBuffer() = default;
+
+/* Adds a received audio frame to the buffer. */
+
+bool RTPJitterBuffer::addFrame(const frame::RTPHeader& header, const short* samples, uint64_t arrivalMs)
+{
+    assert(samples != nullptr);
+
+    uint16_t seq = header.getSequence();
+
+    // RFC 3550 A.8 interarrival jitter, in timestamp units
+    int64_t transit = (int64_t)((arrivalMs * m_clockRate) / 1000U) - (int64_t)header.getTimestamp();
+    if (m_haveTransit) {
+        int64_t d = transit - m_lastTransit;
+        if (d < 0)
+            d = -d;
+
+        // a jump of more than a second is a new stream or a clock reset, not jitter
+        if (d < (int64_t)m_clockRate)
+            m_jitter += ((float)d - m_jitter) / 16.0f;
+    }
+    m_lastTransit = transit;
+    m_haveTransit = true;
+
+    if (!m_synced) {
+        m_nextSeq = seq;
+        m_synced = true;
+    }
+
+    int16_t offset = (int16_t)(uint16_t)(seq - m_nextSeq);
+    if (offset < 0) {
+        // a frame just behind the playout point while not playing is the new start of a talkspurt
+        // whose first frames arrived out of order; anything else has missed its playout time
+        if (!m_playing && (m_count == 0U || (uint16_t)(m_highSeq - seq) < m_slots)) {
+            m_nextSeq = seq;
+            offset = 0;
+        }
+        else {
+            m_late++;
+            return false;
+        }
+    }
+
+    // too far ahead of the playout point to fit; the sender restarted or we lost a great deal, resync
+    if ((uint32_t)offset >= m_slots) {
+        reset();
+        m_nextSeq = seq;
+        m_synced = true;
+    }
+
+    uint32_t slot = seq % m_slots;
+    if (m_valid[slot] && m_seq[slot] == seq) {
+        m_duplicates++;
+        return false;
+    }
+
+    // a slot still holding a different (stale) frame is replaced, not counted again
+    bool replaced = m_valid[slot];
+
+    ::memcpy(m_buffer.data() + (slot * m_frameLength), samples, m_frameLength * sizeof(short));
+    m_valid[slot] = true;
+    m_seq[slot] = seq;
+    if (m_count == 0U || (int16_t)(uint16_t)(seq - m_highSeq) > 0)
+        m_highSeq = seq;
+    if (!replaced)
+        m_count++;
+
+    return true;
+}
+
+/* Gets the audio frame due for playout. */
+
+bool RTPJitterBuffer::getFrame(short* samples)
+{
+    assert(samples != nullptr);
+
+    if (!m_playing) {
+        // adapt the playout delay at talkspurt boundaries, where changing it cannot be heard
+        float frameTicks = (float)m_frameLength;
+        uint32_t target = m_minDelay + (uint32_t)::ceilf((m_jitter * 2.0f) / frameTicks);
+        if (target > m_maxDelay)
+            target = m_maxDelay;
+        m_targetDelay = target;
+
+        if (m_count < m_targetDelay)
+            return false;
+
+        // start from the oldest buffered frame, rather than concealing frames lost ahead of it
+        for (uint32_t n = 0U; n < m_slots; n++) {
+            uint32_t slot = m_nextSeq % m_slots;
+            if (m_valid[slot] && m_seq[slot] == m_nextSeq)
+                break;
+            m_nextSeq++;
+        }
+
+        m_playing = true;
+        m_lossRun = 0U;
+    }
+
+    uint32_t slot = m_nextSeq % m_slots;
+    if (m_valid[slot] && m_seq[slot] == m_nextSeq) {
+        ::memcpy(samples, m_buffer.data() + (slot * m_frameLength), m_frameLength * sizeof(short));
+        ::memcpy(m_lastFrame.data(), samples, m_frameLength * sizeof(short));
+
+        m_valid[slot] = false;
+        m_count--;
+        m_lossRun = 0U;
+    }
+    else {
+        // nothing left to wait for; the talkspurt has ended
+        if (m_count == 0U && m_lossRun >= MAX_CONCEALED_FRAMES) {
+            m_playing = false;
+            return false;
+        }
+
+        // conceal the missing frame by repeating the last good frame at decreasing level
+        for (uint32_t i = 0U; i < m_frameLength; i++) {
+            m_lastFrame[i] = (short)(m_lastFrame[i] * CONCEALMENT_FADE);
+            samples[i] = m_lastFrame[i];
+        }
+
+        m_lossRun++;
+        m_concealed++;
+    }
+
+    m_nextSeq++;
+    return true;
+}
+
+/* Discards all buffered frames and stops playout. */
+
+void RTPJitterBuffer::reset()
+{
+    std::fill(m_valid.begin(), m_valid.end(), false);
+    std::fill(m_lastFrame.begin(), m_lastFrame.end(), 0);
+    m_count = 0U;
+
+    m_playing = false;
+    m_synced = false;
+    m_nextSeq = 0U;
+    m_lossRun = 0U;
+}
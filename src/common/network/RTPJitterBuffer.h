@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file RTPJitterBuffer.h
+ * @ingroup network_core
+ * @file RTPJitterBuffer.cpp
+ * @ingroup network_core
+ */
+#if !defined(__RTP_JITTER_BUFFER_H__)
+#define __RTP_JITTER_BUFFER_H__
+
+#include "common/Defines.h"
+#include "common/network/RTPHeader.h"
+
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements an adaptive playout buffer for fixed length RTP audio frames.
+     *
+     *  Frames are slotted by RTP sequence number, so reordered packets are put back in order and
+     *  duplicate or late packets are discarded. Playout starts once the buffer holds the target
+     *  delay worth of frames; the target is re-derived at the start of every talkspurt from the
+     *  RFC 3550 interarrival jitter estimate, bounded by the configured minimum and maximum delay.
+     *
+     *  A frame missing at its playout time is concealed by repeating the last good frame at
+     *  decreasing level; after a run of concealed frames with nothing buffered, playout stops
+     *  until the next talkspurt fills the buffer again.
+     * @ingroup network_core
+     */
+    class HOST_SW_API RTPJitterBuffer {
+    public:
+        /**
+         * @brief Initializes a new instance of the RTPJitterBuffer class.
+         * @param frameLength Number of samples in each audio frame.
+         * @param minDelay Minimum playout delay (in frames).
+         * @param maxDelay Maximum playout delay (in frames).
+         * @param clockRate RTP timestamp clock rate (in Hz).
+         */
+        RTPJitterBuffer(uint32_t frameLength, uint32_t minDelay, uint32_t maxDelay, uint32_t clockRate = RTP_GENERIC_CLOCK_RATE);
+        /**
+         * @brief Finalizes a instance of the RTPJitterBuffer class.
+         */
+        ~RTPJitterBuffer();
+
+        /**
+         * @brief Adds a received audio frame to the buffer.
+         * @param header RTP header of the received frame.
+         * @param[in] samples Audio samples of the frame (frameLength samples).
+         * @param arrivalMs Local arrival time of the frame (in milliseconds).
+         * @returns bool True, if the frame was buffered, otherwise false (late or duplicate).
+         */
+        bool addFrame(const frame::RTPHeader& header, const short* samples, uint64_t arrivalMs);
+        /**
+         * @brief Gets the audio frame due for playout. This should be called once every frame period.
+         * @param[out] samples Buffer to write the frame's audio samples to (frameLength samples).
+         * @returns bool True, if a frame (received or concealed) was written, otherwise false (not playing).
+         */
+        bool getFrame(short* samples);
+
+        /**
+         * @brief Discards all buffered frames and stops playout.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the number of frames currently buffered.
+         * @returns uint32_t Number of frames buffered.
+         */
+        uint32_t depth() const { return m_count; }
+        /**
+         * @brief Gets the current interarrival jitter estimate.
+         * @returns uint32_t Interarrival jitter (in milliseconds).
+         */
+        uint32_t jitterMs() const { return (uint32_t)((m_jitter * 1000.0f) / m_clockRate); }
+
+    public:
+        /**
+         * @brief Flag indicating whether frames are being played out.
+         */
+        __READONLY_PROPERTY_PLAIN(bool, playing);
+        /**
+         * @brief Current playout delay target (in frames).
+         */
+        __READONLY_PROPERTY_PLAIN(uint32_t, targetDelay);
+        /**
+         * @brief Number of frames dropped because they arrived after their playout time.
+         */
+        __READONLY_PROPERTY_PLAIN(uint32_t, late);
+        /**
+         * @brief Number of frames dropped because they were already buffered.
+         */
+        __READONLY_PROPERTY_PLAIN(uint32_t, duplicates);
+        /**
+         * @brief Number of frames concealed because they were missing at their playout time.
+         */
+        __READONLY_PROPERTY_PLAIN(uint32_t, concealed);
+
+    private:
+        uint32_t m_frameLength;
+        uint32_t m_minDelay;
+        uint32_t m_maxDelay;
+        uint32_t m_clockRate;
+
+        uint32_t m_slots;
+        std::vector<short> m_buffer;
+        std::vector<bool> m_valid;
+        std::vector<uint16_t> m_seq;
+        uint32_t m_count;
+
+        bool m_synced;
+        uint16_t m_nextSeq;
+        uint16_t m_highSeq;
+
+        std::vector<short> m_lastFrame;
+        uint32_t m_lossRun;
+
+        bool m_haveTransit;
+        int64_t m_lastTransit;
+        float m_jitter;
+    };
+} // namespace network
+
+#endif // __RTP_JITTER_BUFFER_H__
@@ -176,6 +176,20 @@ void Socket::close()
 #endif // defined(_WIN32)
 }
 
+/* Gets the descriptor of the UDP socket (e.g. for readiness polling). */
+
+int Socket::getDescriptor() const
+{
+#if defined(_WIN32)
+    if (m_fd == INVALID_SOCKET)
+        return -1;
+
+    return (int)m_fd;
+#else
+    return m_fd;
+#endif // defined(_WIN32)
+}
+
 /* Read data from the UDP socket. */
 
 ssize_t Socket::read(uint8_t* buffer, uint32_t length, sockaddr_storage& address, uint32_t& addrLen) noexcept
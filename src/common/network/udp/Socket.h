@@ -227,6 +227,12 @@ namespace network
              */
             void close();
 
+            /**
+             * @brief Gets the descriptor of the UDP socket (e.g. for readiness polling).
+             * @returns int Socket descriptor, or -1 if the socket is not open.
+             */
+            int getDescriptor() const;
+
             /**
              * @brief Read data from the UDP socket.
              * @param[out] buffer Buffer to read data into.
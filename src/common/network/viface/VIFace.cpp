@@ -468,14 +468,13 @@ bool VIFace::isUp() const
 
 /* Read a packet from the virtual interface. */
 
-ssize_t VIFace::read(uint8_t* buffer)
+ssize_t VIFace::read(uint8_t* buffer, uint32_t timeout)
 {
     assert(buffer != nullptr);
-    ::memset(buffer, 0x00U, m_mtu);
 
     struct epoll_event wait_event;
 
-    int ret = epoll_wait(m_epollFd, &wait_event, 1, 0);
+    int ret = epoll_wait(m_epollFd, &wait_event, 1, (int)timeout);
     if ((ret < 0) && (errno != EINTR)) {
         LogError(LOG_NET, "Error returned from epoll_wait, err: %d, error: %s", errno, strerror(errno));
         return -1;
@@ -103,9 +103,11 @@ namespace network
              *
              * @param[out] buffer The packet (if tun) or frame (if tap) as a binary blob
              *  (array of bytes).
+             * @param timeout Time to wait for a packet to arrive (in milliseconds); by default
+             *  this does not wait.
              * @returns ssize_t Actual length of data read from remote UDP socket.
              */
-            ssize_t read(uint8_t* buffer);
+            ssize_t read(uint8_t* buffer, uint32_t timeout = 0U);
             /**
              * @brief Write a packet to this virtual interface.
              *
@@ -20,6 +20,7 @@
 #define  __NXDN_DEFINES_H__
 
 #include "common/Defines.h"
+#include "common/Utils.h"
 
 // Shorthand macro to nxdn::defines -- keeps source code that doesn't use "using" concise
 #define NXDDEF nxdn::defines
@@ -116,6 +117,19 @@ namespace nxdn
         const uint32_t  PCKT_INFO_LENGTH_BYTES = 3U;
         /** @} */
 
+        /** @name Interleave Tables */
+        /** @brief SACCH Interleaver (5 rows by 12 columns) */
+        constexpr BlockInterleaveTable<NXDN_SACCH_FEC_LENGTH_BITS, 12U> SACCH_INTERLEAVE{};
+        /** @brief FACCH1 Interleaver (9 rows by 16 columns) */
+        constexpr BlockInterleaveTable<NXDN_FACCH1_FEC_LENGTH_BITS, 16U> FACCH1_INTERLEAVE{};
+        /** @brief UDCH Interleaver (29 rows by 12 columns) */
+        constexpr BlockInterleaveTable<NXDN_UDCH_FEC_LENGTH_BITS, 12U> UDCH_INTERLEAVE{};
+        /** @brief Outbound CAC Interleaver (25 rows by 12 columns) */
+        constexpr BlockInterleaveTable<NXDN_CAC_FEC_LENGTH_BITS, 12U> CAC_OUT_INTERLEAVE{};
+        /** @brief Inbound CAC Interleaver (21 rows by 12 columns) */
+        constexpr BlockInterleaveTable<NXDN_CAC_IN_FEC_LENGTH_BITS, 12U> CAC_IN_INTERLEAVE{};
+        /** @} */
+
         /** @name Thresholds */
         /** @brief Default Silence Threshold */
         const uint32_t  DEFAULT_SILENCE_THRESHOLD = 14U;
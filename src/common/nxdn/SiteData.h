@@ -168,6 +168,28 @@ namespace nxdn
             return *this;
         }
 
+        /**
+         * @brief Equality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data is the same, otherwise false.
+         */
+        bool operator==(const SiteData& data) const
+        {
+            return m_locId == data.m_locId &&
+                m_channelId == data.m_channelId && m_channelNo == data.m_channelNo &&
+                m_siteInfo1 == data.m_siteInfo1 && m_siteInfo2 == data.m_siteInfo2 &&
+                m_isAdjSite == data.m_isAdjSite &&
+                m_callsign == data.m_callsign &&
+                m_requireReg == data.m_requireReg &&
+                m_netActive == data.m_netActive;
+        }
+        /**
+         * @brief Inequality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data differs, otherwise false.
+         */
+        bool operator!=(const SiteData& data) const { return !(*this == data); }
+
     public:
         /** @name Site Data */
         /**
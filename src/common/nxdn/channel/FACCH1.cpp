@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2018 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "nxdn/channel/FACCH1.h"
@@ -25,17 +26,6 @@ using namespace nxdn::channel;
 //  Constants
 // ---------------------------------------------------------------------------
 
-const uint32_t INTERLEAVE_TABLE[] = {
-    0U,  9U, 18U, 27U, 36U, 45U, 54U, 63U, 72U, 81U, 90U,  99U, 108U, 117U, 126U, 135U,
-    1U, 10U, 19U, 28U, 37U, 46U, 55U, 64U, 73U, 82U, 91U, 100U, 109U, 118U, 127U, 136U,
-    2U, 11U, 20U, 29U, 38U, 47U, 56U, 65U, 74U, 83U, 92U, 101U, 110U, 119U, 128U, 137U,
-    3U, 12U, 21U, 30U, 39U, 48U, 57U, 66U, 75U, 84U, 93U, 102U, 111U, 120U, 129U, 138U,
-    4U, 13U, 22U, 31U, 40U, 49U, 58U, 67U, 76U, 85U, 94U, 103U, 112U, 121U, 130U, 139U,
-    5U, 14U, 23U, 32U, 41U, 50U, 59U, 68U, 77U, 86U, 95U, 104U, 113U, 122U, 131U, 140U,
-    6U, 15U, 24U, 33U, 42U, 51U, 60U, 69U, 78U, 87U, 96U, 105U, 114U, 123U, 132U, 141U,
-    7U, 16U, 25U, 34U, 43U, 52U, 61U, 70U, 79U, 88U, 97U, 106U, 115U, 124U, 133U, 142U,
-    8U, 17U, 26U, 35U, 44U, 53U, 62U, 71U, 80U, 89U, 98U, 107U, 116U, 125U, 134U, 143U };
-
 const uint32_t PUNCTURE_LIST[] = {
     1U,   5U,   9U,  13U,  17U,  21U,  25U,  29U,  33U,  37U,
     41U,  45U,  49U,  53U,  57U,  61U,  65U,  69U,  73U,  77U,
@@ -92,11 +82,7 @@ bool FACCH1::decode(const uint8_t* data, uint32_t offset)
     ::memset(buffer, 0x00U, NXDN_FACCH1_FEC_LENGTH_BYTES);
 
     // deinterleave
-    for (uint32_t i = 0U; i < NXDN_FACCH1_FEC_LENGTH_BITS; i++) {
-        uint32_t n = INTERLEAVE_TABLE[i] + offset;
-        bool b = READ_BIT(data, n);
-        WRITE_BIT(buffer, i, b);
-    }
+    Utils::permuteBits(data, offset, buffer, 0U, FACCH1_INTERLEAVE.deinterleave, NXDN_FACCH1_FEC_LENGTH_BITS);
 
 #if DEBUG_NXDN_FACCH1
     Utils::dump(2U, "FACCH1::decode(), FACCH1 Raw", buffer, NXDN_FACCH1_FEC_LENGTH_BYTES);
@@ -123,15 +109,9 @@ bool FACCH1::decode(const uint8_t* data, uint32_t offset)
     edac::Convolution conv;
     conv.start();
 
-    n = 0U;
-    for (uint32_t i = 0U; i < (NXDN_FACCH1_CRC_LENGTH_BITS + 4U); i++) {
-        uint8_t s0 = puncture[n++];
-        uint8_t s1 = puncture[n++];
-
-        if (!conv.decode(s0, s1)) {
-            LogError(LOG_NXDN, "FACCH1::decode(), failed to decode convolution, i = %u, n = %u", i);
-            return false;
-        }
+    if (!conv.decodeBlock(puncture, NXDN_FACCH1_CRC_LENGTH_BITS + 4U)) {
+        LogError(LOG_NXDN, "FACCH1::decode(), failed to decode convolution");
+        return false;
     }
 
     conv.chainback(m_data, NXDN_FACCH1_CRC_LENGTH_BITS);
@@ -189,11 +169,7 @@ void FACCH1::encode(uint8_t* data, uint32_t offset) const
     }
 
     // interleave
-    for (uint32_t i = 0U; i < NXDN_FACCH1_FEC_LENGTH_BITS; i++) {
-        uint32_t n = INTERLEAVE_TABLE[i] + offset;
-        bool b = READ_BIT(puncture, i);
-        WRITE_BIT(data, n, b);
-    }
+    Utils::permuteBits(puncture, 0U, data, offset, FACCH1_INTERLEAVE.interleave, NXDN_FACCH1_FEC_LENGTH_BITS);
 
 #if DEBUG_NXDN_SACCH
     Utils::dump(2U, "FACCH1::encode(), FACCH1 Puncture and Interleave", data, NXDN_FACCH1_FEC_LENGTH_BYTES);
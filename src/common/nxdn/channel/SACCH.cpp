@@ -26,14 +26,6 @@ using namespace nxdn::channel;
 //  Constants
 // ---------------------------------------------------------------------------
 
-const uint32_t INTERLEAVE_TABLE[] = {
-    0U, 5U, 10U, 15U, 20U, 25U, 30U, 35U, 40U, 45U, 50U, 55U,
-    1U, 6U, 11U, 16U, 21U, 26U, 31U, 36U, 41U, 46U, 51U, 56U,
-    2U, 7U, 12U, 17U, 22U, 27U, 32U, 37U, 42U, 47U, 52U, 57U,
-    3U, 8U, 13U, 18U, 23U, 28U, 33U, 38U, 43U, 48U, 53U, 58U,
-    4U, 9U, 14U, 19U, 24U, 29U, 34U, 39U, 44U, 49U, 54U, 59U
-};
-
 const uint32_t PUNCTURE_LIST[] = { 5U, 11U, 17U, 23U, 29U, 35U, 41U, 47U, 53U, 59U, 65U, 71U };
 
 // ---------------------------------------------------------------------------
@@ -92,11 +84,7 @@ bool SACCH::decode(const uint8_t* data)
     ::memset(buffer, 0x00U, NXDN_SACCH_FEC_LENGTH_BYTES);
 
     // deinterleave
-    for (uint32_t i = 0U; i < NXDN_SACCH_FEC_LENGTH_BITS; i++) {
-        uint32_t n = INTERLEAVE_TABLE[i] + NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS;
-        bool b = READ_BIT(data, n);
-        WRITE_BIT(buffer, i, b);
-    }
+    Utils::permuteBits(data, NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS, buffer, 0U, SACCH_INTERLEAVE.deinterleave, NXDN_SACCH_FEC_LENGTH_BITS);
 
 #if DEBUG_NXDN_SACCH
     Utils::dump(2U, "SACCH::decode(), SACCH Raw", buffer, NXDN_SACCH_FEC_LENGTH_BYTES);
@@ -125,15 +113,9 @@ bool SACCH::decode(const uint8_t* data)
     edac::Convolution conv;
     conv.start();
 
-    n = 0U;
-    for (uint32_t i = 0U; i < (NXDN_SACCH_CRC_LENGTH_BITS + 4U); i++) {
-        uint8_t s0 = puncture[n++];
-        uint8_t s1 = puncture[n++];
-
-        if (!conv.decode(s0, s1)) {
-            LogError(LOG_NXDN, "SACCH::decode(), failed to decode convolution, i = %u, n = %u", i);
-            return false;
-        }
+    if (!conv.decodeBlock(puncture, NXDN_SACCH_CRC_LENGTH_BITS + 4U)) {
+        LogError(LOG_NXDN, "SACCH::decode(), failed to decode convolution");
+        return false;
     }
 
     conv.chainback(m_data, NXDN_SACCH_CRC_LENGTH_BITS);
@@ -204,11 +186,7 @@ void SACCH::encode(uint8_t* data) const
     }
 
     // interleave
-    for (uint32_t i = 0U; i < NXDN_SACCH_FEC_LENGTH_BITS; i++) {
-        uint32_t n = INTERLEAVE_TABLE[i] + NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS;
-        bool b = READ_BIT(puncture, i);
-        WRITE_BIT(data, n, b);
-    }
+    Utils::permuteBits(puncture, 0U, data, NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS, SACCH_INTERLEAVE.interleave, NXDN_SACCH_FEC_LENGTH_BITS);
 
 #if DEBUG_NXDN_SACCH
     Utils::dump(2U, "SACCH::encode(), SACCH Puncture and Interleave", data, NXDN_SACCH_FEC_LENGTH_BYTES);
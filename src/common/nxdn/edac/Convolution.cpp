@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2015,2016,2018,2021 Jonathan Naylor, G4KLX
- *  Copyright (C) 2022 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2022,2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "nxdn/edac/Convolution.h"
@@ -17,6 +17,14 @@ using namespace nxdn::edac;
 #include <cstring>
 #include <cstdlib>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CONVOLUTION_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONVOLUTION_NEON 1
+#endif
+
 // ---------------------------------------------------------------------------
 //  Constants
 // ---------------------------------------------------------------------------
@@ -29,6 +37,14 @@ const uint32_t NUM_OF_STATES = 16U;
 const uint32_t M = 4U;
 const uint32_t K = 5U;
 
+const uint32_t MAX_DECISIONS = 300U;
+
+#if defined(CONVOLUTION_NEON)
+/* Decision bit of each even/odd state. */
+const uint16_t DECISION_BITS_EVEN[] = { 0x0001U, 0x0004U, 0x0010U, 0x0040U, 0x0100U, 0x0400U, 0x1000U, 0x4000U };
+const uint16_t DECISION_BITS_ODD[] = { 0x0002U, 0x0008U, 0x0020U, 0x0080U, 0x0200U, 0x0800U, 0x2000U, 0x8000U };
+#endif
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -36,26 +52,19 @@ const uint32_t K = 5U;
 /* Initializes a new instance of the Convolution class. */
 
 Convolution::Convolution() :
-    m_metrics1(nullptr),
-    m_metrics2(nullptr),
-    m_oldMetrics(nullptr),
-    m_newMetrics(nullptr),
-    m_decisions(nullptr),
-    m_dp(nullptr)
+    m_metrics1(),
+    m_metrics2(),
+    m_oldMetrics(m_metrics1),
+    m_newMetrics(m_metrics2),
+    m_decisions(),
+    m_dp(m_decisions)
 {
-    m_metrics1  = new uint16_t[20U];
-    m_metrics2  = new uint16_t[20U];
-    m_decisions = new uint64_t[300U];
+    /* stub */
 }
 
 /* Finalizes a instance of the Convolution class. */
 
-Convolution::~Convolution()
-{
-    delete[] m_metrics1;
-    delete[] m_metrics2;
-    delete[] m_decisions;
-}
+Convolution::~Convolution() = default;
 
 /* Starts convolution processing. */
 
@@ -101,35 +110,132 @@ uint32_t Convolution::chainback(uint8_t* out, uint32_t nBits)
 
 bool Convolution::decode(uint8_t s0, uint8_t s1)
 {
-    *m_dp = 0U;
+    const uint8_t in[] = { s0, s1 };
+    return decodeBlock(in, 1U);
+}
 
-    for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
-        uint8_t j = i * 2U;
+/* Decodes a block of depunctured symbol pairs. */
 
-        uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
+bool Convolution::decodeBlock(const uint8_t* in, uint32_t nPairs)
+{
+    assert(in != nullptr);
 
-        uint16_t m0 = m_oldMetrics[i] + metric;
-        uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
-        uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
-        m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+    if ((uint32_t)(m_dp - m_decisions) + nPairs > MAX_DECISIONS) {
+        return false;
+    }
 
-        m0 = m_oldMetrics[i] + (M - metric);
-        m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
-        uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
-        m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+#if defined(CONVOLUTION_SSE2)
+    // the 16 path metrics are held in two registers; states 0 - 7 and states 8 - 15
+    __m128i lo = _mm_loadu_si128((const __m128i*)(m_oldMetrics + 0U));
+    __m128i hi = _mm_loadu_si128((const __m128i*)(m_oldMetrics + NUM_OF_STATES_D2));
+
+    const __m128i branch1 = _mm_setr_epi16(0, 0, 0, 0, 2, 2, 2, 2);
+    const __m128i branch2 = _mm_setr_epi16(0, 2, 2, 0, 0, 2, 2, 0);
+    const __m128i m = _mm_set1_epi16(M);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+
+    for (uint32_t n = 0U; n < nPairs; n++, in += 2U) {
+        __m128i d0 = _mm_sub_epi16(branch1, _mm_set1_epi16(in[0U]));
+        __m128i d1 = _mm_sub_epi16(branch2, _mm_set1_epi16(in[1U]));
+        __m128i metric = _mm_add_epi16(_mm_max_epi16(d0, _mm_sub_epi16(zero, d0)), _mm_max_epi16(d1, _mm_sub_epi16(zero, d1)));
+        __m128i inverse = _mm_sub_epi16(m, metric);
+
+        // the survivor is the unsigned minimum, a - (a -sat b); the decision (m0 >= m1) is taken off
+        // the metric dependency chain, biasing both sides into the signed range for the compare
+        __m128i m0 = _mm_add_epi16(lo, metric);
+        __m128i m1 = _mm_add_epi16(hi, inverse);
+        __m128i keep0 = _mm_cmpgt_epi16(_mm_xor_si128(m1, bias), _mm_xor_si128(m0, bias));
+        __m128i even = _mm_sub_epi16(m0, _mm_subs_epu16(m0, m1));
+
+        m0 = _mm_add_epi16(lo, inverse);
+        m1 = _mm_add_epi16(hi, metric);
+        __m128i keep1 = _mm_cmpgt_epi16(_mm_xor_si128(m1, bias), _mm_xor_si128(m0, bias));
+        __m128i odd = _mm_sub_epi16(m0, _mm_subs_epu16(m0, m1));
+
+        // new state j = 2i + decision, interleave the even and odd states back into order
+        lo = _mm_unpacklo_epi16(even, odd);
+        hi = _mm_unpackhi_epi16(even, odd);
+
+        __m128i keep = _mm_packs_epi16(_mm_unpacklo_epi16(keep0, keep1), _mm_unpackhi_epi16(keep0, keep1));
+        *m_dp++ = (uint16_t)~_mm_movemask_epi8(keep);
+    }
 
-        *m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+    _mm_storeu_si128((__m128i*)(m_oldMetrics + 0U), lo);
+    _mm_storeu_si128((__m128i*)(m_oldMetrics + NUM_OF_STATES_D2), hi);
+#elif defined(CONVOLUTION_NEON)
+    // the 16 path metrics are held in two registers; states 0 - 7 and states 8 - 15
+    uint16x8_t lo = vld1q_u16(m_oldMetrics + 0U);
+    uint16x8_t hi = vld1q_u16(m_oldMetrics + NUM_OF_STATES_D2);
+
+    const uint16x8_t branch1 = vmovl_u8(vld1_u8(BRANCH_TABLE1));
+    const uint16x8_t branch2 = vmovl_u8(vld1_u8(BRANCH_TABLE2));
+    const uint16x8_t m = vdupq_n_u16(M);
+    const uint16x8_t bitsEven = vld1q_u16(DECISION_BITS_EVEN);
+    const uint16x8_t bitsOdd = vld1q_u16(DECISION_BITS_ODD);
+
+    for (uint32_t n = 0U; n < nPairs; n++, in += 2U) {
+        uint16x8_t metric = vaddq_u16(vabdq_u16(branch1, vdupq_n_u16(in[0U])), vabdq_u16(branch2, vdupq_n_u16(in[1U])));
+        uint16x8_t inverse = vsubq_u16(m, metric);
+
+        uint16x8_t m0 = vaddq_u16(lo, metric);
+        uint16x8_t m1 = vaddq_u16(hi, inverse);
+        uint16x8_t decision0 = vcgeq_u16(m0, m1);
+        uint16x8_t even = vbslq_u16(decision0, m1, m0);
+
+        m0 = vaddq_u16(lo, inverse);
+        m1 = vaddq_u16(hi, metric);
+        uint16x8_t decision1 = vcgeq_u16(m0, m1);
+        uint16x8_t odd = vbslq_u16(decision1, m1, m0);
+
+        // new state j = 2i + decision, interleave the even and odd states back into order
+        uint16x8x2_t states = vzipq_u16(even, odd);
+        lo = states.val[0U];
+        hi = states.val[1U];
+
+        uint16x8_t bits = vorrq_u16(vandq_u16(decision0, bitsEven), vandq_u16(decision1, bitsOdd));
+#if defined(__aarch64__)
+        *m_dp++ = vaddvq_u16(bits);
+#else
+        uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(bits));
+        *m_dp++ = (uint16_t)(vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1));
+#endif
     }
 
-    ++m_dp;
+    vst1q_u16(m_oldMetrics + 0U, lo);
+    vst1q_u16(m_oldMetrics + NUM_OF_STATES_D2, hi);
+#else
+    for (uint32_t n = 0U; n < nPairs; n++, in += 2U) {
+        uint8_t s0 = in[0U];
+        uint8_t s1 = in[1U];
 
-    if ((m_dp - m_decisions) > 300) {
-        return false;
-    }
+        *m_dp = 0U;
+
+        for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
+            uint8_t j = i * 2U;
+
+            uint16_t metric = std::abs(BRANCH_TABLE1[i] - s0) + std::abs(BRANCH_TABLE2[i] - s1);
 
-    uint16_t* tmp = m_oldMetrics;
-    m_oldMetrics = m_newMetrics;
-    m_newMetrics = tmp;
+            uint16_t m0 = m_oldMetrics[i] + metric;
+            uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
+            uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+            m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+            m0 = m_oldMetrics[i] + (M - metric);
+            m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
+            uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+            m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+            *m_dp |= (uint16_t(decision1) << (j + 1U)) | (uint16_t(decision0) << (j + 0U));
+        }
+
+        ++m_dp;
+
+        uint16_t* tmp = m_oldMetrics;
+        m_oldMetrics = m_newMetrics;
+        m_newMetrics = tmp;
+    }
+#endif
 
     return true;
 }
@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2015,2016,2018,2021 Jonathan Naylor, G4KLX
- *  Copyright (C) 2022 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2022,2024 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -67,6 +67,13 @@ namespace nxdn
              * @returns bool
              */
             bool decode(uint8_t s0, uint8_t s1);
+            /**
+             * @brief Decodes a block of depunctured symbol pairs.
+             * @param[in] in Depunctured symbols (2 symbols per trellis step).
+             * @param nPairs Number of symbol pairs.
+             * @returns bool True, if symbols were decoded, otherwise false.
+             */
+            bool decodeBlock(const uint8_t* in, uint32_t nPairs);
             /**
              * @brief 
              * @param[in] in 
@@ -76,15 +83,15 @@ namespace nxdn
             void encode(const uint8_t* in, uint8_t* out, uint32_t nBits) const;
 
         private:
-            uint16_t* m_metrics1;
-            uint16_t* m_metrics2;
+            uint16_t m_metrics1[16U];
+            uint16_t m_metrics2[16U];
 
             uint16_t* m_oldMetrics;
             uint16_t* m_newMetrics;
 
-            uint64_t* m_decisions;
+            uint16_t m_decisions[300U];
 
-            uint64_t* m_dp;
+            uint16_t* m_dp;
         };
     } // namespace edac
 } // namespace nxdn
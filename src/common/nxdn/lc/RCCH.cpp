@@ -26,6 +26,7 @@ bool RCCH::m_verbose = false;
 
 uint8_t* RCCH::m_siteCallsign = nullptr;
 SiteData RCCH::m_siteData = SiteData();
+uint32_t RCCH::m_siteDataVersion = 0U;
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -96,6 +97,19 @@ void RCCH::setCallsign(std::string callsign)
         for (uint32_t i = 0; i < idLength; i++)
             m_siteCallsign[i] = callsign[i];
     }
+
+    m_siteDataVersion++;
+}
+
+/* Sets the local site data. */
+
+void RCCH::setSiteData(SiteData siteData)
+{
+    if (siteData == m_siteData)
+        return;
+
+    m_siteData = siteData;
+    m_siteDataVersion++;
 }
 
 // ---------------------------------------------------------------------------
@@ -96,7 +96,14 @@ namespace nxdn
              * @brief Sets the local site data.
              * @param siteData Site data to set for the RCCH class.
              */
-            static void setSiteData(SiteData siteData) { m_siteData = siteData; }
+            static void setSiteData(SiteData siteData);
+            /**
+             * @brief Gets the version of the local site data.
+             *  The version changes whenever the site data or callsign changes; pre-encoded broadcasts are only valid for the
+             *  version they were encoded with.
+             * @returns uint32_t Version of the local site data.
+             */
+            static uint32_t getSiteDataVersion() { return m_siteDataVersion; }
             /** @} */
 
         public:
@@ -188,6 +195,7 @@ namespace nxdn
             // Local Site data
             static uint8_t* m_siteCallsign;
             static SiteData m_siteData;
+            static uint32_t m_siteDataVersion;
 
             /**
              * @brief Internal helper to decode a RCCH link control message.
@@ -34,6 +34,24 @@ RCCHFactory::~RCCHFactory() = default;
 /* Create an instance of a RCCH. */
 
 std::unique_ptr<RCCH> RCCHFactory::createRCCH(const uint8_t* data, uint32_t length, uint32_t offset)
+{
+    return std::unique_ptr<RCCH>(create(data, length, offset, false));
+}
+
+/* Decode a RCCH into this thread's reusable instance of its type. */
+
+RCCH* RCCHFactory::decodeRCCH(const uint8_t* data, uint32_t length, uint32_t offset)
+{
+    return create(data, length, offset, true);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Create (or borrow) and decode an instance of a RCCH. */
+
+RCCH* RCCHFactory::create(const uint8_t* data, uint32_t length, uint32_t offset, bool pooled)
 {
     assert(data != nullptr);
 
@@ -43,17 +61,17 @@ std::unique_ptr<RCCH> RCCHFactory::createRCCH(const uint8_t* data, uint32_t leng
     switch (messageType) {
     case MessageType::RTCH_VCALL:
     case MessageType::RCCH_VCALL_CONN:
-        return decode(new MESSAGE_TYPE_VCALL_CONN(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_VCALL_CONN>(pooled), data, length, offset);
     case MessageType::RTCH_DCALL_HDR:
-        return decode(new MESSAGE_TYPE_DCALL_HDR(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_DCALL_HDR>(pooled), data, length, offset);
     case MessageType::IDLE:
-        return decode(new MESSAGE_TYPE_IDLE(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_IDLE>(pooled), data, length, offset);
     case MessageType::RCCH_REG:
-        return decode(new MESSAGE_TYPE_REG(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_REG>(pooled), data, length, offset);
     case MessageType::RCCH_REG_C:
-        return decode(new MESSAGE_TYPE_REG_C(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_REG_C>(pooled), data, length, offset);
     case MessageType::RCCH_GRP_REG:
-        return decode(new MESSAGE_TYPE_GRP_REG(), data, length, offset);
+        return decode(instance<MESSAGE_TYPE_GRP_REG>(pooled), data, length, offset);
     default:
         LogError(LOG_NXDN, "RCCH::decodeRCCH(), unknown RCCH value, messageType = $%02X", messageType);
         return nullptr;
@@ -62,17 +80,13 @@ std::unique_ptr<RCCH> RCCHFactory::createRCCH(const uint8_t* data, uint32_t leng
     return nullptr;
 }
 
-// ---------------------------------------------------------------------------
-//  Private Class Members
-// ---------------------------------------------------------------------------
-
 /* Internal helper to decode a RCCH link control message. */
 
-std::unique_ptr<RCCH> RCCHFactory::decode(RCCH* rcch, const uint8_t* data, uint32_t length, uint32_t offset)
+RCCH* RCCHFactory::decode(RCCH* rcch, const uint8_t* data, uint32_t length, uint32_t offset)
 {
     assert(rcch != nullptr);
     assert(data != nullptr);
 
     rcch->decode(data, length, offset);
-    return std::unique_ptr<RCCH>(rcch);
+    return rcch;
 }
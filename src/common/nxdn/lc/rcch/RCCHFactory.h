@@ -21,6 +21,7 @@
 #define  __NXDN_LC__RCCH_FACTORY_H__
 
 #include "common/Defines.h"
+#include "common/MessagePool.h"
 
 #include "common/nxdn/lc/RCCH.h"
 #include "common/nxdn/lc/rcch/MESSAGE_TYPE_DCALL_HDR.h"
@@ -67,8 +68,36 @@ namespace nxdn
                  * @param offset Offset for RCCH in data buffer.
                  */
                 static std::unique_ptr<RCCH> createRCCH(const uint8_t* data, uint32_t length, uint32_t offset = 0U);
+                /**
+                 * @brief Decode a RCCH into this thread's reusable instance of its type.
+                 *
+                 *  No memory is allocated; the returned RCCH is borrowed and only remains valid until this
+                 *  thread next decodes a RCCH of the same type. It must not be deleted or retained.
+                 * @param[in] data Buffer containing a RCCH to decode.
+                 * @param length Length of data buffer.
+                 * @param offset Offset for RCCH in data buffer.
+                 * @returns RCCH* Borrowed instance of a RCCH representing the decoded data.
+                 */
+                static RCCH* decodeRCCH(const uint8_t* data, uint32_t length, uint32_t offset = 0U);
 
             private:
+                /**
+                 * @brief Helper to allocate (or borrow) an instance of a RCCH type.
+                 * @tparam T RCCH type.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 * @returns RCCH* Instance of the RCCH type.
+                 */
+                template<class T>
+                static RCCH* instance(bool pooled) { return (pooled) ? MessagePool<T>::borrow() : new T(); }
+
+                /**
+                 * @brief Create (or borrow) and decode an instance of a RCCH.
+                 * @param[in] data Buffer containing a RCCH to decode.
+                 * @param length Length of data buffer.
+                 * @param offset Offset for RCCH in data buffer.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 */
+                static RCCH* create(const uint8_t* data, uint32_t length, uint32_t offset, bool pooled);
                 /**
                  * @brief Internal helper to decode a RCCH link control message.
                  * @param[out] rcch
@@ -76,7 +105,7 @@ namespace nxdn
                  * @param length Length of data buffer.
                  * @param offset Offset for RCCH in data buffer.
                  */
-                static std::unique_ptr<RCCH> decode(RCCH* rcch, const uint8_t* data, uint32_t length, uint32_t offset = 0U);
+                static RCCH* decode(RCCH* rcch, const uint8_t* data, uint32_t length, uint32_t offset = 0U);
             };
         } // namespace rcch
     } // namespace lc
@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
@@ -18,6 +19,15 @@ using namespace p25;
 
 #include <cassert>
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t LDU_IMBE_FRAMES = 9U;
+/* Start of each IMBE frame in a LDU (each frame is 148 bits including the status symbols). */
+const uint32_t LDU_IMBE_START[] = { 114U, 262U, 452U, 640U, 830U, 1020U, 1208U, 1398U, 1578U };
+const uint32_t LDU_IMBE_LENGTH = 148U;
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -36,49 +46,24 @@ Audio::~Audio() = default;
 
 /* Process P25 IMBE audio data. */
 
-uint32_t Audio::process(uint8_t* data)
+uint32_t Audio::process(uint8_t* data, uint32_t* errors)
 {
     assert(data != nullptr);
 
-    uint32_t errs = 0U;
-
-    uint8_t imbe[18U];
-
-    P25Utils::decode(data, imbe, 114U, 262U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 114U, 262U);
-
-    P25Utils::decode(data, imbe, 262U, 410U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 262U, 410U);
+    uint8_t imbe[LDU_IMBE_FRAMES * edac::IMBE_FEC_LENGTH_BYTES];
+    for (uint32_t n = 0U; n < LDU_IMBE_FRAMES; n++)
+        P25Utils::decode(data, imbe + (n * edac::IMBE_FEC_LENGTH_BYTES), LDU_IMBE_START[n], LDU_IMBE_START[n] + LDU_IMBE_LENGTH);
 
-    P25Utils::decode(data, imbe, 452U, 600U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 452U, 600U);
+    uint32_t frameErrs[LDU_IMBE_FRAMES];
+    uint32_t errs = m_fec.regenerateIMBE(imbe, LDU_IMBE_FRAMES, frameErrs);
 
-    P25Utils::decode(data, imbe, 640U, 788U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 640U, 788U);
-
-    P25Utils::decode(data, imbe, 830U, 978U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 830U, 978U);
-
-    P25Utils::decode(data, imbe, 1020U, 1168U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 1020U, 1168U);
-
-    P25Utils::decode(data, imbe, 1208U, 1356U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 1208U, 1356U);
-
-    P25Utils::decode(data, imbe, 1398U, 1546U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 1398U, 1546U);
-
-    P25Utils::decode(data, imbe, 1578U, 1726U);
-    errs += m_fec.regenerateIMBE(imbe);
-    P25Utils::encode(imbe, data, 1578U, 1726U);
+    // only frames that were corrected need to be interleaved back into the LDU
+    for (uint32_t n = 0U; n < LDU_IMBE_FRAMES; n++) {
+        if (frameErrs[n] > 0U)
+            P25Utils::encode(imbe + (n * edac::IMBE_FEC_LENGTH_BYTES), data, LDU_IMBE_START[n], LDU_IMBE_START[n] + LDU_IMBE_LENGTH);
+        if (errors != nullptr)
+            errors[n] = frameErrs[n];
+    }
 
     return errs;
 }
@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -43,9 +44,10 @@ namespace p25
         /**
          * @brief Process P25 IMBE audio data.
          * @param data IMBE audio buffer.
+         * @param[out] errors Number of errors in each of the 9 IMBE frames (may be nullptr).
          * @returns uint32_t Number of errors in the audio buffer.
          */
-        uint32_t process(uint8_t* data);
+        uint32_t process(uint8_t* data, uint32_t* errors = nullptr);
 
         /**
          * @brief Decode a P25 IMBE audio frame.
@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
@@ -97,25 +98,19 @@ uint32_t P25Utils::decode(const uint8_t* in, uint8_t* out, uint32_t start, uint3
 
     // Move the SSx positions to the range needed
     uint32_t ss0Pos = P25_SS0_START;
-    uint32_t ss1Pos = P25_SS1_START;
-
     while (ss0Pos < start) {
         ss0Pos += P25_SS_INCREMENT;
-        ss1Pos += P25_SS_INCREMENT;
     }
 
+    // move the runs of bits between the status symbols (at most 70 bits) a word at a time
     uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++) {
-        if (i == ss0Pos) {
-            ss0Pos += P25_SS_INCREMENT;
-        }
-        else if (i == ss1Pos) {
-            ss1Pos += P25_SS_INCREMENT;
-        }
-        else {
-            bool b = READ_BIT(in, i);
-            WRITE_BIT(out, n, b);
-            n++;
+    for (uint32_t i = start; i < stop; i = ss0Pos + 2U, ss0Pos += P25_SS_INCREMENT) {
+        uint32_t runStop = (ss0Pos < stop) ? ss0Pos : stop;
+        while (i < runStop) {
+            uint32_t len = (runStop - i > 56U) ? 56U : runStop - i;
+            Utils::writeBits(out, n, Utils::readBits(in, i, len), len);
+            i += len;
+            n += len;
         }
     }
 
@@ -131,25 +126,19 @@ uint32_t P25Utils::encode(const uint8_t* in, uint8_t* out, uint32_t start, uint3
 
     // Move the SSx positions to the range needed
     uint32_t ss0Pos = P25_SS0_START;
-    uint32_t ss1Pos = P25_SS1_START;
-
     while (ss0Pos < start) {
         ss0Pos += P25_SS_INCREMENT;
-        ss1Pos += P25_SS_INCREMENT;
     }
 
+    // move the runs of bits between the status symbols (at most 70 bits) a word at a time
     uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++) {
-        if (i == ss0Pos) {
-            ss0Pos += P25_SS_INCREMENT;
-        }
-        else if (i == ss1Pos) {
-            ss1Pos += P25_SS_INCREMENT;
-        }
-        else {
-            bool b = READ_BIT(in, n);
-            WRITE_BIT(out, i, b);
-            n++;
+    for (uint32_t i = start; i < stop; i = ss0Pos + 2U, ss0Pos += P25_SS_INCREMENT) {
+        uint32_t runStop = (ss0Pos < stop) ? ss0Pos : stop;
+        while (i < runStop) {
+            uint32_t len = (runStop - i > 56U) ? 56U : runStop - i;
+            Utils::writeBits(out, i, Utils::readBits(in, n, len), len);
+            i += len;
+            n += len;
         }
     }
 
@@ -255,6 +255,30 @@ namespace p25
             return *this;
         }
 
+        /**
+         * @brief Equality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data is the same, otherwise false.
+         */
+        bool operator==(const SiteData& data) const
+        {
+            return m_lra == data.m_lra &&
+                m_netId == data.m_netId && m_sysId == data.m_sysId &&
+                m_rfssId == data.m_rfssId && m_siteId == data.m_siteId &&
+                m_channelId == data.m_channelId && m_channelNo == data.m_channelNo &&
+                m_serviceClass == data.m_serviceClass &&
+                m_isAdjSite == data.m_isAdjSite &&
+                m_callsign == data.m_callsign && m_chCnt == data.m_chCnt &&
+                m_netActive == data.m_netActive &&
+                m_lto == data.m_lto;
+        }
+        /**
+         * @brief Inequality operator.
+         * @param data Instance of SiteData to compare.
+         * @returns bool True, if the site data differs, otherwise false.
+         */
+        bool operator!=(const SiteData& data) const { return !(*this == data); }
+
     public:
         /** @name Site Data */
         /**
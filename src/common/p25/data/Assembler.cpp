@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "p25/P25Defines.h"
+#include "p25/data/Assembler.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::data;
+
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t USER_DATA_LENGTH = P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the Assembler class. */
+
+Assembler::Assembler() :
+    m_extendedAddress(false),
+    m_blockCount(0U),
+    m_decodedCount(0U),
+    m_userDataLength(0U),
+    m_header(),
+    m_block(),
+    m_userData(nullptr)
+{
+    m_userData = new uint8_t[USER_DATA_LENGTH];
+    ::memset(m_userData, 0x00U, USER_DATA_LENGTH);
+}
+
+/* Finalizes a instance of the Assembler class. */
+
+Assembler::~Assembler()
+{
+    delete[] m_userData;
+}
+
+/* Decodes the PDU header block, starting a new PDU. */
+
+bool Assembler::decodeHeader(const uint8_t* block)
+{
+    assert(block != nullptr);
+
+    reset();
+    return m_header.decode(block);
+}
+
+/* Decodes the next PDU block, writing its payload directly into the PDU user data. */
+
+bool Assembler::decodeBlock(const uint8_t* block)
+{
+    assert(block != nullptr);
+
+    if (isComplete() || m_blockCount >= P25_MAX_PDU_BLOCKS)
+        return false;
+
+    // every block has a fixed slot in the user data; the second header of an unconfirmed PDU is
+    // the same length as an unconfirmed block, so it takes the first slot
+    uint32_t blockLength = (m_header.getFormat() == PDUFormatType::CONFIRMED) ? P25_PDU_CONFIRMED_DATA_LENGTH_BYTES : P25_PDU_UNCONFIRMED_LENGTH_BYTES;
+    uint32_t index = m_blockCount;
+    uint8_t* slot = m_userData + (index * blockLength);
+
+    bool secondHeader = isSecondHeader();
+    m_blockCount++;
+
+    if (secondHeader) {
+        if (!m_header.decodeExtAddr(block))
+            return false;
+
+        m_header.getExtAddrData(slot);
+        m_extendedAddress = true;
+    }
+    else {
+        if (!m_block.decode(block, m_header, slot))
+            return false;
+
+        // if we are getting unconfirmed or confirmed blocks, and if we've reached the total number of blocks
+        // set this block as the last block for full packet CRC
+        if ((m_header.getFormat() == PDUFormatType::CONFIRMED) || (m_header.getFormat() == PDUFormatType::UNCONFIRMED)) {
+            if (m_blockCount == m_header.getBlocksToFollow()) {
+                m_block.setLastBlock(true);
+            }
+        }
+
+        // confirmed extended addressing carries the source address at the start of the first block
+        if (m_header.getSAP() == PDUSAP::EXT_ADDR && m_header.getFormat() == PDUFormatType::CONFIRMED &&
+            m_block.getSerialNo() == 0U) {
+            m_header.decodeExtAddr(slot);
+            m_extendedAddress = true;
+        }
+    }
+
+    m_decodedCount++;
+    if ((index + 1U) * blockLength > m_userDataLength) {
+        m_userDataLength = (index + 1U) * blockLength;
+    }
+
+    return true;
+}
+
+/* Resets the assembler for a new PDU. */
+
+void Assembler::reset()
+{
+    m_header.reset();
+
+    m_extendedAddress = false;
+    m_blockCount = 0U;
+    m_decodedCount = 0U;
+
+    m_userDataLength = 0U;
+    ::memset(m_userData, 0x00U, USER_DATA_LENGTH);
+}
+
+/* Flag indicating the next block is the second (extended addressing) header of an unconfirmed PDU. */
+
+bool Assembler::isSecondHeader() const
+{
+    return m_blockCount == 0U && m_header.getSAP() == PDUSAP::EXT_ADDR &&
+        m_header.getFormat() == PDUFormatType::UNCONFIRMED;
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file Assembler.h
+ * @ingroup p25_pdu
+ * @file Assembler.cpp
+ * @ingroup p25_pdu
+ */
+#if !defined(__P25_DATA__ASSEMBLER_H__)
+#define  __P25_DATA__ASSEMBLER_H__
+
+#include "common/Defines.h"
+#include "common/p25/data/DataBlock.h"
+#include "common/p25/data/DataHeader.h"
+
+namespace p25
+{
+    namespace data
+    {
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Reassembles the user data of a P25 PDU packet, one block at a time.
+         *
+         *  The user data is kept in a single buffer (slab) with a fixed slot per block; each block
+         *  is decoded (Trellis and CRC-9) as it is received directly into its slot, so a completed
+         *  PDU is ready for the full packet CRC-32 check and dispatch without any further copying.
+         *  The slab is allocated once and reused by every PDU the assembler handles.
+         * @ingroup p25_pdu
+         */
+        class HOST_SW_API Assembler {
+        public:
+            /**
+             * @brief Initializes a new instance of the Assembler class.
+             */
+            Assembler();
+            /**
+             * @brief Copy constructor.
+             */
+            Assembler(const Assembler&) = delete;
+            /**
+             * @brief Finalizes a instance of the Assembler class.
+             */
+            ~Assembler();
+
+            /**
+             * @brief Disable copy assignment operator (=).
+             */
+            Assembler& operator=(const Assembler&) = delete;
+
+            /**
+             * @brief Decodes the PDU header block, starting a new PDU.
+             * @param[in] block Buffer containing the FEC encoded PDU header block.
+             * @returns bool True, if PDU header decoded, otherwise false.
+             */
+            bool decodeHeader(const uint8_t* block);
+            /**
+             * @brief Decodes the next PDU block, writing its payload directly into the PDU user data.
+             * @param[in] block Buffer containing the FEC encoded PDU block.
+             * @returns bool True, if PDU block decoded, otherwise false.
+             */
+            bool decodeBlock(const uint8_t* block);
+
+            /**
+             * @brief Resets the assembler for a new PDU.
+             */
+            void reset();
+
+            /**
+             * @brief Flag indicating the next block is the second (extended addressing) header of an
+             *  unconfirmed PDU.
+             * @returns bool True, if the next block is the second header, otherwise false.
+             */
+            bool isSecondHeader() const;
+            /**
+             * @brief Flag indicating all the blocks of the PDU have been received.
+             * @returns bool True, if all blocks have been received, otherwise false.
+             */
+            bool isComplete() const { return m_blockCount >= m_header.getBlocksToFollow(); }
+
+            /**
+             * @brief Gets the PDU data header.
+             * @returns DataHeader& PDU data header.
+             */
+            DataHeader& header() { return m_header; }
+            /**
+             * @brief Gets the last data block decoded.
+             * @returns const DataBlock& Last data block decoded.
+             */
+            const DataBlock& lastBlock() const { return m_block; }
+
+            /**
+             * @brief Gets the PDU user data.
+             * @returns uint8_t* Buffer containing the PDU user data.
+             */
+            uint8_t* userData() const { return m_userData; }
+
+        public:
+            /**
+             * @brief Flag indicating the PDU uses extended addressing.
+             */
+            __READONLY_PROPERTY(bool, extendedAddress, ExtendedAddress);
+            /**
+             * @brief Number of blocks received (excluding the header).
+             */
+            __READONLY_PROPERTY(uint32_t, blockCount, BlockCount);
+            /**
+             * @brief Number of blocks successfully decoded (excluding the header).
+             */
+            __READONLY_PROPERTY(uint32_t, decodedCount, DecodedCount);
+            /**
+             * @brief Length of the PDU user data.
+             */
+            __READONLY_PROPERTY(uint32_t, userDataLength, UserDataLength);
+
+        private:
+            DataHeader m_header;
+            DataBlock m_block;
+
+            uint8_t* m_userData;
+        };
+    } // namespace data
+} // namespace p25
+
+#endif // __P25_DATA__ASSEMBLER_H__
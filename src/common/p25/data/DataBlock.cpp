@@ -49,11 +49,18 @@ DataBlock::~DataBlock()
 
 bool DataBlock::decode(const uint8_t* data, const DataHeader& header)
 {
-    assert(data != nullptr);
     assert(m_data != nullptr);
 
-    uint8_t buffer[P25_PDU_CONFIRMED_LENGTH_BYTES];
-    ::memset(buffer, 0x00U, P25_PDU_CONFIRMED_LENGTH_BYTES);
+    ::memset(m_data, 0x00U, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);
+    return decode(data, header, m_data);
+}
+
+/* Decodes P25 PDU data block, writing the payload directly to the given buffer rather than to the data block. */
+
+bool DataBlock::decode(const uint8_t* data, const DataHeader& header, uint8_t* payload)
+{
+    assert(data != nullptr);
+    assert(payload != nullptr);
 
     m_fmt = header.getFormat();
     m_headerSap = header.getSAP();
@@ -63,6 +70,9 @@ bool DataBlock::decode(const uint8_t* data, const DataHeader& header)
     m_lastBlock = false;
 
     if (m_fmt == PDUFormatType::CONFIRMED) {
+        uint8_t buffer[P25_PDU_CONFIRMED_LENGTH_BYTES];
+        ::memset(buffer, 0x00U, P25_PDU_CONFIRMED_LENGTH_BYTES);
+
         // decode 3/4 rate Trellis
         try {
             bool valid = m_trellis.decode34(data, buffer);
@@ -78,24 +88,10 @@ bool DataBlock::decode(const uint8_t* data, const DataHeader& header)
             m_serialNo = (buffer[0] & 0xFEU) >> 1;                                          // Confirmed Data Serial No.
             uint16_t crc = ((buffer[0] & 0x01U) << 8) + buffer[1];                          // CRC-9 Check Sum
 
-            ::memset(m_data, 0x00U, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);
-            ::memcpy(m_data, buffer + 2U, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);             // Payload Data
-
-            uint8_t crcBuffer[P25_PDU_CONFIRMED_LENGTH_BYTES];
-            ::memset(crcBuffer, 0x00U, P25_PDU_CONFIRMED_LENGTH_BYTES);
-
-            // generate CRC buffer
-            for (uint32_t i = 0U; i < 144U; i++) {
-                bool b = READ_BIT(buffer, i);
-                if (i < 7U) {
-                    WRITE_BIT(crcBuffer, i, b);
-                } else if (i > 15U) {
-                    WRITE_BIT(crcBuffer, i - 9U, b);
-                }
-            }
+            ::memcpy(payload, buffer + 2U, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);            // Payload Data
 
             // compute CRC-9 for the packet
-            uint16_t calculated = edac::CRC::createCRC9(crcBuffer, 135U);
+            uint16_t calculated = crc9(buffer);
             if ((crc ^ calculated) != 0) {
                 LogWarning(LOG_P25, "PDU, fmt = $%02X, invalid crc = $%04X != $%04X (computed)", m_fmt, crc, calculated);
             }
@@ -110,21 +106,17 @@ bool DataBlock::decode(const uint8_t* data, const DataHeader& header)
         }
     }
     else if ((m_fmt == PDUFormatType::UNCONFIRMED) || (m_fmt == PDUFormatType::RSP) || (m_fmt == PDUFormatType::AMBT)) {
-        // decode 1/2 rate Trellis
+        // decode 1/2 rate Trellis (the unconfirmed block is entirely payload, so decode straight into it)
         try {
-            bool valid = m_trellis.decode12(data, buffer);
+            bool valid = m_trellis.decode12(data, payload);
             if (!valid) {
                 LogError(LOG_P25, "DataBlock::decode(), failed to decode Trellis 1/2 rate coding");
                 return false;
             }
 
-            ::memset(m_data, 0x00U, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);
-
 #if DEBUG_P25_PDU_DATA
-            Utils::dump(1U, "P25, DataBlock::decode(), Unconfirmed PDU Data Block", buffer, P25_PDU_UNCONFIRMED_LENGTH_BYTES);
+            Utils::dump(1U, "P25, DataBlock::decode(), Unconfirmed PDU Data Block", payload, P25_PDU_UNCONFIRMED_LENGTH_BYTES);
 #endif
-
-            ::memcpy(m_data, buffer, P25_PDU_UNCONFIRMED_LENGTH_BYTES);                     // Payload Data
         }
         catch (...) {
             Utils::dump(2U, "P25, decoding excepted with input data", data, P25_PDU_UNCONFIRMED_LENGTH_BYTES);
@@ -153,20 +145,7 @@ void DataBlock::encode(uint8_t* data)
 
         ::memcpy(buffer + 2U, m_data, P25_PDU_CONFIRMED_DATA_LENGTH_BYTES);                 // Payload Data
 
-        uint8_t crcBuffer[P25_PDU_CONFIRMED_LENGTH_BYTES];
-        ::memset(crcBuffer, 0x00U, P25_PDU_CONFIRMED_LENGTH_BYTES);
-
-        // generate CRC buffer
-        for (uint32_t i = 0U; i < 144U; i++) {
-            bool b = READ_BIT(buffer, i);
-            if (i < 7U) {
-                WRITE_BIT(crcBuffer, i, b);
-            } else if (i > 15U) {
-                WRITE_BIT(crcBuffer, i - 9U, b);
-            }
-        }
-
-        uint16_t crc = edac::CRC::createCRC9(crcBuffer, 135U);
+        uint16_t crc = crc9(buffer);
         buffer[0U] = buffer[0U] + ((crc >> 8) & 0x01U);                                     // CRC-9 Check Sum (b8)
         buffer[1U] = (crc & 0xFFU);                                                         // CRC-9 Check Sum (b0 - b7)
 
@@ -253,3 +232,27 @@ uint32_t DataBlock::getData(uint8_t* buffer) const
         return 0U;
     }
 }
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to compute the CRC-9 of a confirmed data block. */
+
+uint16_t DataBlock::crc9(const uint8_t* block)
+{
+    assert(block != nullptr);
+
+    // the CRC covers the 7-bit serial number followed by the payload, skipping the 9 bits
+    // of the CRC itself; so shift the payload left by one bit to butt it against the serial
+    uint8_t crcBuffer[P25_PDU_CONFIRMED_LENGTH_BYTES];
+    ::memset(crcBuffer, 0x00U, P25_PDU_CONFIRMED_LENGTH_BYTES);
+
+    crcBuffer[0U] = (block[0U] & 0xFEU) | (block[2U] >> 7);
+    for (uint32_t i = 1U; i < P25_PDU_CONFIRMED_LENGTH_BYTES - 2U; i++) {
+        crcBuffer[i] = (uint8_t)(block[i + 1U] << 1) | (block[i + 2U] >> 7);
+    }
+    crcBuffer[P25_PDU_CONFIRMED_LENGTH_BYTES - 2U] = (uint8_t)(block[P25_PDU_CONFIRMED_LENGTH_BYTES - 1U] << 1);
+
+    return edac::CRC::createCRC9(crcBuffer, 135U);
+}
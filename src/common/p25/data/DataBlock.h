@@ -52,6 +52,16 @@ namespace p25
              * @returns bool True, if PDU data block decoded, otherwise false.
              */
             bool decode(const uint8_t* data, const DataHeader& header);
+            /**
+             * @brief Decodes P25 PDU data block, writing the payload directly to the given buffer
+             *  rather than to the data block.
+             * @param[in] data Buffer containing a PDU data block to decode.
+             * @param header P25 PDU data header.
+             * @param[out] payload Buffer to write the block payload to (P25_PDU_CONFIRMED_DATA_LENGTH_BYTES
+             *  bytes for confirmed data, otherwise P25_PDU_UNCONFIRMED_LENGTH_BYTES bytes).
+             * @returns bool True, if PDU data block decoded, otherwise false.
+             */
+            bool decode(const uint8_t* data, const DataHeader& header, uint8_t* payload);
             /**
              * @brief Encodes a P25 PDU data block.
              * @param[out] data Buffer to encode a PDU data block.
@@ -104,6 +114,13 @@ namespace p25
             uint8_t m_headerSap;
 
             uint8_t* m_data;
+
+            /**
+             * @brief Helper to compute the CRC-9 of a confirmed data block.
+             * @param[in] block Confirmed data block (serial number, CRC-9 and payload).
+             * @returns uint16_t CRC-9 of the block.
+             */
+            static uint16_t crc9(const uint8_t* block);
         };
     } // namespace data
 } // namespace p25
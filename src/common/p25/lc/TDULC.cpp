@@ -118,10 +118,9 @@ ulong64_t TDULC::toValue(const uint8_t* payload)
 
 /* Internal helper to convert a 64-bit long value to payload bytes. */
 
-UInt8Array TDULC::fromValue(const ulong64_t value)
+void TDULC::fromValue(const ulong64_t value, uint8_t* payload)
 {
-    UInt8Array payload = std::unique_ptr<uint8_t[]>(new uint8_t[P25_TDULC_PAYLOAD_LENGTH_BYTES]);
-    ::memset(payload.get(), 0x00U, P25_TDULC_PAYLOAD_LENGTH_BYTES);
+    assert(payload != nullptr);
 
     // split ulong64_t (8 byte) value into bytes
     payload[0U] = (uint8_t)((value >> 56) & 0xFFU);
@@ -132,8 +131,6 @@ UInt8Array TDULC::fromValue(const ulong64_t value)
     payload[5U] = (uint8_t)((value >> 16) & 0xFFU);
     payload[6U] = (uint8_t)((value >> 8) & 0xFFU);
     payload[7U] = (uint8_t)((value >> 0) & 0xFFU);
-
-    return payload;
 }
 
 /* Internal helper to decode a terminator data unit w/ link control. */
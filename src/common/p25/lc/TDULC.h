@@ -176,9 +176,9 @@ namespace p25
             /**
              * @brief Internal helper to convert a 64-bit long value to payload bytes.
              * @param[in] value 64-bit packed value.
-             * @returns UInt8Array Buffer containing the unpacked payload.
+             * @param[out] payload Buffer to unpack the payload into.
              */
-            static UInt8Array fromValue(const ulong64_t value);
+            static void fromValue(const ulong64_t value, uint8_t* payload);
 
             /**
              * @brief Internal helper to decode terminator data unit w/ link control.
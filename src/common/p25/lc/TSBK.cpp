@@ -34,6 +34,7 @@ bool TSBK::m_warnCRC = false;
 
 uint8_t* TSBK::m_siteCallsign = nullptr;
 SiteData TSBK::m_siteData = SiteData();
+uint32_t TSBK::m_siteDataVersion = 0U;
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -88,7 +89,8 @@ TSBK::TSBK() :
     m_siteIdenEntry(lookups::IdenTable()),
     m_rs(),
     m_trellis(),
-    m_raw(nullptr)
+    m_raw(),
+    m_rawDecoded(false)
 {
     if (m_siteCallsign == nullptr) {
         m_siteCallsign = new uint8_t[MOT_CALLSIGN_LENGTH_BYTES];
@@ -102,11 +104,7 @@ TSBK::TSBK() :
 
 /* Finalizes a instance of TSBK class. */
 
-TSBK::~TSBK()
-{
-    if (m_raw != nullptr)
-        delete[] m_raw;
-}
+TSBK::~TSBK() = default;
 
 /* Returns a string that represents the current TSBK. */
 
@@ -117,9 +115,9 @@ std::string TSBK::toString(bool isp)
 
 /* Returns a copy of the raw decoded TSBK bytes. */
 
-uint8_t* TSBK::getDecodedRaw() const
+const uint8_t* TSBK::getDecodedRaw() const
 {
-    return m_raw;
+    return (m_rawDecoded) ? m_raw : nullptr;
 }
 
 /* Sets the callsign. */
@@ -140,6 +138,20 @@ void TSBK::setCallsign(std::string callsign)
         for (uint32_t i = 0; i < idLength; i++)
             m_siteCallsign[i] = callsign[i];
     }
+
+    m_siteDataVersion++;
+}
+
+/* Sets the local site data. */
+
+void TSBK::setSiteData(SiteData siteData)
+{
+    // site data is pushed every clock; only an actual change invalidates pre-encoded broadcasts
+    if (siteData == m_siteData)
+        return;
+
+    m_siteData = siteData;
+    m_siteDataVersion++;
 }
 
 // ---------------------------------------------------------------------------
@@ -169,10 +181,9 @@ ulong64_t TSBK::toValue(const uint8_t* payload)
 
 /* Internal helper to convert a 64-bit long value to payload bytes. */
 
-UInt8Array TSBK::fromValue(const ulong64_t value)
+void TSBK::fromValue(const ulong64_t value, uint8_t* payload)
 {
-    UInt8Array payload = std::unique_ptr<uint8_t[]>(new uint8_t[P25_TSBK_LENGTH_BYTES - 4U]);
-    ::memset(payload.get(), 0x00U, P25_TSBK_LENGTH_BYTES - 4U);
+    assert(payload != nullptr);
 
     // split ulong64_t (8 byte) value into bytes
     payload[0U] = (uint8_t)((value >> 56) & 0xFFU);
@@ -183,8 +194,6 @@ UInt8Array TSBK::fromValue(const ulong64_t value)
     payload[5U] = (uint8_t)((value >> 16) & 0xFFU);
     payload[6U] = (uint8_t)((value >> 8) & 0xFFU);
     payload[7U] = (uint8_t)((value >> 0) & 0xFFU);
-
-    return payload;
 }
 
 /* Internal helper to decode a trunking signalling block. */
@@ -252,8 +261,8 @@ bool TSBK::decode(const uint8_t* data, uint8_t* payload, bool rawTSBK)
         Utils::dump(2U, "TSBK::decode(), TSBK Value", tsbk, P25_TSBK_LENGTH_BYTES);
     }
 
-    m_raw = new uint8_t[P25_TSBK_LENGTH_BYTES];
     ::memcpy(m_raw, tsbk, P25_TSBK_LENGTH_BYTES);
+    m_rawDecoded = true;
 
     m_lco = tsbk[0U] & 0x3F;                                                        // LCO
     m_lastBlock = (tsbk[0U] & 0x80U) == 0x80U;                                      // Last Block Marker
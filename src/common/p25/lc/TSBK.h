@@ -100,9 +100,9 @@ namespace p25
             /**
              * @brief Returns a copy of the raw decoded TSBK bytes.
              * This will only return data for a *decoded* TSBK, not a created or copied TSBK.
-             * @returns uint8_t* Raw decoded TSBK bytes.
+             * @returns const uint8_t* Raw decoded TSBK bytes.
              */
-            uint8_t* getDecodedRaw() const;
+            const uint8_t* getDecodedRaw() const;
 
             /**
              * @brief Gets the flag indicating verbose log output.
@@ -136,7 +136,14 @@ namespace p25
              * @brief Sets the local site data.
              * @param siteData Site data to set for the TSBK class.
              */
-            static void setSiteData(SiteData siteData) { m_siteData = siteData; }
+            static void setSiteData(SiteData siteData);
+            /**
+             * @brief Gets the version of the local site data.
+             *  The version changes whenever the site data or callsign changes; pre-encoded broadcasts are only valid for the
+             *  version they were encoded with.
+             * @returns uint32_t Version of the local site data.
+             */
+            static uint32_t getSiteDataVersion() { return m_siteDataVersion; }
             /** @} */
 
         public:
@@ -243,6 +250,7 @@ namespace p25
             // Local Site data
             static uint8_t* m_siteCallsign;
             static SiteData m_siteData;
+            static uint32_t m_siteDataVersion;
 
             /**
              * @brief Internal helper to convert payload bytes to a 64-bit long value.
@@ -253,9 +261,9 @@ namespace p25
             /**
              * @brief Internal helper to convert a 64-bit long value to payload bytes.
              * @param[in] value 64-bit packed value.
-             * @returns UInt8Array Buffer containing the unpacked payload.
+             * @param[out] payload Buffer to unpack the payload into.
              */
-            static UInt8Array fromValue(const ulong64_t value);
+            static void fromValue(const ulong64_t value, uint8_t* payload);
 
             /**
              * @brief Internal helper to decode a trunking signalling block.
@@ -277,7 +285,8 @@ namespace p25
             __PROTECTED_COPY(TSBK);
 
         private:
-            uint8_t* m_raw;
+            uint8_t m_raw[defines::P25_TSBK_LENGTH_BYTES];
+            bool m_rawDecoded;
         };
     } // namespace lc
 } // namespace p25
@@ -76,8 +76,9 @@ void LC_ADJ_STS_BCAST::encode(uint8_t* data)
         return; // blatantly ignore creating this TSBK
     }
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
 
 // ---------------------------------------------------------------------------
@@ -52,6 +52,7 @@ void LC_CALL_TERM::encode(uint8_t* data)
     rsValue = 0U;
     rsValue = (rsValue << 24) + m_dstId;                                        // Target Address
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
@@ -54,6 +54,7 @@ void LC_CONV_FALLBACK::encode(uint8_t* data)
     rsValue = (rsValue << 16) + m_siteData.channelId();                             // Channel ID 2
     rsValue = (rsValue << 8) + m_siteData.channelId();                              // Channel ID 1
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
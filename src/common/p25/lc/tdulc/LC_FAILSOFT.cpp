@@ -51,6 +51,7 @@ void LC_FAILSOFT::encode(uint8_t* data)
     rsValue = m_mfId;
     rsValue = (rsValue << 56);
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
@@ -56,6 +56,7 @@ void LC_GROUP_UPDT::encode(uint8_t* data)
     rsValue = (rsValue << 12) + m_grpVchNo;                                         // Group B - Channel Number
     rsValue = (rsValue << 16) + m_dstId;                                            // Group B - Talkgroup Address
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
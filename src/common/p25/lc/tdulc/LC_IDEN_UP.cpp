@@ -94,6 +94,7 @@ void LC_IDEN_UP::encode(uint8_t* data)
         return; // blatently ignore creating this TSBK
     }
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
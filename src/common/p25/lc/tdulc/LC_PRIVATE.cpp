@@ -70,6 +70,7 @@ void LC_PRIVATE::encode(uint8_t* data)
     rsValue = (rsValue << 24) + m_dstId;                                            // Target Radio Address
     rsValue = (rsValue << 24) + m_srcId;                                            // Source Radio Address
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
@@ -57,6 +57,7 @@ void LC_RFSS_STS_BCAST::encode(uint8_t* data)
     rsValue = (rsValue << 12) + m_siteData.channelNo();                             // Channel Number
     rsValue = (rsValue << 8) + m_siteData.serviceClass();                           // System Service Class
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
@@ -55,6 +55,7 @@ void LC_SYS_SRV_BCAST::encode(uint8_t* data)
     rsValue = (rsValue << 16) + services;                                           // System Services Available
     rsValue = (rsValue << 24) + services;                                           // System Services Supported
 
-    std::unique_ptr<uint8_t[]> rs = TDULC::fromValue(rsValue);
-    TDULC::encode(data, rs.get());
+    uint8_t rs[P25_TDULC_PAYLOAD_LENGTH_BYTES];
+    TDULC::fromValue(rsValue, rs);
+    TDULC::encode(data, rs);
 }
@@ -71,8 +71,9 @@ void IOSP_ACK_RSP::encode(uint8_t* data, bool rawTSBK, bool noTrellis)
     }
     tsbkValue = (tsbkValue << 24) + m_srcId;                                        // Source Radio Address
 
-    std::unique_ptr<uint8_t[]> tsbk = TSBK::fromValue(tsbkValue);
-    TSBK::encode(data, tsbk.get(), rawTSBK, noTrellis);
+    uint8_t tsbk[P25_TSBK_LENGTH_BYTES - 4U];
+    TSBK::fromValue(tsbkValue, tsbk);
+    TSBK::encode(data, tsbk, rawTSBK, noTrellis);
 }
 
 /* Returns a string that represents the current TSBK. */
@@ -63,8 +63,9 @@ void IOSP_EXT_FNCT::encode(uint8_t* data, bool rawTSBK, bool noTrellis)
     tsbkValue = (tsbkValue << 24) + m_srcId;                                        // Argument
     tsbkValue = (tsbkValue << 24) + m_dstId;                                        // Target Radio Address
 
-    std::unique_ptr<uint8_t[]> tsbk = TSBK::fromValue(tsbkValue);
-    TSBK::encode(data, tsbk.get(), rawTSBK, noTrellis);
+    uint8_t tsbk[P25_TSBK_LENGTH_BYTES - 4U];
+    TSBK::fromValue(tsbkValue, tsbk);
+    TSBK::encode(data, tsbk, rawTSBK, noTrellis);
 }
 
 /* Returns a string that represents the current TSBK. */
@@ -25,6 +25,7 @@
 #define  __P25_LC__TSBK_FACTORY_H__
 
 #include "common/Defines.h"
+#include "common/MessagePool.h"
 
 #include "common/edac/Trellis.h"
 
@@ -130,6 +131,16 @@ namespace p25
                  * @returns TSBK* Instance of a TSBK representing the decoded data.
                  */
                 static std::unique_ptr<TSBK> createTSBK(const uint8_t* data, bool rawTSBK = false);
+                /**
+                 * @brief Decode a TSBK into this thread's reusable instance of its type.
+                 *
+                 *  No memory is allocated; the returned TSBK is borrowed and only remains valid until this
+                 *  thread next decodes a TSBK of the same type. It must not be deleted or retained.
+                 * @param[in] data Buffer containing TSBK packet data to decode.
+                 * @param rawTSBK Flag indicating whether or not the passed buffer is raw.
+                 * @returns TSBK* Borrowed instance of a TSBK representing the decoded data.
+                 */
+                static TSBK* decodeTSBK(const uint8_t* data, bool rawTSBK = false);
                 /**
                  * @brief Create an instance of a AMBT.
                  * @param[in] dataHeader P25 PDU data header
@@ -147,14 +158,32 @@ namespace p25
             private:
                 static bool m_warnCRC;
 
+                /**
+                 * @brief Helper to allocate (or borrow) an instance of a TSBK type.
+                 * @tparam T TSBK type.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 * @returns TSBK* Instance of the TSBK type.
+                 */
+                template<class T>
+                static TSBK* instance(bool pooled) { return (pooled) ? MessagePool<T>::borrow() : new T(); }
+
+                /**
+                 * @brief Create (or borrow) and decode an instance of a TSBK.
+                 * @param[in] data Buffer containing TSBK packet data to decode.
+                 * @param rawTSBK Flag indicating whether or not the passed buffer is raw.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
+                 * @returns TSBK* Instance of a TSBK representing the decoded data.
+                 */
+                static TSBK* create(const uint8_t* data, bool rawTSBK, bool pooled);
                 /**
                  * @brief Decode a TSBK.
                  * @param tsbk Instance of a TSBK.
                  * @param[in] data Buffer containing TSBK packet data to decode.
                  * @param rawTSBK Flag indicating whether or not the passed buffer is raw.
+                 * @param pooled Flag indicating the instance is borrowed from the per-thread pool.
                  * @returns TSBK* Instance of a TSBK representing the decoded data.
                  */
-                static std::unique_ptr<TSBK> decode(TSBK* tsbk, const uint8_t* data, bool rawTSBK = false);
+                static TSBK* decode(TSBK* tsbk, const uint8_t* data, bool rawTSBK, bool pooled);
                 /**
                  * @brief Decode an AMBT.
                  * @param tsbk Instance of a TSBK.
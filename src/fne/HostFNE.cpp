@@ -41,6 +41,7 @@ using namespace lookups;
 
 #define IDLE_WARMUP_MS 5U
 #define DEFAULT_MTU_SIZE 496
+#define VTUN_WAIT_MS 5U
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -199,12 +200,12 @@ int HostFNE::run()
     ** Initialize Threads
     */
 
-    if (!Thread::runAsThread(this, threadMasterNetwork))
+    if (!Thread::runAsThread(this, threadMasterNetwork, nullptr, THREAD_GROUP_NETWORK))
         return EXIT_FAILURE;
-    if (!Thread::runAsThread(this, threadDiagNetwork))
+    if (!Thread::runAsThread(this, threadDiagNetwork, nullptr, THREAD_GROUP_NETWORK))
         return EXIT_FAILURE;
 #if !defined(_WIN32)
-    if (!Thread::runAsThread(this, threadVirtualNetworking))
+    if (!Thread::runAsThread(this, threadVirtualNetworking, nullptr, THREAD_GROUP_NETWORK))
         return EXIT_FAILURE;
 #endif // !defined(_WIN32)
     /*
@@ -219,6 +220,9 @@ int HostFNE::run()
 
     ::LogInfoEx(LOG_HOST, "[ OK ] FNE is up and running on %s %s %s", utsinfo.sysname, utsinfo.release, utsinfo.machine);
 #endif // defined(_WIN32)
+    // the main loop clocks the master and peer networks
+    Thread::applyGroupSchedule(THREAD_GROUP_NETWORK);
+
     while (!g_killed) {
         uint32_t ms = stopWatch.elapsed();
 
@@ -345,6 +349,12 @@ bool HostFNE::readParams()
     LogInfo("    Allow Activity Log Transfer: %s", m_allowActivityTransfer ? "yes" : "no");
     LogInfo("    Allow Diagnostic Log Transfer: %s", m_allowDiagnosticTransfer ? "yes" : "no");
 
+    yaml::Node rtConf = systemConf["realtime"];
+    const THREAD_GROUP rtGroups[] = { THREAD_GROUP_NETWORK, THREAD_GROUP_REST };
+    bool memoryLocked = false;
+    if (!Thread::configureSchedule(rtConf, rtGroups, sizeof(rtGroups) / sizeof(THREAD_GROUP), memoryLocked))
+        return false;
+
     // attempt to load and populate routing rules
     yaml::Node masterConf = m_conf["master"];
     yaml::Node talkgroupRules = masterConf["talkgroup_rules"];
@@ -862,24 +872,27 @@ void* HostFNE::threadVirtualNetworking(void* arg)
             StopWatch stopWatch;
             stopWatch.start();
 
+            uint8_t packet[DEFAULT_MTU_SIZE];
+
             while (!g_killed) {
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
 
-                uint8_t packet[DEFAULT_MTU_SIZE];
-                ::memset(packet, 0x00U, DEFAULT_MTU_SIZE);
-
-                ssize_t len = fne->m_tun->read(packet);
-                if (len > 0) {
+                // wait for a packet from the virtual interface (rather than polling for one), then
+                // handle every packet that is waiting before clocking the traffic handler
+                ssize_t len = fne->m_tun->read(packet, VTUN_WAIT_MS);
+                while (len > 0) {
                     switch (fne->m_packetDataMode) {
                     case PacketDataMode::DMR:
                         // TODO: not supported yet
                         break;
 
                     case PacketDataMode::PROJECT25:
-                        fne->m_network->p25TrafficHandler()->packetData()->processPacketFrame(packet, DEFAULT_MTU_SIZE);
+                        fne->m_network->p25TrafficHandler()->packetData()->processPacketFrame(packet, (uint32_t)len);
                         break;
                     }
+
+                    len = fne->m_tun->read(packet);
                 }
 
                 // clock traffic handler
@@ -892,8 +905,6 @@ void* HostFNE::threadVirtualNetworking(void* arg)
                     fne->m_network->p25TrafficHandler()->packetData()->clock(ms);
                     break;
                 }
-
-                Thread::sleep(5U);
             }
         }
 
@@ -141,17 +141,17 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     uint32_t frameLength = buffer[23U];
 
     // process a TSBK out into a class literal if possible
-    std::unique_ptr<lc::TSBK> tsbk;
+    lc::TSBK* tsbk = nullptr;
     if (duid == DUID::TSDU) {
-        UInt8Array data = std::unique_ptr<uint8_t[]>(new uint8_t[frameLength]);
-        ::memset(data.get(), 0x00U, frameLength);
-        ::memcpy(data.get(), buffer + 24U, frameLength);
+        uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+        ::memcpy(data, buffer + 24U, (frameLength < P25_TSDU_FRAME_LENGTH_BYTES) ? frameLength : P25_TSDU_FRAME_LENGTH_BYTES);
 
-        tsbk = lc::tsbk::TSBKFactory::createTSBK(data.get());
+        tsbk = lc::tsbk::TSBKFactory::decodeTSBK(data);
     }
 
     // is the stream valid?
-    if (validate(peerId, control, duid, tsbk.get(), streamId)) {
+    if (validate(peerId, control, duid, tsbk, streamId)) {
         // is this peer ignored?
         if (!isPeerPermitted(peerId, control, duid, streamId)) {
             return false;
@@ -604,11 +604,11 @@ void TagP25Data::routeRewrite(uint8_t* buffer, uint32_t peerId, uint8_t duid, ui
 
         // are we receiving a TSDU?
         if (duid == DUID::TSDU) {
-            UInt8Array data = std::unique_ptr<uint8_t[]>(new uint8_t[frameLength]);
-            ::memset(data.get(), 0x00U, frameLength);
-            ::memcpy(data.get(), buffer + 24U, frameLength);
+            uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+            ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+            ::memcpy(data, buffer + 24U, (frameLength < P25_TSDU_FRAME_LENGTH_BYTES) ? frameLength : P25_TSDU_FRAME_LENGTH_BYTES);
 
-            std::unique_ptr<lc::TSBK> tsbk = lc::tsbk::TSBKFactory::createTSBK(data.get());
+            lc::TSBK* tsbk = lc::tsbk::TSBKFactory::decodeTSBK(data);
             if (tsbk != nullptr) {
                 // handle standard P25 reference opcodes
                 switch (tsbk->getLCO()) {
@@ -685,11 +685,13 @@ bool TagP25Data::processTSDUFrom(uint8_t* buffer, uint32_t peerId, uint8_t duid)
     if (duid == DUID::TSDU) {
         uint32_t frameLength = buffer[23U];
 
-        UInt8Array data = std::unique_ptr<uint8_t[]>(new uint8_t[frameLength]);
-        ::memset(data.get(), 0x00U, frameLength);
-        ::memcpy(data.get(), buffer + 24U, frameLength);
+        uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
 
-        std::unique_ptr<lc::TSBK> tsbk = lc::tsbk::TSBKFactory::createTSBK(data.get());
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        ::memcpy(data, buffer + 24U, (frameLength < P25_TSDU_FRAME_LENGTH_BYTES) ? frameLength : P25_TSDU_FRAME_LENGTH_BYTES);
+
+        lc::TSBK* tsbk = lc::tsbk::TSBKFactory::decodeTSBK(data);
         if (tsbk != nullptr) {
             // report tsbk event to InfluxDB
             if (m_network->m_enableInfluxDB && m_network->m_influxLogRawData) {
@@ -727,7 +729,7 @@ bool TagP25Data::processTSDUFrom(uint8_t* buffer, uint32_t peerId, uint8_t duid)
                         // LogWarning(LOG_NET, "PEER %u, passing ADJ_STS_BCAST to internal peers is prohibited, dropping", peerId);
                         return false;
                     } else {
-                        lc::tsbk::OSP_ADJ_STS_BCAST* osp = static_cast<lc::tsbk::OSP_ADJ_STS_BCAST*>(tsbk.get());
+                        lc::tsbk::OSP_ADJ_STS_BCAST* osp = static_cast<lc::tsbk::OSP_ADJ_STS_BCAST*>(tsbk);
 
                         if (m_network->m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, sysId = $%03X, rfss = $%02X, site = $%02X, chId = %u, chNo = %u, svcClass = $%02X, peerId = %u", tsbk->toString().c_str(),
@@ -756,11 +758,13 @@ bool TagP25Data::processTSDUTo(uint8_t* buffer, uint32_t peerId, uint8_t duid)
     if (duid == DUID::TSDU) {
         uint32_t frameLength = buffer[23U];
 
-        UInt8Array data = std::unique_ptr<uint8_t[]>(new uint8_t[frameLength]);
-        ::memset(data.get(), 0x00U, frameLength);
-        ::memcpy(data.get(), buffer + 24U, frameLength);
+        uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
 
-        std::unique_ptr<lc::TSBK> tsbk = lc::tsbk::TSBKFactory::createTSBK(data.get());
+        ::memcpy(data, buffer + 24U, (frameLength < P25_TSDU_FRAME_LENGTH_BYTES) ? frameLength : P25_TSDU_FRAME_LENGTH_BYTES);
+
+        lc::TSBK* tsbk = lc::tsbk::TSBKFactory::decodeTSBK(data);
         if (tsbk != nullptr) {
             //uint32_t srcId = tsbk->getSrcId();
             uint32_t dstId = tsbk->getDstId();
@@ -823,11 +827,13 @@ bool TagP25Data::processTSDUToExternal(uint8_t* buffer, uint32_t srcPeerId, uint
     if (duid == DUID::TSDU) {
         uint32_t frameLength = buffer[23U];
 
-        UInt8Array data = std::unique_ptr<uint8_t[]>(new uint8_t[frameLength]);
-        ::memset(data.get(), 0x00U, frameLength);
-        ::memcpy(data.get(), buffer + 24U, frameLength);
+        uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES];
+
+        ::memset(data, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        ::memcpy(data, buffer + 24U, (frameLength < P25_TSDU_FRAME_LENGTH_BYTES) ? frameLength : P25_TSDU_FRAME_LENGTH_BYTES);
 
-        std::unique_ptr<lc::TSBK> tsbk = lc::tsbk::TSBKFactory::createTSBK(data.get());
+        lc::TSBK* tsbk = lc::tsbk::TSBKFactory::decodeTSBK(data);
         if (tsbk != nullptr) {
             // handle standard P25 reference opcodes
             switch (tsbk->getLCO()) {
@@ -837,7 +843,7 @@ bool TagP25Data::processTSDUToExternal(uint8_t* buffer, uint32_t srcPeerId, uint
                         // LogWarning(LOG_NET, "PEER %u, passing ADJ_STS_BCAST to external peers is prohibited, dropping", dstPeerId);
                         return false;
                     } else {
-                        lc::tsbk::OSP_ADJ_STS_BCAST* osp = static_cast<lc::tsbk::OSP_ADJ_STS_BCAST*>(tsbk.get());
+                        lc::tsbk::OSP_ADJ_STS_BCAST* osp = static_cast<lc::tsbk::OSP_ADJ_STS_BCAST*>(tsbk);
 
                         if (m_network->m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, sysId = $%03X, rfss = $%02X, site = $%02X, chId = %u, chNo = %u, svcClass = $%02X, peerId = %u", tsbk->toString().c_str(),
@@ -62,7 +62,13 @@ P25PacketData::P25PacketData(FNENetwork* network, TagP25Data* tag, bool debug) :
 
 /* Finalizes a instance of the P25PacketData class. */
 
-P25PacketData::~P25PacketData() = default;
+P25PacketData::~P25PacketData()
+{
+    for (auto& entry : m_status) {
+        delete entry.second;
+    }
+    m_status.clear();
+}
 
 /* Process a data frame from the network. */
 
@@ -81,9 +87,9 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
     ::memset(buffer, 0x00U, P25_PDU_FEC_LENGTH_BYTES);
     ::memcpy(buffer, data + 24U, P25_PDU_FEC_LENGTH_BYTES);
 
-    auto it = std::find_if(m_status.begin(), m_status.end(), [&](StatusMapPair x) { return x.second->peerId == peerId; });
-    if (it != m_status.end()) {
-        RxStatus* status = m_status[peerId];
+    auto it = m_status.find(peerId);
+    if (it != m_status.end() && it->second->active) {
+        RxStatus* status = it->second;
         if (streamId != status->streamId) {
             LogWarning(LOG_NET, "P25, Data Call Collision, peer = %u, streamId = %u, rxPeer = %u, rxLlId = %u, rxStreamId = %u, external = %u",
                 peerId, streamId, status->peerId, status->llId, status->streamId, external);
@@ -94,53 +100,63 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                 LogWarning(LOG_NET, "P25, force clearing stuck data call, timeout, peer = %u, streamId = %u, rxPeer = %u, rxLlId = %u, rxStreamId = %u, external = %u",
                     peerId, streamId, status->peerId, status->llId, status->streamId, external);
 
-                delete status;
-                m_status.erase(peerId);
+                status->active = false;
             }
 
             return false;
         }
     } else {
         if (currentBlock == 0U) {
-            // this is a new call stream
-            RxStatus* status = new RxStatus();
+            // this is a new call stream; the receive status (and its assembler) of a peer is reused
+            // for every PDU it sends
+            RxStatus* status = nullptr;
+            if (it != m_status.end()) {
+                status = it->second;
+            }
+            else {
+                status = new RxStatus();
+                m_status[peerId] = status;
+            }
+
             status->callStartTime = pktTime;
             status->streamId = streamId;
             status->peerId = peerId;
 
-            bool ret = status->header.decode(buffer);
+            p25::data::DataHeader& header = status->assembler.header();
+
+            bool ret = status->assembler.decodeHeader(buffer);
             if (!ret) {
                 LogWarning(LOG_NET, P25_PDU_STR ", unfixable RF 1/2 rate header data");
                 Utils::dump(1U, "Unfixable PDU Data", buffer, P25_PDU_FEC_LENGTH_BYTES);
+
                 return false;
             }
 
             LogMessage(LOG_NET, P25_PDU_STR ", peerId = %u, ack = %u, outbound = %u, fmt = $%02X, sap = $%02X, fullMessage = %u, blocksToFollow = %u, padLength = %u, packetLength = %u, S = %u, n = %u, seqNo = %u, hdrOffset = %u, llId = %u",
-                peerId, status->header.getAckNeeded(), status->header.getOutbound(), status->header.getFormat(), status->header.getSAP(), status->header.getFullMessage(),
-                status->header.getBlocksToFollow(), status->header.getPadLength(), status->header.getPacketLength(), status->header.getSynchronize(), status->header.getNs(), status->header.getFSN(),
-                status->header.getHeaderOffset(), status->header.getLLId());
+                peerId, header.getAckNeeded(), header.getOutbound(), header.getFormat(), header.getSAP(), header.getFullMessage(),
+                header.getBlocksToFollow(), header.getPadLength(), header.getPacketLength(), header.getSynchronize(), header.getNs(), header.getFSN(),
+                header.getHeaderOffset(), header.getLLId());
 
             // make sure we don't get a PDU with more blocks then we support
-            if (status->header.getBlocksToFollow() >= P25_MAX_PDU_BLOCKS) {
-                LogError(LOG_NET, P25_PDU_STR ", too many PDU blocks to process, %u > %u", status->header.getBlocksToFollow(), P25_MAX_PDU_BLOCKS);
+            if (header.getBlocksToFollow() >= P25_MAX_PDU_BLOCKS) {
+                LogError(LOG_NET, P25_PDU_STR ", too many PDU blocks to process, %u > %u", header.getBlocksToFollow(), P25_MAX_PDU_BLOCKS);
+
                 return false;
             }
 
-            status->llId = status->header.getLLId();
-
-            m_status[peerId] = status;
+            status->llId = header.getLLId();
+            status->active = true;
 
             // is this a response header?
-            if (status->header.getFormat() == PDUFormatType::RSP) {
+            if (header.getFormat() == PDUFormatType::RSP) {
                 dispatch(peerId);
 
-                delete status;
-                m_status.erase(peerId);
+                status->active = false;
                 return true;
             }
 
-            if (status->header.getSAP() != PDUSAP::EXT_ADDR &&
-                status->header.getFormat() != PDUFormatType::UNCONFIRMED) {
+            if (header.getSAP() != PDUSAP::EXT_ADDR &&
+                header.getFormat() != PDUFormatType::UNCONFIRMED) {
                 m_readyForPkt[status->llId] = true;
                 m_suSendSeq[status->llId] = 0U;
             }
@@ -154,9 +170,11 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
     }
 
     RxStatus* status = m_status[peerId];
+    p25::data::Assembler& assembler = status->assembler;
+    p25::data::DataHeader& header = assembler.header();
 
     // is the source ID a blacklisted ID?
-    lookups::RadioId rid = m_network->m_ridLookup->find(status->header.getLLId());
+    lookups::RadioId rid = m_network->m_ridLookup->find(header.getLLId());
     if (!rid.radioDefault()) {
         if (!rid.radioEnabled()) {
             // report error event to InfluxDB
@@ -165,140 +183,81 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                     .meas("call_error_event")
                         .tag("peerId", std::to_string(peerId))
                         .tag("streamId", std::to_string(streamId))
-                        .tag("srcId", std::to_string(status->header.getLLId()))
-                        .tag("dstId", std::to_string(status->header.getLLId()))
+                        .tag("srcId", std::to_string(header.getLLId()))
+                        .tag("dstId", std::to_string(header.getLLId()))
                             .field("message", INFLUXDB_ERRSTR_DISABLED_SRC_RID)
                         .timestamp(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count())
                     .request(m_network->m_influxServer);
             }
 
-            delete status;
-            m_status.erase(peerId);
+            status->active = false;
             return false;
         }
     }
 
-    ::memcpy(status->netPDU + status->dataOffset, data + 24U, blockLength);
-    status->dataOffset += blockLength;
-    status->netPDUCount++;
-    status->dataBlockCnt++;
-
-    if (status->dataBlockCnt >= status->header.getBlocksToFollow()) {
-        uint32_t blocksToFollow = status->header.getBlocksToFollow();
-        uint32_t offset = 0U;
-        uint32_t dataOffset = 0U;
-
-        uint8_t buffer[P25_PDU_FEC_LENGTH_BYTES];
+    // decode the block as it arrives, directly into its slot in the PDU user data
+    bool secondHeader = assembler.isSecondHeader();
+    bool ret = assembler.decodeBlock(buffer);
+    if (secondHeader) {
+        if (!ret) {
+            LogWarning(LOG_NET, P25_PDU_STR ", unfixable RF 1/2 rate second header data");
+            Utils::dump(1U, "Unfixable PDU Data", buffer, P25_PDU_HEADER_LENGTH_BYTES);
 
-        status->dataBlockCnt = 0U;
+            status->active = false;
 
-        // process all blocks in the data stream
-        status->pduUserData = new uint8_t[P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U];
-        ::memset(status->pduUserData, 0x00U, P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U);
-
-        // process second header if we're using enhanced addressing
-        if (status->header.getSAP() == PDUSAP::EXT_ADDR &&
-            status->header.getFormat() == PDUFormatType::UNCONFIRMED) {
-            ::memset(buffer, 0x00U, P25_PDU_FEC_LENGTH_BYTES);
-            ::memcpy(buffer, status->netPDU, P25_PDU_FEC_LENGTH_BYTES);
-
-            bool ret = status->header.decodeExtAddr(buffer);
-            if (!ret) {
-                LogWarning(LOG_NET, P25_PDU_STR ", unfixable RF 1/2 rate second header data");
-                Utils::dump(1U, "Unfixable PDU Data", buffer, P25_PDU_HEADER_LENGTH_BYTES);
-
-                delete status;
-                m_status.erase(peerId);
-
-                return false;
-            }
-
-            LogMessage(LOG_NET, P25_PDU_STR ", ISP, extended address, sap = $%02X, srcLlId = %u",
-                status->header.getEXSAP(), status->header.getSrcLLId());
-
-            status->extendedAddress = true;
-            status->llId = status->header.getSrcLLId();
-            m_readyForPkt[status->llId] = true;
-            m_suSendSeq[status->llId] = 0U;
-
-            offset += P25_PDU_FEC_LENGTH_BYTES;
-            blocksToFollow--;
-
-            // if we are using a secondary header place it in the PDU user data buffer
-            status->header.getExtAddrData(status->pduUserData + dataOffset);
-            dataOffset += P25_PDU_HEADER_LENGTH_BYTES;
-            status->pduUserDataLength += P25_PDU_HEADER_LENGTH_BYTES;
+            return false;
         }
 
-        // decode data blocks
-        for (uint32_t i = 0U; i < blocksToFollow; i++) {
-            ::memset(buffer, 0x00U, P25_PDU_FEC_LENGTH_BYTES);
-            ::memcpy(buffer, status->netPDU + offset, P25_PDU_FEC_LENGTH_BYTES);
-
-            bool ret = status->blockData[i].decode(buffer, status->header);
-            if (ret) {
-                // if we are getting unconfirmed or confirmed blocks, and if we've reached the total number of blocks
-                // set this block as the last block for full packet CRC
-                if ((status->header.getFormat() == PDUFormatType::CONFIRMED) || (status->header.getFormat() == PDUFormatType::UNCONFIRMED)) {
-                    if ((status->dataBlockCnt + 1U) == blocksToFollow) {
-                        status->blockData[i].setLastBlock(true);
-                    }
-                }
-
-                // are we processing extended address data from the first block?
-                if (status->header.getSAP() == PDUSAP::EXT_ADDR && status->header.getFormat() == PDUFormatType::CONFIRMED &&
-                    status->blockData[i].getSerialNo() == 0U) {
-                    uint8_t secondHeader[P25_PDU_HEADER_LENGTH_BYTES];
-                    ::memset(secondHeader, 0x00U, P25_PDU_HEADER_LENGTH_BYTES);
-                    status->blockData[i].getData(secondHeader);
-
-                    status->header.decodeExtAddr(secondHeader);
-                    LogMessage(LOG_NET, P25_PDU_STR ", ISP, block %u, fmt = $%02X, lastBlock = %u, sap = $%02X, srcLlId = %u",
-                        status->blockData[i].getSerialNo(), status->blockData[i].getFormat(), status->blockData[i].getLastBlock(),
-                        status->header.getEXSAP(), status->header.getSrcLLId());
-
-                    status->extendedAddress = true;
-                }
-                else {
-                    LogMessage(LOG_NET, P25_PDU_STR ", peerId = %u, block %u, fmt = $%02X, lastBlock = %u",
-                        peerId, (status->header.getFormat() == PDUFormatType::CONFIRMED) ? status->blockData[i].getSerialNo() : status->dataBlockCnt, status->blockData[i].getFormat(),
-                        status->blockData[i].getLastBlock());
-                }
-
-                status->blockData[i].getData(status->pduUserData + dataOffset);
-                dataOffset += (status->header.getFormat() == PDUFormatType::CONFIRMED) ? P25_PDU_CONFIRMED_DATA_LENGTH_BYTES : P25_PDU_UNCONFIRMED_LENGTH_BYTES;
-                status->pduUserDataLength = dataOffset;
-
-                status->dataBlockCnt++;
-            }
-            else {
-                if (status->blockData[i].getFormat() == PDUFormatType::CONFIRMED)
-                    LogWarning(LOG_NET, P25_PDU_STR ", unfixable PDU data (3/4 rate or CRC), block %u", i);
-                else
-                    LogWarning(LOG_NET, P25_PDU_STR ", unfixable PDU data (1/2 rate or CRC), block %u", i);
+        LogMessage(LOG_NET, P25_PDU_STR ", ISP, extended address, sap = $%02X, srcLlId = %u",
+            header.getEXSAP(), header.getSrcLLId());
 
-                if (m_network->m_dumpDataPacket) {
-                    Utils::dump(1U, "Unfixable PDU Data", buffer, P25_PDU_FEC_LENGTH_BYTES);
-                }
-            }
+        status->llId = header.getSrcLLId();
+        m_readyForPkt[status->llId] = true;
+        m_suSendSeq[status->llId] = 0U;
+    }
+    else if (ret) {
+        const p25::data::DataBlock& block = assembler.lastBlock();
+
+        // did we process extended address data from the first block?
+        if (header.getSAP() == PDUSAP::EXT_ADDR && header.getFormat() == PDUFormatType::CONFIRMED &&
+            block.getSerialNo() == 0U) {
+            LogMessage(LOG_NET, P25_PDU_STR ", ISP, block %u, fmt = $%02X, lastBlock = %u, sap = $%02X, srcLlId = %u",
+                block.getSerialNo(), block.getFormat(), block.getLastBlock(),
+                header.getEXSAP(), header.getSrcLLId());
+        }
+        else {
+            LogMessage(LOG_NET, P25_PDU_STR ", peerId = %u, block %u, fmt = $%02X, lastBlock = %u",
+                peerId, (header.getFormat() == PDUFormatType::CONFIRMED) ? block.getSerialNo() : assembler.getBlockCount() - 1U, block.getFormat(),
+                block.getLastBlock());
+        }
+    }
+    else {
+        if (header.getFormat() == PDUFormatType::CONFIRMED)
+            LogWarning(LOG_NET, P25_PDU_STR ", unfixable PDU data (3/4 rate or CRC), block %u", assembler.getBlockCount() - 1U);
+        else
+            LogWarning(LOG_NET, P25_PDU_STR ", unfixable PDU data (1/2 rate or CRC), block %u", assembler.getBlockCount() - 1U);
 
-            offset += P25_PDU_FEC_LENGTH_BYTES;
+        if (m_network->m_dumpDataPacket) {
+            Utils::dump(1U, "Unfixable PDU Data", buffer, P25_PDU_FEC_LENGTH_BYTES);
         }
+    }
 
-        if (status->dataBlockCnt < blocksToFollow) {
-            LogWarning(LOG_NET, P25_PDU_STR ", incomplete PDU (%d / %d blocks), peerId = %u, llId = %u", status->dataBlockCnt, blocksToFollow, peerId, status->llId);
+    if (assembler.isComplete()) {
+        uint32_t blocksToFollow = header.getBlocksToFollow();
+        if (assembler.getDecodedCount() < blocksToFollow) {
+            LogWarning(LOG_NET, P25_PDU_STR ", incomplete PDU (%d / %d blocks), peerId = %u, llId = %u", assembler.getDecodedCount(), blocksToFollow, peerId, status->llId);
         }
 
         // dispatch the PDU data
-        if (status->dataBlockCnt > 0U) {
+        if (assembler.getDecodedCount() > 0U) {
             dispatch(peerId);
         }
 
         uint64_t duration = hrc::diff(pktTime, status->callStartTime);
-        uint32_t srcId = (status->extendedAddress) ? status->header.getSrcLLId() : status->header.getLLId();
-        uint32_t dstId = status->header.getLLId();
+        uint32_t srcId = (assembler.getExtendedAddress()) ? header.getSrcLLId() : header.getLLId();
+        uint32_t dstId = header.getLLId();
         LogMessage(LOG_NET, "P25, Data Call End, peer = %u, srcId = %u, dstId = %u, blocks = %u, duration = %u, streamId = %u, external = %u",
-            peerId, srcId, dstId, status->header.getBlocksToFollow(), duration / 1000, streamId, external);
+            peerId, srcId, dstId, blocksToFollow, duration / 1000, streamId, external);
 
         // report call event to InfluxDB
         if (m_network->m_enableInfluxDB) {
@@ -314,8 +273,7 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                 .request(m_network->m_influxServer);
         }
 
-        delete status;
-        m_status.erase(peerId);
+        status->active = false;
     }
 
     return true;
@@ -326,6 +284,11 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
 void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool alreadyQueued)
 {
 #if !defined(_WIN32)
+    if (len < sizeof(struct ip)) {
+        LogError(LOG_NET, P25_PDU_STR ", illegal IP packet length, len %u", len);
+        return;
+    }
+
     struct ip* ipHeader = (struct ip*)data;
 
     char srcIp[INET_ADDRSTRLEN];
@@ -338,14 +301,28 @@ void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool a
     uint16_t pktLen = Utils::reverseEndian(ipHeader->ip_len); // bryanb: this could be problematic on different endianness
 
     LogMessage(LOG_NET, "P25, VTUN -> PDU IP Data, srcIp = %s, dstIp = %s, pktLen = %u, proto = %02X", srcIp, dstIp, pktLen, proto);
+
+    if (pktLen > len) {
+        LogError(LOG_NET, P25_PDU_STR ", illegal IP packet length, pktLen %u, len %u", pktLen, len);
+        return;
+    }
 #if DEBUG_P25_PDU_DATA
     Utils::dump(1U, "P25PacketData::processPacketFrame() packet", data, pktLen);
 #endif
 
+    // lay the packet out as PDU user data (behind the extended address) now, so it can be sent
+    // as is once the SU is ready for it
+    p25::data::DataHeader pduHeader = p25::data::DataHeader();
+    pduHeader.setFormat(PDUFormatType::CONFIRMED);
+    pduHeader.setSAP(PDUSAP::EXT_ADDR);
+    pduHeader.calculateLength(pktLen);
+    uint32_t pduLength = pduHeader.getPDULength();
+
     VTUNDataFrame dataFrame;
-    dataFrame.buffer = new uint8_t[len];
-    ::memcpy(dataFrame.buffer, data, len);
-    dataFrame.bufferLen = len;
+    dataFrame.buffer = new uint8_t[pduLength];
+    ::memset(dataFrame.buffer, 0x00U, pduLength);
+    ::memcpy(dataFrame.buffer + 4U, data, pktLen);
+    dataFrame.bufferLen = pduLength;
     dataFrame.pktLen = pktLen;
 
     uint32_t dstLlId = getLLIdAddress(Utils::reverseEndian(ipHeader->ip_dst.s_addr));
@@ -409,16 +386,13 @@ void P25PacketData::clock(uint32_t ms)
         rspHeader.setSrcLLId(WUID_FNE);
 
         rspHeader.calculateLength(dataFrame.pktLen);
-        uint32_t pduLength = rspHeader.getPDULength();
+        assert(rspHeader.getPDULength() == dataFrame.bufferLen);
 
-        UInt8Array __pduUserData = std::make_unique<uint8_t[]>(pduLength);
-        uint8_t* pduUserData = __pduUserData.get();
-        ::memset(pduUserData, 0x00U, pduLength);
-        ::memcpy(pduUserData + 4U, dataFrame.buffer, dataFrame.pktLen);
+        // the frame buffer already holds the packet laid out as PDU user data
 #if DEBUG_P25_PDU_DATA
-        Utils::dump(1U, "P25PacketData::clock() pduUserData", pduUserData, pduLength);
+        Utils::dump(1U, "P25PacketData::clock() pduUserData", dataFrame.buffer, dataFrame.bufferLen);
 #endif
-        dispatchUserFrameToFNE(rspHeader, true, pduUserData);
+        dispatchUserFrameToFNE(rspHeader, true, dataFrame.buffer);
 
         delete[] dataFrame.buffer;
         m_dataFrames.pop_front();
@@ -434,38 +408,40 @@ void P25PacketData::clock(uint32_t ms)
 void P25PacketData::dispatch(uint32_t peerId)
 {
     RxStatus* status = m_status[peerId];
+    data::Assembler& assembler = status->assembler;
+    data::DataHeader& header = assembler.header();
 
     bool crcValid = false;
-    if (status->header.getBlocksToFollow() > 0U) {
-        if (status->pduUserDataLength < 4U) {
-            LogError(LOG_NET, P25_PDU_STR ", illegal PDU packet length, blocks %u, len %u", status->header.getBlocksToFollow(), status->pduUserDataLength);
+    if (header.getBlocksToFollow() > 0U) {
+        if (assembler.getUserDataLength() < 4U) {
+            LogError(LOG_NET, P25_PDU_STR ", illegal PDU packet length, blocks %u, len %u", header.getBlocksToFollow(), assembler.getUserDataLength());
             return;
         }
 
-        crcValid = edac::CRC::checkCRC32(status->pduUserData, status->pduUserDataLength);
+        crcValid = edac::CRC::checkCRC32(assembler.userData(), assembler.getUserDataLength());
         if (!crcValid) {
-            LogError(LOG_NET, P25_PDU_STR ", failed CRC-32 check, blocks %u, len %u", status->header.getBlocksToFollow(), status->pduUserDataLength);
+            LogError(LOG_NET, P25_PDU_STR ", failed CRC-32 check, blocks %u, len %u", header.getBlocksToFollow(), assembler.getUserDataLength());
             return;
         }
     }
 
-    if (m_network->m_dumpDataPacket && status->dataBlockCnt > 0U) {
-        Utils::dump(1U, "PDU Packet", status->pduUserData, status->pduUserDataLength);
+    if (m_network->m_dumpDataPacket && assembler.getDecodedCount() > 0U) {
+        Utils::dump(1U, "PDU Packet", assembler.userData(), assembler.getUserDataLength());
     }    
 
-    if (status->header.getFormat() == PDUFormatType::RSP) {
+    if (header.getFormat() == PDUFormatType::RSP) {
         LogMessage(LOG_NET, P25_PDU_STR ", ISP, response, fmt = $%02X, rspClass = $%02X, rspType = $%02X, rspStatus = $%02X, llId = %u, srcLlId = %u",
-                status->header.getFormat(), status->header.getResponseClass(), status->header.getResponseType(), status->header.getResponseStatus(),
-                status->header.getLLId(), status->header.getSrcLLId());
+                header.getFormat(), header.getResponseClass(), header.getResponseType(), header.getResponseStatus(),
+                header.getLLId(), header.getSrcLLId());
 /*
-        if (status->header.getResponseClass() == PDUAckClass::ACK && status->header.getResponseType() == PDUAckType::ACK) {
-            m_readyForPkt[status->header.getSrcLLId()] = true;
+        if (header.getResponseClass() == PDUAckClass::ACK && header.getResponseType() == PDUAckType::ACK) {
+            m_readyForPkt[header.getSrcLLId()] = true;
         }
 */
         return;
     }
 
-    uint8_t sap = (status->extendedAddress) ? status->header.getEXSAP() : status->header.getSAP();
+    uint8_t sap = (assembler.getExtendedAddress()) ? header.getEXSAP() : header.getSAP();
 
     // don't dispatch SNDCP control, conventional data registration or ARP
     if (sap != PDUSAP::SNDCP_CTRL_DATA && sap != PDUSAP::CONV_DATA_REG &&
@@ -486,7 +462,7 @@ void P25PacketData::dispatch(uint32_t peerId)
 
         uint8_t arpPacket[P25_PDU_ARP_PCKT_LENGTH];
         ::memset(arpPacket, 0x00U, P25_PDU_ARP_PCKT_LENGTH);
-        ::memcpy(arpPacket, status->pduUserData + 12U, P25_PDU_ARP_PCKT_LENGTH);
+        ::memcpy(arpPacket, assembler.userData() + 12U, P25_PDU_ARP_PCKT_LENGTH);
 
         uint16_t opcode = __GET_UINT16B(arpPacket, 6U);
         uint32_t srcHWAddr = __GET_UINT16(arpPacket, 8U);
@@ -524,12 +500,12 @@ void P25PacketData::dispatch(uint32_t peerId)
             break;
 
         int dataPktOffset = 0U;
-        if (status->header.getFormat() == PDUFormatType::CONFIRMED && status->extendedAddress)
+        if (header.getFormat() == PDUFormatType::CONFIRMED && assembler.getExtendedAddress())
             dataPktOffset = 4U;
-        if (status->header.getFormat() == PDUFormatType::UNCONFIRMED && status->extendedAddress)
+        if (header.getFormat() == PDUFormatType::UNCONFIRMED && assembler.getExtendedAddress())
             dataPktOffset = 12U;
 
-        struct ip* ipHeader = (struct ip*)(status->pduUserData + dataPktOffset);
+        struct ip* ipHeader = (struct ip*)(assembler.userData() + dataPktOffset);
 
         char srcIp[INET_ADDRSTRLEN];
         inet_ntop(AF_INET, &(ipHeader->ip_src), srcIp, INET_ADDRSTRLEN);
@@ -542,10 +518,13 @@ void P25PacketData::dispatch(uint32_t peerId)
 
         LogMessage(LOG_NET, "P25, PDU -> VTUN, IP Data, srcIp = %s, dstIp = %s, pktLen = %u, proto = %02X", srcIp, dstIp, pktLen, proto);
 
-        UInt8Array __ipFrame = std::make_unique<uint8_t[]>(pktLen);
-        uint8_t* ipFrame = __ipFrame.get();
-        ::memset(ipFrame, 0x00U, pktLen);
-        ::memcpy(ipFrame, status->pduUserData + dataPktOffset, pktLen);
+        if ((uint32_t)(pktLen + dataPktOffset) > assembler.getUserDataLength()) {
+            LogError(LOG_NET, P25_PDU_STR ", illegal IP packet length, pktLen %u, len %u", pktLen, assembler.getUserDataLength());
+            break;
+        }
+
+        // the IP packet was reassembled in place, so write it to the tunnel straight from the PDU user data
+        uint8_t* ipFrame = assembler.userData() + dataPktOffset;
 #if DEBUG_P25_PDU_DATA
         Utils::dump(1U, "P25PacketData::dispatch() ipFrame", ipFrame, pktLen);
 #endif
@@ -553,15 +532,15 @@ void P25PacketData::dispatch(uint32_t peerId)
             LogError(LOG_NET, P25_PDU_STR ", failed to write IP frame to virtual tunnel, len %u", pktLen);
         }
 
-        write_PDU_Ack_Response(PDUAckClass::ACK, PDUAckType::ACK, status->header.getNs(), (status->extendedAddress) ? status->header.getSrcLLId() : status->header.getLLId());
-        m_readyForPkt[status->header.getSrcLLId()] = true;
+        write_PDU_Ack_Response(PDUAckClass::ACK, PDUAckType::ACK, header.getNs(), (assembler.getExtendedAddress()) ? header.getSrcLLId() : header.getLLId());
+        m_readyForPkt[header.getSrcLLId()] = true;
 #endif // !defined(_WIN32)
     }
     break;
     case PDUSAP::SNDCP_CTRL_DATA:
     {
         LogMessage(LOG_NET, P25_PDU_STR ", SNDCP_CTRL_DATA (SNDCP Control Data), blocksToFollow = %u",
-            status->header.getBlocksToFollow());
+            header.getBlocksToFollow());
 
         processSNDCPControl(status);
     }
@@ -576,9 +555,11 @@ void P25PacketData::dispatch(uint32_t peerId)
 void P25PacketData::dispatchToFNE(uint32_t peerId)
 {
     RxStatus* status = m_status[peerId];
+    data::Assembler& assembler = status->assembler;
+    data::DataHeader& header = assembler.header();
 
-    uint32_t srcId = (status->extendedAddress) ? status->header.getSrcLLId() : status->header.getLLId();
-    uint32_t dstId = status->header.getLLId();
+    uint32_t srcId = (assembler.getExtendedAddress()) ? header.getSrcLLId() : header.getLLId();
+    uint32_t dstId = header.getLLId();
 
     // repeat traffic to the connected peers
     if (m_network->m_peers.size() > 0U) {
@@ -590,7 +571,7 @@ void P25PacketData::dispatchToFNE(uint32_t peerId)
                     m_network->m_frameQueue->flushQueue();
                 }
 
-                write_PDU_User(peer.first, nullptr, status->header, status->extendedAddress, status->pduUserData, true);
+                write_PDU_User(peer.first, nullptr, header, assembler.getExtendedAddress(), assembler.userData(), true);
                 if (m_network->m_debug) {
                     LogDebug(LOG_NET, "P25, srcPeer = %u, dstPeer = %u, duid = $%02X, srcId = %u, dstId = %u", 
                         peerId, peer.first, DUID::PDU, srcId, dstId);
@@ -620,7 +601,7 @@ void P25PacketData::dispatchToFNE(uint32_t peerId)
                     continue;
                 }
 
-                write_PDU_User(dstPeerId, peer.second, status->header, status->extendedAddress, status->pduUserData);
+                write_PDU_User(dstPeerId, peer.second, header, assembler.getExtendedAddress(), assembler.userData());
                 if (m_network->m_debug) {
                     LogDebug(LOG_NET, "P25, srcPeer = %u, dstPeer = %u, duid = $%02X, srcId = %u, dstId = %u", 
                         peerId, dstPeerId, DUID::PDU, srcId, dstId);
@@ -686,13 +667,16 @@ void P25PacketData::dispatchUserFrameToFNE(p25::data::DataHeader& dataHeader, bo
 
 bool P25PacketData::processSNDCPControl(RxStatus* status)
 {
-    std::unique_ptr<sndcp::SNDCPPacket> packet = SNDCPFactory::create(status->pduUserData);
+    data::Assembler& assembler = status->assembler;
+    data::DataHeader& header = assembler.header();
+
+    std::unique_ptr<sndcp::SNDCPPacket> packet = SNDCPFactory::create(assembler.userData());
     if (packet == nullptr) {
         LogWarning(LOG_NET, P25_PDU_STR ", undecodable SNDCP packet");
         return false;
     }
 
-    uint32_t llId = status->header.getLLId();
+    uint32_t llId = header.getLLId();
 
     switch (packet->getPDUType()) {
         case SNDCP_PDUType::ACT_TDS_CTX:
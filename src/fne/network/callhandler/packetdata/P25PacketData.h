@@ -19,6 +19,7 @@
 #include "fne/Defines.h"
 #include "common/Clock.h"
 #include "common/p25/P25Defines.h"
+#include "common/p25/data/Assembler.h"
 #include "common/p25/data/DataBlock.h"
 #include "common/p25/data/DataHeader.h"
 #include "network/FNENetwork.h"
@@ -111,17 +112,9 @@ namespace network
                     uint32_t llId;
                     uint32_t streamId;
                     uint32_t peerId;
+                    bool active;
 
-                    p25::data::DataBlock* blockData;
-                    p25::data::DataHeader header;
-                    bool extendedAddress;
-                    uint32_t dataOffset;
-                    uint8_t dataBlockCnt;
-                    uint8_t* netPDU;
-                    uint32_t netPDUCount;
-
-                    uint8_t* pduUserData;
-                    uint32_t pduUserDataLength;
+                    p25::data::Assembler assembler;
 
                     /**
                      * @brief Initializes a new instance of the RxStatus class
@@ -130,32 +123,10 @@ namespace network
                         llId(0U),
                         streamId(0U),
                         peerId(0U),
-                        blockData(nullptr),
-                        header(),
-                        extendedAddress(false),
-                        dataOffset(0U),
-                        dataBlockCnt(0U),
-                        netPDU(nullptr),
-                        netPDUCount(0U),
-                        pduUserData(nullptr),
-                        pduUserDataLength(0U)
-                    {
-                        blockData = new p25::data::DataBlock[P25DEF::P25_MAX_PDU_BLOCKS];
-
-                        netPDU = new uint8_t[P25DEF::P25_PDU_FRAME_LENGTH_BYTES + 2U];
-                        ::memset(netPDU, 0x00U, P25DEF::P25_PDU_FRAME_LENGTH_BYTES + 2U);
-
-                        pduUserData = new uint8_t[P25DEF::P25_MAX_PDU_BLOCKS * P25DEF::P25_PDU_CONFIRMED_LENGTH_BYTES + 2U];
-                        ::memset(pduUserData, 0x00U, P25DEF::P25_MAX_PDU_BLOCKS * P25DEF::P25_PDU_CONFIRMED_LENGTH_BYTES + 2U);
-                    }
-                    /**
-                     * @brief Finalizes a instance of the RxStatus class
-                     */
-                    ~RxStatus()
+                        active(false),
+                        assembler()
                     {
-                        delete[] blockData;
-                        delete[] netPDU;
-                        delete[] pduUserData;
+                        /* stub */
                     }
                 };
                 typedef std::pair<const uint32_t, RxStatus*> StatusMapPair;
@@ -12,7 +12,9 @@
 */
 #include "Defines.h"
 #include "common/network/udp/Socket.h"
+#include "common/Thread.h"
 #include "modem/port/ModemNullPort.h"
+#include "modem/port/ModemLoopbackPort.h"
 #include "modem/port/UARTPort.h"
 #include "modem/port/PseudoPTYPort.h"
 #include "modem/port/UDPPort.h"
@@ -69,6 +71,7 @@ bool Host::readParams()
     m_idleTickDelay = (uint8_t)systemConf["idleTickDelay"].as<uint32_t>(5U);
     if (m_idleTickDelay < 1U)
         m_idleTickDelay = 1U;
+    m_useEventLoop = systemConf["eventLoop"].as<bool>(true);
 
     m_identity = systemConf["identity"].as<std::string>();
     m_fixedMode = systemConf["fixedMode"].as<bool>(false);
@@ -95,6 +98,7 @@ bool Host::readParams()
         }
         LogInfo("    Active Tick Delay: %ums", m_activeTickDelay);
         LogInfo("    Idle Tick Delay: %ums", m_idleTickDelay);
+        LogInfo("    Event Loop: %s", m_useEventLoop ? "yes" : "no");
         LogInfo("    Timeout: %us", m_timeout);
         LogInfo("    RF Mode Hang: %us", m_rfModeHang);
         LogInfo("    RF Talkgroup Hang: %us", m_rfTalkgroupHang);
@@ -337,6 +341,11 @@ bool Host::readParams()
         LogInfo("    Modem Remote Control: yes");
     }
 
+    yaml::Node rtConf = systemConf["realtime"];
+    const THREAD_GROUP rtGroups[] = { THREAD_GROUP_MODEM, THREAD_GROUP_PROTOCOL, THREAD_GROUP_NETWORK, THREAD_GROUP_REST };
+    if (!Thread::configureSchedule(rtConf, rtGroups, sizeof(rtGroups) / sizeof(THREAD_GROUP), m_memoryLocked))
+        return false;
+
     return true;
 }
 
@@ -461,6 +470,7 @@ bool Host::createModem()
     bool rtrt = dfsiParams["rtrt"].as<bool>(true);
     bool diu = dfsiParams["diu"].as<bool>(true);
     uint16_t jitter = dfsiParams["jitter"].as<uint16_t>(200U);
+    bool txPacing = dfsiParams["txPacing"].as<bool>(true);
     bool useFSCForUDP = dfsiParams["useFSC"].as<bool>(false);
     uint16_t dfsiCallTimeout = dfsiParams["callTimeout"].as<uint16_t>(200U);
 
@@ -514,6 +524,41 @@ bool Host::createModem()
     if (portType == NULL_PORT) {
         modemPort = new port::ModemNullPort();
     }
+    else if (portType == LOOPBACK_PORT) {
+        yaml::Node loopbackConf = modemProtocol["loopback"];
+        bool repeat = loopbackConf["repeat"].as<bool>(false);
+        uint32_t reportInterval = loopbackConf["reportInterval"].as<uint32_t>(10U);
+
+        std::vector<port::LoopbackStep> script;
+        yaml::Node& scriptList = loopbackConf["script"];
+        for (size_t i = 0; i < scriptList.size(); i++) {
+            yaml::Node& stepConf = scriptList[i];
+
+            std::string traffic = stepConf["traffic"].as<std::string>("p25-reg");
+            std::transform(traffic.begin(), traffic.end(), traffic.begin(), ::tolower);
+
+            port::LoopbackStep step;
+            if (!port::ModemLoopbackPort::parseTraffic(traffic, step.traffic)) {
+                LogError(LOG_HOST, "Invalid loopback traffic type, %s!", traffic.c_str());
+                return false;
+            }
+
+            step.count = stepConf["count"].as<uint32_t>(100U);
+            step.rate = stepConf["rate"].as<uint32_t>(10U);
+            step.srcId = stepConf["srcId"].as<uint32_t>(1000U);
+            step.dstId = stepConf["dstId"].as<uint32_t>(1U);
+            step.slot = (uint8_t)stepConf["slot"].as<uint32_t>(1U);
+            step.ber = stepConf["ber"].as<float>(0.0F);
+            step.callLength = stepConf["callLength"].as<uint32_t>(3000U);
+            step.pduBlocks = stepConf["pduBlocks"].as<uint32_t>(3U);
+            script.push_back(step);
+        }
+
+        modemPort = new port::ModemLoopbackPort(m_p25NAC, m_dmrColorCode, script, repeat, reportInterval);
+        LogInfo("    Loopback Script Steps: %u", (uint32_t)script.size());
+        LogInfo("    Loopback Repeat: %s", repeat ? "yes" : "no");
+        LogInfo("    Loopback Report Interval: %us", reportInterval);
+    }
     else if (portType == UART_PORT || portType == PTY_PORT) {
         port::SERIAL_SPEED serialSpeed = port::SERIAL_115200;
         switch (uartSpeed) {
@@ -573,6 +618,7 @@ bool Host::createModem()
         LogInfo("    DFSI RT/RT: %s", rtrt ? "yes" : "no");
         LogInfo("    DFSI DIU Flag: %s", diu ? "yes" : "no");
         LogInfo("    DFSI Jitter Size: %u ms", jitter);
+        LogInfo("    DFSI TX Pacing: %s", txPacing ? "yes" : "no");
         if (g_remoteModemMode) {
             LogInfo("    DFSI Use FSC: %s", useFSCForUDP ? "yes" : "no");
         }
@@ -651,6 +697,7 @@ bool Host::createModem()
         m_modem = new ModemV24(modemPort, m_duplex, m_p25QueueSizeBytes, m_p25QueueSizeBytes, rtrt, diu, jitter,
             dumpModemStatus, trace, debug);
         ((ModemV24*)m_modem)->setCallTimeout(dfsiCallTimeout);
+        ((ModemV24*)m_modem)->setTxPacing(txPacing);
     } else {
         m_modem = new Modem(modemPort, m_duplex, rxInvert, txInvert, pttInvert, dcBlocker, cosLockout, fdmaPreamble, dmrRxDelay, p25CorrCount,
             m_dmrQueueSizeBytes, m_p25QueueSizeBytes, m_nxdnQueueSizeBytes, disableOFlowReset, ignoreModemConfigArea, dumpModemStatus, trace, debug);
@@ -730,6 +777,12 @@ bool Host::createNetwork()
     bool updateLookup = networkConf["updateLookups"].as<bool>(false);
     bool saveLookup = networkConf["saveLookups"].as<bool>(false);
     bool debug = networkConf["debug"].as<bool>(false);
+    yaml::Node jitterBufferConf = networkConf["jitterBuffer"];
+    bool jitterBufferEnable = jitterBufferConf["enable"].as<bool>(false);
+    uint32_t jitterBufferMinDelay = jitterBufferConf["minDelay"].as<uint32_t>(60U);
+    uint32_t jitterBufferMaxDelay = jitterBufferConf["maxDelay"].as<uint32_t>(360U);
+    if (jitterBufferMaxDelay < jitterBufferMinDelay)
+        jitterBufferMaxDelay = jitterBufferMinDelay;
 
     m_allowStatusTransfer = allowStatusTransfer;
 
@@ -810,6 +863,11 @@ bool Host::createNetwork()
         else
             LogInfo("    Local: random");
         LogInfo("    DMR Jitter: %ums", jitter);
+        LogInfo("    Jitter Buffer: %s", jitterBufferEnable ? "yes" : "no");
+        if (jitterBufferEnable) {
+            LogInfo("    Jitter Buffer Min. Delay: %ums", jitterBufferMinDelay);
+            LogInfo("    Jitter Buffer Max. Delay: %ums", jitterBufferMaxDelay);
+        }
         LogInfo("    Slot 1: %s", slot1 ? "enabled" : "disabled");
         LogInfo("    Slot 2: %s", slot2 ? "enabled" : "disabled");
         LogInfo("    Allow Activity Log Transfer: %s", allowActivityTransfer ? "yes" : "no");
@@ -861,6 +919,10 @@ bool Host::createNetwork()
             m_network->setPresharedKey(presharedKey);
         }
 
+        if (jitterBufferEnable) {
+            m_network->setJitterBuffer(jitterBufferMinDelay, jitterBufferMaxDelay);
+        }
+
         m_network->enable(true);
         bool ret = m_network->open();
         if (!ret) {
@@ -152,10 +152,7 @@ void* Host::threadDMRReader1(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                host->waitTick(host->m_dmr1RxEvents);
             }
         }
 
@@ -413,10 +410,7 @@ void* Host::threadDMRReader2(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                host->waitTick(host->m_dmr2RxEvents);
             }
         }
 
@@ -101,10 +101,7 @@ void* Host::threadNXDNReader(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                host->waitTick(host->m_nxdnRxEvents);
             }
         }
 
@@ -143,10 +143,7 @@ void* Host::threadP25Reader(void* arg)
                     }
                 }
 
-                if (host->m_state != STATE_IDLE)
-                    Thread::sleep(m_activeTickDelay);
-                if (host->m_state == STATE_IDLE)
-                    Thread::sleep(m_idleTickDelay);
+                host->waitTick(host->m_p25RxEvents);
             }
         }
 
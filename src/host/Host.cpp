@@ -149,6 +149,14 @@ Host::Host(const std::string& confFile) :
     m_p25OverflowCnt(0U),
     m_nxdnOverflowCnt(0U),
     m_disableWatchdogOverflow(false),
+    m_useEventLoop(true),
+    m_memoryLocked(false),
+    m_mainEvents(),
+    m_modemEvents(),
+    m_dmr1RxEvents(),
+    m_dmr2RxEvents(),
+    m_p25RxEvents(),
+    m_nxdnRxEvents(),
     m_restAddress("0.0.0.0"),
     m_restPort(REST_API_DEFAULT_PORT),
     m_RESTAPI(nullptr),
@@ -791,55 +799,65 @@ int Host::run()
     ** Initialize Threads
     */
 
+    // the modem thread wakes the frame readers when it has frames for them
+    if (m_useEventLoop) {
+        m_mainEvents.open();
+        m_modemEvents.open();
+        m_dmr1RxEvents.open();
+        m_dmr2RxEvents.open();
+        m_p25RxEvents.open();
+        m_nxdnRxEvents.open();
+    }
+
     /** Watchdog */
     if (!Thread::runAsThread(this, threadWatchdog))
         return EXIT_FAILURE;
 
     /** Modem */
-    if (!Thread::runAsThread(this, threadModem))
+    if (!Thread::runAsThread(this, threadModem, nullptr, THREAD_GROUP_MODEM))
         return EXIT_FAILURE;
 
     /** Digital Mobile Radio Frame Processor */
     if (m_dmr != nullptr) {
-        if (!Thread::runAsThread(this, threadDMRReader1))
+        if (!Thread::runAsThread(this, threadDMRReader1, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
-        if (!Thread::runAsThread(this, threadDMRWriter1))
+        if (!Thread::runAsThread(this, threadDMRWriter1, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
-        if (!Thread::runAsThread(this, threadDMRReader2))
+        if (!Thread::runAsThread(this, threadDMRReader2, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
-        if (!Thread::runAsThread(this, threadDMRWriter2))
+        if (!Thread::runAsThread(this, threadDMRWriter2, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
     }
 
     /** Project 25 Frame Processor */
     if (m_p25 != nullptr) {
-        if (!Thread::runAsThread(this, threadP25Reader))
+        if (!Thread::runAsThread(this, threadP25Reader, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
-        if (!Thread::runAsThread(this, threadP25Writer))
+        if (!Thread::runAsThread(this, threadP25Writer, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
     }
 
     /** Next Generation Digital Narrowband Frame Processor */
     if (m_nxdn != nullptr) {
-        if (!Thread::runAsThread(this, threadNXDNReader))
+        if (!Thread::runAsThread(this, threadNXDNReader, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
-        if (!Thread::runAsThread(this, threadNXDNWriter))
+        if (!Thread::runAsThread(this, threadNXDNWriter, nullptr, THREAD_GROUP_PROTOCOL))
             return EXIT_FAILURE;
     }
 
     /** Adjacent Site and Affiliation Update */
-    if (!Thread::runAsThread(this, threadSiteData))
+    if (!Thread::runAsThread(this, threadSiteData, nullptr, THREAD_GROUP_NETWORK))
         return EXIT_FAILURE;
 
     /** Network Presence Notification */
     {
         if (!m_controlChData.address().empty() && m_controlChData.port() != 0 && m_network != nullptr) {
-            if (!Thread::runAsThread(this, threadPresence))
+            if (!Thread::runAsThread(this, threadPresence, nullptr, THREAD_GROUP_NETWORK))
                 return EXIT_FAILURE;
         }
 
         if (m_dmrCtrlChannel || m_p25CtrlChannel || m_nxdnCtrlChannel) {
-            if (!Thread::runAsThread(this, threadPresence))
+            if (!Thread::runAsThread(this, threadPresence, nullptr, THREAD_GROUP_NETWORK))
                 return EXIT_FAILURE;
         }
     }
@@ -856,6 +874,9 @@ int Host::run()
 
     ::LogInfoEx(LOG_HOST, "[ OK ] Host is up and running on %s %s %s", utsinfo.sysname, utsinfo.release, utsinfo.machine);
 #endif // defined(_WIN32)
+    // the main loop clocks the protocol controllers, and wakes early when network data arrives
+    Thread::applyGroupSchedule(THREAD_GROUP_PROTOCOL);
+
     while (!killed) {
         if (m_modem->hasLockout() && m_state != HOST_STATE_LOCKOUT)
             setState(HOST_STATE_LOCKOUT);
@@ -1259,10 +1280,11 @@ int Host::run()
 
         m_modeTimer.clock(ms);
 
-        if ((m_state != STATE_IDLE) && ms <= m_activeTickDelay)
-            Thread::sleep(m_activeTickDelay);
-        if (m_state == STATE_IDLE)
-            Thread::sleep(m_idleTickDelay);
+        // an event driven wait returns at once when the tick has already passed
+        if (m_state == STATE_IDLE || ms <= m_activeTickDelay || m_mainEvents.isEventDriven()) {
+            m_mainEvents.watch(0U, (m_network != nullptr) ? m_network->getDescriptor() : -1);
+            waitTick(m_mainEvents);
+        }
     }
 
     if (rssi != nullptr) {
@@ -1472,6 +1494,24 @@ json::object Host::getStatus()
         modemInfo["txFrequencyEffective"].set<uint32_t>(txFreqEffective);
 
         modemInfo["v24Connected"].set<bool>(m_modem->m_v24Connected);
+        if (m_isModemDFSI) {
+            uint32_t spacing[V24_TX_PACING_BUCKETS], late[V24_TX_PACING_BUCKETS], frames = 0U;
+            ((ModemV24*)m_modem)->getTxPacing(spacing, late, frames);
+
+            // histogram buckets are keyed by their upper bound in us; "max" holds everything above the last
+            json::object spacingHist = json::object(), lateHist = json::object();
+            for (uint32_t i = 0U; i < V24_TX_PACING_BUCKETS; i++) {
+                std::string key = (i < V24_TX_PACING_BUCKETS - 1U) ? std::to_string(V24_TX_PACING_BOUNDS_US[i]) : "max";
+                spacingHist[key].set<uint32_t>(spacing[i]);
+                lateHist[key].set<uint32_t>(late[i]);
+            }
+
+            json::object txPacing = json::object();
+            txPacing["frames"].set<uint32_t>(frames);
+            txPacing["spacingErrorUs"].set<json::object>(spacingHist);
+            txPacing["lateUs"].set<json::object>(lateHist);
+            modemInfo["v24TxPacing"].set<json::object>(txPacing);
+        }
 
         uint8_t protoVer = m_modem->getVersion();
         modemInfo["protoVer"].set<uint8_t>(protoVer);
@@ -1479,6 +1519,79 @@ json::object Host::getStatus()
         response["modem"].set<json::object>(modemInfo);
     }
 
+    // network jitter buffer statistics, per protocol, with each stream being played out
+    if (m_network != nullptr) {
+        std::vector<network::FrameJitterBuffer*> buffers = m_network->jitterBuffers();
+        if (!buffers.empty()) {
+            auto statsToJson = [](const network::JitterBufferStats& stats) {
+                json::object info = json::object();
+                info["depth"].set<uint32_t>(stats.depth);
+                info["delayMs"].set<uint32_t>(stats.delayMs);
+                info["jitterMs"].set<uint32_t>(stats.jitterMs);
+                info["received"].set<uint32_t>(stats.received);
+                info["released"].set<uint32_t>(stats.released);
+                info["reordered"].set<uint32_t>(stats.reordered);
+                info["late"].set<uint32_t>(stats.late);
+                info["duplicates"].set<uint32_t>(stats.duplicates);
+                info["lost"].set<uint32_t>(stats.lost);
+                return info;
+            };
+
+            json::object jitterBuffers = json::object();
+            for (network::FrameJitterBuffer* buffer : buffers) {
+                std::vector<network::JitterBufferStats> streams;
+                network::JitterBufferStats totals;
+                buffer->getStats(streams, totals);
+
+                json::object bufferInfo = statsToJson(totals);
+                json::array streamInfo = json::array();
+                for (const network::JitterBufferStats& stats : streams) {
+                    json::object info = statsToJson(stats);
+                    info["streamId"].set<uint32_t>(stats.streamId);
+                    streamInfo.push_back(json::value(info));
+                }
+
+                bufferInfo["streams"].set<json::array>(streamInfo);
+                jitterBuffers[buffer->name()].set<json::object>(bufferInfo);
+            }
+
+            response["netJitterBuffer"].set<json::object>(jitterBuffers);
+        }
+    }
+
+    {
+        json::object schedInfo = json::object();
+        schedInfo["eventLoop"].set<bool>(m_useEventLoop);
+        schedInfo["memoryLocked"].set<bool>(m_memoryLocked);
+
+        // how late each processing loop woke up for its ticks
+        json::object jitterInfo = json::object();
+        auto addJitter = [&](const std::string& name, const EventLoop& events) {
+            uint32_t maxUs = 0U, avgUs = 0U, peakUs = 0U;
+            events.getJitter(maxUs, avgUs, peakUs);
+
+            json::object loopJitter = json::object();
+            loopJitter["maxUs"].set<uint32_t>(maxUs);
+            loopJitter["avgUs"].set<uint32_t>(avgUs);
+            loopJitter["peakUs"].set<uint32_t>(peakUs);
+            jitterInfo[name].set<json::object>(loopJitter);
+        };
+
+        addJitter("main", m_mainEvents);
+        addJitter("modem", m_modemEvents);
+        if (m_dmr != nullptr) {
+            addJitter("dmrSlot1", m_dmr1RxEvents);
+            addJitter("dmrSlot2", m_dmr2RxEvents);
+        }
+        if (m_p25 != nullptr)
+            addJitter("p25", m_p25RxEvents);
+        if (m_nxdn != nullptr)
+            addJitter("nxdn", m_nxdnRxEvents);
+
+        schedInfo["jitter"].set<json::object>(jitterInfo);
+        response["scheduling"].set<json::object>(schedInfo);
+    }
+
     return response;
 }
 
@@ -1551,6 +1664,13 @@ bool Host::rmtPortModemHandler(Modem* modem, uint32_t ms, modem::RESP_TYPE_DVM r
     return true;
 }
 
+/* Helper to wait for the next "tick" of a processing loop, using the active or idle tick delay. */
+
+void Host::waitTick(EventLoop& events)
+{
+    events.wait((m_state != STATE_IDLE) ? m_activeTickDelay : m_idleTickDelay);
+}
+
 /* Helper to set the host/modem running state. */
 
 void Host::setState(uint8_t state)
@@ -1722,12 +1842,23 @@ void* Host::threadModem(void* arg)
                 stopWatch.start();
 
                 host->m_modem->clock(ms);
+
+                // wake the frame readers for any frames now waiting
+                if (host->m_dmr != nullptr) {
+                    if (host->m_modem->hasDMRFrame1())
+                        host->m_dmr1RxEvents.notify();
+                    if (host->m_modem->hasDMRFrame2())
+                        host->m_dmr2RxEvents.notify();
+                }
+                if (host->m_p25 != nullptr && host->m_modem->hasP25Frame())
+                    host->m_p25RxEvents.notify();
+                if (host->m_nxdn != nullptr && host->m_modem->hasNXDNFrame())
+                    host->m_nxdnRxEvents.notify();
             }
 
-            if (host->m_state != STATE_IDLE)
-                Thread::sleep(m_activeTickDelay);
-            if (host->m_state == STATE_IDLE)
-                Thread::sleep(m_idleTickDelay);
+            // wake early when the modem port has data
+            host->m_modemEvents.watch(0U, host->m_modem->getPortDescriptor());
+            host->waitTick(host->m_modemEvents);
         }
 
         LogDebug(LOG_HOST, "[STOP] %s", threadName.c_str());
@@ -26,6 +26,7 @@
 #define __HOST_H__
 
 #include "Defines.h"
+#include "common/EventLoop.h"
 #include "common/Timer.h"
 #include "common/lookups/AffiliationLookup.h"
 #include "common/lookups/ChannelLookup.h"
@@ -214,6 +215,15 @@ private:
     static uint8_t m_activeTickDelay;
     static uint8_t m_idleTickDelay;
 
+    bool m_useEventLoop;
+    bool m_memoryLocked;
+    EventLoop m_mainEvents;
+    EventLoop m_modemEvents;
+    EventLoop m_dmr1RxEvents;
+    EventLoop m_dmr2RxEvents;
+    EventLoop m_p25RxEvents;
+    EventLoop m_nxdnRxEvents;
+
     friend class RESTAPI;
     std::string m_restAddress;
     uint16_t m_restPort;
@@ -259,6 +269,12 @@ private:
      */
     void setState(uint8_t state);
 
+    /**
+     * @brief Helper to wait for the next "tick" of a processing loop, using the active or idle tick delay.
+     * @param events Event loop of the processing loop.
+     */
+    void waitTick(EventLoop& events);
+
     /**
      * @brief Entry point to modem clocking thread.
      * @param arg Instance of the thread_t structure.
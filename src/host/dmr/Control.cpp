@@ -252,7 +252,7 @@ bool Control::processWakeup(const uint8_t* data)
         return false;
 
     // generate a new CSBK and check validity
-    std::unique_ptr<lc::CSBK> csbk = lc::csbk::CSBKFactory::createCSBK(data + 2U, DataType::CSBK);
+    lc::CSBK* csbk = lc::csbk::CSBKFactory::decodeCSBK(data + 2U, DataType::CSBK);
     if (csbk == nullptr)
         return false;
 
@@ -57,8 +57,9 @@ void CSBK_DVM_GIT_HASH::encode(uint8_t* data)
     csbkValue = (csbkValue << 4) + m_siteIdenEntry.channelId();                     // Channel ID
     csbkValue = (csbkValue << 12) + m_logicalCh1;                                   // Channel Number
 
-    std::unique_ptr<uint8_t[]> csbk = CSBK::fromValue(csbkValue);
-    CSBK::encode(data, csbk.get());
+    uint8_t csbk[DMR_CSBK_LENGTH_BYTES - 4U];
+    CSBK::fromValue(csbkValue, csbk);
+    CSBK::encode(data, csbk);
 }
 
 /* Returns a string that represents the current CSBK. */
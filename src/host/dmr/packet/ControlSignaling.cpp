@@ -118,6 +118,12 @@ using namespace dmr::packet;
 const uint32_t ADJ_SITE_UPDATE_CNT = 5U;
 const uint32_t GRANT_TIMER_TIMEOUT = 15U;
 
+// keys of the pre-encoded TSCC broadcasts; announcements carry their parameters in the key
+const uint32_t BCAST_KEY_SYS_PARM = 1U;
+const uint32_t BCAST_KEY_ALOHA = 2U;
+const uint32_t BCAST_KEY_GIT_HASH = 3U;
+const uint32_t BCAST_KEY_ANN_WD = 0x80000000U;
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -137,7 +143,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len)
 
     if (dataType == DataType::CSBK) {
         // generate a new CSBK and check validity
-        std::unique_ptr<lc::CSBK> csbk = CSBKFactory::createCSBK(data + 2U, dataType);
+        lc::CSBK* csbk = CSBKFactory::decodeCSBK(data + 2U, dataType);
         if (csbk == nullptr)
             return false;
 
@@ -198,7 +204,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len)
             } else {
                 handled = true;
 
-                CSBK_RAND* isp = static_cast<CSBK_RAND*>(csbk.get());
+                CSBK_RAND* isp = static_cast<CSBK_RAND*>(csbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, "DMR Slot %u, CSBK, RAND (Random Access), serviceKind = $%02X, serviceOptions = $%02X, serviceExtra = $%02X, srcId = %u, dstId = %u",
                         m_slot->m_slotNo, isp->getServiceKind(), isp->getServiceOptions(), isp->getServiceExtra(), isp->getSrcId(), isp->getDstId());
@@ -301,7 +307,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len)
         break;
         case CSBKO::EXT_FNCT:
         {
-            CSBK_EXT_FNCT* isp = static_cast<CSBK_EXT_FNCT*>(csbk.get());
+            CSBK_EXT_FNCT* isp = static_cast<CSBK_EXT_FNCT*>(csbk);
             if (m_verbose) {
                 LogMessage(LOG_RF, "DMR Slot %u, CSBK, %s, op = $%02X, arg = %u, tgt = %u",
                     m_slot->m_slotNo, csbk->toString().c_str(), isp->getExtendedFunction(), dstId, srcId);
@@ -340,7 +346,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len)
         break;
         case CSBKO::MAINT:
         {
-            CSBK_MAINT* isp = static_cast<CSBK_MAINT*>(csbk.get());
+            CSBK_MAINT* isp = static_cast<CSBK_MAINT*>(csbk);
             if (m_verbose) {
                 LogMessage(LOG_RF, "DMR Slot %u, CSBK, %s, kind = $%02X, srcId = %u",
                     m_slot->m_slotNo, csbk->toString().c_str(), isp->getMaintKind(), srcId);
@@ -398,7 +404,7 @@ void ControlSignaling::processNetwork(const data::NetData& dmrData)
     dmrData.getData(data + 2U);
 
     if (dataType == DataType::CSBK) {
-        std::unique_ptr<lc::CSBK> csbk = CSBKFactory::createCSBK(data + 2U, dataType);
+        lc::CSBK* csbk = CSBKFactory::decodeCSBK(data + 2U, dataType);
         if (csbk == nullptr) {
             LogError(LOG_NET, "DMR Slot %u, CSBK, unable to decode the network CSBK", m_slot->m_slotNo);
             return;
@@ -410,7 +416,7 @@ void ControlSignaling::processNetwork(const data::NetData& dmrData)
 
         // handle updating internal adjacent site information
         if (csbko == CSBKO::BROADCAST) {
-            CSBK_BROADCAST* osp = static_cast<CSBK_BROADCAST*>(csbk.get());
+            CSBK_BROADCAST* osp = static_cast<CSBK_BROADCAST*>(csbk);
             if (osp->getAnncType() == BroadcastAnncType::ANN_WD_TSCC) {
                 if (!m_slot->m_enableTSCC) {
                     return;
@@ -477,7 +483,7 @@ void ControlSignaling::processNetwork(const data::NetData& dmrData)
 
                 ::ActivityLog("DMR", false, "Slot %u call alert request from %u to %u", m_slot->m_slotNo, srcId, dstId);
             } else {
-                CSBK_RAND* isp = static_cast<CSBK_RAND*>(csbk.get());
+                CSBK_RAND* isp = static_cast<CSBK_RAND*>(csbk);
                 if (m_verbose) {
                     LogMessage(LOG_NET, "DMR Slot %u, CSBK, RAND (Random Access), serviceKind = $%02X, serviceOptions = $%02X, serviceExtra = $%02X, srcId = %u, dstId = %u",
                         m_slot->m_slotNo, isp->getServiceKind(), isp->getServiceOptions(), isp->getServiceExtra(), isp->getSrcId(), isp->getDstId());
@@ -530,7 +536,7 @@ void ControlSignaling::processNetwork(const data::NetData& dmrData)
         break;
         case CSBKO::EXT_FNCT:
         {
-            CSBK_EXT_FNCT* isp = static_cast<CSBK_EXT_FNCT*>(csbk.get());
+            CSBK_EXT_FNCT* isp = static_cast<CSBK_EXT_FNCT*>(csbk);
             if (m_verbose) {
                 LogMessage(LOG_NET, "DMR Slot %u, CSBK, %s, op = $%02X, arg = %u, tgt = %u",
                     m_slot->m_slotNo, csbk->toString().c_str(), isp->getExtendedFunction(), dstId, srcId);
@@ -686,6 +692,7 @@ void ControlSignaling::writeRF_Call_Alrt(uint32_t srcId, uint32_t dstId)
 
 ControlSignaling::ControlSignaling(Slot * slot, network::BaseNetwork * network, bool dumpCSBKData, bool debug, bool verbose) :
     m_slot(slot),
+    m_bcastCache(),
     m_dumpCSBKData(dumpCSBKData),
     m_verbose(verbose),
     m_debug(debug)
@@ -703,7 +710,7 @@ ControlSignaling::~ControlSignaling() = default;
 
 /* Helper to write a CSBK packet. */
 
-void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
+void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm, uint32_t bcastKey)
 {
     // don't add any frames if the queue is full
     uint8_t len = DMR_FRAME_LENGTH_BYTES + 2U;
@@ -728,6 +735,9 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
     // Convert the Data Sync to be from the BS or MS as needed
     Sync::addDMRDataSync(data + 2U, m_slot->m_duplex);
 
+    if (bcastKey != 0U)
+        m_bcastCache.add(lc::CSBK::getSiteDataVersion(), bcastKey, data + 2U);
+
     m_slot->m_rfSeqNo = 0U;
 
     data[0U] = modem::TAG_DATA;
@@ -737,6 +747,35 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
         m_slot->addFrame(data, false, imm);
 }
 
+/* Helper to write a pre-encoded broadcast CSBK packet from the broadcast cache. */
+
+bool ControlSignaling::writeRF_CSBK_Bcast(uint32_t bcastKey)
+{
+    const uint8_t* frame = m_bcastCache.find(lc::CSBK::getSiteDataVersion(), bcastKey);
+    if (frame == nullptr)
+        return false;
+
+    // don't add any frames if the queue is full
+    uint8_t len = DMR_FRAME_LENGTH_BYTES + 2U;
+    uint32_t space = m_slot->m_txQueue.freeSpace();
+    if (space < (len + 1U)) {
+        return true;
+    }
+
+    uint8_t data[DMR_FRAME_LENGTH_BYTES + 2U];
+    ::memcpy(data + 2U, frame, DMR_FRAME_LENGTH_BYTES);
+
+    m_slot->m_rfSeqNo = 0U;
+
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
+
+    if (m_slot->m_duplex)
+        m_slot->addFrame(data);
+
+    return true;
+}
+
 /* Helper to write a network CSBK. */
 
 void ControlSignaling::writeNet_CSBK(lc::CSBK* csbk)
@@ -1475,12 +1514,15 @@ void ControlSignaling::writeRF_CSBK_Payload_Clear(uint32_t dstId, uint32_t srcId
 
 void ControlSignaling::writeRF_TSCC_Aloha()
 {
+    if (writeRF_CSBK_Bcast(BCAST_KEY_ALOHA))
+        return;
+
     std::unique_ptr<CSBK_ALOHA> csbk = std::make_unique<CSBK_ALOHA>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setNRandWait(m_slot->m_alohaNRandWait);
     csbk->setBackoffNo(m_slot->m_alohaBackOff);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK(csbk.get(), false, BCAST_KEY_ALOHA);
 }
 
 /* Helper to write a TSCC Ann-Wd broadcast packet on the RF interface. */
@@ -1489,6 +1531,11 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
 {
     m_slot->m_rfSeqNo = 0U;
 
+    uint32_t bcastKey = BCAST_KEY_ANN_WD | ((channelNo & 0xFFFU) << 18) | ((systemIdentity & 0xFFFFU) << 2) |
+        (annWd ? 0x02U : 0x00U) | (requireReg ? 0x01U : 0x00U);
+    if (writeRF_CSBK_Bcast(bcastKey))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     csbk->siteIdenEntry(m_slot->m_idenEntry);
     csbk->setCdef(false);
@@ -1503,26 +1550,32 @@ void ControlSignaling::writeRF_TSCC_Bcast_Ann_Wd(uint32_t channelNo, bool annWd,
             m_slot->m_slotNo, csbk->toString().c_str(), channelNo, annWd);
     }
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK(csbk.get(), false, bcastKey);
 }
 
 /* Helper to write a TSCC Sys_Parm broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Bcast_Sys_Parm()
 {
+    if (writeRF_CSBK_Bcast(BCAST_KEY_SYS_PARM))
+        return;
+
     std::unique_ptr<CSBK_BROADCAST> csbk = std::make_unique<CSBK_BROADCAST>();
     DEBUG_LOG_CSBK(csbk->toString());
     csbk->setAnncType(BroadcastAnncType::SITE_PARMS);
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK(csbk.get(), false, BCAST_KEY_SYS_PARM);
 }
 
 /* Helper to write a TSCC Git Hash broadcast packet on the RF interface. */
 
 void ControlSignaling::writeRF_TSCC_Git_Hash()
 {
+    if (writeRF_CSBK_Bcast(BCAST_KEY_GIT_HASH))
+        return;
+
     std::unique_ptr<CSBK_DVM_GIT_HASH> csbk = std::make_unique<CSBK_DVM_GIT_HASH>();
     DEBUG_LOG_CSBK(csbk->toString());
 
-    writeRF_CSBK(csbk.get());
+    writeRF_CSBK(csbk.get(), false, BCAST_KEY_GIT_HASH);
 }
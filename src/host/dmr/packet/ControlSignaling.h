@@ -23,6 +23,7 @@
 #include "common/dmr/lc/LC.h"
 #include "common/dmr/lc/CSBK.h"
 #include "common/network/BaseNetwork.h"
+#include "common/BroadcastCache.h"
 #include "common/RingBuffer.h"
 #include "common/StopWatch.h"
 #include "common/Timer.h"
@@ -89,6 +90,8 @@ namespace dmr
             friend class dmr::Slot;
             Slot* m_slot;
 
+            BroadcastCache<defines::DMR_FRAME_LENGTH_BYTES> m_bcastCache;
+
             bool m_dumpCSBKData;
             bool m_verbose;
             bool m_debug;
@@ -120,8 +123,15 @@ namespace dmr
              * @brief Helper to write a CSBK packet.
              * @param csbk CSBK to write to the modem.
              * @param imm Flag indicating the TSBK should be written to the immediate queue.
+             * @param bcastKey Key to cache the encoded CSBK frame under, for static broadcasts (0 if not cached).
+             */
+            void writeRF_CSBK(lc::CSBK* csbk, bool imm = false, uint32_t bcastKey = 0U);
+            /**
+             * @brief Helper to write a pre-encoded broadcast CSBK packet from the broadcast cache.
+             * @param bcastKey Key of the encoded CSBK frame.
+             * @returns bool True, if the broadcast was cached (and written), otherwise false.
              */
-            void writeRF_CSBK(lc::CSBK* csbk, bool imm = false);
+            bool writeRF_CSBK_Bcast(uint32_t bcastKey);
             /**
              * @brief Helper to write a network CSBK packet.
              * @param csbk CSBK to write to the network.
@@ -129,8 +129,9 @@ Modem::Modem(port::IModemPort* port, bool duplex, bool rxInvert, bool txInvert,
     m_modemState(STATE_IDLE),
     m_buffer(nullptr),
     m_length(0U),
-    m_rspOffset(0U),
-    m_rspState(RESP_START),
+    m_rxBuffer(nullptr),
+    m_rxLength(0U),
+    m_rxOffset(0U),
     m_rspDoubleLength(false),
     m_rspType(CMD_GET_STATUS),
     m_openPortHandler(nullptr),
@@ -164,6 +165,7 @@ Modem::Modem(port::IModemPort* port, bool duplex, bool rxInvert, bool txInvert,
     assert(port != nullptr);
 
     m_buffer = new uint8_t[BUFFER_LENGTH];
+    m_rxBuffer = new uint8_t[RX_BUFFER_LENGTH];
 }
 
 /* Finalizes a instance of the Modem class. */
@@ -172,6 +174,7 @@ Modem::~Modem()
 {
     delete m_port;
     delete[] m_buffer;
+    delete[] m_rxBuffer;
 }
 
 /* Sets the RF DC offset parameters. */
@@ -466,8 +469,7 @@ bool Modem::open()
         m_inactivityTimer.stop();
     }
 
-    m_rspOffset = 0U;
-    m_rspState = RESP_START;
+    clearResponse();
 
     ret = readFlash();
     if (!ret) {
@@ -533,358 +535,370 @@ void Modem::clock(uint32_t ms)
     }
 
     bool forceModemReset = false;
-    RESP_TYPE_DVM type = getResponse();
+    bool rspHandled = false;
 
-    // do we have a custom response handler?
-    if (m_rspHandler != nullptr) {
-        // execute custom response handler
-        if (m_rspHandler(this, ms, type, m_rspDoubleLength, m_buffer, m_length)) {
-            // all logic handled by handler -- return
-            return;
+    // process every complete response read from the modem (the first pass always runs, so a custom
+    // response handler is still clocked when there is no data)
+    uint32_t responses = 0U;
+    RESP_TYPE_DVM type = RTM_TIMEOUT;
+    do {
+        type = getResponse();
+
+        // do we have a custom response handler?
+        if (m_rspHandler != nullptr) {
+            // execute custom response handler
+            if (m_rspHandler(this, ms, type, m_rspDoubleLength, m_buffer, m_length)) {
+                // all logic handled by handler -- next response
+                rspHandled = true;
+                continue;
+            }
         }
-    }
 
-    if (type == RTM_TIMEOUT) {
-        // Nothing to do
-    }
-    else if (type == RTM_ERROR) {
-        // Nothing to do
-    }
-    else {
-        // type == RTM_OK
-        uint8_t cmdOffset = 2U;
-        if (m_rspDoubleLength) {
-            cmdOffset = 3U;
+        if (type == RTM_TIMEOUT) {
+            // Nothing to do
         }
+        else if (type == RTM_ERROR) {
+            // Nothing to do
+        }
+        else {
+            // type == RTM_OK
+            uint8_t cmdOffset = 2U;
+            if (m_rspDoubleLength) {
+                cmdOffset = 3U;
+            }
 
-        switch (m_buffer[cmdOffset]) {
-        /** Digital Mobile Radio */
-        case CMD_DMR_DATA1:
-        {
-            if (m_dmrEnabled) {
-                std::lock_guard<std::mutex> lock(m_dmr1ReadLock);
+            switch (m_buffer[cmdOffset]) {
+            /** Digital Mobile Radio */
+            case CMD_DMR_DATA1:
+            {
+                if (m_dmrEnabled) {
+                    std::lock_guard<std::mutex> lock(m_dmr1ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_DMR_DATA1 double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_DMR_DATA1 double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = m_length - 2U;
-                m_rxDMRQueue1.addData(&data, 1U);
+                    uint8_t data = m_length - 2U;
+                    m_rxDMRQueue1.addData(&data, 1U);
 
-                if (m_buffer[3U] == (DMRDEF::SYNC_DATA | DMRDEF::DataType::TERMINATOR_WITH_LC))
-                    data = TAG_EOT;
-                else
-                    data = TAG_DATA;
-                m_rxDMRQueue1.addData(&data, 1U);
+                    if (m_buffer[3U] == (DMRDEF::SYNC_DATA | DMRDEF::DataType::TERMINATOR_WITH_LC))
+                        data = TAG_EOT;
+                    else
+                        data = TAG_DATA;
+                    m_rxDMRQueue1.addData(&data, 1U);
 
-                m_rxDMRQueue1.addData(m_buffer + 3U, m_length - 3U);
+                    m_rxDMRQueue1.addData(m_buffer + 3U, m_length - 3U);
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_DMR_DATA2:
-        {
-            if (m_dmrEnabled) {
-                std::lock_guard<std::mutex> lock(m_dmr2ReadLock);
+            case CMD_DMR_DATA2:
+            {
+                if (m_dmrEnabled) {
+                    std::lock_guard<std::mutex> lock(m_dmr2ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_DMR_DATA2 double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_DMR_DATA2 double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = m_length - 2U;
-                m_rxDMRQueue2.addData(&data, 1U);
+                    uint8_t data = m_length - 2U;
+                    m_rxDMRQueue2.addData(&data, 1U);
 
-                if (m_buffer[3U] == (DMRDEF::SYNC_DATA | DMRDEF::DataType::TERMINATOR_WITH_LC))
-                    data = TAG_EOT;
-                else
-                    data = TAG_DATA;
-                m_rxDMRQueue2.addData(&data, 1U);
+                    if (m_buffer[3U] == (DMRDEF::SYNC_DATA | DMRDEF::DataType::TERMINATOR_WITH_LC))
+                        data = TAG_EOT;
+                    else
+                        data = TAG_DATA;
+                    m_rxDMRQueue2.addData(&data, 1U);
 
-                m_rxDMRQueue2.addData(m_buffer + 3U, m_length - 3U);
+                    m_rxDMRQueue2.addData(m_buffer + 3U, m_length - 3U);
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_DMR_LOST1:
-        {
-            if (m_dmrEnabled) {
-                std::lock_guard<std::mutex> lock(m_dmr1ReadLock);
+            case CMD_DMR_LOST1:
+            {
+                if (m_dmrEnabled) {
+                    std::lock_guard<std::mutex> lock(m_dmr1ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_DMR_LOST1 double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_DMR_LOST1 double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = 1U;
-                m_rxDMRQueue1.addData(&data, 1U);
+                    uint8_t data = 1U;
+                    m_rxDMRQueue1.addData(&data, 1U);
 
-                data = TAG_LOST;
-                m_rxDMRQueue1.addData(&data, 1U);
+                    data = TAG_LOST;
+                    m_rxDMRQueue1.addData(&data, 1U);
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_DMR_LOST2:
-        {
-            if (m_dmrEnabled) {
-                std::lock_guard<std::mutex> lock(m_dmr2ReadLock);
+            case CMD_DMR_LOST2:
+            {
+                if (m_dmrEnabled) {
+                    std::lock_guard<std::mutex> lock(m_dmr2ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_DMR_LOST2 double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_DMR_LOST2 double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = 1U;
-                m_rxDMRQueue2.addData(&data, 1U);
+                    uint8_t data = 1U;
+                    m_rxDMRQueue2.addData(&data, 1U);
 
-                data = TAG_LOST;
-                m_rxDMRQueue2.addData(&data, 1U);
+                    data = TAG_LOST;
+                    m_rxDMRQueue2.addData(&data, 1U);
+                }
             }
-        }
-        break;
+            break;
 
-        /** Project 25 */
-        case CMD_P25_DATA:
-        {
-            if (m_p25Enabled) {
-                std::lock_guard<std::mutex> lock(m_p25ReadLock);
+            /** Project 25 */
+            case CMD_P25_DATA:
+            {
+                if (m_p25Enabled) {
+                    std::lock_guard<std::mutex> lock(m_p25ReadLock);
 
-                uint8_t length[2U];
-                if (m_length > 255U)
-                    length[0U] = ((m_length - cmdOffset) >> 8U) & 0xFFU;
-                else
-                    length[0U] = 0x00U;
-                length[1U] = (m_length - cmdOffset) & 0xFFU;
-                m_rxP25Queue.addData(length, 2U);
+                    uint8_t length[2U];
+                    if (m_length > 255U)
+                        length[0U] = ((m_length - cmdOffset) >> 8U) & 0xFFU;
+                    else
+                        length[0U] = 0x00U;
+                    length[1U] = (m_length - cmdOffset) & 0xFFU;
+                    m_rxP25Queue.addData(length, 2U);
 
-                uint8_t data = TAG_DATA;
-                m_rxP25Queue.addData(&data, 1U);
+                    uint8_t data = TAG_DATA;
+                    m_rxP25Queue.addData(&data, 1U);
 
-                m_rxP25Queue.addData(m_buffer + (cmdOffset + 1U), m_length - (cmdOffset + 1U));
+                    m_rxP25Queue.addData(m_buffer + (cmdOffset + 1U), m_length - (cmdOffset + 1U));
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_P25_LOST:
-        {
-            if (m_p25Enabled) {
-                std::lock_guard<std::mutex> lock(m_p25ReadLock);
+            case CMD_P25_LOST:
+            {
+                if (m_p25Enabled) {
+                    std::lock_guard<std::mutex> lock(m_p25ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_P25_LOST double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_P25_LOST double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = 1U;
-                m_rxP25Queue.addData(&data, 1U);
+                    uint8_t data = 1U;
+                    m_rxP25Queue.addData(&data, 1U);
 
-                data = TAG_LOST;
-                m_rxP25Queue.addData(&data, 1U);
+                    data = TAG_LOST;
+                    m_rxP25Queue.addData(&data, 1U);
+                }
             }
-        }
-        break;
+            break;
 
-        /** Next Generation Digital Narrowband */
-        case CMD_NXDN_DATA:
-        {
-            if (m_nxdnEnabled) {
-                std::lock_guard<std::mutex> lock(m_nxdnReadLock);
+            /** Next Generation Digital Narrowband */
+            case CMD_NXDN_DATA:
+            {
+                if (m_nxdnEnabled) {
+                    std::lock_guard<std::mutex> lock(m_nxdnReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_NXDN_DATA double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_NXDN_DATA double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = m_length - 2U;
-                m_rxNXDNQueue.addData(&data, 1U);
+                    uint8_t data = m_length - 2U;
+                    m_rxNXDNQueue.addData(&data, 1U);
 
-                data = TAG_DATA;
-                m_rxNXDNQueue.addData(&data, 1U);
+                    data = TAG_DATA;
+                    m_rxNXDNQueue.addData(&data, 1U);
 
-                m_rxNXDNQueue.addData(m_buffer + 3U, m_length - 3U);
+                    m_rxNXDNQueue.addData(m_buffer + 3U, m_length - 3U);
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_NXDN_LOST:
-        {
-            if (m_nxdnEnabled) {
-                std::lock_guard<std::mutex> lock(m_nxdnReadLock);
+            case CMD_NXDN_LOST:
+            {
+                if (m_nxdnEnabled) {
+                    std::lock_guard<std::mutex> lock(m_nxdnReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_NXDN_LOST double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_NXDN_LOST double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = 1U;
-                m_rxNXDNQueue.addData(&data, 1U);
+                    uint8_t data = 1U;
+                    m_rxNXDNQueue.addData(&data, 1U);
 
-                data = TAG_LOST;
-                m_rxNXDNQueue.addData(&data, 1U);
+                    data = TAG_LOST;
+                    m_rxNXDNQueue.addData(&data, 1U);
+                }
             }
-        }
-        break;
+            break;
 
-        /** General */
-        case CMD_GET_STATUS:
-        {
-            m_isHotspot = (m_buffer[3U] & 0x01U) == 0x01U;
+            /** General */
+            case CMD_GET_STATUS:
+            {
+                m_isHotspot = (m_buffer[3U] & 0x01U) == 0x01U;
 
-            // override hotspot flag if we're forcing hotspot
-            if (m_forceHotspot) {
-                m_isHotspot = m_forceHotspot;
-            }
+                // override hotspot flag if we're forcing hotspot
+                if (m_forceHotspot) {
+                    m_isHotspot = m_forceHotspot;
+                }
 
-            bool dmrEnable = (m_buffer[3U] & 0x02U) == 0x02U;
-            bool p25Enable = (m_buffer[3U] & 0x08U) == 0x08U;
-            bool nxdnEnable = (m_buffer[3U] & 0x10U) == 0x10U;
+                bool dmrEnable = (m_buffer[3U] & 0x02U) == 0x02U;
+                bool p25Enable = (m_buffer[3U] & 0x08U) == 0x08U;
+                bool nxdnEnable = (m_buffer[3U] & 0x10U) == 0x10U;
 
-            // flag indicating if free space is being reported in 16-byte blocks instead of LDUs
-            bool spaceInBlocks = (m_buffer[3U] & 0x80U) == 0x80U;
+                // flag indicating if free space is being reported in 16-byte blocks instead of LDUs
+                bool spaceInBlocks = (m_buffer[3U] & 0x80U) == 0x80U;
 
-            m_v24Connected = true;
-            m_modemState = (DVM_STATE)m_buffer[4U];
+                m_v24Connected = true;
+                m_modemState = (DVM_STATE)m_buffer[4U];
 
-            m_tx = (m_buffer[5U] & 0x01U) == 0x01U;
+                m_tx = (m_buffer[5U] & 0x01U) == 0x01U;
 
-            bool adcOverflow = (m_buffer[5U] & 0x02U) == 0x02U;
-            if (adcOverflow) {
-                //LogError(LOG_MODEM, "ADC levels have overflowed");
-                m_adcOverFlowCount++;
+                bool adcOverflow = (m_buffer[5U] & 0x02U) == 0x02U;
+                if (adcOverflow) {
+                    //LogError(LOG_MODEM, "ADC levels have overflowed");
+                    m_adcOverFlowCount++;
 
-                if (m_adcOverFlowCount >= MAX_ADC_OVERFLOW / 2U) {
-                    LogWarning(LOG_MODEM, "ADC overflow count > %u!", MAX_ADC_OVERFLOW / 2U);
-                }
+                    if (m_adcOverFlowCount >= MAX_ADC_OVERFLOW / 2U) {
+                        LogWarning(LOG_MODEM, "ADC overflow count > %u!", MAX_ADC_OVERFLOW / 2U);
+                    }
 
-                if (!m_disableOFlowReset) {
-                    if (m_adcOverFlowCount > MAX_ADC_OVERFLOW) {
-                        LogError(LOG_MODEM, "ADC overflow count > %u, resetting modem", MAX_ADC_OVERFLOW);
-                        forceModemReset = true;
+                    if (!m_disableOFlowReset) {
+                        if (m_adcOverFlowCount > MAX_ADC_OVERFLOW) {
+                            LogError(LOG_MODEM, "ADC overflow count > %u, resetting modem", MAX_ADC_OVERFLOW);
+                            forceModemReset = true;
+                        }
+                    }
+                    else {
+                        m_adcOverFlowCount = 0U;
                     }
                 }
                 else {
-                    m_adcOverFlowCount = 0U;
-                }
-            }
-            else {
-                if (m_adcOverFlowCount != 0U) {
-                    m_adcOverFlowCount--;
+                    if (m_adcOverFlowCount != 0U) {
+                        m_adcOverFlowCount--;
+                    }
                 }
-            }
 
-            bool rxOverflow = (m_buffer[5U] & 0x04U) == 0x04U;
-            if (rxOverflow)
-                LogError(LOG_MODEM, "RX buffer has overflowed");
+                bool rxOverflow = (m_buffer[5U] & 0x04U) == 0x04U;
+                if (rxOverflow)
+                    LogError(LOG_MODEM, "RX buffer has overflowed");
 
-            bool txOverflow = (m_buffer[5U] & 0x08U) == 0x08U;
-            if (txOverflow)
-                LogError(LOG_MODEM, "TX buffer has overflowed");
+                bool txOverflow = (m_buffer[5U] & 0x08U) == 0x08U;
+                if (txOverflow)
+                    LogError(LOG_MODEM, "TX buffer has overflowed");
 
-            m_lockout = (m_buffer[5U] & 0x10U) == 0x10U;
+                m_lockout = (m_buffer[5U] & 0x10U) == 0x10U;
 
-            bool dacOverflow = (m_buffer[5U] & 0x20U) == 0x20U;
-            if (dacOverflow) {
-                //LogError(LOG_MODEM, "DAC levels have overflowed");
-                m_dacOverFlowCount++;
+                bool dacOverflow = (m_buffer[5U] & 0x20U) == 0x20U;
+                if (dacOverflow) {
+                    //LogError(LOG_MODEM, "DAC levels have overflowed");
+                    m_dacOverFlowCount++;
 
-                if (m_dacOverFlowCount > MAX_DAC_OVERFLOW / 2U) {
-                    LogWarning(LOG_MODEM, "DAC overflow count > %u!", MAX_DAC_OVERFLOW / 2U);
-                }
+                    if (m_dacOverFlowCount > MAX_DAC_OVERFLOW / 2U) {
+                        LogWarning(LOG_MODEM, "DAC overflow count > %u!", MAX_DAC_OVERFLOW / 2U);
+                    }
 
-                if (!m_disableOFlowReset) {
-                    if (m_dacOverFlowCount > MAX_DAC_OVERFLOW) {
-                        LogError(LOG_MODEM, "DAC overflow count > %u, resetting modem", MAX_DAC_OVERFLOW);
-                        forceModemReset = true;
+                    if (!m_disableOFlowReset) {
+                        if (m_dacOverFlowCount > MAX_DAC_OVERFLOW) {
+                            LogError(LOG_MODEM, "DAC overflow count > %u, resetting modem", MAX_DAC_OVERFLOW);
+                            forceModemReset = true;
+                        }
+                    }
+                    else {
+                        m_dacOverFlowCount = 0U;
                     }
                 }
                 else {
-                    m_dacOverFlowCount = 0U;
+                    if (m_dacOverFlowCount != 0U) {
+                        m_dacOverFlowCount--;
+                    }
                 }
-            }
-            else {
-                if (m_dacOverFlowCount != 0U) {
-                    m_dacOverFlowCount--;
+
+                m_cd = (m_buffer[5U] & 0x40U) == 0x40U;
+
+                // spaces from the modem are returned in "logical" frame count, or a block size, not raw byte size
+                // for DMR and NXDN, becuase the protocols use fixed length frames we always return
+                // space in frame count
+                m_dmrSpace1 = m_buffer[7U] * (DMRDEF::DMR_FRAME_LENGTH_BYTES + 2U);
+                m_dmrSpace2 = m_buffer[8U] * (DMRDEF::DMR_FRAME_LENGTH_BYTES + 2U);
+                m_nxdnSpace = m_buffer[11U] * (NXDDEF::NXDN_FRAME_LENGTH_BYTES);
+
+                // P25 free space can be reported as 16-byte blocks or frames based on the flag above
+                if (spaceInBlocks)
+                    m_p25Space = m_buffer[10U] * P25_BUFFER_BLOCK_SIZE;
+                else
+                    m_p25Space = m_buffer[10U] * (P25DEF::P25_LDU_FRAME_LENGTH_BYTES);
+
+                if (m_dumpModemStatus) {
+                    LogDebug(LOG_MODEM, "Modem::clock(), CMD_GET_STATUS, isHotspot = %u, dmr = %u / %u, p25 = %u / %u, nxdn = %u / %u, modemState = %u, tx = %u, adcOverflow = %u, rxOverflow = %u, txOverflow = %u, dacOverflow = %u, dmrSpace1 = %u, dmrSpace2 = %u, p25Space = %u, nxdnSpace = %u",
+                        m_isHotspot, dmrEnable, m_dmrEnabled, p25Enable, m_p25Enabled, nxdnEnable, m_nxdnEnabled, m_modemState, m_tx, adcOverflow, rxOverflow, txOverflow, dacOverflow, m_dmrSpace1, m_dmrSpace2, m_p25Space, m_nxdnSpace);
+                    LogDebug(LOG_MODEM, "Modem::clock(), CMD_GET_STATUS, rxDMRData1 size = %u, len = %u, free = %u; rxDMRData2 size = %u, len = %u, free = %u, rxP25Data size = %u, len = %u, free = %u, rxNXDNData size = %u, len = %u, free = %u",
+                        m_rxDMRQueue1.length(), m_rxDMRQueue1.dataSize(), m_rxDMRQueue1.freeSpace(), m_rxDMRQueue2.length(), m_rxDMRQueue2.dataSize(), m_rxDMRQueue2.freeSpace(),
+                        m_rxP25Queue.length(), m_rxP25Queue.dataSize(), m_rxP25Queue.freeSpace(), m_rxNXDNQueue.length(), m_rxNXDNQueue.dataSize(), m_rxNXDNQueue.freeSpace());
                 }
-            }
 
-            m_cd = (m_buffer[5U] & 0x40U) == 0x40U;
-
-            // spaces from the modem are returned in "logical" frame count, or a block size, not raw byte size
-            // for DMR and NXDN, becuase the protocols use fixed length frames we always return
-            // space in frame count
-            m_dmrSpace1 = m_buffer[7U] * (DMRDEF::DMR_FRAME_LENGTH_BYTES + 2U);
-            m_dmrSpace2 = m_buffer[8U] * (DMRDEF::DMR_FRAME_LENGTH_BYTES + 2U);
-            m_nxdnSpace = m_buffer[11U] * (NXDDEF::NXDN_FRAME_LENGTH_BYTES);
-
-            // P25 free space can be reported as 16-byte blocks or frames based on the flag above
-            if (spaceInBlocks)
-                m_p25Space = m_buffer[10U] * P25_BUFFER_BLOCK_SIZE;
-            else
-                m_p25Space = m_buffer[10U] * (P25DEF::P25_LDU_FRAME_LENGTH_BYTES);
-
-            if (m_dumpModemStatus) {
-                LogDebug(LOG_MODEM, "Modem::clock(), CMD_GET_STATUS, isHotspot = %u, dmr = %u / %u, p25 = %u / %u, nxdn = %u / %u, modemState = %u, tx = %u, adcOverflow = %u, rxOverflow = %u, txOverflow = %u, dacOverflow = %u, dmrSpace1 = %u, dmrSpace2 = %u, p25Space = %u, nxdnSpace = %u",
-                    m_isHotspot, dmrEnable, m_dmrEnabled, p25Enable, m_p25Enabled, nxdnEnable, m_nxdnEnabled, m_modemState, m_tx, adcOverflow, rxOverflow, txOverflow, dacOverflow, m_dmrSpace1, m_dmrSpace2, m_p25Space, m_nxdnSpace);
-                LogDebug(LOG_MODEM, "Modem::clock(), CMD_GET_STATUS, rxDMRData1 size = %u, len = %u, free = %u; rxDMRData2 size = %u, len = %u, free = %u, rxP25Data size = %u, len = %u, free = %u, rxNXDNData size = %u, len = %u, free = %u",
-                    m_rxDMRQueue1.length(), m_rxDMRQueue1.dataSize(), m_rxDMRQueue1.freeSpace(), m_rxDMRQueue2.length(), m_rxDMRQueue2.dataSize(), m_rxDMRQueue2.freeSpace(),
-                    m_rxP25Queue.length(), m_rxP25Queue.dataSize(), m_rxP25Queue.freeSpace(), m_rxNXDNQueue.length(), m_rxNXDNQueue.dataSize(), m_rxNXDNQueue.freeSpace());
+                m_gotModemStatus = true;
+                m_inactivityTimer.start();
             }
+            break;
 
-            m_gotModemStatus = true;
-            m_inactivityTimer.start();
-        }
-        break;
+            case CMD_GET_VERSION:
+            case CMD_ACK:
+                break;
 
-        case CMD_GET_VERSION:
-        case CMD_ACK:
+            case CMD_NAK:
+            {
+                LogWarning(LOG_MODEM, "NAK, command = 0x%02X (%s), reason = %u (%s)", m_buffer[3U], cmdToString(m_buffer[3U]).c_str(), m_buffer[4U], rsnToString(m_buffer[4U]).c_str());
+                switch (m_buffer[4U]) {
+                    case RSN_RINGBUFF_FULL:
+                    {
+                        switch (m_buffer[3U]) {
+                            case CMD_DMR_DATA1:
+                                LogWarning(LOG_MODEM, "NAK, %s, dmrSpace1 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace1);
+                                break;
+                            case CMD_DMR_DATA2:
+                                LogWarning(LOG_MODEM, "NAK, %s, dmrSpace2 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace2);
+                                break;
+
+                            case CMD_P25_DATA:
+                                LogWarning(LOG_MODEM, "NAK, %s, p25Space = %u", rsnToString(m_buffer[4U]).c_str(), m_p25Space);
+                                break;
+
+                            case CMD_NXDN_DATA:
+                                LogWarning(LOG_MODEM, "NAK, %s, nxdnSpace = %u", rsnToString(m_buffer[4U]).c_str(), m_nxdnSpace);
+                                break;
+                            }
+                    }
+                    break;
+                }
+            }
             break;
 
-        case CMD_NAK:
-        {
-            LogWarning(LOG_MODEM, "NAK, command = 0x%02X (%s), reason = %u (%s)", m_buffer[3U], cmdToString(m_buffer[3U]).c_str(), m_buffer[4U], rsnToString(m_buffer[4U]).c_str());
-            switch (m_buffer[4U]) {
-                case RSN_RINGBUFF_FULL:
-                {
-                    switch (m_buffer[3U]) {
-                        case CMD_DMR_DATA1:
-                            LogWarning(LOG_MODEM, "NAK, %s, dmrSpace1 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace1);
-                            break;
-                        case CMD_DMR_DATA2:
-                            LogWarning(LOG_MODEM, "NAK, %s, dmrSpace2 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace2);
-                            break;
-
-                        case CMD_P25_DATA:
-                            LogWarning(LOG_MODEM, "NAK, %s, p25Space = %u", rsnToString(m_buffer[4U]).c_str(), m_p25Space);
-                            break;
-
-                        case CMD_NXDN_DATA:
-                            LogWarning(LOG_MODEM, "NAK, %s, nxdnSpace = %u", rsnToString(m_buffer[4U]).c_str(), m_nxdnSpace);
-                            break;
-                        }
-                }
+            case CMD_DEBUG1:
+            case CMD_DEBUG2:
+            case CMD_DEBUG3:
+            case CMD_DEBUG4:
+            case CMD_DEBUG5:
+            case CMD_DEBUG_DUMP:
+                printDebug(m_buffer, m_length);
+                break;
+
+            default:
+                LogWarning(LOG_MODEM, "Unknown message, type = %02X", m_buffer[2U]);
+                Utils::dump("Buffer dump", m_buffer, m_length);
                 break;
             }
         }
-        break;
-
-        case CMD_DEBUG1:
-        case CMD_DEBUG2:
-        case CMD_DEBUG3:
-        case CMD_DEBUG4:
-        case CMD_DEBUG5:
-        case CMD_DEBUG_DUMP:
-            printDebug(m_buffer, m_length);
-            break;
+    } while (type == RTM_OK && !forceModemReset && ++responses < MAX_RESPONSES_PER_CLOCK);
 
-        default:
-            LogWarning(LOG_MODEM, "Unknown message, type = %02X", m_buffer[2U]);
-            Utils::dump("Buffer dump", m_buffer, m_length);
-            if (m_rspState != RESP_START)
-                m_rspState = RESP_START;
-            break;
-        }
+    if (rspHandled) {
+        // all logic handled by handler -- return
+        return;
     }
 
     // force a modem reset because of a error condition
@@ -1133,6 +1147,34 @@ uint32_t Modem::readNXDNFrame(uint8_t* data)
     return 0U;
 }
 
+/* Helper to test if the DMR Slot 1 ring buffer has received frames waiting (without reading them). */
+
+bool Modem::hasDMRFrame1() const
+{
+    return !m_rxDMRQueue1.isEmpty();
+}
+
+/* Helper to test if the DMR Slot 2 ring buffer has received frames waiting (without reading them). */
+
+bool Modem::hasDMRFrame2() const
+{
+    return !m_rxDMRQueue2.isEmpty();
+}
+
+/* Helper to test if the P25 ring buffer has received frames waiting (without reading them). */
+
+bool Modem::hasP25Frame() const
+{
+    return !m_rxP25Queue.isEmpty();
+}
+
+/* Helper to test if the NXDN ring buffer has received frames waiting (without reading them). */
+
+bool Modem::hasNXDNFrame() const
+{
+    return !m_rxNXDNQueue.isEmpty();
+}
+
 /* Helper to test if the DMR Slot 1 ring buffer has free space. */
 
 bool Modem::hasDMRSpace1() const
@@ -1168,6 +1210,13 @@ bool Modem::isHotspot() const
     return m_isHotspot;
 }
 
+/* Gets the descriptor that becomes readable when the modem port has data (e.g. for readiness polling). */
+
+int Modem::getPortDescriptor() const
+{
+    return m_port->getDescriptor();
+}
+
 /* Flag indicating whether or not the air interface modem is transmitting. */
 
 bool Modem::hasTX() const
@@ -2361,146 +2410,110 @@ void Modem::printDebug(const uint8_t* buffer, uint16_t len)
 
 RESP_TYPE_DVM Modem::getResponse()
 {
-    m_rspDoubleLength = false;
-
-    //LogDebug(LOG_MODEM, "getResponse(), checking if we have data");
-
-    // get the start of the frame or nothing at all
-    if (m_rspState == RESP_START) {
-        int ret = m_port->read(m_buffer + 0U, 1U);
-        if (ret < 0) {
-            LogError(LOG_MODEM, "Error reading from the modem, ret = %d", ret);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
-
-        if (ret == 0) {
-            //LogDebug(LOG_MODEM, "getResponse(), no data available");
-            return RTM_TIMEOUT;
-        }
-
-        if (m_buffer[0U] != DVM_SHORT_FRAME_START &&
-            m_buffer[0U] != DVM_LONG_FRAME_START) {
-            //LogError(LOG_MODEM, "Modem::getResponse(), illegal response, first byte not a frame start; byte = %02X", m_buffer[0U]);
-            ::memset(m_buffer, 0x00U, BUFFER_LENGTH);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
+    // return the next buffered frame, if there is one
+    RESP_TYPE_DVM ret = parseResponse();
+    if (ret != RTM_TIMEOUT)
+        return ret;
 
-        if (m_buffer[0U] == DVM_LONG_FRAME_START) {
-            m_rspDoubleLength = true;
-        }
-
-        //LogDebug(LOG_MODEM, "getResponse(), RESP_START");
-
-        m_rspState = RESP_LENGTH1;
+    // move the partial frame (if any) to the front of the buffer
+    if (m_rxOffset > 0U) {
+        m_rxLength -= m_rxOffset;
+        if (m_rxLength > 0U)
+            ::memmove(m_rxBuffer, m_rxBuffer + m_rxOffset, m_rxLength);
+        m_rxOffset = 0U;
     }
 
-    //LogDebug(LOG_MODEM, "getResponse(), getting frame length 1/2, rspDoubleLength = %u", m_rspDoubleLength);
-    // get the length of the frame, 1/2
-    if (m_rspState == RESP_LENGTH1) {
-        int ret = m_port->read(m_buffer + 1U, 1U);
-        if (ret < 0) {
-            LogError(LOG_MODEM, "Error reading from the modem, ret = %d", ret);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
-
-        if (ret == 0)
-            return RTM_TIMEOUT;
-
-        if (m_buffer[1U] >= 250U && !m_rspDoubleLength) {
-            LogError(LOG_MODEM, "Invalid length received from the modem, len = %u", m_buffer[1U]);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
-
-        if (m_rspDoubleLength) {
-            m_rspState = RESP_LENGTH2;
-            m_length = ((m_buffer[1U] & 0xFFU) << 8);
-        } else {
-            m_rspState = RESP_TYPE;
-            m_length = m_buffer[1U];
-        }
+    //LogDebug(LOG_MODEM, "getResponse(), checking if we have data");
 
-        //LogDebug(LOG_MODEM, "getResponse(), RESP_LENGTH1, len = %u", m_length);
+    // read everything the port has available in one go
+    int len = m_port->readAvailable(m_rxBuffer + m_rxLength, RX_BUFFER_LENGTH - m_rxLength);
+    if (len < 0) {
+        LogError(LOG_MODEM, "Error reading from the modem, ret = %d", len);
+        clearResponse();
+        return RTM_ERROR;
+    }
 
-        m_rspOffset = 2U;
+    if (len == 0) {
+        //LogDebug(LOG_MODEM, "getResponse(), no data available");
+        return RTM_TIMEOUT;
     }
 
-    //LogDebug(LOG_MODEM, "getResponse(), getting frame length 2/2");
-    // get the length of the frame, 2/2
-    if (m_rspState == RESP_LENGTH2) {
-        int ret = m_port->read(m_buffer + 2U, 1U);
-        if (ret < 0) {
-            LogError(LOG_MODEM, "Error reading from the modem, ret = %d", ret);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
+    m_rxLength += (uint32_t)len;
+    return parseResponse();
+}
 
-        if (ret == 0)
-            return RTM_TIMEOUT;
+/* Helper to extract the next complete frame from the read-ahead buffer. */
 
-        m_length = (m_length + (m_buffer[2U] & 0xFFU));
-        m_rspState = RESP_TYPE;
+RESP_TYPE_DVM Modem::parseResponse()
+{
+    m_rspDoubleLength = false;
 
-        //LogDebug(LOG_MODEM, "getResponse(), RESP_LENGTH2, len = %u", m_length);
+    if (m_rxOffset >= m_rxLength)
+        return RTM_TIMEOUT;
 
-        m_rspDoubleLength = true;
-        m_rspOffset = 3U;
-    }
+    const uint8_t* frame = m_rxBuffer + m_rxOffset;
+    uint32_t avail = m_rxLength - m_rxOffset;
 
-    //LogDebug(LOG_MODEM, "getResponse(), getting frame type");
-    // get the frame type
-    if (m_rspState == RESP_TYPE) {
-        int ret = m_port->read(m_buffer + m_rspOffset, 1U);
-        if (ret < 0) {
-            LogError(LOG_MODEM, "Error reading from the modem, ret = %d", ret);
-            m_rspState = RESP_START;
-            return RTM_ERROR;
-        }
+    // get the start of the frame; on garbage, skip ahead to the next frame start
+    if (frame[0U] != DVM_SHORT_FRAME_START &&
+        frame[0U] != DVM_LONG_FRAME_START) {
+        //LogError(LOG_MODEM, "Modem::getResponse(), illegal response, first byte not a frame start; byte = %02X", frame[0U]);
+        uint32_t skip = 1U;
+        while (skip < avail && frame[skip] != DVM_SHORT_FRAME_START && frame[skip] != DVM_LONG_FRAME_START)
+            skip++;
 
-        if (ret == 0)
-            return RTM_TIMEOUT;
+        m_rxOffset += skip;
+        return RTM_ERROR;
+    }
 
-        m_rspType = (DVM_COMMANDS)m_buffer[m_rspOffset];
+    bool doubleLength = (frame[0U] == DVM_LONG_FRAME_START);
+    uint32_t headerLength = doubleLength ? 3U : 2U;
 
-        //LogDebug(LOG_MODEM, "getResponse(), RESP_TYPE, len = %u, type = %u", m_length, m_rspType);
+    // get the length of the frame
+    if (avail < headerLength)
+        return RTM_TIMEOUT;
 
-        m_rspState = RESP_DATA;
-        m_rspOffset++;
+    uint32_t length = frame[1U];
+    if (doubleLength) {
+        length = ((frame[1U] & 0xFFU) << 8) + (frame[2U] & 0xFFU);
+    }
+    else if (length >= 250U) {
+        LogError(LOG_MODEM, "Invalid length received from the modem, len = %u", length);
+        m_rxOffset++;
+        return RTM_ERROR;
     }
 
-    //LogDebug(LOG_MODEM, "getResponse(), getting frame data");
+    if (length <= headerLength || length > BUFFER_LENGTH) {
+        LogError(LOG_MODEM, "Invalid length received from the modem, len = %u", length);
+        m_rxOffset++;
+        return RTM_ERROR;
+    }
 
     // get the frame data
-    if (m_rspState == RESP_DATA) {
+    if (avail < length) {
         if (m_debug && m_trace)
-            LogDebug(LOG_MODEM, "getResponse(), RESP_DATA, len = %u, offset = %u, type = %02X", m_length, m_rspOffset, m_rspType);
-
-        while (m_rspOffset < m_length) {
-            int ret = m_port->read(m_buffer + m_rspOffset, m_length - m_rspOffset);
-            if (ret < 0) {
-                LogError(LOG_MODEM, "Error reading from the modem, ret = %d", ret);
-                m_rspState = RESP_START;
-                return RTM_ERROR;
-            }
+            LogDebug(LOG_MODEM, "getResponse(), partial frame, len = %u, avail = %u", length, avail);
+        return RTM_TIMEOUT;
+    }
 
-            if (ret == 0)
-                return RTM_TIMEOUT;
+    ::memcpy(m_buffer, frame, length);
+    m_length = (uint16_t)length;
+    m_rspDoubleLength = doubleLength;
+    m_rspType = (DVM_COMMANDS)m_buffer[headerLength];
+    m_rxOffset += length;
 
-            if (ret > 0)
-                m_rspOffset += ret;
-        }
+    if (m_debug && m_trace)
+        Utils::dump(1U, "Modem getResponse()", m_buffer, m_length);
 
-        if (m_debug && m_trace)
-            Utils::dump(1U, "Modem getResponse()", m_buffer, m_length);
-    }
+    return RTM_OK;
+}
 
-    m_rspState = RESP_START;
-    m_rspOffset = 0U;
+/* Helper to discard any unparsed data in the read-ahead buffer. */
 
-    return RTM_OK;
+void Modem::clearResponse()
+{
+    m_rxLength = 0U;
+    m_rxOffset = 0U;
 }
 
 /* Helper to convert a serial opcode to a string. */
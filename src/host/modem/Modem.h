@@ -237,17 +237,6 @@ namespace modem
         RSN_NXDN_DISABLED = 65U             //! NXDN Disabled
     };
 
-    /**
-     * @brief Modem response state machine.
-     */
-    enum RESP_STATE {
-        RESP_START,                         //! Start Handling Frame
-        RESP_LENGTH1,                       //! Frame Length 1
-        RESP_LENGTH2,                       //! Frame Length 2
-        RESP_TYPE,                          //! Frame Type
-        RESP_DATA                           //! Frame Data
-    };
-
     /**
      * @brief Hotspot gain modes.
      */
@@ -267,7 +256,9 @@ namespace modem
     const uint8_t MAX_FDMA_PREAMBLE = 255U;
 
     const uint32_t MAX_RESPONSES = 30U;
+    const uint32_t MAX_RESPONSES_PER_CLOCK = 16U;
     const uint32_t BUFFER_LENGTH = 2000U;
+    const uint32_t RX_BUFFER_LENGTH = BUFFER_LENGTH * 2U;
 
     const uint32_t MAX_ADC_OVERFLOW = 128U;
     const uint32_t MAX_DAC_OVERFLOW = 128U;
@@ -479,6 +470,26 @@ namespace modem
          * @returns uint32_t Length of data read from ring buffer.
          */
         uint32_t readNXDNFrame(uint8_t* data);
+        /**
+         * @brief Helper to test if the DMR Slot 1 ring buffer has received frames waiting (without reading them).
+         * @returns bool True, if the DMR Slot 1 ring buffer has frames waiting, otherwise false.
+         */
+        bool hasDMRFrame1() const;
+        /**
+         * @brief Helper to test if the DMR Slot 2 ring buffer has received frames waiting (without reading them).
+         * @returns bool True, if the DMR Slot 2 ring buffer has frames waiting, otherwise false.
+         */
+        bool hasDMRFrame2() const;
+        /**
+         * @brief Helper to test if the P25 ring buffer has received frames waiting (without reading them).
+         * @returns bool True, if the P25 ring buffer has frames waiting, otherwise false.
+         */
+        bool hasP25Frame() const;
+        /**
+         * @brief Helper to test if the NXDN ring buffer has received frames waiting (without reading them).
+         * @returns bool True, if the NXDN ring buffer has frames waiting, otherwise false.
+         */
+        bool hasNXDNFrame() const;
 
         /**
          * @brief Helper to test if the DMR Slot 1 ring buffer has free space.
@@ -527,6 +538,12 @@ namespace modem
          */
         bool isHotspot() const;
 
+        /**
+         * @brief Gets the descriptor that becomes readable when the modem port has data (e.g. for readiness polling).
+         * @returns int Port descriptor, or -1 if the port has none.
+         */
+        int getPortDescriptor() const;
+
         /**
          * @brief Flag indicating whether or not the air interface modem is transmitting.
          * @returns bool True, if air interface modem is transmitting, otherwise false.
@@ -789,8 +806,9 @@ namespace modem
 
         uint8_t* m_buffer;
         uint16_t m_length;
-        uint16_t m_rspOffset;
-        RESP_STATE m_rspState;
+        uint8_t* m_rxBuffer;            // read-ahead of raw bytes from the port, not yet parsed into frames
+        uint32_t m_rxLength;
+        uint32_t m_rxOffset;
         bool m_rspDoubleLength;
         DVM_COMMANDS m_rspType;
 
@@ -879,9 +897,21 @@ namespace modem
 
         /**
          * @brief Helper to get the raw response packet from modem.
+         *
+         *  Bytes are read from the port in bulk into a read-ahead buffer, and the port is only read when no
+         *  complete frame remains buffered; so repeated calls return every frame received, one per call.
          * @returns RESP_TYPE_DVM Response type from modem.
          */
         RESP_TYPE_DVM getResponse();
+        /**
+         * @brief Helper to extract the next complete frame from the read-ahead buffer.
+         * @returns RESP_TYPE_DVM Response type from modem; RTM_TIMEOUT if no complete frame is buffered.
+         */
+        RESP_TYPE_DVM parseResponse();
+        /**
+         * @brief Helper to discard any unparsed data in the read-ahead buffer.
+         */
+        void clearResponse();
 
         /**
          * @brief Helper to convert a serial opcode to a string.
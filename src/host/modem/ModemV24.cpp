@@ -32,6 +32,15 @@ using namespace p25::dfsi::frames;
 
 #include <cassert>
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define IMBE_FRAME_SPACING_US 20000U
+#define NON_IMBE_FRAME_SPACING_US 5000U
+
+#define TX_PACER_IDLE_WAIT_MS 100U
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -56,10 +65,24 @@ ModemV24::ModemV24(port::IModemPort* port, bool duplex, uint32_t p25QueueSize, u
     m_callTimeout(200U),
     m_jitter(jitter),
     m_lastP25Tx(0U),
+    m_txP25QueueLock(),
+    m_portLock(),
+    m_txPacing(false),
+    m_txPacerThread(nullptr),
+    m_txPacerRunning(false),
+    m_txPacerEvents(),
+    m_txLastDue(0U),
+    m_txLastSent(0U),
+    m_txPacedFrames(0U),
     m_rs()
 {
     m_v24Connected = false; // defaulted to false for V.24 modems
 
+    for (uint32_t i = 0U; i < V24_TX_PACING_BUCKETS; i++) {
+        m_txSpacingHist[i] = 0U;
+        m_txLateHist[i] = 0U;
+    }
+
     // Init m_call
     m_txCall = new DFSICallData();
     m_rxCall = new DFSICallData();
@@ -69,6 +92,8 @@ ModemV24::ModemV24(port::IModemPort* port, bool duplex, uint32_t p25QueueSize, u
 
 ModemV24::~ModemV24()
 {
+    stopTxPacer();
+
     delete m_nid;
     delete m_txCall;
     delete m_rxCall;
@@ -81,6 +106,28 @@ void ModemV24::setCallTimeout(uint16_t timeout)
     m_callTimeout = timeout;
 }
 
+/* Sets whether DFSI frames are released by a dedicated pacing thread. */
+
+void ModemV24::setTxPacing(bool txPacing)
+{
+    m_txPacing = txPacing;
+}
+
+/* Gets the DFSI TX pacing histograms; counts of frames per V24_TX_PACING_BOUNDS_US bucket. */
+
+void ModemV24::getTxPacing(uint32_t* spacing, uint32_t* late, uint32_t& frames) const
+{
+    assert(spacing != nullptr);
+    assert(late != nullptr);
+
+    for (uint32_t i = 0U; i < V24_TX_PACING_BUCKETS; i++) {
+        spacing[i] = m_txSpacingHist[i].load();
+        late[i] = m_txLateHist[i].load();
+    }
+
+    frames = m_txPacedFrames.load();
+}
+
 /* Sets the P25 NAC. */
 
 void ModemV24::setP25NAC(uint32_t nac)
@@ -110,8 +157,7 @@ bool ModemV24::open()
         m_inactivityTimer.stop();
     }
 
-    m_rspOffset = 0U;
-    m_rspState = RESP_START;
+    clearResponse();
 
     // do we have an open port handler?
     if (m_openPortHandler) {
@@ -119,11 +165,14 @@ bool ModemV24::open()
         if (!ret)
             return false;
 
+        startTxPacer();
+
         m_error = false;
         return true;
     }
 
     m_statusTimer.start();
+    startTxPacer();
 
     m_error = false;
 
@@ -150,219 +199,231 @@ void ModemV24::clock(uint32_t ms)
 
     uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
     bool forceModemReset = false;
-    RESP_TYPE_DVM type = getResponse();
-
-    // do we have a custom response handler?
-    if (m_rspHandler != nullptr) {
-        // execute custom response handler
-        if (m_rspHandler(this, ms, type, m_rspDoubleLength, m_buffer, m_length)) {
-            // all logic handled by handler -- return
-            return;
+    bool rspHandled = false;
+
+    // process every complete response read from the modem (the first pass always runs, so a custom
+    // response handler is still clocked when there is no data)
+    uint32_t responses = 0U;
+    RESP_TYPE_DVM type = RTM_TIMEOUT;
+    do {
+        type = getResponse();
+
+        // do we have a custom response handler?
+        if (m_rspHandler != nullptr) {
+            // execute custom response handler
+            if (m_rspHandler(this, ms, type, m_rspDoubleLength, m_buffer, m_length)) {
+                // all logic handled by handler -- next response
+                rspHandled = true;
+                continue;
+            }
         }
-    }
 
-    if (type == RTM_TIMEOUT) {
-        // Nothing to do
-    }
-    else if (type == RTM_ERROR) {
-        // Nothing to do
-    }
-    else {
-        // type == RTM_OK
-        uint8_t cmdOffset = 2U;
-        if (m_rspDoubleLength) {
-            cmdOffset = 3U;
+        if (type == RTM_TIMEOUT) {
+            // Nothing to do
         }
+        else if (type == RTM_ERROR) {
+            // Nothing to do
+        }
+        else {
+            // type == RTM_OK
+            uint8_t cmdOffset = 2U;
+            if (m_rspDoubleLength) {
+                cmdOffset = 3U;
+            }
 
-        switch (m_buffer[cmdOffset]) {
-        /** Project 25 */
-        case CMD_P25_DATA:
-        {
-            if (m_p25Enabled) {
-                std::lock_guard<std::mutex> lock(m_p25ReadLock);
+            switch (m_buffer[cmdOffset]) {
+            /** Project 25 */
+            case CMD_P25_DATA:
+            {
+                if (m_p25Enabled) {
+                    std::lock_guard<std::mutex> lock(m_p25ReadLock);
             
-                // convert data from V.24/DFSI formatting to TIA-102 air formatting
-                convertToAir(m_buffer + (cmdOffset + 1U), m_length - (cmdOffset + 1U));
+                    // convert data from V.24/DFSI formatting to TIA-102 air formatting
+                    convertToAir(m_buffer + (cmdOffset + 1U), m_length - (cmdOffset + 1U));
+                }
             }
-        }
-        break;
+            break;
 
-        case CMD_P25_LOST:
-        {
-            if (m_p25Enabled) {
-                std::lock_guard<std::mutex> lock(m_p25ReadLock);
+            case CMD_P25_LOST:
+            {
+                if (m_p25Enabled) {
+                    std::lock_guard<std::mutex> lock(m_p25ReadLock);
 
-                if (m_rspDoubleLength) {
-                    LogError(LOG_MODEM, "CMD_P25_LOST double length?; len = %u", m_length);
-                    break;
-                }
+                    if (m_rspDoubleLength) {
+                        LogError(LOG_MODEM, "CMD_P25_LOST double length?; len = %u", m_length);
+                        break;
+                    }
 
-                uint8_t data = 1U;
-                m_rxP25Queue.addData(&data, 1U);
+                    uint8_t data = 1U;
+                    m_rxP25Queue.addData(&data, 1U);
 
-                data = TAG_LOST;
-                m_rxP25Queue.addData(&data, 1U);
+                    data = TAG_LOST;
+                    m_rxP25Queue.addData(&data, 1U);
+                }
             }
-        }
-        break;
+            break;
 
-        /** General */
-        case CMD_GET_STATUS:
-        {
-            m_isHotspot = (m_buffer[3U] & 0x01U) == 0x01U;
+            /** General */
+            case CMD_GET_STATUS:
+            {
+                m_isHotspot = (m_buffer[3U] & 0x01U) == 0x01U;
 
-            // override hotspot flag if we're forcing hotspot
-            if (m_forceHotspot) {
-                m_isHotspot = m_forceHotspot;
-            }
+                // override hotspot flag if we're forcing hotspot
+                if (m_forceHotspot) {
+                    m_isHotspot = m_forceHotspot;
+                }
 
-            bool dmrEnable = (m_buffer[3U] & 0x02U) == 0x02U;
-            bool p25Enable = (m_buffer[3U] & 0x08U) == 0x08U;
-            bool nxdnEnable = (m_buffer[3U] & 0x10U) == 0x10U;
+                bool dmrEnable = (m_buffer[3U] & 0x02U) == 0x02U;
+                bool p25Enable = (m_buffer[3U] & 0x08U) == 0x08U;
+                bool nxdnEnable = (m_buffer[3U] & 0x10U) == 0x10U;
 
-            // flag indicating if free space is being reported in 16-byte blocks instead of LDUs
-            bool spaceInBlocks = (m_buffer[3U] & 0x80U) == 0x80U;
+                // flag indicating if free space is being reported in 16-byte blocks instead of LDUs
+                bool spaceInBlocks = (m_buffer[3U] & 0x80U) == 0x80U;
 
-            m_v24Connected = (m_buffer[3U] & 0x40U) == 0x40U;
-            m_modemState = (DVM_STATE)m_buffer[4U];
+                m_v24Connected = (m_buffer[3U] & 0x40U) == 0x40U;
+                m_modemState = (DVM_STATE)m_buffer[4U];
 
-            m_tx = (m_buffer[5U] & 0x01U) == 0x01U;
+                m_tx = (m_buffer[5U] & 0x01U) == 0x01U;
 
-            bool adcOverflow = (m_buffer[5U] & 0x02U) == 0x02U;
-            if (adcOverflow) {
-                //LogError(LOG_MODEM, "ADC levels have overflowed");
-                m_adcOverFlowCount++;
+                bool adcOverflow = (m_buffer[5U] & 0x02U) == 0x02U;
+                if (adcOverflow) {
+                    //LogError(LOG_MODEM, "ADC levels have overflowed");
+                    m_adcOverFlowCount++;
 
-                if (m_adcOverFlowCount >= MAX_ADC_OVERFLOW / 2U) {
-                    LogWarning(LOG_MODEM, "ADC overflow count > %u!", MAX_ADC_OVERFLOW / 2U);
-                }
+                    if (m_adcOverFlowCount >= MAX_ADC_OVERFLOW / 2U) {
+                        LogWarning(LOG_MODEM, "ADC overflow count > %u!", MAX_ADC_OVERFLOW / 2U);
+                    }
 
-                if (!m_disableOFlowReset) {
-                    if (m_adcOverFlowCount > MAX_ADC_OVERFLOW) {
-                        LogError(LOG_MODEM, "ADC overflow count > %u, resetting modem", MAX_ADC_OVERFLOW);
-                        forceModemReset = true;
+                    if (!m_disableOFlowReset) {
+                        if (m_adcOverFlowCount > MAX_ADC_OVERFLOW) {
+                            LogError(LOG_MODEM, "ADC overflow count > %u, resetting modem", MAX_ADC_OVERFLOW);
+                            forceModemReset = true;
+                        }
+                    }
+                    else {
+                        m_adcOverFlowCount = 0U;
                     }
                 }
                 else {
-                    m_adcOverFlowCount = 0U;
-                }
-            }
-            else {
-                if (m_adcOverFlowCount != 0U) {
-                    m_adcOverFlowCount--;
+                    if (m_adcOverFlowCount != 0U) {
+                        m_adcOverFlowCount--;
+                    }
                 }
-            }
 
-            bool rxOverflow = (m_buffer[5U] & 0x04U) == 0x04U;
-            if (rxOverflow)
-                LogError(LOG_MODEM, "RX buffer has overflowed");
+                bool rxOverflow = (m_buffer[5U] & 0x04U) == 0x04U;
+                if (rxOverflow)
+                    LogError(LOG_MODEM, "RX buffer has overflowed");
 
-            bool txOverflow = (m_buffer[5U] & 0x08U) == 0x08U;
-            if (txOverflow)
-                LogError(LOG_MODEM, "TX buffer has overflowed");
+                bool txOverflow = (m_buffer[5U] & 0x08U) == 0x08U;
+                if (txOverflow)
+                    LogError(LOG_MODEM, "TX buffer has overflowed");
 
-            m_lockout = (m_buffer[5U] & 0x10U) == 0x10U;
+                m_lockout = (m_buffer[5U] & 0x10U) == 0x10U;
 
-            bool dacOverflow = (m_buffer[5U] & 0x20U) == 0x20U;
-            if (dacOverflow) {
-                //LogError(LOG_MODEM, "DAC levels have overflowed");
-                m_dacOverFlowCount++;
+                bool dacOverflow = (m_buffer[5U] & 0x20U) == 0x20U;
+                if (dacOverflow) {
+                    //LogError(LOG_MODEM, "DAC levels have overflowed");
+                    m_dacOverFlowCount++;
 
-                if (m_dacOverFlowCount > MAX_DAC_OVERFLOW / 2U) {
-                    LogWarning(LOG_MODEM, "DAC overflow count > %u!", MAX_DAC_OVERFLOW / 2U);
-                }
+                    if (m_dacOverFlowCount > MAX_DAC_OVERFLOW / 2U) {
+                        LogWarning(LOG_MODEM, "DAC overflow count > %u!", MAX_DAC_OVERFLOW / 2U);
+                    }
 
-                if (!m_disableOFlowReset) {
-                    if (m_dacOverFlowCount > MAX_DAC_OVERFLOW) {
-                        LogError(LOG_MODEM, "DAC overflow count > %u, resetting modem", MAX_DAC_OVERFLOW);
-                        forceModemReset = true;
+                    if (!m_disableOFlowReset) {
+                        if (m_dacOverFlowCount > MAX_DAC_OVERFLOW) {
+                            LogError(LOG_MODEM, "DAC overflow count > %u, resetting modem", MAX_DAC_OVERFLOW);
+                            forceModemReset = true;
+                        }
+                    }
+                    else {
+                        m_dacOverFlowCount = 0U;
                     }
                 }
                 else {
-                    m_dacOverFlowCount = 0U;
+                    if (m_dacOverFlowCount != 0U) {
+                        m_dacOverFlowCount--;
+                    }
                 }
-            }
-            else {
-                if (m_dacOverFlowCount != 0U) {
-                    m_dacOverFlowCount--;
+
+                m_cd = (m_buffer[5U] & 0x40U) == 0x40U;
+
+                // spaces from the modem are returned in "logical" frame count, or a block size, not raw byte size
+                // DMR and NXDN space are always 0U since the board doesn't support them
+                m_dmrSpace1 = 0U;
+                m_dmrSpace2 = 0U;
+                m_nxdnSpace = 0U;
+
+                // P25 free space can be reported as 16-byte blocks or frames based on the flag above
+                if (spaceInBlocks)
+                    m_p25Space = m_buffer[10U] * P25_BUFFER_BLOCK_SIZE;
+                else
+                    m_p25Space = m_buffer[10U] * (P25DEF::P25_LDU_FRAME_LENGTH_BYTES);
+
+                if (m_dumpModemStatus) {
+                    LogDebug(LOG_MODEM, "ModemV24::clock(), CMD_GET_STATUS, isHotspot = %u, v24Connected = %u, dmr = %u / %u, p25 = %u / %u, nxdn = %u / %u, modemState = %u, tx = %u, adcOverflow = %u, rxOverflow = %u, txOverflow = %u, dacOverflow = %u, dmrSpace1 = %u, dmrSpace2 = %u, p25Space = %u, nxdnSpace = %u",
+                        m_isHotspot, m_v24Connected, dmrEnable, m_dmrEnabled, p25Enable, m_p25Enabled, nxdnEnable, m_nxdnEnabled, m_modemState, m_tx, adcOverflow, rxOverflow, txOverflow, dacOverflow, m_dmrSpace1, m_dmrSpace2, m_p25Space, m_nxdnSpace);
+                    LogDebug(LOG_MODEM, "ModemV24::clock(), CMD_GET_STATUS, rxDMRData1 size = %u, len = %u, free = %u; rxDMRData2 size = %u, len = %u, free = %u, rxP25Data size = %u, len = %u, free = %u, rxNXDNData size = %u, len = %u, free = %u",
+                        m_rxDMRQueue1.length(), m_rxDMRQueue1.dataSize(), m_rxDMRQueue1.freeSpace(), m_rxDMRQueue2.length(), m_rxDMRQueue2.dataSize(), m_rxDMRQueue2.freeSpace(),
+                        m_rxP25Queue.length(), m_rxP25Queue.dataSize(), m_rxP25Queue.freeSpace(), m_rxNXDNQueue.length(), m_rxNXDNQueue.dataSize(), m_rxNXDNQueue.freeSpace());
                 }
-            }
 
-            m_cd = (m_buffer[5U] & 0x40U) == 0x40U;
-
-            // spaces from the modem are returned in "logical" frame count, or a block size, not raw byte size
-            // DMR and NXDN space are always 0U since the board doesn't support them
-            m_dmrSpace1 = 0U;
-            m_dmrSpace2 = 0U;
-            m_nxdnSpace = 0U;
-
-            // P25 free space can be reported as 16-byte blocks or frames based on the flag above
-            if (spaceInBlocks)
-                m_p25Space = m_buffer[10U] * P25_BUFFER_BLOCK_SIZE;
-            else
-                m_p25Space = m_buffer[10U] * (P25DEF::P25_LDU_FRAME_LENGTH_BYTES);
-
-            if (m_dumpModemStatus) {
-                LogDebug(LOG_MODEM, "ModemV24::clock(), CMD_GET_STATUS, isHotspot = %u, v24Connected = %u, dmr = %u / %u, p25 = %u / %u, nxdn = %u / %u, modemState = %u, tx = %u, adcOverflow = %u, rxOverflow = %u, txOverflow = %u, dacOverflow = %u, dmrSpace1 = %u, dmrSpace2 = %u, p25Space = %u, nxdnSpace = %u",
-                    m_isHotspot, m_v24Connected, dmrEnable, m_dmrEnabled, p25Enable, m_p25Enabled, nxdnEnable, m_nxdnEnabled, m_modemState, m_tx, adcOverflow, rxOverflow, txOverflow, dacOverflow, m_dmrSpace1, m_dmrSpace2, m_p25Space, m_nxdnSpace);
-                LogDebug(LOG_MODEM, "ModemV24::clock(), CMD_GET_STATUS, rxDMRData1 size = %u, len = %u, free = %u; rxDMRData2 size = %u, len = %u, free = %u, rxP25Data size = %u, len = %u, free = %u, rxNXDNData size = %u, len = %u, free = %u",
-                    m_rxDMRQueue1.length(), m_rxDMRQueue1.dataSize(), m_rxDMRQueue1.freeSpace(), m_rxDMRQueue2.length(), m_rxDMRQueue2.dataSize(), m_rxDMRQueue2.freeSpace(),
-                    m_rxP25Queue.length(), m_rxP25Queue.dataSize(), m_rxP25Queue.freeSpace(), m_rxNXDNQueue.length(), m_rxNXDNQueue.dataSize(), m_rxNXDNQueue.freeSpace());
+                m_gotModemStatus = true;
+                m_inactivityTimer.start();
             }
+            break;
 
-            m_gotModemStatus = true;
-            m_inactivityTimer.start();
-        }
-        break;
+            case CMD_GET_VERSION:
+            case CMD_ACK:
+                break;
 
-        case CMD_GET_VERSION:
-        case CMD_ACK:
+            case CMD_NAK:
+            {
+                LogWarning(LOG_MODEM, "NAK, command = 0x%02X (%s), reason = %u (%s)", m_buffer[3U], cmdToString(m_buffer[3U]).c_str(), m_buffer[4U], rsnToString(m_buffer[4U]).c_str());
+                switch (m_buffer[4U]) {
+                    case RSN_RINGBUFF_FULL:
+                    {
+                        switch (m_buffer[3U]) {
+                            case CMD_DMR_DATA1:
+                                LogWarning(LOG_MODEM, "NAK, %s, dmrSpace1 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace1);
+                                break;
+                            case CMD_DMR_DATA2:
+                                LogWarning(LOG_MODEM, "NAK, %s, dmrSpace2 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace2);
+                                break;
+
+                            case CMD_P25_DATA:
+                                LogWarning(LOG_MODEM, "NAK, %s, p25Space = %u", rsnToString(m_buffer[4U]).c_str(), m_p25Space);
+                                break;
+
+                            case CMD_NXDN_DATA:
+                                LogWarning(LOG_MODEM, "NAK, %s, nxdnSpace = %u", rsnToString(m_buffer[4U]).c_str(), m_nxdnSpace);
+                                break;
+                            }
+                    }
+                    break;
+                }
+            }
             break;
 
-        case CMD_NAK:
-        {
-            LogWarning(LOG_MODEM, "NAK, command = 0x%02X (%s), reason = %u (%s)", m_buffer[3U], cmdToString(m_buffer[3U]).c_str(), m_buffer[4U], rsnToString(m_buffer[4U]).c_str());
-            switch (m_buffer[4U]) {
-                case RSN_RINGBUFF_FULL:
-                {
-                    switch (m_buffer[3U]) {
-                        case CMD_DMR_DATA1:
-                            LogWarning(LOG_MODEM, "NAK, %s, dmrSpace1 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace1);
-                            break;
-                        case CMD_DMR_DATA2:
-                            LogWarning(LOG_MODEM, "NAK, %s, dmrSpace2 = %u", rsnToString(m_buffer[4U]).c_str(), m_dmrSpace2);
-                            break;
-
-                        case CMD_P25_DATA:
-                            LogWarning(LOG_MODEM, "NAK, %s, p25Space = %u", rsnToString(m_buffer[4U]).c_str(), m_p25Space);
-                            break;
-
-                        case CMD_NXDN_DATA:
-                            LogWarning(LOG_MODEM, "NAK, %s, nxdnSpace = %u", rsnToString(m_buffer[4U]).c_str(), m_nxdnSpace);
-                            break;
-                        }
-                }
+            case CMD_DEBUG1:
+            case CMD_DEBUG2:
+            case CMD_DEBUG3:
+            case CMD_DEBUG4:
+            case CMD_DEBUG5:
+            case CMD_DEBUG_DUMP:
+                printDebug(m_buffer, m_length);
+                break;
+
+            default:
+                LogWarning(LOG_MODEM, "Unknown message, type = %02X", m_buffer[2U]);
+                Utils::dump("Buffer dump", m_buffer, m_length);
                 break;
             }
         }
-        break;
+    } while (type == RTM_OK && !forceModemReset && ++responses < MAX_RESPONSES_PER_CLOCK);
 
-        case CMD_DEBUG1:
-        case CMD_DEBUG2:
-        case CMD_DEBUG3:
-        case CMD_DEBUG4:
-        case CMD_DEBUG5:
-        case CMD_DEBUG_DUMP:
-            printDebug(m_buffer, m_length);
-            break;
-
-        default:
-            LogWarning(LOG_MODEM, "Unknown message, type = %02X", m_buffer[2U]);
-            Utils::dump("Buffer dump", m_buffer, m_length);
-            if (m_rspState != RESP_START)
-                m_rspState = RESP_START;
-            break;
-        }
+    if (rspHandled) {
+        // all logic handled by handler -- return
+        return;
     }
 
     // force a modem reset because of a error condition
@@ -371,12 +432,14 @@ void ModemV24::clock(uint32_t ms)
         reset();
     }
 
-    // write anything waiting to the serial port
-    int len = writeSerial();
-    if (m_debug && len > 0) {
-        LogDebug(LOG_MODEM, "Wrote %u-byte message to the serial V24 device", len);
-    } else if (len < 0) {
-        LogError(LOG_MODEM, "Failed to write to serial port!");
+    // write anything waiting to the serial port (unless the pacing thread does)
+    if (m_txPacerThread == nullptr) {
+        int len = writeSerial();
+        if (m_debug && len > 0) {
+            LogDebug(LOG_MODEM, "Wrote %u-byte message to the serial V24 device", len);
+        } else if (len < 0) {
+            LogError(LOG_MODEM, "Failed to write to serial port!");
+        }
     }
 
     // clear an RX call in progress flag if we're longer than our timeout value
@@ -393,6 +456,7 @@ void ModemV24::clock(uint32_t ms)
 void ModemV24::close()
 {
     LogDebug(LOG_MODEM, "Closing the modem");
+    stopTxPacer();
     m_port->close();
 
     m_gotModemStatus = false;
@@ -432,6 +496,7 @@ int ModemV24::write(const uint8_t* data, uint32_t length)
         convertFromAir(buffer, length);
         return length;
     } else {
+        std::lock_guard<std::mutex> lock(m_portLock);
         return Modem::write(data, length);
     }
 }
@@ -448,71 +513,194 @@ int ModemV24::writeSerial()
      *  Serial TX ringbuffer format:
      * 
      *  | 0x01 | 0x02 | 0x03 | 0x04 | 0x05 | 0x06 | 0x07 | 0x08 | 0x09 | 0x0A | 0x0B | 0x0C | ... |
-     *  |   Length    | Tag  |               int64_t timestamp in ms                 |   data     |
+     *  |   Length    | Tag  |         uint64_t timestamp in us (steady clock)       |   data     |
      */
 
-    // check empty
-    if (m_txP25Queue.isEmpty())
-        return 0U;
+    UInt8Array __buffer;
+    uint16_t len = 0U;
+    uint64_t ts = 0U;
+    {
+        std::lock_guard<std::mutex> lock(m_txP25QueueLock);
 
-    // get length
-    uint8_t length[2U];
-    ::memset(length, 0x00U, 2U);
-    m_txP25Queue.peek(length, 2U);
+        // check empty
+        if (m_txP25Queue.isEmpty())
+            return 0U;
 
-    // convert length byets to int
-    uint16_t len = 0U;
-    len = (length[0U] << 8) + length[1U];
+        // get length
+        uint8_t length[2U];
+        ::memset(length, 0x00U, 2U);
+        m_txP25Queue.peek(length, 2U);
 
-    // this ensures we never get in a situation where we have length & type bytes stuck in the queue by themselves
-    if (m_txP25Queue.dataSize() == 2U && len > m_txP25Queue.dataSize()) {
-        m_txP25Queue.get(length, 2U); // ensure we pop bytes off
-        return 0U;
-    }
+        // convert length byets to int
+        len = (length[0U] << 8) + length[1U];
 
-    // get current timestamp
-    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        // this ensures we never get in a situation where we have length & type bytes stuck in the queue by themselves
+        if (m_txP25Queue.dataSize() == 2U && len > m_txP25Queue.dataSize()) {
+            m_txP25Queue.get(length, 2U); // ensure we pop bytes off
+            return 0U;
+        }
+
+        // check if we have enough data to get everything - len + 2U (length bytes) + 1U (tag) + 8U (timestamp)
+        if (m_txP25Queue.dataSize() < len + 11U)
+            return 0U;
 
-    // peek the timestamp to see if we should wait
-    if (m_txP25Queue.dataSize() >= 11U) {
+        // peek the timestamp to see if we should wait
         uint8_t lengthTagTs[11U];
         ::memset(lengthTagTs, 0x00U, 11U);
         m_txP25Queue.peek(lengthTagTs, 11U);
 
-        // get the timestamp
-        int64_t ts;
         assert(sizeof ts == 8);
         ::memcpy(&ts, lengthTagTs + 3U, 8U);
 
         // if it's not time to send, return
-        if (ts > now) {
+        if (ts > EventLoop::now()) {
             return 0U;
         }
-    }
 
-    // check if we have enough data to get everything - len + 2U (length bytes) + 1U (tag) + 8U (timestamp)
-    if (m_txP25Queue.dataSize() >= len + 11U) {
         // Get the length, tag and timestamp
-        uint8_t lengthTagTs[11U];
         m_txP25Queue.get(lengthTagTs, 11U);
-        
+
         // Get the actual data
-        UInt8Array __buffer = std::make_unique<uint8_t[]>(len);
-        uint8_t* buffer = __buffer.get();
-        m_txP25Queue.get(buffer, len);
-        
+        __buffer = std::make_unique<uint8_t[]>(len);
+        m_txP25Queue.get(__buffer.get(), len);
+
         // Sanity check on data tag
         uint8_t tag = lengthTagTs[2U];
         if (tag != TAG_DATA) {
             LogError(LOG_MODEM, "Got unexpected data tag from TX P25 ringbuffer! %02X", tag);
             return 0U;
         }
+    }
+
+    // we already checked the timestamp above, so we just get the data and write it
+    int ret = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_portLock);
+        ret = m_port->write(__buffer.get(), len);
+    }
+
+    // account how closely the frame kept to its schedule
+    uint64_t sent = EventLoop::now();
+    uint64_t late = sent - ts;
+
+    uint32_t bucket = 0U;
+    while (bucket < V24_TX_PACING_BUCKETS - 1U && late >= V24_TX_PACING_BOUNDS_US[bucket])
+        bucket++;
+    m_txLateHist[bucket]++;
+
+    // spacing is only meaningful between frames of the same stream; a new stream starts a jitter buffer later
+    if (m_txLastDue != 0U && ts > m_txLastDue && ts - m_txLastDue <= IMBE_FRAME_SPACING_US) {
+        uint64_t target = ts - m_txLastDue;
+        uint64_t actual = sent - m_txLastSent;
+        uint64_t error = (actual > target) ? actual - target : target - actual;
+
+        bucket = 0U;
+        while (bucket < V24_TX_PACING_BUCKETS - 1U && error >= V24_TX_PACING_BOUNDS_US[bucket])
+            bucket++;
+        m_txSpacingHist[bucket]++;
+    }
+
+    m_txLastDue = ts;
+    m_txLastSent = sent;
+    m_txPacedFrames++;
+
+    return ret;
+}
+
+/* Helper to get the due time of the frame at the head of the P25 Tx queue. */
+
+bool ModemV24::peekTxDue(uint64_t& due)
+{
+    std::lock_guard<std::mutex> lock(m_txP25QueueLock);
+    if (m_txP25Queue.dataSize() < 11U)
+        return false;
+
+    uint8_t lengthTagTs[11U];
+    m_txP25Queue.peek(lengthTagTs, 11U);
+    ::memcpy(&due, lengthTagTs + 3U, 8U);
+    return true;
+}
+
+/* Helper to start the DFSI TX pacing thread. */
+
+void ModemV24::startTxPacer()
+{
+    if (!m_txPacing || m_txPacerThread != nullptr)
+        return;
+
+    m_txPacerEvents.open();
+    m_txPacerRunning = true;
+
+    m_txPacerThread = new thread_t();
+    if (!Thread::runAsThread(this, threadTxPacer, m_txPacerThread, THREAD_GROUP_MODEM)) {
+        LogError(LOG_MODEM, "Unable to start the DFSI TX pacing thread, frames are written on the modem clock");
+        m_txPacerRunning = false;
+        m_txPacerThread = nullptr; // released by runAsThread()
+        m_txPacerEvents.close();
+    }
+}
+
+/* Helper to stop (and wait for) the DFSI TX pacing thread. */
+
+void ModemV24::stopTxPacer()
+{
+    if (m_txPacerThread == nullptr)
+        return;
+
+    m_txPacerRunning = false;
+    m_txPacerEvents.notify();
+
+#if defined(_WIN32)
+    ::WaitForSingleObject(m_txPacerThread->thread, INFINITE);
+    ::CloseHandle(m_txPacerThread->thread);
+#else
+    ::pthread_join(m_txPacerThread->thread, nullptr);
+#endif // defined(_WIN32)
+
+    delete m_txPacerThread;
+    m_txPacerThread = nullptr;
+    m_txPacerEvents.close();
+}
+
+/* Entry point to the DFSI TX pacing thread. */
+
+void* ModemV24::threadTxPacer(void* arg)
+{
+    thread_t* th = (thread_t*)arg;
+    if (th != nullptr) {
+        std::string threadName("modem:v24-tx");
+        ModemV24* modem = static_cast<ModemV24*>(th->obj);
+        if (modem == nullptr) {
+            LogDebug(LOG_MODEM, "[FAIL] %s", threadName.c_str());
+            return nullptr;
+        }
 
-        // we already checked the timestamp above, so we just get the data and write it
-        return m_port->write(buffer, len);
+        LogDebug(LOG_MODEM, "[ OK ] %s", threadName.c_str());
+#ifdef _GNU_SOURCE
+        ::pthread_setname_np(th->thread, threadName.c_str());
+#endif // _GNU_SOURCE
+
+        while (modem->m_txPacerRunning) {
+            // write the head frame once it is due; otherwise sleep until it is, or until a frame is queued
+            uint64_t due = 0U;
+            if (modem->peekTxDue(due) && due <= EventLoop::now()) {
+                int len = modem->writeSerial();
+                if (modem->m_debug && len > 0) {
+                    LogDebug(LOG_MODEM, "Wrote %u-byte message to the serial V24 device", len);
+                } else if (len < 0) {
+                    LogError(LOG_MODEM, "Failed to write to serial port!");
+                }
+
+                continue;
+            }
+
+            modem->m_txPacerEvents.waitUntil(due, TX_PACER_IDLE_WAIT_MS);
+        }
+
+        LogDebug(LOG_MODEM, "[STOP] %s", threadName.c_str());
     }
 
-    return 0U;
+    return nullptr;
 }
 
 /* Helper to store converted Rx frames. */
@@ -1093,15 +1281,18 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
     if (m_trace)
         Utils::dump(1U, "ModemV24::queueP25Frame() data", data, len);
 
-    // get current time in ms
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(m_txP25QueueLock);
 
-    // timestamp for this message (in ms)
+    // get current time in us
+    uint64_t now = EventLoop::now();
+    uint64_t jitter = m_jitter * 1000ULL;
+
+    // timestamp for this message (in us)
     uint64_t msgTime = 0U;
 
-    // if this is our first message, timestamp is just now + the jitter buffer offset in ms
+    // if this is our first message, timestamp is just now + the jitter buffer offset
     if (m_lastP25Tx == 0U) {
-        msgTime = now + m_jitter;
+        msgTime = now + jitter;
 
         // if the message type requests no jitter delay -- just set the message time to now
         if (msgType == STT_NON_IMBE_NO_JITTER)
@@ -1110,22 +1301,23 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
     // if we had a message before this, calculate the new timestamp dynamically
     else {
         // if the last message occurred longer than our jitter buffer delay, we restart the sequence and calculate the same as above
-        if ((int64_t)(now - m_lastP25Tx) > m_jitter) {
-            msgTime = now + m_jitter;
+        if ((int64_t)(now - m_lastP25Tx) > (int64_t)jitter) {
+            msgTime = now + jitter;
         }
         // otherwise, we time out messages as required by the message type
         else {
             if (msgType == STT_IMBE) {
                 // IMBEs must go out at 20ms intervals
-                msgTime = m_lastP25Tx + 20U;
+                msgTime = m_lastP25Tx + IMBE_FRAME_SPACING_US;
             } else {
                 // Otherwise we don't care, we use 5ms since that's the theoretical minimum time a 9600 baud message can take
-                msgTime = m_lastP25Tx + 5U;
+                msgTime = m_lastP25Tx + NON_IMBE_FRAME_SPACING_US;
             }
         }
     }
 
     len += 4U;
+    bool wasEmpty = m_txP25Queue.isEmpty();
 
     // convert 16-bit length to 2 bytes
     uint8_t length[2U];
@@ -1160,6 +1352,10 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
 
     // update the last message time
     m_lastP25Tx = msgTime;
+
+    // a new head frame changes the pacing thread's next deadline
+    if (wasEmpty && m_txPacerThread != nullptr)
+        m_txPacerEvents.notify();
 }
 
 /* Send a start of stream sequence (HDU, etc) to the connected serial V.24 device */
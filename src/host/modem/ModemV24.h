@@ -18,6 +18,8 @@
 
 #include "Defines.h"
 #include "common/edac/RS634717.h"
+#include "common/EventLoop.h"
+#include "common/Thread.h"
 #include "common/p25/dfsi/frames/MotVoiceHeader1.h"
 #include "common/p25/dfsi/frames/MotVoiceHeader2.h"
 #include "common/p25/lc/LC.h"
@@ -25,6 +27,9 @@
 #include "common/p25/NID.h"
 #include "modem/Modem.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace modem
 {
     // ---------------------------------------------------------------------------
@@ -47,6 +52,17 @@ namespace modem
         STT_IMBE                            //! IMBE Voice Frame
     };
 
+    /**
+     * @brief Number of buckets in the DFSI TX pacing histograms.
+     * @ingroup modem
+     */
+    const uint32_t V24_TX_PACING_BUCKETS = 7U;
+    /**
+     * @brief Upper bounds (exclusive, in us) of the DFSI TX pacing histogram buckets; the last bucket is unbounded.
+     * @ingroup modem
+     */
+    const uint32_t V24_TX_PACING_BOUNDS_US[V24_TX_PACING_BUCKETS - 1U] = { 100U, 250U, 500U, 1000U, 2000U, 5000U };
+
     /** @} */
 
     // ---------------------------------------------------------------------------
@@ -238,7 +254,7 @@ namespace modem
          * @param p25TxQueueSize Modem P25 Tx frame buffer queue size (bytes).
          * @param rtrt Flag indicating whether or not RT/RT is enabled.
          * @param diu Flag indicating whether or not V.24 communications are to a DIU.
-         * @param jitter 
+         * @param jitter Jitter buffer length (in ms).
          * @param dumpModemStatus Flag indicating whether the modem status is dumped to the log.
          * @param trace Flag indicating whether air interface modem trace is enabled.
          * @param debug Flag indicating whether air interface modem debug is enabled.
@@ -255,6 +271,21 @@ namespace modem
          * @param timeout Timeout.
          */
         void setCallTimeout(uint16_t timeout);
+        /**
+         * @brief Sets whether DFSI frames are released by a dedicated pacing thread.
+         *
+         *  When enabled, each queued frame is written at its due time from an absolute-deadline timer,
+         *  instead of on the first modem clock after it; this must be set before the modem is opened.
+         * @param txPacing Flag indicating whether DFSI frames are paced.
+         */
+        void setTxPacing(bool txPacing);
+        /**
+         * @brief Gets the DFSI TX pacing histograms; counts of frames per V24_TX_PACING_BOUNDS_US bucket.
+         * @param[out] spacing Error of the actual against the target spacing from the previous frame of the stream.
+         * @param[out] late Lateness of each frame against its due time.
+         * @param[out] frames Total number of frames written.
+         */
+        void getTxPacing(uint32_t* spacing, uint32_t* late, uint32_t& frames) const;
         /**
          * @brief Sets the P25 NAC.
          * @param nac NAC.
@@ -314,6 +345,20 @@ namespace modem
         uint16_t m_jitter;
         uint64_t m_lastP25Tx;
 
+        std::mutex m_txP25QueueLock;
+        std::mutex m_portLock;
+
+        bool m_txPacing;
+        thread_t* m_txPacerThread;
+        std::atomic<bool> m_txPacerRunning;
+        EventLoop m_txPacerEvents;
+
+        uint64_t m_txLastDue;
+        uint64_t m_txLastSent;
+        std::atomic<uint32_t> m_txSpacingHist[V24_TX_PACING_BUCKETS];
+        std::atomic<uint32_t> m_txLateHist[V24_TX_PACING_BUCKETS];
+        std::atomic<uint32_t> m_txPacedFrames;
+
         edac::RS634717 m_rs;
 
         /**
@@ -321,6 +366,27 @@ namespace modem
          * @return int Actual number of bytes written to the serial interface.
          */
         int writeSerial();
+        /**
+         * @brief Helper to get the due time of the frame at the head of the P25 Tx queue.
+         * @param[out] due Due time of the frame, on the EventLoop steady clock (in us).
+         * @returns bool True, if there is a frame queued, otherwise false.
+         */
+        bool peekTxDue(uint64_t& due);
+
+        /**
+         * @brief Helper to start the DFSI TX pacing thread.
+         */
+        void startTxPacer();
+        /**
+         * @brief Helper to stop (and wait for) the DFSI TX pacing thread.
+         */
+        void stopTxPacer();
+        /**
+         * @brief Entry point to the DFSI TX pacing thread.
+         * @param arg Instance of the thread_t structure.
+         * @returns void* (Ignore)
+         */
+        static void* threadTxPacer(void* arg);
 
         /**
          * @brief Helper to store converted Rx frames.
@@ -18,3 +18,17 @@ using namespace modem::port;
 /* Finalizes a instance of the IModemPort class. */
 
 IModemPort::~IModemPort() = default;
+
+/* Reads whatever data is immediately available from the port, without waiting for more. */
+
+int IModemPort::readAvailable(uint8_t* buffer, uint32_t length)
+{
+    return read(buffer, length);
+}
+
+/* Gets the descriptor that becomes readable when the port has data (e.g. for readiness polling). */
+
+int IModemPort::getDescriptor() const
+{
+    return -1;
+}
@@ -50,6 +50,16 @@ namespace modem
              * @returns int Actual length of data read from serial port.
              */
             virtual int read(uint8_t* buffer, uint32_t length) = 0;
+            /**
+             * @brief Reads whatever data is immediately available from the port, without waiting for more.
+             *
+             *  The default implementation defers to read(), which suits ports whose read() already returns
+             *  short when less data is available; ports whose read() waits for the full length must override.
+             * @param[out] buffer Buffer to read data from the port to.
+             * @param length Maximum length of data to read from the port.
+             * @returns int Actual length of data read from the port (0 if none is available), or less than 0 on error.
+             */
+            virtual int readAvailable(uint8_t* buffer, uint32_t length);
             /**
              * @brief Writes data to the port.
              * @param[in] buffer Buffer containing data to write to port.
@@ -62,6 +72,14 @@ namespace modem
              * @brief Closes the connection to the port.
              */
             virtual void close() = 0;
+
+            /**
+             * @brief Gets the descriptor that becomes readable when the port has data (e.g. for readiness polling).
+             *
+             *  The default implementation returns -1; ports without such a descriptor are polled on each tick.
+             * @returns int Port descriptor, or -1 if there is none.
+             */
+            virtual int getDescriptor() const;
         };
     } // namespace port
 } // namespace modem
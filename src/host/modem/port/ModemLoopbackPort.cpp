@@ -0,0 +1,835 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/dmr/DMRDefines.h"
+#include "common/dmr/SlotType.h"
+#include "common/dmr/Sync.h"
+#include "common/dmr/lc/csbk/CSBKFactory.h"
+#include "common/edac/CRC.h"
+#include "common/edac/Trellis.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/P25Utils.h"
+#include "common/p25/Sync.h"
+#include "common/p25/data/DataBlock.h"
+#include "common/p25/data/DataHeader.h"
+#include "common/p25/data/LowSpeedData.h"
+#include "common/p25/lc/LC.h"
+#include "common/p25/lc/tsbk/TSBKFactory.h"
+#include "common/EventLoop.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+#include "modem/port/ModemLoopbackPort.h"
+#include "modem/Modem.h"
+
+using namespace modem::port;
+using namespace modem;
+using namespace p25::defines;
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t LOOPBACK_BUFFER_LENGTH = 4096U;
+// an injected frame is only queued while the host keeps the read buffer drained
+const uint32_t LOOPBACK_MIN_FREE_SPACE = 300U;
+
+// the script starts once the host transmits (its protocol controllers are up), or after the idle start delay
+const uint64_t LOOPBACK_START_DELAY_US = 2000000U;
+const uint64_t LOOPBACK_IDLE_START_DELAY_US = 30000000U;
+const uint64_t LOOPBACK_RESPONSE_TIMEOUT_US = 2000000U;
+
+const uint64_t LOOPBACK_HDU_SPACING_US = 80000U;
+const uint64_t LOOPBACK_LDU_SPACING_US = 180000U;
+const uint64_t LOOPBACK_CALL_GAP_US = 1000000U;
+
+const uint32_t LOOPBACK_MAX_PDU_BLOCKS = 8U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the ModemLoopbackPort class. */
+
+ModemLoopbackPort::ModemLoopbackPort(uint32_t p25NAC, uint32_t dmrColorCode, const std::vector<LoopbackStep>& script, bool repeat,
+    uint32_t reportInterval) : ModemNullPort(LOOPBACK_BUFFER_LENGTH),
+    m_dmrColorCode(dmrColorCode),
+    m_nid(p25NAC),
+    m_audio(),
+    m_script(script),
+    m_repeat(repeat),
+    m_reportInterval(reportInterval * 1000000ULL),
+    m_random(std::random_device()()),
+    m_running(false),
+    m_started(false),
+    m_startTime(0U),
+    m_stepNo(0U),
+    m_injected(0U),
+    m_nextDue(0U),
+    m_stepStart(0U),
+    m_lastReport(0U),
+    m_callFrames(0U),
+    m_callFrameNo(0U),
+    m_txVoice(false),
+    m_pending(),
+    m_pendingFrames(),
+    m_responses(0U),
+    m_accepted(0U),
+    m_latencySum(0U),
+    m_latencyMax(0U),
+    m_txFrames(0U)
+{
+    /* stub */
+}
+
+/* Finalizes a instance of the ModemLoopbackPort class. */
+
+ModemLoopbackPort::~ModemLoopbackPort() = default;
+
+/* Opens a connection to the port. */
+
+bool ModemLoopbackPort::open()
+{
+    if (m_script.empty()) {
+        LogWarning(LOG_MODEM, "Loopback, no traffic script defined, behaving as a null modem");
+        return true;
+    }
+
+    // the host performs its warmup after the port is opened; hold the script until it transmits
+    m_started = false;
+    m_startTime = EventLoop::now() + LOOPBACK_IDLE_START_DELAY_US;
+    m_running = true;
+
+    return true;
+}
+
+/* Reads data from the port. */
+
+int ModemLoopbackPort::read(uint8_t* buffer, uint32_t length)
+{
+    if (m_running)
+        inject(EventLoop::now());
+
+    return ModemNullPort::read(buffer, length);
+}
+
+/* Writes data to the port. */
+
+int ModemLoopbackPort::write(const uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+
+    if (buffer[0U] == DVM_LONG_FRAME_START) {
+        if (length > 5U && buffer[3U] == CMD_P25_DATA)
+            processP25TX(buffer + 5U, length - 5U);
+
+        return int(length);
+    }
+
+    switch (buffer[2U]) {
+    case CMD_P25_DATA:
+        if (length > 4U)
+            processP25TX(buffer + 4U, length - 4U);
+        break;
+    case CMD_DMR_DATA1:
+    case CMD_DMR_DATA2:
+        if (length >= DMRDEF::DMR_FRAME_LENGTH_BYTES + 4U)
+            processDMRTX(buffer + 4U);
+        break;
+    default:
+        return ModemNullPort::write(buffer, length);
+    }
+
+    return int(length);
+}
+
+/* Closes the connection to the port. */
+
+void ModemLoopbackPort::close()
+{
+    if (m_running && m_started) {
+        report(EventLoop::now(), true);
+        m_running = false;
+    }
+}
+
+/* Helper to convert a traffic type name to its value. */
+
+bool ModemLoopbackPort::parseTraffic(const std::string& name, LOOPBACK_TRAFFIC& traffic)
+{
+    for (uint8_t i = LOOPBACK_P25_REG; i <= LOOPBACK_DMR_GRANT; i++) {
+        if (name == trafficName((LOOPBACK_TRAFFIC)i)) {
+            traffic = (LOOPBACK_TRAFFIC)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Helper to convert a traffic type to its name. */
+
+std::string ModemLoopbackPort::trafficName(LOOPBACK_TRAFFIC traffic)
+{
+    switch (traffic) {
+    case LOOPBACK_P25_REG:
+        return std::string("p25-reg");
+    case LOOPBACK_P25_AFF:
+        return std::string("p25-aff");
+    case LOOPBACK_P25_GRANT:
+        return std::string("p25-grant");
+    case LOOPBACK_P25_VOICE:
+        return std::string("p25-voice");
+    case LOOPBACK_P25_PDU:
+        return std::string("p25-pdu");
+    case LOOPBACK_DMR_REG:
+        return std::string("dmr-reg");
+    case LOOPBACK_DMR_GRANT:
+        return std::string("dmr-grant");
+    default:
+        return std::string("unknown");
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to inject every scripted frame that is due. */
+
+void ModemLoopbackPort::inject(uint64_t now)
+{
+    if (!m_started) {
+        if (now < m_startTime)
+            return;
+
+        startStep(0U, now);
+        m_started = true;
+    }
+
+    while (m_running && now >= m_nextDue) {
+        if (m_buffer.freeSpace() < LOOPBACK_MIN_FREE_SPACE)
+            break;
+
+        const LoopbackStep& step = m_script[m_stepNo];
+        if (m_injected >= step.count) {
+            // give the host a chance to answer the last requests before the step is closed
+            bool outstanding = !m_pending.empty() || !m_pendingFrames.empty();
+            if (outstanding && now - m_nextDue < LOOPBACK_RESPONSE_TIMEOUT_US)
+                break;
+
+            report(now, true);
+
+            if (m_stepNo + 1U < m_script.size()) {
+                startStep(m_stepNo + 1U, now);
+            }
+            else if (m_repeat) {
+                startStep(0U, now);
+            }
+            else {
+                LogMessage(LOG_MODEM, "Loopback, traffic script complete");
+                m_running = false;
+            }
+
+            continue;
+        }
+
+        uint32_t srcId = step.srcId + m_injected;
+        switch (step.traffic) {
+        case LOOPBACK_P25_VOICE:
+        {
+            if (injectP25Voice(step, srcId)) {
+                m_injected++;
+                m_nextDue += LOOPBACK_CALL_GAP_US;
+            }
+            else {
+                m_nextDue += (m_callFrameNo == 1U) ? LOOPBACK_HDU_SPACING_US : LOOPBACK_LDU_SPACING_US;
+            }
+        }
+        break;
+        case LOOPBACK_P25_PDU:
+        {
+            injectP25PDU(step, srcId);
+            m_pendingFrames.push_back(now);
+
+            m_injected++;
+            m_nextDue += 1000000U / step.rate;
+        }
+        break;
+        case LOOPBACK_DMR_REG:
+        case LOOPBACK_DMR_GRANT:
+        {
+            injectDMRCSBK(step, srcId);
+            m_pending[srcId] = now;
+
+            m_injected++;
+            m_nextDue += 1000000U / step.rate;
+        }
+        break;
+        default:
+        {
+            injectP25TSBK(step, srcId);
+            m_pending[srcId] = now;
+
+            m_injected++;
+            m_nextDue += 1000000U / step.rate;
+        }
+        break;
+        }
+    }
+
+    if (m_running && m_reportInterval > 0U && now - m_lastReport >= m_reportInterval && now >= m_stepStart) {
+        report(now, false);
+        m_lastReport = now;
+    }
+}
+
+/* Helper to inject the next P25 request of the current step. */
+
+void ModemLoopbackPort::injectP25TSBK(const LoopbackStep& step, uint32_t srcId)
+{
+    using namespace p25::lc::tsbk;
+
+    uint8_t frame[P25_TSDU_FRAME_LENGTH_BYTES];
+    ::memset(frame, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+    // Generate Sync
+    p25::Sync::addP25Sync(frame);
+
+    // Generate NID
+    m_nid.encode(frame, DUID::TSDU);
+
+    uint32_t sysId = p25::lc::TSBK::getSiteData().sysId();
+
+    std::unique_ptr<p25::lc::TSBK> isp;
+    switch (step.traffic) {
+    case LOOPBACK_P25_REG:
+    {
+        std::unique_ptr<IOSP_U_REG> reg = std::make_unique<IOSP_U_REG>();
+        // the system ID is carried in the low 12 bits of the request's address field
+        reg->setDstId(sysId);
+        isp = std::move(reg);
+    }
+    break;
+    case LOOPBACK_P25_AFF:
+    {
+        std::unique_ptr<IOSP_GRP_AFF> aff = std::make_unique<IOSP_GRP_AFF>();
+        aff->setAnnounceGroup(sysId);
+        aff->setDstId(step.dstId);
+        isp = std::move(aff);
+    }
+    break;
+    default:
+    {
+        std::unique_ptr<IOSP_GRP_VCH> vch = std::make_unique<IOSP_GRP_VCH>();
+        vch->setDstId(step.dstId);
+        isp = std::move(vch);
+    }
+    break;
+    }
+
+    isp->setSrcId(srcId);
+    isp->setLastBlock(true);
+    isp->encode(frame);
+
+    // Add status bits
+    p25::P25Utils::addStatusBits(frame, P25_TSDU_FRAME_LENGTH_BITS, false, true);
+
+    addP25Frame(frame, P25_TSDU_FRAME_LENGTH_BYTES, step.ber);
+}
+
+/* Helper to inject the next frame of a P25 voice call. */
+
+bool ModemLoopbackPort::injectP25Voice(const LoopbackStep& step, uint32_t srcId)
+{
+    uint8_t frame[P25_LDU_FRAME_LENGTH_BYTES];
+    ::memset(frame, 0x00U, P25_LDU_FRAME_LENGTH_BYTES);
+
+    // Generate Sync
+    p25::Sync::addP25Sync(frame);
+
+    // end of call
+    if (m_callFrameNo > m_callFrames) {
+        m_nid.encode(frame, DUID::TDU);
+        p25::P25Utils::addStatusBits(frame, P25_TDU_FRAME_LENGTH_BITS, false);
+
+        addP25Frame(frame, P25_TDU_FRAME_LENGTH_BYTES, step.ber);
+
+        m_callFrameNo = 0U;
+        return true;
+    }
+
+    p25::lc::LC lc = p25::lc::LC();
+    lc.setSrcId(srcId);
+    lc.setDstId(step.dstId);
+
+    if (m_callFrameNo == 0U) {
+        m_nid.encode(frame, DUID::HDU);
+        lc.encodeHDU(frame);
+        p25::P25Utils::addStatusBits(frame, P25_HDU_FRAME_LENGTH_BITS, false);
+
+        addP25Frame(frame, P25_HDU_FRAME_LENGTH_BYTES, step.ber);
+        m_pendingFrames.push_back(EventLoop::now());
+    }
+    else {
+        bool ldu1 = (m_callFrameNo % 2U) == 1U;
+        if (ldu1) {
+            m_nid.encode(frame, DUID::LDU1);
+            lc.encodeLDU1(frame);
+        }
+        else {
+            m_nid.encode(frame, DUID::LDU2);
+            lc.encodeLDU2(frame);
+        }
+
+        // Add the Audio
+        for (uint32_t n = 0U; n < 9U; n++)
+            m_audio.encode(frame, NULL_IMBE, n);
+
+        // Add the Low Speed Data
+        p25::data::LowSpeedData lsd = p25::data::LowSpeedData();
+        lsd.encode(frame);
+
+        p25::P25Utils::addStatusBits(frame, P25_LDU_FRAME_LENGTH_BITS, false);
+
+        addP25Frame(frame, P25_LDU_FRAME_LENGTH_BYTES, step.ber);
+    }
+
+    m_callFrameNo++;
+    return false;
+}
+
+/* Helper to inject a P25 unconfirmed data PDU. */
+
+void ModemLoopbackPort::injectP25PDU(const LoopbackStep& step, uint32_t srcId)
+{
+    uint32_t blocks = step.pduBlocks;
+    uint32_t packetLength = blocks * P25_PDU_UNCONFIRMED_LENGTH_BYTES;
+
+    p25::data::DataHeader dataHeader = p25::data::DataHeader();
+    dataHeader.setFormat(PDUFormatType::UNCONFIRMED);
+    dataHeader.setMFId(MFG_STANDARD);
+    dataHeader.setAckNeeded(false);
+    dataHeader.setOutbound(false);
+    dataHeader.setSAP(PDUSAP::USER_DATA);
+    dataHeader.setLLId(srcId);
+    dataHeader.setFullMessage(true);
+    dataHeader.calculateLength(packetLength - 4U);
+
+    uint8_t userData[LOOPBACK_MAX_PDU_BLOCKS * P25_PDU_UNCONFIRMED_LENGTH_BYTES];
+    for (uint32_t i = 0U; i < packetLength; i++)
+        userData[i] = (uint8_t)(i & 0xFFU);
+    edac::CRC::addCRC32(userData, packetLength);
+
+    uint32_t bitLength = ((blocks + 1U) * P25_PDU_FEC_LENGTH_BITS) + P25_PREAMBLE_LENGTH_BITS;
+    uint32_t offset = P25_PREAMBLE_LENGTH_BITS;
+
+    uint8_t pdu[((LOOPBACK_MAX_PDU_BLOCKS + 1U) * P25_PDU_FEC_LENGTH_BYTES) + P25_PREAMBLE_LENGTH_BYTES + 1U];
+    ::memset(pdu, 0x00U, sizeof(pdu));
+
+    uint8_t block[P25_PDU_FEC_LENGTH_BYTES];
+    ::memset(block, 0x00U, P25_PDU_FEC_LENGTH_BYTES);
+
+    // generate the PDU header and 1/2 rate Trellis
+    dataHeader.encode(block);
+    Utils::setBitRange(block, pdu, offset, P25_PDU_FEC_LENGTH_BITS);
+    offset += P25_PDU_FEC_LENGTH_BITS;
+
+    // generate the PDU data
+    for (uint32_t i = 0U; i < blocks; i++) {
+        p25::data::DataBlock dataBlock = p25::data::DataBlock();
+        dataBlock.setFormat(dataHeader);
+        dataBlock.setSerialNo(i);
+        dataBlock.setData(userData + (i * P25_PDU_UNCONFIRMED_LENGTH_BYTES));
+
+        ::memset(block, 0x00U, P25_PDU_FEC_LENGTH_BYTES);
+        dataBlock.encode(block);
+        Utils::setBitRange(block, pdu, offset, P25_PDU_FEC_LENGTH_BITS);
+        offset += P25_PDU_FEC_LENGTH_BITS;
+    }
+
+    uint8_t frame[P25_PDU_FRAME_LENGTH_BYTES];
+    ::memset(frame, 0x00U, P25_PDU_FRAME_LENGTH_BYTES);
+
+    // Add the data
+    uint32_t newBitLength = p25::P25Utils::encode(pdu, frame, bitLength);
+    uint32_t newByteLength = newBitLength / 8U;
+    if ((newBitLength % 8U) > 0U)
+        newByteLength++;
+
+    // Generate Sync
+    p25::Sync::addP25Sync(frame);
+
+    // Generate NID
+    m_nid.encode(frame, DUID::PDU);
+
+    // Add status bits
+    p25::P25Utils::addStatusBits(frame, newBitLength, false);
+    p25::P25Utils::addIdleStatusBits(frame, newBitLength);
+
+    addP25Frame(frame, newByteLength, step.ber);
+}
+
+/* Helper to inject a DMR random access CSBK. */
+
+void ModemLoopbackPort::injectDMRCSBK(const LoopbackStep& step, uint32_t srcId)
+{
+    using namespace dmr::defines;
+
+    uint8_t frame[DMR_FRAME_LENGTH_BYTES];
+    ::memset(frame, 0x00U, DMR_FRAME_LENGTH_BYTES);
+
+    dmr::lc::csbk::CSBK_RAND csbk = dmr::lc::csbk::CSBK_RAND();
+    csbk.setSrcId(srcId);
+    if (step.traffic == LOOPBACK_DMR_REG) {
+        csbk.setServiceKind(ServiceKind::REG_SVC);
+        csbk.setDstId(WUID_REGI);
+    }
+    else {
+        csbk.setServiceKind(ServiceKind::GRP_VOICE_CALL);
+        csbk.setGI(true);
+        csbk.setDstId(step.dstId);
+    }
+
+    csbk.encode(frame);
+
+    // Regenerate the Slot Type
+    dmr::SlotType slotType;
+    slotType.setColorCode(m_dmrColorCode);
+    slotType.setDataType(DataType::CSBK);
+    slotType.encode(frame);
+
+    // Convert the Data Sync to be from the MS
+    dmr::Sync::addDMRDataSync(frame, false);
+
+    addDMRFrame(step.slot, SYNC_DATA | DataType::CSBK, frame, step.ber);
+}
+
+/* Helper to add a P25 frame to the read buffer, as the modem would deliver it. */
+
+void ModemLoopbackPort::addP25Frame(uint8_t* frame, uint32_t length, float ber)
+{
+    assert(frame != nullptr);
+    assert(length + 4U <= 255U);
+
+    // leave the frame sync intact, the modem would not have delivered the frame otherwise
+    applyBER(frame, P25_SYNC_LENGTH_BITS, length * 8U, ber);
+
+    uint8_t header[4U];
+    header[0U] = DVM_SHORT_FRAME_START;
+    header[1U] = (uint8_t)(length + 4U);
+    header[2U] = CMD_P25_DATA;
+    header[3U] = 0x00U;
+
+    m_buffer.addData(header, 4U);
+    m_buffer.addData(frame, length);
+}
+
+/* Helper to add a DMR frame to the read buffer, as the modem would deliver it. */
+
+void ModemLoopbackPort::addDMRFrame(uint8_t slot, uint8_t control, uint8_t* frame, float ber)
+{
+    assert(frame != nullptr);
+
+    // leave the frame sync (bits 108 - 155) intact
+    applyBER(frame, 0U, 108U, ber);
+    applyBER(frame, 156U, DMRDEF::DMR_FRAME_LENGTH_BITS, ber);
+
+    uint8_t header[4U];
+    header[0U] = DVM_SHORT_FRAME_START;
+    header[1U] = (uint8_t)(DMRDEF::DMR_FRAME_LENGTH_BYTES + 4U);
+    header[2U] = (slot == 2U) ? CMD_DMR_DATA2 : CMD_DMR_DATA1;
+    header[3U] = control;
+
+    m_buffer.addData(header, 4U);
+    m_buffer.addData(frame, DMRDEF::DMR_FRAME_LENGTH_BYTES);
+}
+
+/* Helper to flip random bits of a frame. */
+
+void ModemLoopbackPort::applyBER(uint8_t* frame, uint32_t start, uint32_t stop, float ber)
+{
+    if (ber <= 0.0F)
+        return;
+
+    // step from error to error, instead of drawing a number for every bit
+    std::geometric_distribution<uint32_t> skip(std::min(ber, 100.0F) / 100.0F);
+    for (uint32_t i = start + skip(m_random); i < stop; i += 1U + skip(m_random)) {
+        WRITE_BIT(frame, i, !READ_BIT(frame, i));
+    }
+}
+
+/* Helper to match a transmitted P25 frame against the outstanding requests. */
+
+void ModemLoopbackPort::processP25TX(const uint8_t* frame, uint32_t length)
+{
+    using namespace p25::lc::tsbk;
+
+    if (length < P25_TDU_FRAME_LENGTH_BYTES)
+        return;
+
+    hostTransmitting();
+    m_txFrames++;
+
+    if (!m_nid.decode(frame))
+        return;
+
+    DUID::E duid = m_nid.getDUID();
+    switch (duid) {
+    case DUID::HDU:
+    case DUID::LDU1:
+        if (!m_txVoice && m_running && m_script[m_stepNo].traffic == LOOPBACK_P25_VOICE && !m_pendingFrames.empty()) {
+            account(m_pendingFrames.front(), true);
+            m_pendingFrames.pop_front();
+        }
+        m_txVoice = true;
+        return;
+    case DUID::TDU:
+    case DUID::TDULC:
+        m_txVoice = false;
+        return;
+    case DUID::PDU:
+        if (m_running && m_script[m_stepNo].traffic == LOOPBACK_P25_PDU && !m_pendingFrames.empty()) {
+            account(m_pendingFrames.front(), true);
+            m_pendingFrames.pop_front();
+        }
+        return;
+    case DUID::TSDU:
+        break;
+    default:
+        return;
+    }
+
+    if (m_pending.empty())
+        return;
+
+    uint32_t stop = (length >= P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES) ? 720U : 318U;
+    uint32_t blocks = (length >= P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES) ? 3U : 1U;
+
+    uint8_t tsdu[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES];
+    ::memset(tsdu, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
+    p25::P25Utils::decode(frame, tsdu, 114U, stop);
+
+    edac::Trellis trellis = edac::Trellis();
+    for (uint32_t i = 0U; i < blocks; i++) {
+        uint8_t raw[P25_TSBK_FEC_LENGTH_BYTES];
+        ::memset(raw, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+        Utils::getBitRange(tsdu, raw, i * P25_TSBK_FEC_LENGTH_BITS, P25_TSBK_FEC_LENGTH_BITS);
+
+        uint8_t tsbk[P25_TSBK_LENGTH_BYTES];
+        ::memset(tsbk, 0x00U, P25_TSBK_LENGTH_BYTES);
+        try {
+            if (!trellis.decode12(raw, tsbk))
+                break;
+        }
+        catch (...) {
+            break;
+        }
+
+        if (!edac::CRC::checkCCITT162(tsbk, P25_TSBK_LENGTH_BYTES))
+            break;
+
+        // only the responses to scripted requests are decoded, the broadcasts are skipped
+        uint8_t lco = tsbk[0U] & 0x3FU;
+        if (tsbk[1U] == MFG_STANDARD) {
+            switch (lco) {
+            case TSBKO::IOSP_U_REG:
+            {
+                IOSP_U_REG osp = IOSP_U_REG();
+                if (osp.decode(tsbk, true))
+                    respond(osp.getSrcId(), osp.getDstId(), true);
+            }
+            break;
+            case TSBKO::IOSP_GRP_AFF:
+            {
+                IOSP_GRP_AFF osp = IOSP_GRP_AFF();
+                if (osp.decode(tsbk, true))
+                    respond(osp.getSrcId(), osp.getDstId(), true);
+            }
+            break;
+            case TSBKO::IOSP_GRP_VCH:
+            {
+                IOSP_GRP_VCH osp = IOSP_GRP_VCH();
+                if (osp.decode(tsbk, true))
+                    respond(osp.getSrcId(), osp.getDstId(), true);
+            }
+            break;
+            case TSBKO::OSP_DENY_RSP:
+            {
+                OSP_DENY_RSP osp = OSP_DENY_RSP();
+                if (osp.decode(tsbk, true))
+                    respond(osp.getSrcId(), osp.getDstId(), false);
+            }
+            break;
+            case TSBKO::OSP_QUE_RSP:
+            {
+                OSP_QUE_RSP osp = OSP_QUE_RSP();
+                if (osp.decode(tsbk, true))
+                    respond(osp.getSrcId(), osp.getDstId(), false);
+            }
+            break;
+            default:
+                break;
+            }
+        }
+
+        if ((tsbk[0U] & 0x80U) == 0x80U)
+            break;
+    }
+}
+
+/* Helper to match a transmitted DMR frame against the outstanding requests. */
+
+void ModemLoopbackPort::processDMRTX(const uint8_t* frame)
+{
+    using namespace dmr::defines;
+
+    hostTransmitting();
+    m_txFrames++;
+
+    if (m_pending.empty())
+        return;
+
+    // only data frames carry CSBKs; the modem command carries no frame type on transmit
+    bool dataSync = true;
+    for (uint32_t i = 0U; i < 7U; i++) {
+        uint8_t sync = frame[i + 13U] & SYNC_MASK[i];
+        if (sync != BS_SOURCED_DATA_SYNC[i] && sync != MS_SOURCED_DATA_SYNC[i]) {
+            dataSync = false;
+            break;
+        }
+    }
+
+    if (!dataSync)
+        return;
+
+    dmr::SlotType slotType;
+    slotType.decode(frame);
+    if (slotType.getDataType() != DataType::CSBK)
+        return;
+
+    std::unique_ptr<dmr::lc::CSBK> csbk = dmr::lc::csbk::CSBKFactory::createCSBK(frame, DataType::CSBK);
+    if (csbk == nullptr)
+        return;
+
+    LOOPBACK_TRAFFIC traffic = m_script[m_stepNo].traffic;
+    switch (csbk->getCSBKO()) {
+    case CSBKO::ACK_RSP:
+        // for a voice call request this is only the "wait" response
+        if (traffic == LOOPBACK_DMR_REG)
+            respond(csbk->getSrcId(), csbk->getDstId(), true);
+        break;
+    case CSBKO::NACK_RSP:
+        respond(csbk->getSrcId(), csbk->getDstId(), false);
+        break;
+    case CSBKO::TV_GRANT:
+    case CSBKO::BTV_GRANT:
+        respond(csbk->getSrcId(), csbk->getDstId(), true);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Helper to account the response to an outstanding request. */
+
+void ModemLoopbackPort::respond(uint32_t srcId, uint32_t dstId, bool accepted)
+{
+    auto it = m_pending.find(srcId);
+    if (it == m_pending.end()) {
+        it = m_pending.find(dstId);
+        if (it == m_pending.end())
+            return;
+    }
+
+    account(it->second, accepted);
+    m_pending.erase(it);
+}
+
+/* Helper to account a response latency. */
+
+void ModemLoopbackPort::account(uint64_t injected, bool accepted)
+{
+    uint64_t now = EventLoop::now();
+    uint64_t latency = (now > injected) ? now - injected : 0U;
+
+    m_responses++;
+    if (accepted)
+        m_accepted++;
+
+    m_latencySum += latency;
+    if (latency > m_latencyMax)
+        m_latencyMax = latency;
+}
+
+/* Helper to start the script shortly after the host first transmits. */
+
+void ModemLoopbackPort::hostTransmitting()
+{
+    if (m_started || !m_running)
+        return;
+
+    uint64_t startTime = EventLoop::now() + LOOPBACK_START_DELAY_US;
+    if (startTime < m_startTime)
+        m_startTime = startTime;
+}
+
+/* Helper to start the given script step. */
+
+void ModemLoopbackPort::startStep(uint32_t stepNo, uint64_t now)
+{
+    LoopbackStep& step = m_script[stepNo];
+    if (step.rate == 0U)
+        step.rate = 1U;
+    if (step.pduBlocks == 0U)
+        step.pduBlocks = 1U;
+    if (step.pduBlocks > LOOPBACK_MAX_PDU_BLOCKS)
+        step.pduBlocks = LOOPBACK_MAX_PDU_BLOCKS;
+
+    m_stepNo = stepNo;
+    m_injected = 0U;
+    m_nextDue = now;
+    m_stepStart = now;
+    m_lastReport = now;
+
+    m_callFrames = std::max(step.callLength / 180U, 2U);
+    m_callFrameNo = 0U;
+
+    m_pending.clear();
+    m_pendingFrames.clear();
+
+    m_responses = 0U;
+    m_accepted = 0U;
+    m_latencySum = 0U;
+    m_latencyMax = 0U;
+    m_txFrames = 0U;
+
+    LogMessage(LOG_MODEM, "Loopback, step %u, %s, count = %u, rate = %u/s, srcId = %u, dstId = %u, ber = %.2f%%",
+        stepNo + 1U, trafficName(step.traffic).c_str(), step.count, step.rate, step.srcId, step.dstId, step.ber);
+}
+
+/* Helper to log the statistics of the current script step. */
+
+void ModemLoopbackPort::report(uint64_t now, bool final)
+{
+    const LoopbackStep& step = m_script[m_stepNo];
+
+    float seconds = (now > m_stepStart) ? float(now - m_stepStart) / 1000000.0F : 0.0F;
+    float rate = (seconds > 0.0F) ? float(m_responses) / seconds : 0.0F;
+    float avgMs = (m_responses > 0U) ? float(m_latencySum) / float(m_responses) / 1000.0F : 0.0F;
+    float maxMs = float(m_latencyMax) / 1000.0F;
+
+    LogMessage(LOG_MODEM, "Loopback, step %u, %s%s, injected = %u, responses = %u, accepted = %u, unanswered = %u, %.1f responses/s, latency avg = %.2fms, max = %.2fms, txFrames = %u",
+        m_stepNo + 1U, trafficName(step.traffic).c_str(), final ? " complete" : "", m_injected, m_responses, m_accepted,
+        (m_injected > m_responses) ? m_injected - m_responses : 0U, rate, avgMs, maxMs, m_txFrames);
+}
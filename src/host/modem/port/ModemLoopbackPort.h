@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file ModemLoopbackPort.h
+ * @ingroup port
+ * @file ModemLoopbackPort.cpp
+ * @ingroup port
+ */
+#if !defined(__MODEM_LOOPBACK_PORT_H__)
+#define __MODEM_LOOPBACK_PORT_H__
+
+#include "Defines.h"
+#include "common/p25/Audio.h"
+#include "common/p25/NID.h"
+#include "modem/port/ModemNullPort.h"
+
+#include <deque>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace modem
+{
+    namespace port
+    {
+        // ---------------------------------------------------------------------------
+        //  Constants
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Scripted air interface traffic injected by the loopback modem port.
+         * @ingroup port
+         */
+        enum LOOPBACK_TRAFFIC {
+            LOOPBACK_P25_REG,                   //! P25 Unit Registration Requests
+            LOOPBACK_P25_AFF,                   //! P25 Group Affiliation Requests
+            LOOPBACK_P25_GRANT,                 //! P25 Group Voice Channel Requests
+            LOOPBACK_P25_VOICE,                 //! P25 Group Voice Calls
+            LOOPBACK_P25_PDU,                   //! P25 Unconfirmed Data PDUs
+            LOOPBACK_DMR_REG,                   //! DMR Registration Random Access CSBKs
+            LOOPBACK_DMR_GRANT                  //! DMR Group Voice Call Random Access CSBKs
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Structure Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Represents a step of the loopback modem traffic script.
+         * @ingroup port
+         */
+        struct LoopbackStep {
+            LOOPBACK_TRAFFIC traffic;           //! Traffic Type
+            uint32_t count;                     //! Number of Requests (or Calls); each from the next source ID
+            uint32_t rate;                      //! Requests per Second (ignored for voice calls)
+            uint32_t srcId;                     //! First Source Radio ID
+            uint32_t dstId;                     //! Talkgroup (or Destination) ID
+            uint8_t slot;                       //! DMR Slot
+            float ber;                          //! Bit Error Rate (%) of Injected Frames
+            uint32_t callLength;                //! Voice Call Length (ms)
+            uint32_t pduBlocks;                 //! Number of Data Blocks per PDU
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief This class implements a "loopback" modem port, which injects scripted air interface
+         *  traffic at frame cadence and consumes the transmitted frames.
+         *
+         *  Each request (or call) injected by a script step is matched against the host's response on the
+         *  transmit side; the turnaround latency and response rate are logged per step. This allows the
+         *  protocol engines to be benchmarked without modem hardware.
+         * @ingroup port
+         */
+        class HOST_SW_API ModemLoopbackPort : public ModemNullPort {
+        public:
+            /**
+             * @brief Initializes a new instance of the ModemLoopbackPort class.
+             * @param p25NAC P25 Network Access Code.
+             * @param dmrColorCode DMR Color Code.
+             * @param script Steps of traffic to inject.
+             * @param repeat Flag indicating whether the script restarts once finished.
+             * @param reportInterval Interval between progress reports (in seconds).
+             */
+            ModemLoopbackPort(uint32_t p25NAC, uint32_t dmrColorCode, const std::vector<LoopbackStep>& script, bool repeat,
+                uint32_t reportInterval);
+            /**
+             * @brief Finalizes a instance of the ModemLoopbackPort class.
+             */
+            ~ModemLoopbackPort() override;
+
+            /**
+             * @brief Opens a connection to the port.
+             * @returns bool True, if connection is opened, otherwise false.
+             */
+            bool open() override;
+
+            /**
+             * @brief Reads data from the port.
+             * @param[out] buffer Buffer to read data from the port to.
+             * @param length Length of data to read from the port.
+             * @returns int Actual length of data read from serial port.
+             */
+            int read(uint8_t* buffer, uint32_t length) override;
+            /**
+             * @brief Writes data to the port.
+             * @param[in] buffer Buffer containing data to write to port.
+             * @param length Length of data to write to port.
+             * @returns int Actual length of data written to the port.
+             */
+            int write(const uint8_t* buffer, uint32_t length) override;
+
+            /**
+             * @brief Closes the connection to the port.
+             */
+            void close() override;
+
+            /**
+             * @brief Helper to convert a traffic type name to its value.
+             * @param name Traffic type name (e.g. "p25-reg").
+             * @param[out] traffic Traffic type.
+             * @returns bool True, if the name is a known traffic type, otherwise false.
+             */
+            static bool parseTraffic(const std::string& name, LOOPBACK_TRAFFIC& traffic);
+            /**
+             * @brief Helper to convert a traffic type to its name.
+             * @param traffic Traffic type.
+             * @returns std::string Traffic type name.
+             */
+            static std::string trafficName(LOOPBACK_TRAFFIC traffic);
+
+        private:
+            uint32_t m_dmrColorCode;
+            p25::NID m_nid;
+            p25::Audio m_audio;
+
+            std::vector<LoopbackStep> m_script;
+            bool m_repeat;
+            uint64_t m_reportInterval;
+
+            std::mt19937 m_random;
+
+            bool m_running;
+            bool m_started;
+            uint64_t m_startTime;
+            uint32_t m_stepNo;
+            uint32_t m_injected;
+            uint64_t m_nextDue;
+            uint64_t m_stepStart;
+            uint64_t m_lastReport;
+
+            uint32_t m_callFrames;
+            uint32_t m_callFrameNo;
+            bool m_txVoice;
+
+            std::unordered_map<uint32_t, uint64_t> m_pending;
+            std::deque<uint64_t> m_pendingFrames;
+
+            uint32_t m_responses;
+            uint32_t m_accepted;
+            uint64_t m_latencySum;
+            uint64_t m_latencyMax;
+            uint32_t m_txFrames;
+
+            /**
+             * @brief Helper to inject every scripted frame that is due.
+             * @param now Current time (in us).
+             */
+            void inject(uint64_t now);
+            /**
+             * @brief Helper to inject the next P25 request of the current step.
+             * @param step Current script step.
+             * @param srcId Source radio ID of the request.
+             */
+            void injectP25TSBK(const LoopbackStep& step, uint32_t srcId);
+            /**
+             * @brief Helper to inject the next frame of a P25 voice call.
+             * @param step Current script step.
+             * @param srcId Source radio ID of the call.
+             * @returns bool True, if the call is complete, otherwise false.
+             */
+            bool injectP25Voice(const LoopbackStep& step, uint32_t srcId);
+            /**
+             * @brief Helper to inject a P25 unconfirmed data PDU.
+             * @param step Current script step.
+             * @param srcId Source radio ID of the PDU.
+             */
+            void injectP25PDU(const LoopbackStep& step, uint32_t srcId);
+            /**
+             * @brief Helper to inject a DMR random access CSBK.
+             * @param step Current script step.
+             * @param srcId Source radio ID of the request.
+             */
+            void injectDMRCSBK(const LoopbackStep& step, uint32_t srcId);
+
+            /**
+             * @brief Helper to add a P25 frame to the read buffer, as the modem would deliver it.
+             * @param frame Air interface frame.
+             * @param length Length of frame (bytes).
+             * @param ber Bit error rate (%) to apply to the frame.
+             */
+            void addP25Frame(uint8_t* frame, uint32_t length, float ber);
+            /**
+             * @brief Helper to add a DMR frame to the read buffer, as the modem would deliver it.
+             * @param slot DMR slot.
+             * @param control Frame control byte (sync and data type).
+             * @param frame Air interface frame.
+             * @param ber Bit error rate (%) to apply to the frame.
+             */
+            void addDMRFrame(uint8_t slot, uint8_t control, uint8_t* frame, float ber);
+            /**
+             * @brief Helper to flip random bits of a frame.
+             * @param frame Air interface frame.
+             * @param start First bit which may be flipped.
+             * @param stop Bit after the last which may be flipped.
+             * @param ber Bit error rate (%).
+             */
+            void applyBER(uint8_t* frame, uint32_t start, uint32_t stop, float ber);
+
+            /**
+             * @brief Helper to match a transmitted P25 frame against the outstanding requests.
+             * @param frame Air interface frame.
+             * @param length Length of frame (bytes).
+             */
+            void processP25TX(const uint8_t* frame, uint32_t length);
+            /**
+             * @brief Helper to match a transmitted DMR frame against the outstanding requests.
+             * @param frame Air interface frame.
+             */
+            void processDMRTX(const uint8_t* frame);
+            /**
+             * @brief Helper to account the response to an outstanding request.
+             * @param srcId Source radio ID of the request answered.
+             * @param dstId Destination ID of the response (checked when the source ID is not outstanding).
+             * @param accepted Flag indicating whether the request was accepted (granted).
+             */
+            void respond(uint32_t srcId, uint32_t dstId, bool accepted);
+            /**
+             * @brief Helper to account a response latency.
+             * @param injected Time the answered request was injected (in us).
+             * @param accepted Flag indicating whether the request was accepted (granted).
+             */
+            void account(uint64_t injected, bool accepted);
+
+            /**
+             * @brief Helper to start the script shortly after the host first transmits.
+             */
+            void hostTransmitting();
+            /**
+             * @brief Helper to start the given script step.
+             * @param stepNo Script step.
+             * @param now Current time (in us).
+             */
+            void startStep(uint32_t stepNo, uint64_t now);
+            /**
+             * @brief Helper to log the statistics of the current script step.
+             * @param now Current time (in us).
+             * @param final Flag indicating the step is complete.
+             */
+            void report(uint64_t now, bool final);
+        };
+    } // namespace port
+} // namespace modem
+
+#endif // __MODEM_LOOPBACK_PORT_H__
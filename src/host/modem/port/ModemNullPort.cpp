@@ -26,8 +26,8 @@ const char* HARDWARE = "Null Modem Controller";
 
 /* Initializes a new instance of the ModemNullPort class. */
 
-ModemNullPort::ModemNullPort() :
-    m_buffer(200U, "Null Controller Buffer")
+ModemNullPort::ModemNullPort(uint32_t bufferLength) :
+    m_buffer(bufferLength, "Null Controller Buffer")
 {
     /* stub */
 }
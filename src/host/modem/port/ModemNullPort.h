@@ -39,8 +39,9 @@ namespace modem
         public:
             /**
              * @brief Initializes a new instance of the ModemNullPort class.
+             * @param bufferLength Length of the buffer holding replies waiting to be read (bytes).
              */
-            ModemNullPort();
+            ModemNullPort(uint32_t bufferLength = 200U);
             /**
              * @brief Finalizes a instance of the ModemNullPort class.
              */
@@ -72,7 +73,7 @@ namespace modem
              */
             void close() override;
 
-        private:
+        protected:
             RingBuffer<unsigned char> m_buffer;
 
             /**
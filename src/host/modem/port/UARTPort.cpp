@@ -234,6 +234,52 @@ int UARTPort::read(uint8_t* buffer, uint32_t length)
     return length;
 }
 
+/* Reads whatever data is immediately available from the serial port, in a single read. */
+
+int UARTPort::readAvailable(uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+
+    if (length == 0U)
+        return 0;
+
+#if defined(_WIN32)
+    assert(m_fd != INVALID_HANDLE_VALUE);
+
+    return readNonblock(buffer, length);
+#else
+    assert(m_fd != -1);
+
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(m_fd, &fds);
+
+    struct timeval tv;
+    tv.tv_sec = 0;
+    tv.tv_usec = 0;
+
+    int n = ::select(m_fd + 1, &fds, NULL, NULL, &tv);
+    if (n < 0) {
+        ::LogError(LOG_HOST, "Error from select(), errno=%d", errno);
+        return -1;
+    }
+
+    if (n == 0)
+        return 0;
+
+    ssize_t len = ::read(m_fd, buffer, length);
+    if (len < 0) {
+        if (errno == EAGAIN)
+            return 0;
+
+        ::LogError(LOG_HOST, "Error from read(), errno=%d", errno);
+        return -1;
+    }
+
+    return int(len);
+#endif // defined(_WIN32)
+}
+
 /* Writes data to the serial port. */
 
 int UARTPort::write(const uint8_t* buffer, uint32_t length)
@@ -312,6 +358,17 @@ void UARTPort::close()
     m_isOpen = false;
 }
 
+/* Gets the descriptor of the serial port (e.g. for readiness polling). */
+
+int UARTPort::getDescriptor() const
+{
+#if defined(_WIN32)
+    return -1;
+#else
+    return m_fd;
+#endif // defined(_WIN32)
+}
+
 #if defined(__APPLE__)
 /* Helper on Apple to set serial port to non-blocking. */
 
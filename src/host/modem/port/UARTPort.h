@@ -95,6 +95,13 @@ namespace modem
              * @returns int Actual length of data read from serial port.
              */
             int read(uint8_t* buffer, uint32_t length) override;
+            /**
+             * @brief Reads whatever data is immediately available from the serial port, in a single read.
+             * @param[out] buffer Buffer to read data from the port to.
+             * @param length Maximum length of data to read from the port.
+             * @returns int Actual length of data read from serial port (0 if none is available), or -1 on error.
+             */
+            int readAvailable(uint8_t* buffer, uint32_t length) override;
             /**
              * @brief Writes data to the serial port.
              * @param[in] buffer Buffer containing data to write to port.
@@ -108,6 +115,12 @@ namespace modem
              */
             void close() override;
 
+            /**
+             * @brief Gets the descriptor of the serial port (e.g. for readiness polling).
+             * @returns int Port descriptor, or -1 if the port is not open (or on Windows).
+             */
+            int getDescriptor() const override;
+
 #if defined(__APPLE__)
             /**
              * @brief Helper on Apple to set serial port to non-blocking.
@@ -34,7 +34,7 @@ UDPPort::UDPPort(const std::string& address, uint16_t modemPort) :
     m_socket(modemPort),
     m_addr(),
     m_addrLen(0U),
-    m_buffer(2000U, "UDP Port Ring Buffer")
+    m_buffer(BUFFER_LENGTH * 4U, "UDP Port Ring Buffer")
 {
     assert(!address.empty());
     assert(modemPort > 0U);
@@ -71,26 +71,40 @@ int UDPPort::read(uint8_t* buffer, uint32_t length)
     assert(buffer != nullptr);
     assert(length > 0U);
 
-    uint8_t data[BUFFER_LENGTH];
-    ::memset(data, 0x00U, BUFFER_LENGTH);
-
-    sockaddr_storage addr;
-    uint32_t addrLen;
-    int ret = m_socket.read(data, BUFFER_LENGTH, addr, addrLen);
+    int ret = receive();
 
     // An error occurred on the socket
     if (ret < 0)
         return ret;
 
-    // Add new data to the ring buffer
-    if (ret > 0) {
-        if (udp::Socket::match(addr, m_addr)) {
-            m_buffer.addData(data, ret);
-        }
-        else {
-            std::string addrStr = udp::Socket::address(addr);
-            LogWarning(LOG_HOST, "SECURITY: Remote modem mode encountered invalid IP address; %s", addrStr.c_str());
-        }
+    // Get required data from the ring buffer
+    uint32_t avail = m_buffer.dataSize();
+    if (avail < length)
+        length = avail;
+
+    if (length > 0U)
+        m_buffer.get(buffer, length);
+
+    return int(length);
+}
+
+/* Reads whatever data is immediately available from the port, draining every waiting datagram. */
+
+int UDPPort::readAvailable(uint8_t* buffer, uint32_t length)
+{
+    assert(buffer != nullptr);
+    assert(length > 0U);
+
+    // pull in datagrams until the socket is empty, or there is no longer room for a full one
+    while (m_buffer.freeSpace() >= BUFFER_LENGTH) {
+        int ret = receive();
+
+        // An error occurred on the socket
+        if (ret < 0)
+            return ret;
+
+        if (ret == 0)
+            break;
     }
 
     // Get required data from the ring buffer
@@ -120,3 +134,39 @@ void UDPPort::close()
 {
     m_socket.close();
 }
+
+/* Gets the descriptor of the UDP socket (e.g. for readiness polling). */
+
+int UDPPort::getDescriptor() const
+{
+    return m_socket.getDescriptor();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to read a single datagram from the socket into the ring buffer. */
+
+int UDPPort::receive()
+{
+    uint8_t data[BUFFER_LENGTH];
+    ::memset(data, 0x00U, BUFFER_LENGTH);
+
+    sockaddr_storage addr;
+    uint32_t addrLen;
+    int ret = m_socket.read(data, BUFFER_LENGTH, addr, addrLen);
+    if (ret <= 0)
+        return ret;
+
+    // Add new data to the ring buffer
+    if (udp::Socket::match(addr, m_addr)) {
+        m_buffer.addData(data, ret);
+    }
+    else {
+        std::string addrStr = udp::Socket::address(addr);
+        LogWarning(LOG_HOST, "SECURITY: Remote modem mode encountered invalid IP address; %s", addrStr.c_str());
+    }
+
+    return ret;
+}
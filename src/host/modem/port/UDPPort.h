@@ -62,6 +62,13 @@ namespace modem
              * @returns int Actual length of data read from serial port.
              */
             int read(uint8_t* buffer, uint32_t length) override;
+            /**
+             * @brief Reads whatever data is immediately available from the port, draining every waiting datagram.
+             * @param[out] buffer Buffer to read data from the port to.
+             * @param length Maximum length of data to read from the port.
+             * @returns int Actual length of data read from the port (0 if none is available), or less than 0 on error.
+             */
+            int readAvailable(uint8_t* buffer, uint32_t length) override;
             /**
              * @brief Writes data to the serial port.
              * @param[in] buffer Buffer containing data to write to port.
@@ -75,6 +82,12 @@ namespace modem
              */
             void close() override;
 
+            /**
+             * @brief Gets the descriptor of the UDP socket (e.g. for readiness polling).
+             * @returns int Socket descriptor, or -1 if the socket is not open.
+             */
+            int getDescriptor() const override;
+
         protected:
             network::udp::Socket m_socket;
 
@@ -82,6 +95,13 @@ namespace modem
             uint32_t m_addrLen;
 
             RingBuffer<uint8_t> m_buffer;
+
+        private:
+            /**
+             * @brief Helper to read a single datagram from the socket into the ring buffer.
+             * @returns int Length of the datagram read (0 if none is waiting), or less than 0 on error.
+             */
+            int receive();
         };
     } // namespace port
 } // namespace modem
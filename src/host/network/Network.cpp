@@ -53,6 +53,9 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     m_salt(nullptr),
     m_retryTimer(1000U, 10U),
     m_timeoutTimer(1000U, 60U),
+    m_rxDMRJitter(),
+    m_rxP25Jitter(nullptr),
+    m_rxNXDNJitter(nullptr),
     m_pktSeq(0U),
     m_loginStreamId(0U),
     m_identity(),
@@ -92,6 +95,15 @@ Network::~Network()
 {
     delete[] m_salt;
     delete[] m_rxDMRStreamId;
+
+    for (uint32_t i = 0U; i < 2U; i++) {
+        if (m_rxDMRJitter[i] != nullptr)
+            delete m_rxDMRJitter[i];
+    }
+    if (m_rxP25Jitter != nullptr)
+        delete m_rxP25Jitter;
+    if (m_rxNXDNJitter != nullptr)
+        delete m_rxNXDNJitter;
 }
 
 /* Resets the DMR ring buffer for the given slot. */
@@ -107,6 +119,9 @@ void Network::resetDMR(uint32_t slotNo)
     else {
         m_rxDMRStreamId[1U] = 0U;
     }
+
+    if (m_rxDMRJitter[slotNo - 1U] != nullptr)
+        m_rxDMRJitter[slotNo - 1U]->reset();
 }
 
 /* Resets the P25 ring buffer. */
@@ -115,6 +130,9 @@ void Network::resetP25()
 {
     BaseNetwork::resetP25();
     m_rxP25StreamId = 0U;
+
+    if (m_rxP25Jitter != nullptr)
+        m_rxP25Jitter->reset();
 }
 
 /* Resets the NXDN ring buffer. */
@@ -123,6 +141,9 @@ void Network::resetNXDN()
 {
     BaseNetwork::resetNXDN();
     m_rxNXDNStreamId = 0U;
+
+    if (m_rxNXDNJitter != nullptr)
+        m_rxNXDNJitter->reset();
 }
 
 /* Sets the instances of the Radio ID and Talkgroup ID lookup tables. */
@@ -169,6 +190,34 @@ void Network::setPresharedKey(const uint8_t* presharedKey)
     m_socket->setPresharedKey(presharedKey);
 }
 
+/* Enables the adaptive jitter buffer for received DMR, P25 and NXDN frames. */
+
+void Network::setJitterBuffer(uint32_t minDelay, uint32_t maxDelay)
+{
+    if (m_dmrEnabled) {
+        m_rxDMRJitter[0U] = new FrameJitterBuffer("DMR Slot 1", minDelay, maxDelay);
+        m_rxDMRJitter[1U] = new FrameJitterBuffer("DMR Slot 2", minDelay, maxDelay);
+    }
+
+    if (m_p25Enabled)
+        m_rxP25Jitter = new FrameJitterBuffer("P25", minDelay, maxDelay);
+    if (m_nxdnEnabled)
+        m_rxNXDNJitter = new FrameJitterBuffer("NXDN", minDelay, maxDelay);
+}
+
+/* Gets the jitter buffers for received protocol frames. */
+
+std::vector<FrameJitterBuffer*> Network::jitterBuffers() const
+{
+    std::vector<FrameJitterBuffer*> buffers = std::vector<FrameJitterBuffer*>();
+    for (FrameJitterBuffer* buffer : { m_rxDMRJitter[0U], m_rxDMRJitter[1U], m_rxP25Jitter, m_rxNXDNJitter }) {
+        if (buffer != nullptr)
+            buffers.push_back(buffer);
+    }
+
+    return buffers;
+}
+
 /* Updates the timer by the passed number of milliseconds. */
 
 void Network::clock(uint32_t ms)
@@ -203,6 +252,9 @@ void Network::clock(uint32_t ms)
 
     uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
+    // hand over any held frames that are now due for playout
+    releaseJitterFrames(now);
+
     // roll the RTP timestamp if no call is in progress
     if ((m_status == NET_STAT_RUNNING) &&
         (m_rxDMRStreamId[0U] == 0U && m_rxDMRStreamId[1U] == 0U) &&
@@ -284,9 +336,15 @@ void Network::clock(uint32_t ms)
                         if (length > 255)
                             LogError(LOG_NET, "DMR Stream %u, frame oversized? this shouldn't happen, pktSeq = %u, len = %u", streamId, m_pktSeq, length);
 
-                        uint8_t len = length;
-                        m_rxDMRData.addData(&len, 1U);
-                        m_rxDMRData.addData(buffer.get(), len);
+                        if (m_rxDMRJitter[slotNo - 1U] != nullptr) {
+                            m_rxDMRJitter[slotNo - 1U]->addFrame(streamId, rtpHeader.getSequence(), buffer.get(), length, now);
+                            releaseJitterFrames(now);
+                        }
+                        else {
+                            uint8_t len = length;
+                            m_rxDMRData.addData(&len, 1U);
+                            m_rxDMRData.addData(buffer.get(), len);
+                        }
                     }
                 }
                 else if (fneHeader.getSubFunction() == NET_SUBFUNC::PROTOCOL_SUBFUNC_P25) {         // Encapsulated P25 data frame
@@ -312,9 +370,15 @@ void Network::clock(uint32_t ms)
                         if (length > 255)
                             LogError(LOG_NET, "P25 Stream %u, frame oversized? this shouldn't happen, pktSeq = %u, len = %u", streamId, m_pktSeq, length);
 
-                        uint8_t len = length;
-                        m_rxP25Data.addData(&len, 1U);
-                        m_rxP25Data.addData(buffer.get(), len);
+                        if (m_rxP25Jitter != nullptr) {
+                            m_rxP25Jitter->addFrame(streamId, rtpHeader.getSequence(), buffer.get(), length, now);
+                            releaseJitterFrames(now);
+                        }
+                        else {
+                            uint8_t len = length;
+                            m_rxP25Data.addData(&len, 1U);
+                            m_rxP25Data.addData(buffer.get(), len);
+                        }
                     }
                 }
                 else if (fneHeader.getSubFunction() == NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN) {        // Encapsulated NXDN data frame
@@ -340,9 +404,15 @@ void Network::clock(uint32_t ms)
                         if (length > 255)
                             LogError(LOG_NET, "NXDN Stream %u, frame oversized? this shouldn't happen, pktSeq = %u, len = %u", streamId, m_pktSeq, length);
 
-                        uint8_t len = length;
-                        m_rxNXDNData.addData(&len, 1U);
-                        m_rxNXDNData.addData(buffer.get(), len);
+                        if (m_rxNXDNJitter != nullptr) {
+                            m_rxNXDNJitter->addFrame(streamId, rtpHeader.getSequence(), buffer.get(), length, now);
+                            releaseJitterFrames(now);
+                        }
+                        else {
+                            uint8_t len = length;
+                            m_rxNXDNData.addData(&len, 1U);
+                            m_rxNXDNData.addData(buffer.get(), len);
+                        }
                     }
                 }
                 else {
@@ -713,6 +783,41 @@ void Network::enable(bool enabled)
 //  Protected Class Members
 // ---------------------------------------------------------------------------
 
+/* Helper to move the received protocol frames due for playout from the jitter buffers to the protocol ring buffers. */
+
+void Network::releaseJitterFrames(uint64_t now)
+{
+    uint8_t buffer[JITTER_BUFFER_FRAME_LEN];
+    uint32_t length = 0U;
+
+    for (uint32_t i = 0U; i < 2U; i++) {
+        if (m_rxDMRJitter[i] == nullptr)
+            continue;
+
+        while (m_rxDMRJitter[i]->getFrame(now, buffer, length)) {
+            uint8_t len = length;
+            m_rxDMRData.addData(&len, 1U);
+            m_rxDMRData.addData(buffer, len);
+        }
+    }
+
+    if (m_rxP25Jitter != nullptr) {
+        while (m_rxP25Jitter->getFrame(now, buffer, length)) {
+            uint8_t len = length;
+            m_rxP25Data.addData(&len, 1U);
+            m_rxP25Data.addData(buffer, len);
+        }
+    }
+
+    if (m_rxNXDNJitter != nullptr) {
+        while (m_rxNXDNJitter->getFrame(now, buffer, length)) {
+            uint8_t len = length;
+            m_rxNXDNData.addData(&len, 1U);
+            m_rxNXDNData.addData(buffer, len);
+        }
+    }
+}
+
 /* User overrideable handler that allows user code to process network packets not handled by this class. */
 
 void Network::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, uint32_t streamId)
@@ -27,11 +27,13 @@
 
 #include "Defines.h"
 #include "common/network/BaseNetwork.h"
+#include "common/network/FrameJitterBuffer.h"
 #include "common/lookups/RadioIdLookup.h"
 #include "common/lookups/TalkgroupRulesLookup.h"
 
 #include <string>
 #include <cstdint>
+#include <vector>
 
 namespace network
 {
@@ -123,6 +125,19 @@ namespace network
          * @param presharedKey Encryption preshared key for networking.
          */
         void setPresharedKey(const uint8_t* presharedKey);
+        /**
+         * @brief Enables the adaptive jitter buffer for received DMR, P25 and NXDN frames.
+         *  Received frames are reordered by RTP sequence and held for a playout delay sized from the
+         *  measured network jitter, per stream, before they are made available to the protocol.
+         * @param minDelay Minimum playout delay (in milliseconds).
+         * @param maxDelay Maximum playout delay (in milliseconds).
+         */
+        void setJitterBuffer(uint32_t minDelay, uint32_t maxDelay);
+        /**
+         * @brief Gets the jitter buffers for received protocol frames.
+         * @returns std::vector<FrameJitterBuffer*> List of jitter buffers (empty if the jitter buffer is disabled).
+         */
+        std::vector<FrameJitterBuffer*> jitterBuffers() const;
 
         /**
          * @brief Updates the timer by the passed number of milliseconds.
@@ -185,6 +200,10 @@ namespace network
         uint32_t m_rxP25StreamId;
         uint32_t m_rxNXDNStreamId;
 
+        FrameJitterBuffer* m_rxDMRJitter[2U];
+        FrameJitterBuffer* m_rxP25Jitter;
+        FrameJitterBuffer* m_rxNXDNJitter;
+
         uint16_t m_pktSeq;
         uint32_t m_loginStreamId;
 
@@ -224,6 +243,13 @@ namespace network
         virtual void userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opcode, const uint8_t* data = nullptr, uint32_t length = 0U,
             uint32_t streamId = 0U);
 
+        /**
+         * @brief Helper to move the received protocol frames due for playout from the jitter buffers
+         *  to the protocol ring buffers.
+         * @param now Current time (in milliseconds).
+         */
+        void releaseJitterFrames(uint64_t now);
+
         /**
          * @brief Writes login request to the network.
          * @returns bool True, if login request was sent, otherwise false.
@@ -258,6 +258,8 @@ void RESTAPI::close()
 
 void RESTAPI::entry()
 {
+    Thread::applyGroupSchedule(THREAD_GROUP_REST);
+
 #if defined(ENABLE_TCP_SSL)
     if (m_enableSSL) {
         m_restSecureServer.run();
@@ -117,6 +117,9 @@ using namespace nxdn::packet;
 
 const uint32_t GRANT_TIMER_TIMEOUT = 15U;
 
+const uint32_t BCAST_KEY_SITE_INFO = 1U;
+const uint32_t BCAST_KEY_SRV_INFO = 2U;
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -150,7 +153,7 @@ bool ControlSignaling::process(FuncChannelType::E fct, ChOption::E option, uint8
     uint8_t buffer[NXDN_FRAME_LENGTH_BYTES];
     cac.getData(buffer);
 
-    std::unique_ptr<RCCH> rcch = rcch::RCCHFactory::createRCCH(buffer, NXDN_RCCH_CAC_LC_SHORT_LENGTH_BITS);
+    RCCH* rcch = rcch::RCCHFactory::decodeRCCH(buffer, NXDN_RCCH_CAC_LC_SHORT_LENGTH_BITS);
     if (rcch == nullptr)
         return false;
 
@@ -237,7 +240,7 @@ bool ControlSignaling::processNetwork(FuncChannelType::E fct, ChOption::E option
     }
 
     if (m_nxdn->m_netState == RS_NET_IDLE) {
-        std::unique_ptr<lc::RCCH> rcch = RCCHFactory::createRCCH(data, len);
+        lc::RCCH* rcch = RCCHFactory::decodeRCCH(data, len);
         if (rcch == nullptr) {
             return false;
         }
@@ -272,7 +275,7 @@ bool ControlSignaling::processNetwork(FuncChannelType::E fct, ChOption::E option
                 return false;
         } // switch (rcch->getMessageType())
 
-        writeRF_Message(rcch.get(), true);
+        writeRF_Message(rcch, true);
     }
 
     return true;
@@ -291,6 +294,7 @@ ControlSignaling::ControlSignaling(Control* nxdn, bool debug, bool verbose) :
     m_ccchPagingCnt(2U),
     m_ccchMultiCnt(2U),
     m_rcchIterateCnt(2U),
+    m_bcastCache(),
     m_verifyAff(false),
     m_verifyReg(false),
     m_disableGrantSrcIdCheck(false),
@@ -733,6 +737,9 @@ void ControlSignaling::writeRF_Message_U_Reg_Rsp(uint32_t srcId, uint32_t locId)
 
 void ControlSignaling::writeRF_CC_Message_Site_Info()
 {
+    if (writeRF_CC_Bcast(BCAST_KEY_SITE_INFO))
+        return;
+
     uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
     ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
@@ -772,6 +779,8 @@ void ControlSignaling::writeRF_CC_Message_Site_Info()
     NXDNUtils::scrambler(data + 2U);
     NXDNUtils::addPostBits(data + 2U);
 
+    m_bcastCache.add(lc::RCCH::getSiteDataVersion(), BCAST_KEY_SITE_INFO, data + 2U);
+
     if (m_nxdn->m_duplex) {
         m_nxdn->addFrame(data);
     }
@@ -781,6 +790,9 @@ void ControlSignaling::writeRF_CC_Message_Site_Info()
 
 void ControlSignaling::writeRF_CC_Message_Service_Info()
 {
+    if (writeRF_CC_Bcast(BCAST_KEY_SRV_INFO))
+        return;
+
     uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
     ::memset(data + 2U, 0x00U, NXDN_FRAME_LENGTH_BYTES);
 
@@ -815,7 +827,31 @@ void ControlSignaling::writeRF_CC_Message_Service_Info()
     NXDNUtils::scrambler(data + 2U);
     NXDNUtils::addPostBits(data + 2U);
 
+    m_bcastCache.add(lc::RCCH::getSiteDataVersion(), BCAST_KEY_SRV_INFO, data + 2U);
+
     if (m_nxdn->m_duplex) {
         m_nxdn->addFrame(data);
     }
 }
+
+/* Helper to write a pre-encoded CC broadcast packet from the broadcast cache. */
+
+bool ControlSignaling::writeRF_CC_Bcast(uint32_t bcastKey)
+{
+    // the site and service information only change with the site data; they are encoded once per change
+    const uint8_t* frame = m_bcastCache.find(lc::RCCH::getSiteDataVersion(), bcastKey);
+    if (frame == nullptr)
+        return false;
+
+    uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
+    ::memcpy(data + 2U, frame, NXDN_FRAME_LENGTH_BYTES);
+
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
+
+    if (m_nxdn->m_duplex) {
+        m_nxdn->addFrame(data);
+    }
+
+    return true;
+}
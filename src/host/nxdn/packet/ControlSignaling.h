@@ -18,6 +18,7 @@
 
 #include "Defines.h"
 #include "common/nxdn/lc/RCCH.h"
+#include "common/BroadcastCache.h"
 #include "nxdn/Control.h"
 
 #include <cstdio>
@@ -79,6 +80,8 @@ namespace nxdn
             uint8_t m_ccchMultiCnt;
             uint8_t m_rcchIterateCnt;
 
+            BroadcastCache<defines::NXDN_FRAME_LENGTH_BYTES> m_bcastCache;
+
             bool m_verifyAff;
             bool m_verifyReg;
 
@@ -180,6 +183,12 @@ namespace nxdn
              * @brief Helper to write a CC SRV_INFO broadcast packet on the RF interface.
              */
             void writeRF_CC_Message_Service_Info();
+            /**
+             * @brief Helper to write a pre-encoded CC broadcast packet from the broadcast cache.
+             * @param bcastKey Key of the encoded broadcast frame.
+             * @returns bool True, if the broadcast was cached (and written), otherwise false.
+             */
+            bool writeRF_CC_Bcast(uint32_t bcastKey);
         };
     } // namespace packet
 } // namespace nxdn
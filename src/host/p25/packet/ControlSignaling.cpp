@@ -159,7 +159,7 @@ const uint8_t CONV_FALLBACK_PACKET_DELAY = 8U;
 
 /* Process a data frame from the RF interface. */
 
-bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::TSBK> preDecodedTSBK)
+bool ControlSignaling::process(uint8_t* data, uint32_t len, lc::TSBK* preDecodedTSBK)
 {
     assert(data != nullptr);
 
@@ -180,7 +180,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
     }
 
     RPT_RF_STATE prevRfState = m_p25->m_rfState;
-    std::unique_ptr<lc::TSBK> tsbk;
+    lc::TSBK* tsbk = nullptr;
 
     // handle individual DUIDs
     if (duid == DUID::TSDU) {
@@ -191,14 +191,14 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
         }
 
         if (preDecodedTSBK == nullptr) {
-            tsbk = TSBKFactory::createTSBK(data + 2U);
+            tsbk = TSBKFactory::decodeTSBK(data + 2U);
             if (tsbk == nullptr) {
                 LogWarning(LOG_RF, P25_TSDU_STR ", undecodable LC");
                 m_p25->m_rfState = prevRfState;
                 return false;
             }
         } else {
-            tsbk = std::move(preDecodedTSBK);
+            tsbk = preDecodedTSBK;
         }
 
         const uint32_t constValue = 0x17DC0U;
@@ -284,7 +284,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the target RID
                 VALID_DSTID(tsbk->toString(true), TSBKO::IOSP_UU_ANS, srcId, dstId);
 
-                IOSP_UU_ANS* iosp = static_cast<IOSP_UU_ANS*>(tsbk.get());
+                IOSP_UU_ANS* iosp = static_cast<IOSP_UU_ANS*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, response = $%02X, srcId = %u, dstId = %u",
                         tsbk->toString(true).c_str(), iosp->getResponse(), srcId, dstId);
@@ -329,7 +329,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the source RID
                 VALID_SRCID(tsbk->toString(true), TSBKO::ISP_SNDCP_CH_REQ, srcId);
 
-                ISP_SNDCP_CH_REQ* isp = static_cast<ISP_SNDCP_CH_REQ*>(tsbk.get());
+                ISP_SNDCP_CH_REQ* isp = static_cast<ISP_SNDCP_CH_REQ*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, dataServiceOptions = $%02X, dataAccessControl = $%04X, srcId = %u",
                         tsbk->toString(true).c_str(), isp->getDataServiceOptions(), isp->getDataAccessControl(), srcId);
@@ -351,7 +351,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the source RID
                 VALID_SRCID(tsbk->toString(true), TSBKO::ISP_SNDCP_CH_REQ, srcId);
 
-                ISP_SNDCP_CH_REQ* isp = static_cast<ISP_SNDCP_CH_REQ*>(tsbk.get());
+                ISP_SNDCP_CH_REQ* isp = static_cast<ISP_SNDCP_CH_REQ*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, dataServiceOptions = $%02X, dataAccessControl = %u, srcId = %u",
                         tsbk->toString(true).c_str(), isp->getDataServiceOptions(), isp->getDataAccessControl(), srcId);
@@ -370,7 +370,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the source RID
                 VALID_SRCID(tsbk->toString(true), TSBKO::IOSP_STS_UPDT, srcId);
 
-                IOSP_STS_UPDT* iosp = static_cast<IOSP_STS_UPDT*>(tsbk.get());
+                IOSP_STS_UPDT* iosp = static_cast<IOSP_STS_UPDT*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, status = $%02X, srcId = %u", 
                         tsbk->toString(true).c_str(), iosp->getStatus(), srcId);
@@ -390,7 +390,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the source RID
                 VALID_SRCID(tsbk->toString(true), TSBKO::IOSP_MSG_UPDT, srcId);
 
-                IOSP_MSG_UPDT* iosp = static_cast<IOSP_MSG_UPDT*>(tsbk.get());
+                IOSP_MSG_UPDT* iosp = static_cast<IOSP_MSG_UPDT*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, message = $%02X, srcId = %u, dstId = %u",
                         tsbk->toString(true).c_str(), iosp->getMessage(), srcId, dstId);
@@ -413,7 +413,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the target RID
                 VALID_DSTID(tsbk->toString(true), TSBKO::IOSP_RAD_MON, srcId, dstId);
 
-                IOSP_RAD_MON* iosp = static_cast<IOSP_RAD_MON*>(tsbk.get());
+                IOSP_RAD_MON* iosp = static_cast<IOSP_RAD_MON*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, srcId = %u, dstId = %u, txMult = %u", 
                         tsbk->toString(true).c_str(), srcId, dstId, iosp->getTxMult());
@@ -446,7 +446,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // validate the target RID
                 VALID_DSTID(tsbk->toString(true), TSBKO::IOSP_ACK_RSP, srcId, dstId);
 
-                IOSP_ACK_RSP* iosp = static_cast<IOSP_ACK_RSP*>(tsbk.get());
+                IOSP_ACK_RSP* iosp = static_cast<IOSP_ACK_RSP*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, AIV = %u, serviceType = $%02X, srcId = %u, dstId = %u",
                         tsbk->toString(true).c_str(), iosp->getAIV(), iosp->getService(), srcId, dstId);
@@ -467,7 +467,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
             break;
             case TSBKO::ISP_CAN_SRV_REQ:
             {
-                ISP_CAN_SRV_REQ* isp = static_cast<ISP_CAN_SRV_REQ*>(tsbk.get());
+                ISP_CAN_SRV_REQ* isp = static_cast<ISP_CAN_SRV_REQ*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, AIV = %u, serviceType = $%02X, reason = $%02X, srcId = %u, dstId = %u",
                         tsbk->toString(true).c_str(), isp->getAIV(), isp->getService(), isp->getResponse(), srcId, dstId);
@@ -480,7 +480,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
             break;
             case TSBKO::IOSP_EXT_FNCT:
             {
-                IOSP_EXT_FNCT* iosp = static_cast<IOSP_EXT_FNCT*>(tsbk.get());
+                IOSP_EXT_FNCT* iosp = static_cast<IOSP_EXT_FNCT*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, op = $%02X, arg = %u, tgt = %u",
                         tsbk->toString(true).c_str(), iosp->getExtendedFunction(), srcId, dstId);
@@ -518,7 +518,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
             break;
             case TSBKO::ISP_EMERG_ALRM_REQ:
             {
-                ISP_EMERG_ALRM_REQ* isp = static_cast<ISP_EMERG_ALRM_REQ*>(tsbk.get());
+                ISP_EMERG_ALRM_REQ* isp = static_cast<ISP_EMERG_ALRM_REQ*>(tsbk);
                 if (isp->getEmergency()) {
                     VERBOSE_LOG_TSBK(tsbk->toString(true), srcId, dstId);
 
@@ -552,7 +552,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                     writeRF_TSDU_ACK_FNE(srcId, TSBKO::ISP_GRP_AFF_Q_RSP, true, true);
                 }
 
-                ISP_GRP_AFF_Q_RSP* isp = static_cast<ISP_GRP_AFF_Q_RSP*>(tsbk.get());
+                ISP_GRP_AFF_Q_RSP* isp = static_cast<ISP_GRP_AFF_Q_RSP*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, srcId = %u, dstId = %u, anncId = %u", 
                         tsbk->toString(true).c_str(), srcId, dstId, isp->getAnnounceGroup());
@@ -617,7 +617,7 @@ bool ControlSignaling::process(uint8_t* data, uint32_t len, std::unique_ptr<lc::
                 // make sure control data is supported
                 IS_SUPPORT_CONTROL_CHECK(tsbk->toString(true), TSBKO::ISP_AUTH_RESP, srcId);
 
-                ISP_AUTH_RESP* isp = static_cast<ISP_AUTH_RESP*>(tsbk.get());
+                ISP_AUTH_RESP* isp = static_cast<ISP_AUTH_RESP*>(tsbk);
                 if (m_verbose) {
                     LogMessage(LOG_RF, P25_TSDU_STR ", %s, srcId = %u", 
                         tsbk->toString(true).c_str(), srcId);
@@ -707,7 +707,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
     switch (duid) {
         case DUID::TSDU:
             if (m_p25->m_netState == RS_NET_IDLE) {
-                std::unique_ptr<lc::TSBK> tsbk = TSBKFactory::createTSBK(data);
+                lc::TSBK* tsbk = TSBKFactory::decodeTSBK(data);
                 if (tsbk == nullptr) {
                     return false;
                 }
@@ -718,7 +718,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         return false;
                     }
 
-                    OSP_ADJ_STS_BCAST* osp = static_cast<OSP_ADJ_STS_BCAST*>(tsbk.get());
+                    OSP_ADJ_STS_BCAST* osp = static_cast<OSP_ADJ_STS_BCAST*>(tsbk);
                     if (osp->getAdjSiteId() != m_p25->m_siteData.siteId()) {
                         // update site table data
                         SiteData site;
@@ -796,7 +796,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                             return false;
                     }
 
-                    writeNet_TSDU(tsbk.get());
+                    writeNet_TSDU(tsbk);
                     return true;
                 }
 
@@ -826,7 +826,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         return true; // don't allow this to write to the air
                     case TSBKO::IOSP_UU_ANS:
                     {
-                        IOSP_UU_ANS* iosp = static_cast<IOSP_UU_ANS*>(tsbk.get());
+                        IOSP_UU_ANS* iosp = static_cast<IOSP_UU_ANS*>(tsbk);
                         if (iosp->getResponse() > 0U) {
                             if (m_verbose) {
                                 LogMessage(LOG_NET, P25_TSDU_STR ", %s, response = $%02X, srcId = %u, dstId = %u",
@@ -843,7 +843,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         // validate the source RID
                         VALID_SRCID_NET(tsbk->toString(), srcId);
 
-                        IOSP_STS_UPDT* iosp = static_cast<IOSP_STS_UPDT*>(tsbk.get());
+                        IOSP_STS_UPDT* iosp = static_cast<IOSP_STS_UPDT*>(tsbk);
                         if (m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, status = $%02X, srcId = %u",
                                 tsbk->toString(true).c_str(), iosp->getStatus(), srcId);
@@ -857,7 +857,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         // validate the source RID
                         VALID_SRCID_NET(tsbk->toString(), srcId);
 
-                        IOSP_MSG_UPDT* iosp = static_cast<IOSP_MSG_UPDT*>(tsbk.get());
+                        IOSP_MSG_UPDT* iosp = static_cast<IOSP_MSG_UPDT*>(tsbk);
                         if (m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, message = $%02X, srcId = %u, dstId = %u",
                                 tsbk->toString(true).c_str(), iosp->getMessage(), srcId, dstId);
@@ -874,7 +874,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         // validate the target RID
                         VALID_DSTID(tsbk->toString(true), TSBKO::IOSP_RAD_MON, srcId, dstId);
 
-                        IOSP_RAD_MON* iosp = static_cast<IOSP_RAD_MON*>(tsbk.get());
+                        IOSP_RAD_MON* iosp = static_cast<IOSP_RAD_MON*>(tsbk);
                         VERBOSE_LOG_TSBK_NET(tsbk->toString(true), srcId, dstId);
 
                         ::ActivityLog("P25" , true , "radio monitor request from %u to %u" , srcId , dstId);
@@ -908,7 +908,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         // validate the target RID
                         VALID_DSTID_NET(tsbk->toString(true), dstId);
 
-                        IOSP_ACK_RSP* iosp = static_cast<IOSP_ACK_RSP*>(tsbk.get());
+                        IOSP_ACK_RSP* iosp = static_cast<IOSP_ACK_RSP*>(tsbk);
                         if (m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, AIV = %u, serviceType = $%02X, srcId = %u, dstId = %u",
                                 tsbk->toString(true).c_str(), iosp->getAIV(), iosp->getService(), dstId, srcId);
@@ -922,7 +922,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         // validate the target RID
                         VALID_DSTID_NET(tsbk->toString(true), dstId);
 
-                        IOSP_EXT_FNCT* iosp = static_cast<IOSP_EXT_FNCT*>(tsbk.get());
+                        IOSP_EXT_FNCT* iosp = static_cast<IOSP_EXT_FNCT*>(tsbk);
                         if (m_verbose) {
                             LogMessage(LOG_NET, P25_TSDU_STR ", %s, serviceType = $%02X, arg = %u, tgt = %u",
                                 tsbk->toString(true).c_str(), iosp->getService(), srcId, dstId);
@@ -987,7 +987,7 @@ bool ControlSignaling::processNetwork(uint8_t* data, uint32_t len, lc::LC& contr
                         return false;
                 } // switch (tsbk->getLCO())
 
-                writeNet_TSDU(tsbk.get());
+                writeNet_TSDU(tsbk);
             }
             break;
         default:
@@ -1012,7 +1012,7 @@ bool ControlSignaling::processMBT(DataHeader& dataHeader, DataBlock* blocks)
 
     std::unique_ptr<lc::AMBT> ambt = TSBKFactory::createAMBT(dataHeader, blocks);
     if (ambt != nullptr) {
-        ret = process(data, 1U, std::move(ambt));
+        ret = process(data, 1U, ambt.get());
     }
 
     return ret;
@@ -1501,6 +1501,44 @@ void ControlSignaling::writeRF_TSDU_SBF(lc::TSBK* tsbk, bool noNetwork, bool for
     }
 }
 
+/* Helper to write a pre-encoded TSBK block as a single-block P25 TSDU packet. */
+
+void ControlSignaling::writeRF_TSDU_SBF(const uint8_t* block)
+{
+    if (!m_p25->m_enableControl || !m_p25->m_duplex)
+        return;
+
+    assert(block != nullptr);
+
+    uint8_t data[P25_TSDU_FRAME_LENGTH_BYTES + 2U];
+    ::memset(data + 2U, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+    // Generate Sync
+    Sync::addP25Sync(data + 2U);
+
+    // Generate NID
+    m_p25->m_nid.encode(data + 2U, DUID::TSDU);
+
+    // interleave TSBK block
+    P25Utils::encode(block, data + 2U, 114U, 318U);
+
+    if (m_debug) {
+        Utils::dump(1U, "!!! *TSDU (SBF) TSBK Block Data", data + P25_PREAMBLE_LENGTH_BYTES + 2U, P25_TSBK_FEC_LENGTH_BYTES);
+    }
+
+    // Add busy bits
+    P25Utils::addStatusBits(data + 2U, P25_TSDU_FRAME_LENGTH_BITS, m_inbound, true);
+    P25Utils::addTrunkSlotStatusBits(data + 2U, P25_TSDU_FRAME_LENGTH_BITS);
+
+    // Set first busy bits to 1,1
+    P25Utils::setStatusBits(data + 2U, P25_SS0_START, true, true);
+
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
+
+    m_p25->addFrame(data, P25_TSDU_FRAME_LENGTH_BYTES + 2U);
+}
+
 /* Helper to write a network single-block P25 TSDU packet. */
 
 void ControlSignaling::writeNet_TSDU(lc::TSBK* tsbk)
@@ -1540,7 +1578,8 @@ void ControlSignaling::writeNet_TSDU(lc::TSBK* tsbk)
 
 void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
 {
-    if (!m_p25->m_enableControl) {
+    // trunking data is unsupported in simplex operation
+    if (!m_p25->m_enableControl || !m_p25->m_duplex) {
         ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
         m_mbfCnt = 0U;
         return;
@@ -1553,98 +1592,69 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
 
     // LogDebug(LOG_P25, "writeRF_TSDU_MBF, mbfCnt = %u", m_mbfCnt);
 
-    // trunking data is unsupported in simplex operation
-    if (!m_p25->m_duplex) {
+    // Generate TSBK block
+    tsbk->setLastBlock(m_mbfCnt + 1U == TSBK_MBF_CNT); // set last block on the final block of the MBF
+    tsbk->encode(frame, true);
+
+    if (m_debug) {
+        LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
+            tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
+            tsbk->getSysId(), tsbk->getNetId());
+    }
+
+    writeRF_TSDU_MBF(frame);
+}
+
+/* Helper to write a pre-encoded TSBK block to the multi-block (3-block) P25 TSDU queue. */
+
+void ControlSignaling::writeRF_TSDU_MBF(const uint8_t* block)
+{
+    if (!m_p25->m_enableControl || !m_p25->m_duplex) {
         ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
         m_mbfCnt = 0U;
         return;
     }
 
+    assert(block != nullptr);
+
     if (m_mbfCnt == 0U) {
         ::memset(m_rfMBF, 0x00U, P25_TSBK_FEC_LENGTH_BYTES * TSBK_MBF_CNT);
     }
 
-    // trigger encoding of last block and write to queue
-    if (m_mbfCnt + 1U == TSBK_MBF_CNT) {
-        // Generate TSBK block
-        tsbk->setLastBlock(true); // set last block
-        tsbk->encode(frame, true);
-
-        if (m_debug) {
-            LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-                tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-                tsbk->getSysId(), tsbk->getNetId());
-
-            Utils::dump(1U, "!!! *TSDU MBF Last TSBK Block", frame, P25_TSBK_FEC_LENGTH_BYTES);
-        }
-
-        Utils::setBitRange(frame, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
-
-        // Generate TSDU frame
-        uint8_t tsdu[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES];
-        ::memset(tsdu, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
-
-        uint32_t offset = 0U;
-        for (uint8_t i = 0U; i < m_mbfCnt + 1U; i++) {
-            ::memset(frame, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
-            Utils::getBitRange(m_rfMBF, frame, offset, P25_TSBK_FEC_LENGTH_BITS);
-
-            if (m_debug) {
-                LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-                    tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-                    tsbk->getSysId(), tsbk->getNetId());
-
-                Utils::dump(1U, "!!! *TSDU (MBF) TSBK Block", frame, P25_TSBK_FEC_LENGTH_BYTES);
-            }
-
-            // Add TSBK data
-            Utils::setBitRange(frame, tsdu, offset, P25_TSBK_FEC_LENGTH_BITS);
-
-            offset += P25_TSBK_FEC_LENGTH_BITS;
-        }
-
-        // Utils::dump(2U, "!!! *TSDU DEBUG - tsdu", tsdu, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
-
-        uint8_t data[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U];
-        ::memset(data + 2U, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
-
-        // Generate Sync
-        Sync::addP25Sync(data + 2U);
+    if (m_debug) {
+        Utils::dump(1U, (m_mbfCnt + 1U == TSBK_MBF_CNT) ? "!!! *TSDU MBF Last TSBK Block" : "!!! *TSDU MBF Block Data", block, P25_TSBK_FEC_LENGTH_BYTES);
+    }
 
-        // Generate NID
-        m_p25->m_nid.encode(data + 2U, DUID::TSDU);
+    Utils::setBitRange(block, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
+    m_mbfCnt++;
 
-        // interleave
-        P25Utils::encode(tsdu, data + 2U, 114U, 720U);
+    // write to queue once the last block is added
+    if (m_mbfCnt < TSBK_MBF_CNT)
+        return;
 
-        // Add busy bits
-        P25Utils::addStatusBits(data + 2U, P25_TSDU_TRIPLE_FRAME_LENGTH_BITS, m_inbound, true);
-        P25Utils::addTrunkSlotStatusBits(data + 2U, P25_TSDU_TRIPLE_FRAME_LENGTH_BITS);
+    uint8_t data[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U];
+    ::memset(data + 2U, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
 
-        data[0U] = modem::TAG_DATA;
-        data[1U] = 0x00U;
+    // Generate Sync
+    Sync::addP25Sync(data + 2U);
 
-        m_p25->addFrame(data, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U);
+    // Generate NID
+    m_p25->m_nid.encode(data + 2U, DUID::TSDU);
 
-        ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
-        m_mbfCnt = 0U;
-        return;
-    }
+    // interleave (the TSBK blocks are packed back to back in the MBF buffer)
+    P25Utils::encode(m_rfMBF, data + 2U, 114U, 720U);
 
-    // Generate TSBK block
-    tsbk->setLastBlock(false); // clear last block
-    tsbk->encode(frame, true);
+    // Add busy bits
+    P25Utils::addStatusBits(data + 2U, P25_TSDU_TRIPLE_FRAME_LENGTH_BITS, m_inbound, true);
+    P25Utils::addTrunkSlotStatusBits(data + 2U, P25_TSDU_TRIPLE_FRAME_LENGTH_BITS);
 
-    if (m_debug) {
-        LogDebug(LOG_RF, P25_TSDU_STR " (MBF), lco = $%02X, mfId = $%02X, lastBlock = %u, AIV = %u, EX = %u, srcId = %u, dstId = %u, sysId = $%03X, netId = $%05X",
-            tsbk->getLCO(), tsbk->getMFId(), tsbk->getLastBlock(), tsbk->getAIV(), tsbk->getEX(), tsbk->getSrcId(), tsbk->getDstId(),
-            tsbk->getSysId(), tsbk->getNetId());
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
 
-        Utils::dump(1U, "!!! *TSDU MBF Block Data", frame, P25_TSBK_FEC_LENGTH_BYTES);
-    }
+    m_p25->addFrame(data, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U);
 
-    Utils::setBitRange(frame, m_rfMBF, (m_mbfCnt * P25_TSBK_FEC_LENGTH_BITS), P25_TSBK_FEC_LENGTH_BITS);
-    m_mbfCnt++;
+    ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
+    m_mbfCnt = 0U;
 }
 
 /* Helper to write a alternate multi-block trunking PDU packet. */
@@ -1896,17 +1906,57 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     if (!m_p25->m_enableControl)
         return;
 
+    std::vector<::lookups::IdenTable> idenEntries;
+    if (lco == TSBKO::OSP_IDEN_UP) {
+        idenEntries = m_p25->m_idenTable->list();
+        if (m_mbfIdenCnt >= idenEntries.size())
+            m_mbfIdenCnt = 0U;
+    }
+
+    // static broadcasts only change with the site data (or identity table), and are transmitted pre-encoded; the
+    // cache key is the LCO, the identity entry (for identifier updates) and the last block marker
+    uint32_t bcastKey = 0U;
+    switch (lco) {
+        case TSBKO::OSP_IDEN_UP:
+            bcastKey = ((m_mbfIdenCnt + 1U) << 8) | lco;
+            break;
+        case TSBKO::OSP_NET_STS_BCAST:
+        case TSBKO::OSP_RFSS_STS_BCAST:
+        case TSBKO::OSP_SNDCP_CH_ANN:
+        case TSBKO::OSP_MOT_PSH_CCH:
+        case TSBKO::OSP_MOT_CC_BSI:
+        case TSBKO::OSP_DVM_GIT_HASH:
+            bcastKey = lco;
+            break;
+    }
+
+    uint32_t bcastVersion = lc::TSBK::getSiteDataVersion() + m_p25->m_idenTable->version();
+    if (bcastKey != 0U) {
+        bool lastBlock = !m_ctrlTSDUMBF || (m_mbfCnt + 1U == TSBK_MBF_CNT);
+        bcastKey = (bcastKey << 1) | (lastBlock ? 1U : 0U);
+
+        const uint8_t* block = m_ctrlBcastCache.find(bcastVersion, bcastKey);
+        if (block != nullptr) {
+            if (lco == TSBKO::OSP_IDEN_UP)
+                m_mbfIdenCnt++;
+
+            if (m_ctrlTSDUMBF) {
+                writeRF_TSDU_MBF(block);
+            }
+            else {
+                writeRF_TSDU_SBF(block);
+            }
+            return;
+        }
+    }
+
     std::unique_ptr<lc::TSBK> tsbk;
 
     switch (lco) {
         case TSBKO::OSP_IDEN_UP:
             {
-                std::vector<::lookups::IdenTable> entries = m_p25->m_idenTable->list();
-                if (m_mbfIdenCnt >= entries.size())
-                    m_mbfIdenCnt = 0U;
-
                 uint8_t i = 0U;
-                for (auto entry : entries) {
+                for (auto entry : idenEntries) {
                     // no good very bad way of skipping entries...
                     if (i != m_mbfIdenCnt) {
                         i++;
@@ -2090,6 +2140,24 @@ void ControlSignaling::queueRF_TSBK_Ctrl(uint8_t lco)
     if (tsbk != nullptr) {
         tsbk->setLastBlock(true); // always set last block
 
+        // encode the static broadcast once, and transmit it from the cache from now on
+        if (bcastKey != 0U) {
+            uint8_t block[P25_TSBK_FEC_LENGTH_BYTES];
+            ::memset(block, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+
+            tsbk->setLastBlock((bcastKey & 0x01U) == 0x01U);
+            tsbk->encode(block, true);
+
+            m_ctrlBcastCache.add(bcastVersion, bcastKey, block);
+            if (m_ctrlTSDUMBF) {
+                writeRF_TSDU_MBF(block);
+            }
+            else {
+                writeRF_TSDU_SBF(block);
+            }
+            return;
+        }
+
         // are we transmitting CC as a multi-block?
         if (m_ctrlTSDUMBF) {
             writeRF_TSDU_MBF(tsbk.get());
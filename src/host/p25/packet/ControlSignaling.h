@@ -22,6 +22,7 @@
 #include "common/p25/lc/TSBK.h"
 #include "common/p25/lc/AMBT.h"
 #include "common/p25/lc/TDULC.h"
+#include "common/BroadcastCache.h"
 #include "common/Timer.h"
 #include "p25/Control.h"
 
@@ -61,7 +62,7 @@ namespace p25
              * @param preDecodedTSBK Pre-decoded TSBK.
              * @returns bool True, if data frame is processed, otherwise false.
              */
-            bool process(uint8_t* data, uint32_t len, std::unique_ptr<lc::TSBK> preDecodedTSBK = nullptr);
+            bool process(uint8_t* data, uint32_t len, lc::TSBK* preDecodedTSBK = nullptr);
             /**
              * @brief Process a data frame from the network.
              * @param data Buffer containing data frame.
@@ -175,6 +176,8 @@ namespace p25
             uint8_t m_mbfSCCBCnt;
             uint8_t m_mbfGrpGrntCnt;
 
+            BroadcastCache<defines::P25_TSBK_FEC_LENGTH_BYTES> m_ctrlBcastCache;
+
             std::unordered_map<uint8_t, SiteData> m_adjSiteTable;
             std::unordered_map<uint8_t, uint8_t> m_adjSiteUpdateCnt;
 
@@ -270,6 +273,11 @@ namespace p25
              * @param imm Flag indicating the TSBK should be written to the immediate queue.
              */
             void writeRF_TSDU_SBF(lc::TSBK* tsbk, bool noNetwork, bool forceSingle = false, bool imm = false);
+            /**
+             * @brief Helper to write a pre-encoded TSBK block as a single-block P25 TSDU packet.
+             * @param[in] block Trellis encoded TSBK block (with the last block marker set).
+             */
+            void writeRF_TSDU_SBF(const uint8_t* block);
             /**
              * @brief Helper to write a network single-block P25 TSDU packet.
              * @param tsbk TSBK to write to the network.
@@ -280,6 +288,11 @@ namespace p25
              * @param tsbk TSBK to write to the multi-block queue.
              */
             void writeRF_TSDU_MBF(lc::TSBK* tsbk);
+            /**
+             * @brief Helper to write a pre-encoded TSBK block to the multi-block (3-block) P25 TSDU queue.
+             * @param[in] block Trellis encoded TSBK block.
+             */
+            void writeRF_TSDU_MBF(const uint8_t* block);
             /**
              * @brief Helper to write a alternate multi-block PDU packet.
              * @param tsbk AMBT to write to the modem.
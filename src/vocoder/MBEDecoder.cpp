@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2019-2021 Doug McLain
- *  Copyright (C) 2021 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2021,2024 Bryan Biedenkapp, N2PLL
  *
  */
 #include <iostream>
@@ -72,7 +72,8 @@ const int MBEDecoder::rZ[36] = {
 MBEDecoder::MBEDecoder(MBE_DECODER_MODE mode) :
     m_mbelibParms(NULL),
     m_mbeMode(mode),
-    m_gainAdjust(1.0f)
+    m_gainAdjust(1.0f),
+    m_autoGain(false)
 {
     m_mbelibParms = new mbelibParms();
     mbe_initMbeParms(m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced);
@@ -25,6 +25,14 @@
 #include "vocoder/imbe/aux_sub.h"
 #include "vocoder/imbe/tbls.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define AUX_SUB_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define AUX_SUB_NEON 1
+#endif
+
 // ---------------------------------------------------------------------------
 // Global Functions
 // ---------------------------------------------------------------------------
@@ -181,3 +189,55 @@ void v_equ_shr(Word16* vec1, Word16* vec2, Word16 scale, Word16 n)
     while (n--)
         *vec1++ = shr(*vec2++, scale);
 }
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the exact (non-saturating) dot product of two 16 bit
+//      input vectors, using SIMD where available.
+//
+//  INPUT:
+//		vec1      - Pointer to the first vector
+//		vec2      - Pointer to the second vector
+//      n         - size of input vectors
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_dot(const Word16* vec1, const Word16* vec2, Word16 n)
+{
+    Word32 L_sum = 0;
+    Word16 i = 0;
+
+#if defined(AUX_SUB_SSE2)
+    // pmaddwd multiplies 8 pairs and sums adjacent products into 4 lanes
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(vec1 + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(vec2 + i));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(a, b));
+    }
+
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    L_sum = _mm_cvtsi128_si32(acc);
+#elif defined(AUX_SUB_NEON)
+    int32x4_t acc = vdupq_n_s32(0);
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t a = vld1q_s16(vec1 + i);
+        int16x8_t b = vld1q_s16(vec2 + i);
+        acc = vmlal_s16(acc, vget_low_s16(a), vget_low_s16(b));
+        acc = vmlal_s16(acc, vget_high_s16(a), vget_high_s16(b));
+    }
+
+    int32x2_t acc2 = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+    L_sum = vget_lane_s32(vpadd_s32(acc2, acc2), 0);
+#endif
+    for (; i < n; i++)
+        L_sum += (Word32)vec1[i] * (Word32)vec2[i];
+
+    return L_sum;
+}
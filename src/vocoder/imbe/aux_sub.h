@@ -131,4 +131,26 @@ Word32 L_v_magsq(Word16 *vec, Word16 n);
 //-----------------------------------------------------------------------------
 void v_equ_shr(Word16 *vec1, Word16 *vec2, Word16 scale, Word16 n);
 
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the exact (non-saturating) dot product of two 16 bit
+//      input vectors, using SIMD where available. The caller must
+//      guarantee the sum of the absolute products fits in 31 bits,
+//      in which case the result equals a chain of unsaturated L_mac
+//      calls divided by two.
+//
+//  INPUT:
+//		vec1      - Pointer to the first vector
+//		vec2      - Pointer to the second vector
+//      n         - size of input vectors
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_dot(const Word16 *vec1, const Word16 *vec2, Word16 n);
+
 #endif // __AUX_SUB_H__
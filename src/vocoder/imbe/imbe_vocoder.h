@@ -103,6 +103,7 @@ private:
     void sa_encode(IMBE_PARAM *imbe_param);
     void uv_synt_init(void);
     void uv_synt(IMBE_PARAM *imbe_param, Word16 *snd);
+    Word16 rand_gen(void);
     void v_synt_init(void);
     void v_synt(IMBE_PARAM *imbe_param, Word16 *snd);
     void pitch_ref_init(void);
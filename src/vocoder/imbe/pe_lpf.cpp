@@ -27,6 +27,8 @@
 #include "vocoder/imbe/math_sub.h"
 #include "vocoder/imbe/pe_lpf.h"
 
+#include <string.h>
+
 // ---------------------------------------------------------------------------
 //  Constants
 // ---------------------------------------------------------------------------
@@ -37,6 +39,10 @@ static const Word16 lpf_coef[PE_LPF_ORD] =
     9141, 3891, -495, -1834, -883,  288,   543,  185,  -92,  -94
 };
 
+// largest sample magnitude for which no partial L_mac sum of the filter can saturate,
+// MAX_32 / (2 * sum(abs(lpf_coef)))
+#define PE_LPF_SAFE_AMPLITUDE 23138
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -61,8 +67,35 @@ static const Word16 lpf_coef[PE_LPF_ORD] =
 //-----------------------------------------------------------------------------
 void pe_lpf(Word16* sigin, Word16* sigout, Word16* mem, Word16 len)
 {
-    Word16 i;
+    Word16 i, n;
     Word32 L_sum;
+    Word16 hist[PE_LPF_ORD - 1 + FRAME];
+    Word16 peak = 0;
+
+    if (len > 0 && len <= FRAME) {
+        // lay the filter history and the input out contiguously, so each output is a dot product over a
+        // sliding window instead of shifting the filter memory every sample
+        v_equ(hist, &mem[1], PE_LPF_ORD - 1);
+        v_equ(&hist[PE_LPF_ORD - 1], sigin, len);
+
+        for (i = 0; i < PE_LPF_ORD - 1 + len; i++) {
+            Word16 mag = abs_s(hist[i]);
+            if (mag > peak)
+                peak = mag;
+        }
+
+        // below the safe amplitude the saturating L_mac chain never saturates, so the exact dot product gives a
+        // bit identical result
+        if (peak <= PE_LPF_SAFE_AMPLITUDE) {
+            for (n = 0; n < len; n++) {
+                L_sum = L_shl(L_v_dot(&hist[n], lpf_coef, PE_LPF_ORD), 1);
+                *sigout++ = L_round(L_sum);
+            }
+
+            v_equ(mem, &hist[len - 1], PE_LPF_ORD);
+            return;
+        }
+    }
 
     while (len--) {
         for (i = 0; i < PE_LPF_ORD - 1; i++)
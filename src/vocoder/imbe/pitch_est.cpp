@@ -119,8 +119,16 @@ void imbe_vocoder::e_p(Word16* sigin, Word16* res_buf)
 
     // Calculate correlation for time shift in range 21...150 with step 0.5
     // For integer shifts
-    for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
-        corr[i] = autocorr(sig_wndwed, tmp, scale_shift);
+    if (scale_shift == 0 && L_e0 < MAX_32) {
+        // the sum of the absolute lagged products is bounded by the (unsaturated) zero lag energy, so none of the
+        // saturating sums can saturate and the exact dot product is bit identical
+        for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
+            corr[i] = L_shl(L_v_dot(sig_wndwed, &sig_wndwed[tmp], PITCH_EST_FRAME - tmp), 1);
+    }
+    else {
+        for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
+            corr[i] = autocorr(sig_wndwed, tmp, scale_shift);
+    }
     // For intermediate shifts
     for (i = 1; i < 258; i += 2)
         corr[i] = L_shr(L_add(corr[i - 1], corr[i + 1]), 1);
@@ -21,15 +21,10 @@
 
 #include "vocoder/imbe/typedef.h"
 #include "vocoder/imbe/basic_op.h"
+#include "vocoder/imbe/imbe_vocoder.h"
 
 // ---------------------------------------------------------------------------
-//  Constants
-// ---------------------------------------------------------------------------
-
-static UWord32 seed = 1;
-
-// ---------------------------------------------------------------------------
-//  Global Functions
+//  Private Class Members
 // ---------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -47,7 +42,7 @@ static UWord32 seed = 1;
 //		        Pseudo-random number in signed Q1.16 format
 //
 //-----------------------------------------------------------------------------
-Word16 rand_gen(void)
+Word16 imbe_vocoder::rand_gen(void)
 {
     UWord32 hi, lo;
 
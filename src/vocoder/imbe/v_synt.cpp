@@ -24,7 +24,6 @@
 #include "vocoder/imbe/imbe.h"
 #include "vocoder/imbe/aux_sub.h"
 #include "vocoder/imbe/math_sub.h"
-#include "vocoder/imbe/rand_gen.h"
 #include "vocoder/imbe/tbls.h"
 #include "vocoder/imbe/imbe_vocoder.h"
 
@@ -31,26 +31,163 @@
 #include "vocoder/mbe.h"
 #include "vocoder/mbe_const.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define MBE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MBE_NEON 1
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(disable: 4244)
 #endif
 
+// ---------------------------------------------------------------------------
+//  Macros
+// ---------------------------------------------------------------------------
+
+#define MBE_FRAME_SAMPLES 160
+
+// 4 lane float vector used by the harmonic synthesis oscillators
+#if defined(MBE_SSE2)
+typedef __m128 mbe_v4;
+#define V4_LOAD(p) _mm_loadu_ps(p)
+#define V4_STORE(p, v) _mm_storeu_ps(p, v)
+#define V4_SET1(x) _mm_set1_ps(x)
+#define V4_ADD(a, b) _mm_add_ps(a, b)
+#define V4_SUB(a, b) _mm_sub_ps(a, b)
+#define V4_MUL(a, b) _mm_mul_ps(a, b)
+#elif defined(MBE_NEON)
+typedef float32x4_t mbe_v4;
+#define V4_LOAD(p) vld1q_f32(p)
+#define V4_STORE(p, v) vst1q_f32(p, v)
+#define V4_SET1(x) vdupq_n_f32(x)
+#define V4_ADD(a, b) vaddq_f32(a, b)
+#define V4_SUB(a, b) vsubq_f32(a, b)
+#define V4_MUL(a, b) vmulq_f32(a, b)
+#else
+typedef struct { float v[4]; } mbe_v4;
+static inline mbe_v4 mbe_v4_load(const float* p) { mbe_v4 r = { { p[0], p[1], p[2], p[3] } }; return r; }
+static inline void mbe_v4_store(float* p, mbe_v4 a) { p[0] = a.v[0]; p[1] = a.v[1]; p[2] = a.v[2]; p[3] = a.v[3]; }
+static inline mbe_v4 mbe_v4_set1(float x) { mbe_v4 r = { { x, x, x, x } }; return r; }
+static inline mbe_v4 mbe_v4_add(mbe_v4 a, mbe_v4 b) { mbe_v4 r = { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; return r; }
+static inline mbe_v4 mbe_v4_sub(mbe_v4 a, mbe_v4 b) { mbe_v4 r = { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; return r; }
+static inline mbe_v4 mbe_v4_mul(mbe_v4 a, mbe_v4 b) { mbe_v4 r = { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; return r; }
+#define V4_LOAD(p) mbe_v4_load(p)
+#define V4_STORE(p, v) mbe_v4_store(p, v)
+#define V4_SET1(x) mbe_v4_set1(x)
+#define V4_ADD(a, b) mbe_v4_add(a, b)
+#define V4_SUB(a, b) mbe_v4_sub(a, b)
+#define V4_MUL(a, b) mbe_v4_mul(a, b)
+#endif
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
 
 /* A pseudo - random float between[0.0, 1.0]. */
 
-static float mbe_rand()
+static float mbe_rand(mbe_parms* mp)
 {
-    return ((float)rand() / (float)RAND_MAX);
+    // the PRNG state is carried in the parameters so each decoder has its own sequence
+    mp->seed = mp->seed * 1103515245U + 12345U;
+    return ((float)((mp->seed >> 16) & 0x7FFFU) / (float)0x7FFFU);
 }
 
 /* A pseudo-random float between [-pi, +pi]. */
 
-static float mbe_rand_phase()
+static float mbe_rand_phase(mbe_parms* mp)
+{
+    return mbe_rand(mp) * (((float)M_PI) * 2.0F) - ((float)M_PI);
+}
+
+/* Accumulates amp * gain[n] * cos((w * (n + n0)) + phase) into out[n] for a frame of samples. */
+
+static void mbe_addHarmonic(float* out, const float* gain, float amp, float w, float phase, int n0)
 {
-    return mbe_rand() * (((float)M_PI) * 2.0F) - ((float)M_PI);
+    // rather than evaluating cosf() per sample, each of the 4 lanes runs a recursive phasor oscillator
+    // (offset by one sample from its neighbour) which is rotated by 4 * w every step; over a 160 sample
+    // frame the rotation error stays well below the rounding of the float phase argument the direct
+    // evaluation uses
+    float re[4], im[4];
+    int n, k;
+
+    for (k = 0; k < 4; k++) {
+        float a = (w * (float)(n0 + k)) + phase;
+        re[k] = cosf(a);
+        im[k] = sinf(a);
+    }
+
+    mbe_v4 vre = V4_LOAD(re);
+    mbe_v4 vim = V4_LOAD(im);
+    mbe_v4 c = V4_SET1(cosf(w * 4.0F));
+    mbe_v4 s = V4_SET1(sinf(w * 4.0F));
+    mbe_v4 vamp = V4_SET1(amp);
+
+    for (n = 0; n < MBE_FRAME_SAMPLES; n += 4) {
+        mbe_v4 y = V4_MUL(vre, vamp);
+        if (gain != NULL) {
+            y = V4_MUL(y, V4_LOAD(gain + n));
+        }
+
+        V4_STORE(out + n, V4_ADD(V4_LOAD(out + n), y));
+
+        mbe_v4 t = V4_SUB(V4_MUL(vre, c), V4_MUL(vim, s));
+        vim = V4_ADD(V4_MUL(vre, s), V4_MUL(vim, c));
+        vre = t;
+    }
+}
+
+/* Generates the unvoiced multisine mix of a band into mix[n] (without noise or scaling). */
+
+static void mbe_unvoicedMix(float* mix, float w0, int l, float uvstep, float uvoffset, const float* rphase, int uvquality)
+{
+    int n, i;
+
+    for (n = 0; n < MBE_FRAME_SAMPLES; n++) {
+        mix[n] = 0.0F;
+    }
+
+    for (i = 0; i < uvquality; i++) {
+        mbe_addHarmonic(mix, NULL, 1.0F, w0 * ((float)l + ((float)i * uvstep) - uvoffset), rphase[i], 0);
+    }
+}
+
+/* Adds the unvoiced noise to one or two multisine mixes, drawing from the PRNG sample by sample. */
+
+static void mbe_unvoicedNoise(float* mix, float k, float* mix2, float k2, int uvquality, mbe_parms* mp)
+{
+    // the draws are made in the same order as the per sample synthesis has always made them (first
+    // mix, then second mix, for each sample) so the PRNG sequence is unchanged
+    int n, i;
+
+    for (n = 0; n < MBE_FRAME_SAMPLES; n++) {
+        if (k > 0.0F) {
+            for (i = 0; i < uvquality; i++) {
+                mix[n] += k * mbe_rand(mp);
+            }
+        }
+
+        if (k2 > 0.0F) {
+            for (i = 0; i < uvquality; i++) {
+                mix2[n] += k2 * mbe_rand(mp);
+            }
+        }
+    }
+}
+
+/* Accumulates scale * gain[n] * mix[n] into out[n] for a frame of samples. */
+
+static void mbe_addMix(float* out, const float* mix, const float* gain, float scale)
+{
+    int n;
+    mbe_v4 vscale = V4_SET1(scale);
+
+    for (n = 0; n < MBE_FRAME_SAMPLES; n += 4) {
+        mbe_v4 y = V4_MUL(V4_MUL(V4_LOAD(mix + n), vscale), V4_LOAD(gain + n));
+        V4_STORE(out + n, V4_ADD(V4_LOAD(out + n), y));
+    }
 }
 
 /* */
@@ -117,8 +254,12 @@ void mbe_initMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp, mbe_parms* prev_mp_
     }
 
     prev_mp->repeat = 0;
+    prev_mp->seed = 1U;
     mbe_moveMbeParms(prev_mp, cur_mp);
     mbe_moveMbeParms(prev_mp, prev_mp_enhanced);
+
+    cur_mp->seed = 1U;
+    prev_mp_enhanced->seed = 1U;
 }
 
 /* */
@@ -218,7 +359,8 @@ void mbe_synthesizeSpeechF(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
 
     int i, l, n, maxl;
     float* Ss, loguvquality;
-    float C1, C2, C3, C4;
+    float ck, pk;
+    float mix[MBE_FRAME_SAMPLES], mix2[MBE_FRAME_SAMPLES];
     //float deltaphil, deltawl, thetaln, aln;
     int numUv;
     float cw0, pw0, cw0l, pw0l;
@@ -227,7 +369,7 @@ void mbe_synthesizeSpeechF(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
     float qfactor;
     float rphase[64], rphase2[64];
 
-    const int N = 160;
+    const int N = MBE_FRAME_SAMPLES;
 
     uvthresholdf = (float)2700;
     uvthreshold = ((uvthresholdf * M_PI) / (float)4000);
@@ -295,78 +437,52 @@ void mbe_synthesizeSpeechF(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
             cur_mp->PHIl[l] = cur_mp->PSIl[l];
         }
         else {
-            cur_mp->PHIl[l] = cur_mp->PSIl[l] + ((numUv * mbe_rand_phase()) / cur_mp->L);
+            cur_mp->PHIl[l] = cur_mp->PSIl[l] + ((numUv * mbe_rand_phase(cur_mp)) / cur_mp->L);
         }
     }
 
     for (l = 1; l <= maxl; l++) {
         cw0l = (cw0 * (float)l);
         pw0l = (pw0 * (float)l);
+
+        // the noise weight of a band is only non-zero above the unvoiced threshold
+        ck = (cw0l > uvthreshold) ? ((cw0l - uvthreshold) * uvrand) : 0.0F;
+        pk = (pw0l > uvthreshold) ? ((pw0l - uvthreshold) * uvrand) : 0.0F;
+
         if ((cur_mp->Vl[l] == 0) && (prev_mp->Vl[l] == 1)) {
-            Ss = aout_buf;
             // init random phase
             for (i = 0; i < uvquality; i++) {
-                rphase[i] = mbe_rand_phase();
+                rphase[i] = mbe_rand_phase(cur_mp);
             }
 
-            for (n = 0; n < N; n++) {
-                C1 = 0;
-                // eq 131
-                C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++)
-                {
-                    C3 = C3 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (cw0l > uvthreshold)
-                    {
-                        C3 = C3 + ((cw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-                C3 = C3 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C1 + C3;
-                Ss++;
-            }
+            // eq 131
+            mbe_addHarmonic(aout_buf, Ws + N, prev_mp->Ml[l], pw0l, prev_mp->PHIl[l], 0);
+
+            // unvoiced multisine mix
+            mbe_unvoicedMix(mix, cw0, l, uvstep, uvoffset, rphase, uvquality);
+            mbe_unvoicedNoise(mix, ck, NULL, 0.0F, uvquality, cur_mp);
+            mbe_addMix(aout_buf, mix, Ws, uvsine * cur_mp->Ml[l] * qfactor);
         }
         else if ((cur_mp->Vl[l] == 1) && (prev_mp->Vl[l] == 0)) {
-            Ss = aout_buf;
             // init random phase
             for (i = 0; i < uvquality; i++) {
-                rphase[i] = mbe_rand_phase();
-            }
-            
-            for (n = 0; n < N; n++) {
-                C1 = 0;
-                // eq 132
-                C1 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (pw0l > uvthreshold) {
-                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C1 + C3;
-                Ss++;
+                rphase[i] = mbe_rand_phase(cur_mp);
             }
+
+            // eq 132
+            mbe_addHarmonic(aout_buf, Ws, cur_mp->Ml[l], cw0l, cur_mp->PHIl[l], -N);
+
+            // unvoiced multisine mix
+            mbe_unvoicedMix(mix, pw0, l, uvstep, uvoffset, rphase, uvquality);
+            mbe_unvoicedNoise(mix, pk, NULL, 0.0F, uvquality, cur_mp);
+            mbe_addMix(aout_buf, mix, Ws + N, uvsine * prev_mp->Ml[l] * qfactor);
         }
         //      else if (((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) && ((l >= 8) || (fabsf (cw0 - pw0) >= ((float) 0.1 * cw0))))
         else if ((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) {
-            Ss = aout_buf;
-            for (n = 0; n < N; n++) {
-                C1 = 0;
-                // eq 133-1
-                C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
-                C2 = 0;
-                // eq 133-2
-                C2 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
-                *Ss = *Ss + C1 + C2;
-                Ss++;
-            }
+            // eq 133-1
+            mbe_addHarmonic(aout_buf, Ws + N, prev_mp->Ml[l], pw0l, prev_mp->PHIl[l], 0);
+            // eq 133-2
+            mbe_addHarmonic(aout_buf, Ws, cur_mp->Ml[l], cw0l, cur_mp->PHIl[l], -N);
         }
 /*
         // expensive and unnecessary?
@@ -390,43 +506,23 @@ void mbe_synthesizeSpeechF(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
 */
         else
         {
-            Ss = aout_buf;
             // init random phase
             for (i = 0; i < uvquality; i++) {
-                rphase[i] = mbe_rand_phase();
+                rphase[i] = mbe_rand_phase(cur_mp);
             }
 
             // init random phase
             for (i = 0; i < uvquality; i++) {
-                rphase2[i] = mbe_rand_phase();
+                rphase2[i] = mbe_rand_phase(cur_mp);
             }
 
-            for (n = 0; n < N; n++) {
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (pw0l > uvthreshold) {
-                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-
-                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
-                C4 = 0;
-                
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C4 = C4 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase2[i]);
-                    if (cw0l > uvthreshold) {
-                        C4 = C4 + ((cw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-
-                C4 = C4 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C3 + C4;
-                Ss++;
-            }
+            // unvoiced multisine mix
+            mbe_unvoicedMix(mix, pw0, l, uvstep, uvoffset, rphase, uvquality);
+            mbe_unvoicedMix(mix2, cw0, l, uvstep, uvoffset, rphase2, uvquality);
+            mbe_unvoicedNoise(mix, pk, mix2, ck, uvquality, cur_mp);
+
+            mbe_addMix(aout_buf, mix, Ws + N, uvsine * prev_mp->Ml[l] * qfactor);
+            mbe_addMix(aout_buf, mix2, Ws, uvsine * cur_mp->Ml[l] * qfactor);
         }
     }
 }
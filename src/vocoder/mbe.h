@@ -71,6 +71,7 @@ struct mbe_parameters
     float gamma;
     int un;
     int repeat;
+    unsigned int seed;  // unvoiced synthesis PRNG state (not copied between frames)
 };
 
 typedef struct mbe_parameters mbe_parms;
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+// ---------------------------------------------------------------------------
+//  Bit-at-a-time reference implementations
+// ---------------------------------------------------------------------------
+
+static void refGetBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_t stop)
+{
+    uint32_t n = 0U;
+    for (uint32_t i = start; i < stop; i++, n++) {
+        bool b = READ_BIT(in, i);
+        WRITE_BIT(out, n, b);
+    }
+}
+
+static void refSetBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_t stop)
+{
+    uint32_t n = 0U;
+    for (uint32_t i = start; i < stop; i++, n++) {
+        bool b = READ_BIT(in, n);
+        WRITE_BIT(out, i, b);
+    }
+}
+
+TEST_CASE("Utils", "[Bit Field Test]") {
+    const uint32_t len = 24U;
+    const uint32_t maxBits = len * 8U;
+
+    srand((unsigned int)time(NULL));
+
+    uint8_t in[len];
+    for (uint32_t i = 0U; i < len; i++)
+        in[i] = rand();
+
+    SECTION("GetBits_Equivalence_Test") {
+        bool failed = false;
+
+        INFO("Utils getBits Equivalence Test");
+
+        for (uint32_t start = 0U; start < maxBits && !failed; start++) {
+            for (uint32_t stop = start; stop <= maxBits; stop++) {
+                uint8_t expected[len], actual[len];
+                for (uint32_t i = 0U; i < len; i++)
+                    expected[i] = actual[i] = (uint8_t)(i * 0x5BU);
+
+                refGetBits(in, expected, start, stop);
+                uint32_t n = Utils::getBits(in, actual, start, stop);
+
+                if (n != stop - start || ::memcmp(expected, actual, len) != 0) {
+                    ::LogDebug("T", "getBits mismatch, start = %u, stop = %u", start, stop);
+                    Utils::dump(2U, "Expected", expected, len);
+                    Utils::dump(2U, "Actual", actual, len);
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("SetBits_Equivalence_Test") {
+        bool failed = false;
+
+        INFO("Utils setBits Equivalence Test");
+
+        for (uint32_t start = 0U; start < maxBits && !failed; start++) {
+            for (uint32_t stop = start; stop <= maxBits; stop++) {
+                uint8_t expected[len], actual[len];
+                for (uint32_t i = 0U; i < len; i++)
+                    expected[i] = actual[i] = (uint8_t)(i * 0x5BU);
+
+                refSetBits(in, expected, start, stop);
+                uint32_t n = Utils::setBits(in, actual, start, stop);
+
+                if (n != stop - start || ::memcmp(expected, actual, len) != 0) {
+                    ::LogDebug("T", "setBits mismatch, start = %u, stop = %u", start, stop);
+                    Utils::dump(2U, "Expected", expected, len);
+                    Utils::dump(2U, "Actual", actual, len);
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("ReadWriteBits_Word_Test") {
+        bool failed = false;
+
+        INFO("Utils readBits/writeBits Word Test");
+
+        for (uint32_t offset = 0U; offset < maxBits - 64U && !failed; offset++) {
+            for (uint32_t length = 0U; length <= 64U; length++) {
+                uint64_t expected = 0U;
+                for (uint32_t i = 0U; i < length; i++)
+                    expected = (expected << 1) | (READ_BIT(in, offset + i) ? 1U : 0U);
+
+                if (Utils::readBits(in, offset, length) != expected) {
+                    ::LogDebug("T", "readBits mismatch, offset = %u, length = %u", offset, length);
+                    failed = true;
+                    break;
+                }
+
+                uint8_t buffer[len];
+                ::memset(buffer, 0xA5U, len);
+                uint8_t ref[len];
+                ::memset(ref, 0xA5U, len);
+                for (uint32_t i = 0U; i < length; i++)
+                    WRITE_BIT(ref, offset + i, (expected >> (length - 1U - i)) & 1U);
+
+                Utils::writeBits(buffer, offset, expected, length);
+                if (::memcmp(ref, buffer, len) != 0) {
+                    ::LogDebug("T", "writeBits mismatch, offset = %u, length = %u", offset, length);
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("Bin2Hex_Hex2Bin_Test") {
+        bool failed = false;
+
+        INFO("Utils bin2Hex/hex2Bin Test");
+
+        for (uint32_t offset = 0U; offset <= maxBits - 6U; offset++) {
+            uint8_t expected = 0x00U;
+            for (uint32_t i = 0U; i < 6U; i++)
+                expected |= READ_BIT(in, offset + i) ? (0x20U >> i) : 0x00U;
+
+            uint8_t hex = Utils::bin2Hex(in, offset);
+            if (hex != expected) {
+                ::LogDebug("T", "bin2Hex mismatch, offset = %u, %02X != %02X", offset, hex, expected);
+                failed = true;
+                break;
+            }
+
+            uint8_t buffer[len];
+            ::memcpy(buffer, in, len);
+            Utils::hex2Bin(hex ^ 0x3FU, buffer, offset);
+            Utils::hex2Bin(hex, buffer, offset);
+            if (::memcmp(buffer, in, len) != 0) {
+                ::LogDebug("T", "hex2Bin mismatch, offset = %u", offset);
+                failed = true;
+                break;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/BroadcastCache.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/lc/tsbk/OSP_RFSS_STS_BCAST.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::lc;
+using namespace p25::lc::tsbk;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+TEST_CASE("BroadcastCache", "[Broadcast Cache Test]") {
+    SECTION("Version_Test") {
+        INFO("Broadcast Cache Version Test");
+
+        BroadcastCache<4U> cache;
+        uint8_t a[4U] = { 0x01U, 0x02U, 0x03U, 0x04U };
+        uint8_t b[4U] = { 0x05U, 0x06U, 0x07U, 0x08U };
+
+        REQUIRE(cache.find(1U, 10U) == nullptr);
+        cache.add(1U, 10U, a);
+        cache.add(1U, 11U, b);
+        REQUIRE(cache.size() == 2U);
+
+        const uint8_t* data = cache.find(1U, 10U);
+        REQUIRE(data != nullptr);
+        REQUIRE(::memcmp(data, a, 4U) == 0);
+
+        // a replaced entry is returned, not the original
+        cache.add(1U, 10U, b);
+        REQUIRE(::memcmp(cache.find(1U, 10U), b, 4U) == 0);
+
+        // a new version flushes every entry
+        REQUIRE(cache.find(2U, 11U) == nullptr);
+        REQUIRE(cache.size() == 0U);
+        REQUIRE(cache.hits() == 2U);
+        REQUIRE(cache.misses() == 2U);
+    }
+
+    SECTION("SiteData_Version_Test") {
+        INFO("Broadcast Cache Site Data Version Test");
+
+        SiteData site = SiteData(0xBB800U, 0x001U, 1U, 1U, 0U, 1U, 1U, 0x00U, 0);
+        TSBK::setSiteData(site);
+
+        // pushing unchanged site data keeps pre-encoded broadcasts valid
+        uint32_t version = TSBK::getSiteDataVersion();
+        TSBK::setSiteData(site);
+        REQUIRE(TSBK::getSiteDataVersion() == version);
+
+        BroadcastCache<P25_TSBK_FEC_LENGTH_BYTES> cache;
+
+        uint8_t block[P25_TSBK_FEC_LENGTH_BYTES];
+        ::memset(block, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+        OSP_RFSS_STS_BCAST osp = OSP_RFSS_STS_BCAST();
+        osp.setLastBlock(true);
+        osp.encode(block, true);
+        cache.add(TSBK::getSiteDataVersion(), TSBKO::OSP_RFSS_STS_BCAST, block);
+
+        // the cached block is identical to a fresh encode
+        uint8_t fresh[P25_TSBK_FEC_LENGTH_BYTES];
+        ::memset(fresh, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+        osp.encode(fresh, true);
+
+        const uint8_t* cached = cache.find(TSBK::getSiteDataVersion(), TSBKO::OSP_RFSS_STS_BCAST);
+        REQUIRE(cached != nullptr);
+        REQUIRE(::memcmp(cached, fresh, P25_TSBK_FEC_LENGTH_BYTES) == 0);
+
+        // a network state change invalidates the broadcast, and the broadcast changes with it
+        site.setNetActive(true);
+        TSBK::setSiteData(site);
+        REQUIRE(TSBK::getSiteDataVersion() != version);
+        REQUIRE(cache.find(TSBK::getSiteDataVersion(), TSBKO::OSP_RFSS_STS_BCAST) == nullptr);
+
+        osp.encode(fresh, true);
+        REQUIRE(::memcmp(block, fresh, P25_TSBK_FEC_LENGTH_BYTES) != 0);
+    }
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/EventLoop.h"
+#include "common/StopWatch.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif // defined(__linux__)
+
+TEST_CASE("EventLoop", "[Event Loop Test]") {
+    SECTION("Tick_Test") {
+        INFO("Event Loop Tick Test");
+
+        EventLoop events;
+        events.open();
+
+        // a slow loop body does not stretch the cadence; the overrun tick is returned at once
+        StopWatch stopWatch;
+        stopWatch.start();
+        for (uint32_t i = 0U; i < 10U; i++) {
+            if (i == 5U)
+                std::this_thread::sleep_for(std::chrono::milliseconds(12));
+            events.wait(5U);
+        }
+
+        uint32_t ms = stopWatch.elapsed();
+        REQUIRE(ms >= 40U);
+        if (events.isEventDriven())
+            REQUIRE(ms < 80U);
+    }
+
+#if defined(__linux__)
+    SECTION("Jitter_Test") {
+        INFO("Event Loop Jitter Test");
+
+        EventLoop events;
+        REQUIRE(events.open());
+
+        uint32_t maxUs = 0U, avgUs = 0U, peakUs = 0U;
+        // ticks missed by the overrun are accounted once, so run a few extra to complete the window
+        for (uint32_t i = 0U; i < EVENT_LOOP_JITTER_WINDOW + 10U; i++) {
+            if (i == 10U)
+                std::this_thread::sleep_for(std::chrono::milliseconds(3));
+            events.wait(1U);
+        }
+
+        // the overrun tick is at least 2ms late, and is both the window maximum and the peak
+        events.getJitter(maxUs, avgUs, peakUs);
+        REQUIRE(peakUs >= 2000U);
+        REQUIRE(maxUs == peakUs);
+        REQUIRE(avgUs <= maxUs);
+    }
+
+    SECTION("Deadline_Test") {
+        INFO("Event Loop Deadline Test");
+
+        EventLoop events;
+        REQUIRE(events.open());
+
+        // a deadline wait ends at the deadline, not after a relative sleep
+        uint64_t deadline = EventLoop::now() + 20000U;
+        events.waitUntil(deadline, 1000U);
+        uint64_t now = EventLoop::now();
+        REQUIRE(now >= deadline);
+        REQUIRE(now - deadline < 10000U);
+
+        // a past deadline returns at once, and the periodic cadence resumes afterwards
+        StopWatch stopWatch;
+        stopWatch.start();
+        events.waitUntil(deadline, 1000U);
+        REQUIRE(stopWatch.elapsed() < 500U);
+
+        stopWatch.start();
+        events.wait(5U);
+        events.wait(5U);
+        REQUIRE(stopWatch.elapsed() < 500U);
+
+        // without a deadline, only an event (or the timeout) ends the wait
+        std::thread notifier([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            events.notify();
+        });
+
+        stopWatch.start();
+        events.waitUntil(0U, 1000U);
+        uint32_t ms = stopWatch.elapsed();
+        notifier.join();
+
+        REQUIRE(ms >= 10U);
+        REQUIRE(ms < 500U);
+    }
+
+    SECTION("Notify_Test") {
+        INFO("Event Loop Notify Test");
+
+        EventLoop events;
+        REQUIRE(events.open());
+
+        std::thread notifier([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            events.notify();
+        });
+
+        StopWatch stopWatch;
+        stopWatch.start();
+        events.wait(1000U);
+        uint32_t ms = stopWatch.elapsed();
+        notifier.join();
+
+        REQUIRE(ms < 500U);
+    }
+
+    SECTION("Watch_Test") {
+        INFO("Event Loop Watch Test");
+
+        int fds[2U];
+        REQUIRE(::pipe(fds) == 0);
+
+        EventLoop events;
+        REQUIRE(events.open());
+        events.watch(0U, fds[0U]);
+
+        std::thread writer([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            uint8_t b = 0x55U;
+            ssize_t ret = ::write(fds[1U], &b, 1U);
+            (void)ret;
+        });
+
+        StopWatch stopWatch;
+        stopWatch.start();
+        events.wait(1000U);
+        uint32_t ms = stopWatch.elapsed();
+        writer.join();
+
+        REQUIRE(ms < 500U);
+
+        // reopening a descriptor under the same number must be picked up again
+        uint8_t b = 0U;
+        REQUIRE(::read(fds[0U], &b, 1U) == 1);
+        ::close(fds[0U]);
+        ::close(fds[1U]);
+
+        int fds2[2U];
+        REQUIRE(::pipe(fds2) == 0);
+        REQUIRE(fds2[0U] == fds[0U]);
+        events.watch(0U, fds2[0U]);
+
+        REQUIRE(::write(fds2[1U], &b, 1U) == 1);
+        stopWatch.start();
+        events.wait(1000U);
+        REQUIRE(stopWatch.elapsed() < 500U);
+
+        ::close(fds2[0U]);
+        ::close(fds2[1U]);
+    }
+#endif // defined(__linux__)
+}
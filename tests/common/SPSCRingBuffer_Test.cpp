@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/SPSCRingBuffer.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+TEST_CASE("SPSCRingBuffer", "[SPSC Ring Buffer Test]") {
+    SECTION("Wraparound_Test") {
+        INFO("SPSC Ring Buffer Wraparound Test");
+
+        SPSCRingBuffer<short> buffer(100U, "Test Buffer");
+        REQUIRE(buffer.length() == 128U);
+
+        // odd sized frames walk the read and write positions across the end of the storage
+        short in[48U], out[48U];
+        short next = 0, expect = 0;
+        for (uint32_t n = 0U; n < 1000U; n++) {
+            for (uint32_t i = 0U; i < 48U; i++)
+                in[i] = next++;
+
+            REQUIRE(buffer.addData(in, 48U));
+            REQUIRE(buffer.dataSize() == 48U);
+            REQUIRE(buffer.get(out, 48U));
+
+            for (uint32_t i = 0U; i < 48U; i++)
+                REQUIRE(out[i] == expect++);
+        }
+
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.overruns() == 0U);
+        REQUIRE(buffer.underruns() == 0U);
+    }
+
+    SECTION("Overrun_Underrun_Test") {
+        INFO("SPSC Ring Buffer Overrun/Underrun Test");
+
+        SPSCRingBuffer<short> buffer(64U, "Test Buffer");
+
+        short frame[40U];
+        for (uint32_t i = 0U; i < 40U; i++)
+            frame[i] = (short)i;
+
+        REQUIRE(buffer.addData(frame, 40U));
+        REQUIRE_FALSE(buffer.addData(frame, 40U));      // rejected whole, not partially written
+        REQUIRE(buffer.overruns() == 1U);
+        REQUIRE(buffer.dataSize() == 40U);
+
+        short out[40U];
+        REQUIRE(buffer.get(out, 40U));
+        REQUIRE_FALSE(buffer.get(out, 1U));
+        REQUIRE(buffer.underruns() == 1U);
+
+        REQUIRE(buffer.addData(frame, 40U));
+        buffer.clear();
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.freeSpace() == 64U);
+    }
+
+    SECTION("Producer_Consumer_Test") {
+        INFO("SPSC Ring Buffer Producer/Consumer Test");
+
+        const uint32_t frames = 200000U;
+        const uint32_t frameLength = 160U;
+        SPSCRingBuffer<uint32_t> buffer(frameLength * 4U, "Test Buffer");
+
+        std::thread producer([&]() {
+            uint32_t frame[frameLength];
+            for (uint32_t n = 0U; n < frames; n++) {
+                for (uint32_t i = 0U; i < frameLength; i++)
+                    frame[i] = (n * frameLength) + i;
+
+                while (!buffer.addData(frame, frameLength))
+                    std::this_thread::yield();
+            }
+        });
+
+        bool failed = false;
+        uint32_t frame[frameLength];
+        for (uint32_t n = 0U; n < frames; n++) {
+            while (buffer.dataSize() < frameLength)
+                std::this_thread::yield();
+
+            if (!buffer.get(frame, frameLength))
+                failed = true;
+            for (uint32_t i = 0U; i < frameLength; i++) {
+                if (frame[i] != (n * frameLength) + i) {
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        producer.join();
+        REQUIRE(!failed);
+        REQUIRE(buffer.isEmpty());
+    }
+}
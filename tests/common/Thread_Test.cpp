@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Thread.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif // defined(__linux__)
+
+static std::atomic<int> g_cpuCount(-1);
+static std::atomic<bool> g_onCPU(false);
+static int g_cpu = 0;
+
+static void* threadAffinity(void* arg)
+{
+    thread_t* th = (thread_t*)arg;
+    ::pthread_detach(th->thread);
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set) == 0) {
+        g_onCPU = CPU_ISSET(g_cpu, &set);
+        g_cpuCount = CPU_COUNT(&set);
+    }
+#endif // defined(__linux__) && defined(_GNU_SOURCE)
+
+    delete th;
+    return nullptr;
+}
+
+TEST_CASE("Thread", "[Thread Test]") {
+    SECTION("Group_Schedule_Test") {
+        INFO("Thread Group Schedule Test");
+
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "bogus", 0, ""));
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "fifo", 0, ""));
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "rr", 100, ""));
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, "3-1"));
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, "0,x"));
+        REQUIRE_FALSE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, "64"));
+
+        REQUIRE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, "0,2-3"));
+        REQUIRE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "fifo", 50, ""));
+        REQUIRE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, ""));
+    }
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    SECTION("Group_Affinity_Test") {
+        INFO("Thread Group Affinity Test");
+
+        // pin to the first CPU this process may run on
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        REQUIRE(::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set) == 0);
+        while (g_cpu < 63 && !CPU_ISSET(g_cpu, &set))
+            g_cpu++;
+
+        // pinning is applied as the thread is created
+        REQUIRE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, std::to_string(g_cpu)));
+        REQUIRE(Thread::runAsThread(nullptr, threadAffinity, nullptr, THREAD_GROUP_NETWORK));
+
+        for (uint32_t i = 0U; i < 100U && g_cpuCount == -1; i++)
+            Thread::sleep(10U);
+
+        REQUIRE(g_cpuCount == 1);
+        REQUIRE(g_onCPU);
+
+        REQUIRE(Thread::setGroupSchedule(THREAD_GROUP_NETWORK, "other", 0, ""));
+    }
+#endif // defined(__linux__) && defined(_GNU_SOURCE)
+}
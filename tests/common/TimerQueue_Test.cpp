@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "common/Timer.h"
+#include "common/TimerQueue.h"
+#include "common/lookups/AffiliationLookup.h"
+
+using namespace lookups;
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <unordered_map>
+
+const uint32_t AFF_BENCH_UNITS = 50000U;
+const uint32_t AFF_BENCH_TICKS = 10000U;
+const uint32_t AFF_BENCH_WALK_TICKS = 100U;
+
+/* Helper to report the cost of a run of clock ticks. */
+static void reportTicks(const char* name, uint32_t ticks, std::chrono::steady_clock::time_point start)
+{
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ::LogMessage("T", "%s, %u units, %u ticks in %.3f ms, %.3f us/tick", name, AFF_BENCH_UNITS, ticks, secs * 1000.0, (secs * 1000000.0) / ticks);
+}
+
+TEST_CASE("TimerQueue", "[Timer Queue Test]") {
+    SECTION("Expiry_Test") {
+        INFO("Timer Queue Expiry Test");
+
+        TimerQueue timers;
+        std::vector<uint32_t> expired;
+
+        timers.start(1U, 2U);
+        timers.start(2U, 1U);
+        timers.start(3U, 0U);                   // a zero timeout never runs
+        REQUIRE(timers.size() == 2U);
+        REQUIRE(!timers.isRunning(3U));
+        REQUIRE(timers.getTimeout(1U) == 2U);
+
+        timers.clock(999U, expired);
+        REQUIRE(expired.empty());
+
+        timers.clock(1U, expired);
+        REQUIRE(expired.size() == 1U);
+        REQUIRE(expired[0U] == 2U);
+        REQUIRE(!timers.isRunning(2U));
+        REQUIRE(timers.getTimer(1U) == 1U);
+
+        expired.clear();
+        timers.clock(1000U, expired);
+        REQUIRE(expired.size() == 1U);
+        REQUIRE(expired[0U] == 1U);
+        REQUIRE(timers.size() == 0U);
+    }
+
+    SECTION("Restart_Test") {
+        INFO("Timer Queue Restart Test");
+
+        TimerQueue timers;
+        std::vector<uint32_t> expired;
+
+        // restarting pushes the expiry out
+        timers.start(1U, 2U);
+        timers.clock(1500U, expired);
+        timers.start(1U);
+        REQUIRE(timers.getTimer(1U) == 0U);
+
+        timers.clock(1500U, expired);
+        REQUIRE(expired.empty());
+        timers.clock(500U, expired);
+        REQUIRE(expired.size() == 1U);
+
+        // shortening the timeout pulls the expiry in
+        expired.clear();
+        timers.start(2U, 10U);
+        timers.start(2U, 1U);
+        timers.clock(1000U, expired);
+        REQUIRE(expired.size() == 1U);
+        REQUIRE(expired[0U] == 2U);
+
+        // a stopped timer never expires, and a restarted one expires once
+        expired.clear();
+        timers.start(3U, 1U);
+        timers.stop(3U);
+        timers.start(4U, 1U);
+        timers.start(4U, 1U);
+        timers.clock(5000U, expired);
+        REQUIRE(expired.size() == 1U);
+        REQUIRE(expired[0U] == 4U);
+
+        // heavy churn keeps the heap bounded
+        for (uint32_t i = 0U; i < 1000U; i++) {
+            timers.start(i, 5U);
+            timers.stop(i);
+        }
+        REQUIRE(timers.size() == 0U);
+        expired.clear();
+        timers.clock(5000U, expired);
+        REQUIRE(expired.empty());
+    }
+
+    SECTION("Affiliation_Test") {
+        INFO("Timer Queue Affiliation Test");
+
+        ChannelLookup chLookup = ChannelLookup();
+        chLookup.addRFCh(1U);
+
+        AffiliationLookup aff = AffiliationLookup("Test", &chLookup, false);
+
+        uint32_t deregSrcId = 0U;
+        aff.setUnitDeregCallback([&](uint32_t srcId, bool automatic) { if (automatic) deregSrcId = srcId; });
+
+        aff.unitReg(1234U);
+        REQUIRE(aff.isUnitReg(1234U));
+        REQUIRE(aff.unitRegTimeout(1234U) == 43200U);
+
+        REQUIRE(aff.grantCh(1U, 1234U, 5U, true, false));
+        REQUIRE(aff.isGranted(1U));
+
+        aff.clock(4000U);
+        aff.touchGrant(1U);
+        aff.clock(4000U);
+        REQUIRE(aff.isGranted(1U));
+        aff.clock(1000U);
+        REQUIRE(!aff.isGranted(1U));
+        REQUIRE(chLookup.isRFChAvailable());
+
+        aff.touchUnitReg(1234U);
+        REQUIRE(aff.unitRegTimer(1234U) == 0U);
+        aff.clock(43200U * 1000U);
+        REQUIRE(!aff.isUnitReg(1234U));
+        REQUIRE(deregSrcId == 1234U);
+    }
+}
+
+TEST_CASE("TimerQueue", "[.][Timer Queue Benchmark]") {
+    INFO("Timer Queue Affiliation Benchmark Test");
+
+    ChannelLookup chLookup = ChannelLookup();
+    AffiliationLookup aff = AffiliationLookup("Test", &chLookup, false);
+
+    for (uint32_t i = 1U; i <= AFF_BENCH_UNITS; i++) {
+        aff.unitReg(i);
+    }
+    REQUIRE(aff.unitRegSize() == AFF_BENCH_UNITS);
+
+    // clock at the host tick rate while a share of the units keep checking in
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < AFF_BENCH_TICKS; i++) {
+        aff.touchUnitReg((i % AFF_BENCH_UNITS) + 1U);
+        aff.clock(10U);
+    }
+    reportTicks("Affiliation_Bench_Test, timer queue", AFF_BENCH_TICKS, start);
+
+    // for comparison, a timer per unit with every timer clocked on every tick
+    std::unordered_map<uint32_t, Timer> walked;
+    for (uint32_t i = 1U; i <= AFF_BENCH_UNITS; i++) {
+        walked[i] = Timer(1000U, 43200U);
+        walked[i].start();
+    }
+
+    uint32_t expired = 0U;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < AFF_BENCH_WALK_TICKS; i++) {
+        for (auto& entry : walked) {
+            entry.second.clock(10U);
+            if (entry.second.isRunning() && entry.second.hasExpired())
+                expired++;
+        }
+    }
+    reportTicks("Affiliation_Bench_Test, timer walk", AFF_BENCH_WALK_TICKS, start);
+    REQUIRE(expired == 0U);
+    REQUIRE(aff.unitRegSize() == AFF_BENCH_UNITS);
+
+    // every registration times out together
+    start = std::chrono::steady_clock::now();
+    aff.clock(43200U * 1000U);
+    reportTicks("Affiliation_Bench_Test, all expiring", 1U, start);
+    REQUIRE(aff.unitRegSize() == 0U);
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/AMBEFEC.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace edac;
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+TEST_CASE("AMBEFEC", "[AMBE IMBE FEC Test]") {
+    SECTION("IMBE_Batch_Test") {
+        bool failed = false;
+
+        INFO("IMBE FEC LDU Batch Test");
+
+        srand((unsigned int)time(NULL));
+
+        AMBEFEC fec = AMBEFEC();
+
+        // regenerating random frames yields valid code words
+        uint8_t frames[9U * IMBE_FEC_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < 9U * IMBE_FEC_LENGTH_BYTES; i++)
+            frames[i] = rand();
+        fec.regenerateIMBE(frames, 9U, nullptr);
+
+        uint8_t corrupt[9U * IMBE_FEC_LENGTH_BYTES];
+        ::memcpy(corrupt, frames, 9U * IMBE_FEC_LENGTH_BYTES);
+
+        // corrupt one FEC protected bit (c0 - c6) in every other frame
+        for (uint32_t n = 0U; n < 9U; n += 2U) {
+            uint32_t bit = IMBE_INTERLEAVE[(n * 15U) % 137U];
+            corrupt[(n * IMBE_FEC_LENGTH_BYTES) + (bit >> 3)] ^= BIT_MASK_TABLE[bit & 7U];
+        }
+
+        uint32_t errors[9U];
+        uint32_t total = fec.regenerateIMBE(corrupt, 9U, errors);
+
+        for (uint32_t n = 0U; n < 9U; n++) {
+            if (errors[n] != (((n & 1U) == 0U) ? 1U : 0U)) {
+                ::LogDebug("T", "IMBE_Batch_Test, frame %u, errors = %u", n, errors[n]);
+                failed = true;
+            }
+        }
+
+        if (total != 5U) {
+            ::LogDebug("T", "IMBE_Batch_Test, total errors = %u", total);
+            failed = true;
+        }
+
+        if (::memcmp(corrupt, frames, 9U * IMBE_FEC_LENGTH_BYTES) != 0) {
+            Utils::dump(2U, "IMBE_Batch_Test, regenerated", corrupt, 9U * IMBE_FEC_LENGTH_BYTES);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("IMBE_Correction_Test") {
+        bool failed = false;
+
+        INFO("IMBE FEC Single Bit Correction Test");
+
+        AMBEFEC fec = AMBEFEC();
+
+        uint8_t frame[IMBE_FEC_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < IMBE_FEC_LENGTH_BYTES; i++)
+            frame[i] = rand();
+        fec.regenerateIMBE(frame);
+
+        // flip every FEC protected bit (the 7 bits of c7 are not protected)
+        for (uint32_t i = 0U; i < 137U; i++) {
+            uint32_t bit = IMBE_INTERLEAVE[i];
+
+            uint8_t corrupt[IMBE_FEC_LENGTH_BYTES];
+            ::memcpy(corrupt, frame, IMBE_FEC_LENGTH_BYTES);
+            corrupt[bit >> 3] ^= BIT_MASK_TABLE[bit & 7U];
+
+            uint32_t errors = fec.measureP25BER(corrupt);
+            if (fec.regenerateIMBE(corrupt) != 1U || errors != 1U || ::memcmp(corrupt, frame, IMBE_FEC_LENGTH_BYTES) != 0) {
+                ::LogDebug("T", "IMBE_Correction_Test, failed to correct bit %u", i);
+                failed = true;
+                break;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("DMR_Batch_Test") {
+        bool failed = false;
+
+        INFO("AMBE FEC DMR Burst Test");
+
+        AMBEFEC fec = AMBEFEC();
+
+        // random frames mostly regenerate as silence, whose B word only becomes a valid code word on the
+        // second pass
+        uint8_t burst[33U];
+        for (uint32_t i = 0U; i < 33U; i++)
+            burst[i] = rand();
+        fec.regenerateDMR(burst);
+        fec.regenerateDMR(burst);
+
+        uint8_t corrupt[33U];
+        ::memcpy(corrupt, burst, 33U);
+
+        // two A word bit errors in the first frame, one in each half of the second frame and none in the third
+        corrupt[0U] ^= 0x80U;
+        corrupt[1U] ^= 0x08U;
+        corrupt[9U] ^= 0x80U;
+        corrupt[20U] ^= 0x08U;
+
+        uint32_t errors[3U];
+        uint32_t total = fec.regenerateDMR(corrupt, errors);
+
+        if (errors[0U] != 2U || errors[1U] != 2U || errors[2U] != 0U || total != 4U) {
+            ::LogDebug("T", "DMR_Batch_Test, errors = %u, %u, %u", errors[0U], errors[1U], errors[2U]);
+            failed = true;
+        }
+
+        if (::memcmp(corrupt, burst, 33U) != 0) {
+            Utils::dump(2U, "DMR_Batch_Test, regenerated", corrupt, 33U);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
+
+TEST_CASE("AMBEFEC", "[.][AMBEFEC Benchmark]") {
+    AMBEFEC fec = AMBEFEC();
+
+    uint8_t frames[9U * IMBE_FEC_LENGTH_BYTES];
+    for (uint32_t i = 0U; i < 9U * IMBE_FEC_LENGTH_BYTES; i++)
+        frames[i] = i * 0x11U;
+    fec.regenerateIMBE(frames, 9U, nullptr);
+    frames[4U] ^= 0x08U;
+
+    uint8_t burst[33U];
+    for (uint32_t i = 0U; i < 33U; i++)
+        burst[i] = i * 0x11U;
+    fec.regenerateDMR(burst);
+    fec.regenerateDMR(burst);
+    burst[4U] ^= 0x08U;
+
+    BENCHMARK("IMBE LDU Regenerate") {
+        uint8_t data[9U * IMBE_FEC_LENGTH_BYTES];
+        ::memcpy(data, frames, 9U * IMBE_FEC_LENGTH_BYTES);
+        return fec.regenerateIMBE(data, 9U, nullptr);
+    };
+
+    BENCHMARK("AMBE DMR Burst Regenerate") {
+        uint8_t data[33U];
+        ::memcpy(data, burst, 33U);
+        return fec.regenerateDMR(data);
+    };
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/BPTC19696.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace edac;
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+TEST_CASE("BPTC19696", "[BPTC 196,96 Test]") {
+    SECTION("BPTC19696_Golden_Test") {
+        bool failed = false;
+
+        INFO("BPTC (196,96) Golden Vector Test");
+
+        const uint8_t payload[] = { 0x00U, 0x10U, 0x00U, 0x12U, 0x34U, 0x56U, 0x00U, 0xC0U, 0xFFU, 0xEEU, 0x3CU, 0x5AU };
+
+        // the slot type and sync (bytes 12 - 20) of the burst must be left untouched
+        const uint8_t expected[] = {
+            0x14U, 0xA0U, 0x13U, 0xB8U, 0x31U, 0xE4U, 0x1FU, 0xE8U, 0x78U, 0xC0U, 0x96U, 0x23U, 0xA5U, 0xA5U, 0xA5U, 0xA5U,
+            0xA5U, 0xA5U, 0xA5U, 0xA5U, 0xA6U, 0x4DU, 0x26U, 0xE8U, 0x4CU, 0x11U, 0x1FU, 0x06U, 0x67U, 0xC8U, 0xF6U, 0x16U,
+            0xADU
+        };
+
+        uint8_t data[33U];
+        ::memset(data, 0xA5U, 33U);
+
+        BPTC19696 bptc;
+        bptc.encode(payload, data);
+
+        Utils::dump(2U, "BPTC19696_Golden_Test, encoded", data, 33U);
+
+        if (::memcmp(data, expected, 33U) != 0) {
+            ::LogDebug("T", "BPTC19696_Golden_Test, encoded data mismatch");
+            failed = true;
+        }
+
+        // inject errors into three different rows
+        data[2U] ^= 0x40U;
+        data[9U] ^= 0x01U;
+        data[25U] ^= 0x02U;
+
+        uint8_t decoded[12U];
+        bptc.decode(data, decoded);
+
+        if (::memcmp(decoded, payload, 12U) != 0) {
+            Utils::dump(2U, "BPTC19696_Golden_Test, decoded", decoded, 12U);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("BPTC19696_Correction_Test") {
+        bool failed = false;
+
+        INFO("BPTC (196,96) Single Bit Correction Test");
+
+        srand((unsigned int)time(NULL));
+
+        uint8_t payload[12U];
+        for (uint32_t i = 0U; i < 12U; i++)
+            payload[i] = rand();
+
+        uint8_t data[33U];
+        ::memset(data, 0x00U, 33U);
+
+        BPTC19696 bptc;
+        bptc.encode(payload, data);
+
+        // flip every single coded bit (the slot type and sync bits are skipped)
+        for (uint32_t i = 0U; i < 264U; i++) {
+            if (i >= 98U && i < 166U)
+                continue;
+
+            uint8_t corrupt[33U];
+            ::memcpy(corrupt, data, 33U);
+            corrupt[i >> 3] ^= BIT_MASK_TABLE[i & 7U];
+
+            uint8_t decoded[12U];
+            bptc.decode(corrupt, decoded);
+
+            if (::memcmp(decoded, payload, 12U) != 0) {
+                ::LogDebug("T", "BPTC19696_Correction_Test, failed to correct bit %u", i);
+                failed = true;
+                break;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+}
+
+TEST_CASE("BPTC19696", "[.][BPTC19696 Benchmark]") {
+    uint8_t payload[12U];
+    for (uint32_t i = 0U; i < 12U; i++)
+        payload[i] = i * 0x11U;
+
+    uint8_t data[33U];
+    ::memset(data, 0x00U, 33U);
+
+    BPTC19696 enc;
+    enc.encode(payload, data);
+    data[5U] ^= 0x08U;
+
+    BENCHMARK("BPTC19696 Decode") {
+        BPTC19696 bptc;
+        bptc.decode(data, payload);
+        return payload[0U];
+    };
+
+    BENCHMARK("BPTC19696 Encode") {
+        BPTC19696 bptc;
+        bptc.encode(payload, data);
+        return data[0U];
+    };
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/Trellis.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace edac;
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+TEST_CASE("Trellis", "[Trellis Test]") {
+    SECTION("Trellis34_Golden_Test") {
+        bool failed = false;
+
+        INFO("Trellis 3/4 Rate Golden Vector Test");
+
+        const uint8_t payload[] = {
+            0x00U, 0x10U, 0x00U, 0x12U, 0x34U, 0x56U, 0x00U, 0xC0U, 0xFFU, 0xEEU, 0x3CU, 0x5AU, 0x81U, 0x42U, 0x24U, 0x18U,
+            0xA5U, 0x0FU
+        };
+
+        // the slot type and sync (bits 98 - 165) of the burst must be left untouched
+        const uint8_t expected[] = {
+            0x2EU, 0x2FU, 0x7FU, 0x8AU, 0xF0U, 0xF6U, 0xB2U, 0x27U, 0x52U, 0x1DU, 0x8FU, 0xEBU, 0xE5U, 0xA5U, 0xA5U, 0xA5U,
+            0xA5U, 0xA5U, 0xA5U, 0xA5U, 0xA7U, 0x22U, 0xA7U, 0xD5U, 0x38U, 0xE7U, 0x80U, 0xD2U, 0xC3U, 0xB8U, 0xCFU, 0xFAU,
+            0x7DU
+        };
+
+        uint8_t data[33U];
+        ::memset(data, 0xA5U, 33U);
+
+        Trellis trellis;
+        trellis.encode34(payload, data, true);
+
+        if (::memcmp(data, expected, 33U) != 0) {
+            Utils::dump(2U, "Trellis34_Golden_Test, encoded", data, 33U);
+            failed = true;
+        }
+
+        // inject a symbol error into each half of the burst
+        data[3U] ^= 0x40U;
+        data[27U] ^= 0x02U;
+
+        uint8_t decoded[18U];
+        if (!trellis.decode34(data, decoded, true) || ::memcmp(decoded, payload, 18U) != 0) {
+            Utils::dump(2U, "Trellis34_Golden_Test, decoded", decoded, 18U);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("Trellis12_Golden_Test") {
+        bool failed = false;
+
+        INFO("Trellis 1/2 Rate Golden Vector Test");
+
+        const uint8_t payload[] = { 0x00U, 0x10U, 0x00U, 0x12U, 0x34U, 0x56U, 0x00U, 0xC0U, 0xFFU, 0xEEU, 0x3CU, 0x5AU };
+
+        const uint8_t expected[] = {
+            0x22U, 0x22U, 0x9CU, 0x9FU, 0xF8U, 0x9CU, 0x92U, 0xC2U, 0xCFU, 0x02U, 0x58U, 0x6FU, 0x02U, 0xE2U, 0xEBU, 0x02U,
+            0x28U, 0x48U, 0xD2U, 0x22U, 0x1EU, 0xD2U, 0x28U, 0x65U, 0xA0U
+        };
+
+        uint8_t data[25U];
+        ::memset(data, 0x00U, 25U);
+
+        Trellis trellis;
+        trellis.encode12(payload, data);
+
+        if (::memcmp(data, expected, 25U) != 0) {
+            Utils::dump(2U, "Trellis12_Golden_Test, encoded", data, 25U);
+            failed = true;
+        }
+
+        data[11U] ^= 0x10U;
+
+        uint8_t decoded[12U];
+        if (!trellis.decode12(data, decoded) || ::memcmp(decoded, payload, 12U) != 0) {
+            Utils::dump(2U, "Trellis12_Golden_Test, decoded", decoded, 12U);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("Trellis_RoundTrip_Test") {
+        bool failed = false;
+
+        INFO("Trellis Random Round Trip Test");
+
+        srand((unsigned int)time(NULL));
+
+        Trellis trellis;
+        for (uint32_t n = 0U; n < 100U; n++) {
+            uint8_t payload[18U];
+            for (uint32_t i = 0U; i < 18U; i++)
+                payload[i] = rand();
+
+            uint8_t data[33U];
+            ::memset(data, 0x00U, 33U);
+            trellis.encode34(payload, data, (n & 1U) == 1U);
+
+            uint8_t decoded[18U];
+            if (!trellis.decode34(data, decoded, (n & 1U) == 1U) || ::memcmp(decoded, payload, 18U) != 0) {
+                Utils::dump(2U, "Trellis_RoundTrip_Test, payload", payload, 18U);
+                failed = true;
+                break;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+}
+
+TEST_CASE("Trellis", "[.][Trellis Benchmark]") {
+    uint8_t payload[18U];
+    for (uint32_t i = 0U; i < 18U; i++)
+        payload[i] = i * 0x11U;
+
+    uint8_t data[33U];
+    ::memset(data, 0x00U, 33U);
+
+    Trellis enc;
+    enc.encode12(payload, data);
+
+    BENCHMARK("Trellis 1/2 Rate Decode") {
+        Trellis trellis;
+        trellis.decode12(data, payload);
+        return payload[0U];
+    };
+
+    BENCHMARK("Trellis 3/4 Rate Encode") {
+        Trellis trellis;
+        trellis.encode34(payload, data, true);
+        return data[0U];
+    };
+}
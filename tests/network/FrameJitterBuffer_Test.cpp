@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/FrameJitterBuffer.h"
+#include "common/network/RTPFNEHeader.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define TEST_FRAME_MS 60U
+#define TEST_TICK_MS 10U
+#define TEST_TERMINATOR 0xFFU
+
+// ---------------------------------------------------------------------------
+//  Helpers
+// ---------------------------------------------------------------------------
+
+/* Helper to get the RTP sequence of a test frame; the DVM sequence wraps before RTP_END_OF_CALL_SEQ. */
+
+static uint16_t frameSeq(uint32_t n)
+{
+    return (uint16_t)((65530U + n) % RTP_END_OF_CALL_SEQ);
+}
+
+/* Helper to release every due frame, recording the frame numbers. */
+
+static void drain(FrameJitterBuffer& buffer, uint64_t now, std::vector<uint8_t>& released)
+{
+    uint8_t data[JITTER_BUFFER_FRAME_LEN];
+    uint32_t length = 0U;
+    while (buffer.getFrame(now, data, length)) {
+        REQUIRE(length == 4U);
+        released.push_back(data[0U]);
+    }
+}
+
+TEST_CASE("FrameJitterBuffer", "[Frame Jitter Buffer Test]") {
+    SECTION("Reorder_Loss_Test") {
+        INFO("Frame Jitter Buffer Reorder and Loss Test");
+
+        const uint32_t frames = 30U;
+
+        // arrival time of every frame; frames arrive on time unless perturbed here
+        std::vector<int64_t> arriveAt(frames);
+        for (uint32_t n = 0U; n < frames; n++)
+            arriveAt[n] = n * TEST_FRAME_MS;
+
+        std::swap(arriveAt[5U], arriveAt[6U]);              // reordered
+        arriveAt[10U] = -1;                                 // lost
+        arriveAt[20U] += 600U;                              // delayed past its playout point
+
+        FrameJitterBuffer buffer("Test", 60U, 360U);
+        std::vector<uint8_t> released;
+
+        uint64_t end = (frames * TEST_FRAME_MS) + 2000U;
+        for (uint64_t t = 0U; t < end; t += TEST_TICK_MS) {
+            for (uint32_t n = 0U; n < frames; n++) {
+                if (arriveAt[n] != (int64_t)t)
+                    continue;
+
+                uint8_t data[4U] = { (uint8_t)n, 0x00U, 0x00U, 0x00U };
+                bool buffered = buffer.addFrame(1U, frameSeq(n), data, 4U, t);
+                REQUIRE(buffered == (n != 20U));
+
+                // frame 3 arrives twice
+                if (n == 3U)
+                    REQUIRE(!buffer.addFrame(1U, frameSeq(n), data, 4U, t));
+            }
+
+            // the call terminator is sent without a sequence, right behind the last frame
+            if (t == (frames - 1U) * TEST_FRAME_MS) {
+                uint8_t data[4U] = { TEST_TERMINATOR, 0x00U, 0x00U, 0x00U };
+                REQUIRE(buffer.addFrame(1U, RTP_END_OF_CALL_SEQ, data, 4U, t));
+            }
+
+            // nothing is released before the stream has been held for the minimum delay
+            if (t < 60U) {
+                uint8_t data[JITTER_BUFFER_FRAME_LEN];
+                uint32_t length = 0U;
+                REQUIRE(!buffer.getFrame(t, data, length));
+                continue;
+            }
+
+            drain(buffer, t, released);
+        }
+
+        // every frame that arrived in time is released exactly once and in order, then the terminator
+        std::vector<uint8_t> expected;
+        for (uint32_t n = 0U; n < frames; n++) {
+            if (n != 10U && n != 20U)
+                expected.push_back((uint8_t)n);
+        }
+        expected.push_back(TEST_TERMINATOR);
+
+        REQUIRE(released == expected);
+
+        std::vector<JitterBufferStats> streams;
+        JitterBufferStats totals;
+        buffer.getStats(streams, totals);
+
+        // the stream has gone quiet, and has been folded into the totals
+        REQUIRE(streams.empty());
+        REQUIRE(totals.depth == 0U);
+        REQUIRE(totals.received == frames - 1U);
+        REQUIRE(totals.released == frames - 1U);
+        REQUIRE(totals.reordered == 1U);
+        REQUIRE(totals.duplicates == 1U);
+        REQUIRE(totals.late == 1U);
+        REQUIRE(totals.lost == 2U);
+    }
+
+    SECTION("Streams_Test") {
+        INFO("Frame Jitter Buffer Streams Test");
+
+        FrameJitterBuffer buffer("Test", 60U, 360U);
+        std::vector<uint8_t> released;
+
+        // two streams, each with its own sequence
+        for (uint32_t n = 0U; n < 4U; n++) {
+            uint8_t a[4U] = { (uint8_t)n, 0x00U, 0x00U, 0x00U };
+            uint8_t b[4U] = { (uint8_t)(0x80U + n), 0x00U, 0x00U, 0x00U };
+            REQUIRE(buffer.addFrame(1U, (uint16_t)n, a, 4U, n * TEST_FRAME_MS));
+            REQUIRE(buffer.addFrame(2U, (uint16_t)(100U + n), b, 4U, n * TEST_FRAME_MS));
+        }
+
+        std::vector<JitterBufferStats> streams;
+        JitterBufferStats totals;
+        buffer.getStats(streams, totals);
+        REQUIRE(streams.size() == 2U);
+        REQUIRE(totals.depth == 8U);
+
+        drain(buffer, 4U * TEST_FRAME_MS, released);
+        REQUIRE(released.size() == 8U);
+
+        std::vector<uint8_t> a, b;
+        for (uint8_t n : released) {
+            if (n & 0x80U)
+                b.push_back(n);
+            else
+                a.push_back(n);
+        }
+
+        REQUIRE(a == std::vector<uint8_t>({ 0x00U, 0x01U, 0x02U, 0x03U }));
+        REQUIRE(b == std::vector<uint8_t>({ 0x80U, 0x81U, 0x82U, 0x83U }));
+
+        // a reset drops whatever is held
+        uint8_t data[4U] = { 0x04U, 0x00U, 0x00U, 0x00U };
+        REQUIRE(buffer.addFrame(1U, 5U, data, 4U, 5U * TEST_FRAME_MS));
+        buffer.reset();
+        drain(buffer, 10U * TEST_FRAME_MS, released);
+        REQUIRE(released.size() == 8U);
+
+        buffer.getStats(streams, totals);
+        REQUIRE(streams.empty());
+        REQUIRE(totals.received == 9U);
+        REQUIRE(totals.released == 8U);
+    }
+
+    SECTION("Adaptive_Delay_Test") {
+        INFO("Frame Jitter Buffer Adaptive Delay Test");
+
+        FrameJitterBuffer buffer("Test", 60U, 360U);
+        std::vector<uint8_t> released;
+        uint8_t data[4U] = { 0x00U, 0x00U, 0x00U, 0x00U };
+
+        // a steady stream keeps the minimum delay
+        uint64_t t = 0U;
+        for (uint32_t n = 0U; n < 100U; n++, t += TEST_FRAME_MS) {
+            buffer.addFrame(1U, (uint16_t)n, data, 4U, t);
+            drain(buffer, t, released);
+        }
+
+        std::vector<JitterBufferStats> streams;
+        JitterBufferStats totals;
+        buffer.getStats(streams, totals);
+        REQUIRE(streams.size() == 1U);
+        REQUIRE(streams[0U].delayMs == 60U);
+
+        // a bursty stream (frames arriving in clumps of three) raises it
+        for (uint32_t n = 0U; n < 150U; n++) {
+            uint64_t arrival = t + ((n / 3U) * 3U * TEST_FRAME_MS);
+            buffer.addFrame(2U, (uint16_t)n, data, 4U, arrival);
+            drain(buffer, arrival, released);
+        }
+
+        // (the steady stream has gone quiet by now, and been retired)
+        buffer.getStats(streams, totals);
+        REQUIRE(streams.size() == 1U);
+        REQUIRE(streams[0U].streamId == 2U);
+
+        JitterBufferStats bursty = streams[0U];
+        REQUIRE(bursty.jitterMs > 0U);
+        REQUIRE(bursty.delayMs > 60U);
+        REQUIRE(bursty.delayMs <= 360U);
+
+        // the next stream starts from what the last one measured
+        drain(buffer, t + 60000U, released);
+        buffer.addFrame(3U, 0U, data, 4U, t + 60000U);
+        buffer.getStats(streams, totals);
+        REQUIRE(streams.size() == 1U);
+        REQUIRE(streams[0U].delayMs == totals.delayMs);
+        REQUIRE(totals.delayMs > 60U);
+    }
+}
@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/RTPHeader.h"
+#include "common/network/RTPJitterBuffer.h"
+#include "common/network/udp/Socket.h"
+#include "common/Thread.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+#define TEST_FRAME_LENGTH 160U
+#define TEST_FRAME_MS 20U
+#define TEST_LOOPBACK_PORT 34597U
+
+// ---------------------------------------------------------------------------
+//  Helpers
+// ---------------------------------------------------------------------------
+
+/* Helper to get the constant sample value identifying a test frame. */
+
+static short frameValue(uint32_t n)
+{
+    return (short)(1000 + (n * 16));
+}
+
+/* Helper to add a test frame carrying the given RTP sequence number to a jitter buffer. */
+
+static bool addSequence(RTPJitterBuffer& buffer, uint16_t seq, uint32_t n)
+{
+    frame::RTPHeader header;
+    header.setSequence(seq);
+    header.setTimestamp(n * TEST_FRAME_LENGTH);
+
+    short samples[TEST_FRAME_LENGTH];
+    for (uint32_t i = 0U; i < TEST_FRAME_LENGTH; i++)
+        samples[i] = frameValue(n);
+
+    return buffer.addFrame(header, samples, (uint64_t)n * TEST_FRAME_MS);
+}
+
+/* Helper to build an RTP audio packet for a test frame. */
+
+static void buildPacket(uint32_t n, uint8_t* packet)
+{
+    frame::RTPHeader header;
+    header.setPayloadType(96U);
+    header.setSequence((uint16_t)(65500U + n));            // exercises sequence wraparound
+    header.setTimestamp(n * TEST_FRAME_LENGTH);
+    header.setSSRC(0x12345678U);
+    header.encode(packet);
+
+    short value = frameValue(n);
+    for (uint32_t i = 0U; i < TEST_FRAME_LENGTH; i++) {
+        packet[RTP_HEADER_LENGTH_BYTES + (i * 2U) + 0U] = (uint8_t)((value >> 8) & 0xFFU);
+        packet[RTP_HEADER_LENGTH_BYTES + (i * 2U) + 1U] = (uint8_t)(value & 0xFFU);
+    }
+}
+
+TEST_CASE("RTPJitterBuffer", "[RTP Jitter Buffer Test]") {
+    SECTION("Loopback_Reorder_Delay_Loss_Test") {
+        INFO("RTP Jitter Buffer Loopback Test");
+
+        const uint32_t frames = 60U;
+        const uint32_t packetLength = RTP_HEADER_LENGTH_BYTES + (TEST_FRAME_LENGTH * 2U);
+
+        udp::Socket rx("127.0.0.1", TEST_LOOPBACK_PORT);
+        REQUIRE(rx.open());
+        udp::Socket tx("127.0.0.1", 0U);
+        REQUIRE(tx.open());
+
+        sockaddr_storage rxAddr;
+        uint32_t rxAddrLen;
+        REQUIRE(udp::Socket::lookup("127.0.0.1", TEST_LOOPBACK_PORT, rxAddr, rxAddrLen) == 0);
+
+        // send time (in frame periods) of every frame; frames are sent on time unless perturbed here
+        std::vector<int32_t> sendAt(frames);
+        for (uint32_t n = 0U; n < frames; n++)
+            sendAt[n] = (int32_t)n;
+
+        std::swap(sendAt[10U], sendAt[11U]);                // reordered
+        std::swap(sendAt[40U], sendAt[42U]);                // reordered across two frames
+        sendAt[20U] = -1;                                   // lost
+        sendAt[35U] = -1;                                   // lost
+        sendAt[30U] = 38;                                   // delayed past its playout time
+        sendAt[15U] = 16;                                   // delayed, but still in time
+
+        RTPJitterBuffer buffer(TEST_FRAME_LENGTH, 3U, 8U);
+
+        std::vector<short> played;
+        uint32_t received = 0U;
+        uint32_t sent = 0U;
+
+        for (uint32_t t = 0U; t < frames + 16U; t++) {
+            for (uint32_t n = 0U; n < frames; n++) {
+                if (sendAt[n] != (int32_t)t)
+                    continue;
+
+                uint8_t packet[packetLength];
+                buildPacket(n, packet);
+                REQUIRE(tx.write(packet, packetLength, rxAddr, rxAddrLen));
+                sent++;
+
+                // frame 5 is sent twice
+                if (n == 5U) {
+                    REQUIRE(tx.write(packet, packetLength, rxAddr, rxAddrLen));
+                    sent++;
+                }
+            }
+
+            // drain the loopback socket
+            for (uint32_t tries = 0U; received < sent && tries < 500U; tries++) {
+                uint8_t packet[packetLength];
+                sockaddr_storage addr;
+                uint32_t addrLen;
+                ssize_t len = rx.read(packet, packetLength, addr, addrLen);
+                if (len <= 0) {
+                    Thread::sleep(1U);
+                    continue;
+                }
+
+                REQUIRE(len == (ssize_t)packetLength);
+                received++;
+
+                frame::RTPHeader header;
+                REQUIRE(header.decode(packet));
+
+                short samples[TEST_FRAME_LENGTH];
+                for (uint32_t i = 0U; i < TEST_FRAME_LENGTH; i++)
+                    samples[i] = (short)((packet[RTP_HEADER_LENGTH_BYTES + (i * 2U)] << 8) | packet[RTP_HEADER_LENGTH_BYTES + (i * 2U) + 1U]);
+
+                buffer.addFrame(header, samples, (uint64_t)t * TEST_FRAME_MS);
+            }
+
+            short samples[TEST_FRAME_LENGTH];
+            if (buffer.getFrame(samples))
+                played.push_back(samples[0U]);
+        }
+
+        rx.close();
+        tx.close();
+
+        REQUIRE(received == sent);
+
+        // every frame that arrived in time is played exactly once and in order; the gaps are concealed
+        std::vector<short> expected;
+        for (uint32_t n = 0U; n < frames; n++) {
+            if (n != 20U && n != 30U && n != 35U)
+                expected.push_back(frameValue(n));
+        }
+
+        std::vector<short> real;
+        for (short value : played) {
+            if (value >= frameValue(0U))
+                real.push_back(value);
+        }
+
+        REQUIRE(real == expected);
+        REQUIRE(buffer.duplicates() == 1U);
+        REQUIRE(buffer.late() == 1U);
+        REQUIRE(buffer.concealed() >= 3U);
+        REQUIRE(!buffer.playing());
+    }
+
+    SECTION("Adaptive_Delay_Test") {
+        INFO("RTP Jitter Buffer Adaptive Delay Test");
+
+        RTPJitterBuffer buffer(TEST_FRAME_LENGTH, 2U, 10U);
+        short samples[TEST_FRAME_LENGTH];
+        for (uint32_t i = 0U; i < TEST_FRAME_LENGTH; i++)
+            samples[i] = 1000;
+
+        // a steady stream keeps the minimum delay
+        uint32_t n = 0U;
+        for (; n < 100U; n++) {
+            frame::RTPHeader header;
+            header.setSequence((uint16_t)n);
+            header.setTimestamp(n * TEST_FRAME_LENGTH);
+            buffer.addFrame(header, samples, (uint64_t)n * TEST_FRAME_MS);
+            buffer.getFrame(samples);
+        }
+
+        while (buffer.getFrame(samples))
+            ;
+        buffer.getFrame(samples);
+        REQUIRE(buffer.targetDelay() == 2U);
+
+        // a bursty stream (frames arriving in clumps of three) raises it at the next talkspurt
+        for (uint32_t i = 0U; i < 150U; i++, n++) {
+            frame::RTPHeader header;
+            header.setSequence((uint16_t)n);
+            header.setTimestamp(n * TEST_FRAME_LENGTH);
+            buffer.addFrame(header, samples, (uint64_t)((n / 3U) * 3U) * TEST_FRAME_MS + 40U);
+            buffer.getFrame(samples);
+        }
+
+        while (buffer.getFrame(samples))
+            ;
+        buffer.getFrame(samples);
+        REQUIRE(buffer.jitterMs() > 0U);
+        REQUIRE(buffer.targetDelay() > 2U);
+        REQUIRE(buffer.targetDelay() <= 10U);
+    }
+
+    SECTION("Reordered_Talkspurt_Start_Test") {
+        INFO("RTP Jitter Buffer Reordered Talkspurt Start Test");
+
+        RTPJitterBuffer buffer(TEST_FRAME_LENGTH, 2U, 10U);
+        short samples[TEST_FRAME_LENGTH];
+        std::vector<short> played;
+
+        // the first two frames of the talkspurt arrive swapped (sequence 11, 10, 12, 13)
+        REQUIRE(addSequence(buffer, 11U, 1U));
+        REQUIRE(addSequence(buffer, 10U, 0U));
+        REQUIRE(addSequence(buffer, 12U, 2U));
+        REQUIRE(addSequence(buffer, 13U, 3U));
+        REQUIRE(buffer.depth() == 4U);
+
+        uint32_t periods = 0U;
+        for (; periods < 100U; periods++) {
+            if (!buffer.getFrame(samples))
+                break;
+            played.push_back(samples[0U]);
+        }
+
+        REQUIRE(periods < 100U);
+        REQUIRE(!buffer.playing());
+        REQUIRE(buffer.depth() == 0U);
+
+        std::vector<short> real;
+        for (short value : played) {
+            if (value >= frameValue(0U))
+                real.push_back(value);
+        }
+
+        std::vector<short> expected;
+        for (uint32_t n = 0U; n < 4U; n++)
+            expected.push_back(frameValue(n));
+        REQUIRE(real == expected);
+        REQUIRE(buffer.late() == 0U);
+        REQUIRE(buffer.concealed() == 3U);
+    }
+
+    SECTION("Sequence_Wraparound_Test") {
+        INFO("RTP Jitter Buffer Sequence Wraparound Test");
+
+        RTPJitterBuffer buffer(TEST_FRAME_LENGTH, 2U, 10U);
+        short samples[TEST_FRAME_LENGTH];
+        std::vector<short> played;
+
+        // frames 0 - 5 (sequence 65530 - 65535), of which all but the last are played out
+        for (uint32_t n = 0U; n < 6U; n++)
+            REQUIRE(addSequence(buffer, (uint16_t)(65530U + n), n));
+        for (uint32_t n = 0U; n < 5U; n++) {
+            REQUIRE(buffer.getFrame(samples));
+            played.push_back(samples[0U]);
+        }
+        REQUIRE(buffer.depth() == 1U);
+
+        // a burst of frames 6 - 21 (sequence 0 - 15) arrives while sequence 65535 is still buffered;
+        // sequence 15 is 16 frames ahead of it, within the window, and must not displace it
+        for (uint32_t n = 6U; n < 22U; n++)
+            REQUIRE(addSequence(buffer, (uint16_t)(65530U + n), n));
+        REQUIRE(buffer.depth() == 17U);
+
+        uint32_t periods = 0U;
+        for (; periods < 100U; periods++) {
+            if (!buffer.getFrame(samples))
+                break;
+            played.push_back(samples[0U]);
+        }
+
+        // the talkspurt ends once the buffer runs dry
+        REQUIRE(periods < 100U);
+        REQUIRE(!buffer.playing());
+        REQUIRE(buffer.depth() == 0U);
+
+        std::vector<short> real;
+        for (short value : played) {
+            if (value >= frameValue(0U))
+                real.push_back(value);
+        }
+
+        std::vector<short> expected;
+        for (uint32_t n = 0U; n < 22U; n++)
+            expected.push_back(frameValue(n));
+        REQUIRE(real == expected);
+        REQUIRE(buffer.concealed() == 3U);
+    }
+}
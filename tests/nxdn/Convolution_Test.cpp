@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/nxdn/edac/Convolution.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace nxdn::edac;
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+// 92 data bits followed by the 4 zero tail bits (the length of a FACCH1 with CRC)
+const uint32_t CONV_TEST_LENGTH_BITS = 96U;
+const uint32_t CONV_TEST_LENGTH_BYTES = CONV_TEST_LENGTH_BITS / 8U;
+
+/* Helper to encode a random block into depunctured symbols (0 or 2), with the 8 zero flush symbols appended. */
+static void encodeSymbols(const uint8_t* data, uint8_t* symbols)
+{
+    uint8_t encoded[CONV_TEST_LENGTH_BYTES * 2U];
+    ::memset(encoded, 0x00U, CONV_TEST_LENGTH_BYTES * 2U);
+
+    Convolution conv;
+    conv.encode(data, encoded, CONV_TEST_LENGTH_BITS);
+
+    for (uint32_t i = 0U; i < CONV_TEST_LENGTH_BITS * 2U; i++)
+        symbols[i] = READ_BIT(encoded, i) ? 2U : 0U;
+    for (uint32_t i = 0U; i < 8U; i++)
+        symbols[(CONV_TEST_LENGTH_BITS * 2U) + i] = 0U;
+}
+
+TEST_CASE("NXDN", "[Convolution Test]") {
+    SECTION("NXDN_Convolution_Test") {
+        bool failed = false;
+
+        INFO("NXDN Convolution Block Decode Test");
+
+        srand((unsigned int)time(NULL));
+
+        uint8_t data[CONV_TEST_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < CONV_TEST_LENGTH_BYTES; i++)
+            data[i] = rand();
+        data[CONV_TEST_LENGTH_BYTES - 1U] &= 0xF0U;
+
+        uint8_t symbols[(CONV_TEST_LENGTH_BITS * 2U) + 8U];
+        encodeSymbols(data, symbols);
+
+        // flip a few well separated symbols and erase (puncture) another
+        symbols[10U] ^= 0x02U;
+        symbols[75U] ^= 0x02U;
+        symbols[140U] ^= 0x02U;
+        symbols[111U] = 1U;
+
+        Convolution conv;
+        conv.start();
+        if (!conv.decodeBlock(symbols, CONV_TEST_LENGTH_BITS + 4U)) {
+            ::LogDebug("T", "NXDN_Convolution_Test, block decode failed");
+            failed = true;
+        }
+
+        uint8_t decoded[CONV_TEST_LENGTH_BYTES];
+        conv.chainback(decoded, CONV_TEST_LENGTH_BITS);
+
+        if (::memcmp(decoded, data, CONV_TEST_LENGTH_BYTES) != 0) {
+            Utils::dump(2U, "NXDN_Convolution_Test, expected", data, CONV_TEST_LENGTH_BYTES);
+            Utils::dump(2U, "NXDN_Convolution_Test, decoded", decoded, CONV_TEST_LENGTH_BYTES);
+            failed = true;
+        }
+
+        // the block decoder must make the same decisions as stepping the trellis one pair at a time
+        Convolution step;
+        step.start();
+        for (uint32_t i = 0U; i < CONV_TEST_LENGTH_BITS + 4U; i++)
+            step.decode(symbols[i * 2U], symbols[(i * 2U) + 1U]);
+
+        uint8_t stepped[CONV_TEST_LENGTH_BYTES];
+        step.chainback(stepped, CONV_TEST_LENGTH_BITS);
+
+        if (::memcmp(stepped, decoded, CONV_TEST_LENGTH_BYTES) != 0) {
+            Utils::dump(2U, "NXDN_Convolution_Test, stepped", stepped, CONV_TEST_LENGTH_BYTES);
+            failed = true;
+        }
+
+        // the decision buffer holds 300 steps; a block past that must be rejected
+        uint8_t overrun[602U];
+        ::memset(overrun, 0x00U, 602U);
+
+        conv.start();
+        if (conv.decodeBlock(overrun, 301U)) {
+            ::LogDebug("T", "NXDN_Convolution_Test, decision buffer overrun accepted");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
+
+TEST_CASE("NXDN", "[.][NXDN Convolution Benchmark]") {
+    uint8_t data[CONV_TEST_LENGTH_BYTES];
+    for (uint32_t i = 0U; i < CONV_TEST_LENGTH_BYTES; i++)
+        data[i] = i * 0x11U;
+    data[CONV_TEST_LENGTH_BYTES - 1U] &= 0xF0U;
+
+    uint8_t symbols[(CONV_TEST_LENGTH_BITS * 2U) + 8U];
+    encodeSymbols(data, symbols);
+    symbols[33U] ^= 0x02U;
+
+    BENCHMARK("NXDN Convolution Decode") {
+        Convolution conv;
+        conv.start();
+        conv.decodeBlock(symbols, CONV_TEST_LENGTH_BITS + 4U);
+
+        uint8_t decoded[CONV_TEST_LENGTH_BYTES];
+        conv.chainback(decoded, CONV_TEST_LENGTH_BITS);
+        return decoded[0U];
+    };
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/nxdn/NXDNDefines.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace nxdn;
+using namespace nxdn::defines;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <time.h>
+
+/* Helper to check a generated interleave table against the block interleaver index formula. */
+static bool checkInterleave(const char* name, const uint16_t* deinterleave, const uint16_t* interleave, uint32_t length, uint32_t cols)
+{
+    uint32_t rows = length / cols;
+    for (uint32_t i = 0U; i < length; i++) {
+        // bit i is written into row (i / cols), column (i % cols) and transmitted column by column
+        uint32_t n = (i % cols) * rows + (i / cols);
+        if (deinterleave[i] != n || interleave[n] != i) {
+            ::LogDebug("T", "%s, table mismatch at %u (%u != %u)", name, i, deinterleave[i], n);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("NXDN", "[Interleave Test]") {
+    SECTION("NXDN_SACCH_Interleave_Test") {
+        INFO("NXDN SACCH Interleave Table Test");
+        REQUIRE(checkInterleave("NXDN_SACCH_Interleave_Test", SACCH_INTERLEAVE.deinterleave, SACCH_INTERLEAVE.interleave, NXDN_SACCH_FEC_LENGTH_BITS, 12U));
+    }
+
+    SECTION("NXDN_FACCH1_Interleave_Test") {
+        INFO("NXDN FACCH1 Interleave Table Test");
+        REQUIRE(checkInterleave("NXDN_FACCH1_Interleave_Test", FACCH1_INTERLEAVE.deinterleave, FACCH1_INTERLEAVE.interleave, NXDN_FACCH1_FEC_LENGTH_BITS, 16U));
+    }
+
+    SECTION("NXDN_UDCH_Interleave_Test") {
+        INFO("NXDN UDCH Interleave Table Test");
+        REQUIRE(checkInterleave("NXDN_UDCH_Interleave_Test", UDCH_INTERLEAVE.deinterleave, UDCH_INTERLEAVE.interleave, NXDN_UDCH_FEC_LENGTH_BITS, 12U));
+    }
+
+    SECTION("NXDN_CAC_Interleave_Test") {
+        INFO("NXDN CAC Interleave Table Test");
+        REQUIRE(checkInterleave("NXDN_CAC_Interleave_Test, outbound", CAC_OUT_INTERLEAVE.deinterleave, CAC_OUT_INTERLEAVE.interleave, NXDN_CAC_FEC_LENGTH_BITS, 12U));
+        REQUIRE(checkInterleave("NXDN_CAC_Interleave_Test, inbound", CAC_IN_INTERLEAVE.deinterleave, CAC_IN_INTERLEAVE.interleave, NXDN_CAC_IN_FEC_LENGTH_BITS, 12U));
+    }
+
+    SECTION("NXDN_Permute_Test") {
+        bool failed = false;
+
+        INFO("NXDN Table Driven Permute Test");
+
+        srand((unsigned int)time(NULL));
+
+        const uint32_t offset = NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS + NXDN_SACCH_FEC_LENGTH_BITS;
+
+        uint8_t frame[NXDN_FRAME_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < NXDN_FRAME_LENGTH_BYTES; i++)
+            frame[i] = rand();
+
+        // deinterleave bit by bit
+        uint8_t expected[NXDN_FACCH1_FEC_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < NXDN_FACCH1_FEC_LENGTH_BITS; i++) {
+            bool b = READ_BIT(frame, FACCH1_INTERLEAVE.deinterleave[i] + offset);
+            WRITE_BIT(expected, i, b);
+        }
+
+        uint8_t buffer[NXDN_FACCH1_FEC_LENGTH_BYTES];
+        Utils::permuteBits(frame, offset, buffer, 0U, FACCH1_INTERLEAVE.deinterleave, NXDN_FACCH1_FEC_LENGTH_BITS);
+
+        if (::memcmp(buffer, expected, NXDN_FACCH1_FEC_LENGTH_BYTES) != 0) {
+            Utils::dump(2U, "NXDN_Permute_Test, deinterleaved", buffer, NXDN_FACCH1_FEC_LENGTH_BYTES);
+            failed = true;
+        }
+
+        // interleaving back must restore the frame, without touching the bits around the FACCH1
+        uint8_t restored[NXDN_FRAME_LENGTH_BYTES];
+        ::memcpy(restored, frame, NXDN_FRAME_LENGTH_BYTES);
+        for (uint32_t i = 0U; i < NXDN_FACCH1_FEC_LENGTH_BITS; i++)
+            WRITE_BIT(restored, i + offset, !READ_BIT(restored, i + offset));
+
+        Utils::permuteBits(buffer, 0U, restored, offset, FACCH1_INTERLEAVE.interleave, NXDN_FACCH1_FEC_LENGTH_BITS);
+
+        if (::memcmp(restored, frame, NXDN_FRAME_LENGTH_BYTES) != 0) {
+            Utils::dump(2U, "NXDN_Permute_Test, interleaved", restored, NXDN_FRAME_LENGTH_BYTES);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
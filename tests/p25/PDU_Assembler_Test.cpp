@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/CRC.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/data/Assembler.h"
+#include "common/Log.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::data;
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+const uint32_t PDU_TEST_PKT_LEN = 480U;
+const uint32_t PDU_TEST_LLID = 1234U;
+const uint32_t PDU_BENCH_PACKETS = 2000U;
+
+// ---------------------------------------------------------------------------
+//  Helpers
+// ---------------------------------------------------------------------------
+
+/* Helper to build a test IP packet. */
+
+static std::vector<uint8_t> testPacket()
+{
+    std::vector<uint8_t> packet(PDU_TEST_PKT_LEN);
+    for (uint32_t i = 0U; i < PDU_TEST_PKT_LEN; i++)
+        packet[i] = (uint8_t)((i * 7U) + 3U);
+
+    return packet;
+}
+
+/* Helper to encode an IP packet as the FEC encoded blocks of an extended addressing PDU, header first. */
+
+static std::vector<std::vector<uint8_t>> encodePDU(uint8_t fmt, const std::vector<uint8_t>& packet)
+{
+    DataHeader header = DataHeader();
+    header.setFormat(fmt);
+    header.setMFId(MFG_STANDARD);
+    header.setAckNeeded(fmt == PDUFormatType::CONFIRMED);
+    header.setSAP(PDUSAP::EXT_ADDR);
+    header.setLLId(WUID_FNE);
+    header.setEXSAP(PDUSAP::PACKET_DATA);
+    header.setSrcLLId(PDU_TEST_LLID);
+    header.calculateLength((uint32_t)packet.size());
+
+    uint32_t pduLength = header.getPDULength();
+    std::vector<uint8_t> userData(pduLength);
+    uint32_t dataOffset = (fmt == PDUFormatType::CONFIRMED) ? 4U : P25_PDU_HEADER_LENGTH_BYTES;
+    ::memcpy(userData.data() + dataOffset, packet.data(), packet.size());
+
+    std::vector<std::vector<uint8_t>> blocks;
+    std::vector<uint8_t> block(P25_PDU_FEC_LENGTH_BYTES);
+    header.encode(block.data());
+    blocks.push_back(block);
+
+    uint32_t blocksToFollow = header.getBlocksToFollow();
+    uint32_t offset = 0U;
+    if (fmt == PDUFormatType::UNCONFIRMED) {
+        header.encodeExtAddr(userData.data(), true);
+
+        std::fill(block.begin(), block.end(), 0x00U);
+        header.encodeExtAddr(block.data());
+        blocks.push_back(block);
+
+        offset += P25_PDU_HEADER_LENGTH_BYTES;
+        blocksToFollow--;
+    }
+    else {
+        header.encodeExtAddr(userData.data());
+    }
+
+    edac::CRC::addCRC32(userData.data(), pduLength);
+
+    for (uint32_t i = 0U; i < blocksToFollow; i++) {
+        DataBlock dataBlock = DataBlock();
+        dataBlock.setFormat(header);
+        dataBlock.setSerialNo(i);
+        dataBlock.setData(userData.data() + offset);
+
+        std::fill(block.begin(), block.end(), 0x00U);
+        dataBlock.encode(block.data());
+        blocks.push_back(block);
+
+        offset += (fmt == PDUFormatType::CONFIRMED) ? P25_PDU_CONFIRMED_DATA_LENGTH_BYTES : P25_PDU_UNCONFIRMED_LENGTH_BYTES;
+    }
+
+    return blocks;
+}
+
+/* Helper to reassemble PDU blocks, returning the IP packet. */
+
+static std::vector<uint8_t> assemble(Assembler& assembler, const std::vector<std::vector<uint8_t>>& blocks)
+{
+    REQUIRE(assembler.decodeHeader(blocks[0U].data()));
+    for (size_t i = 1U; i < blocks.size(); i++) {
+        REQUIRE(!assembler.isComplete());
+        REQUIRE(assembler.decodeBlock(blocks[i].data()));
+    }
+
+    REQUIRE(assembler.isComplete());
+    REQUIRE(edac::CRC::checkCRC32(assembler.userData(), assembler.getUserDataLength()));
+
+    uint32_t dataOffset = (assembler.header().getFormat() == PDUFormatType::CONFIRMED) ? 4U : P25_PDU_HEADER_LENGTH_BYTES;
+    uint8_t* data = assembler.userData() + dataOffset;
+    return std::vector<uint8_t>(data, data + PDU_TEST_PKT_LEN);
+}
+
+/* Helper to report the packet rate of a run. */
+
+static void reportPackets(const char* name, std::chrono::steady_clock::time_point start)
+{
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ::LogMessage("T", "%s, %u packets (%u bytes) in %.3f ms, %.0f packets/s", name, PDU_BENCH_PACKETS, PDU_TEST_PKT_LEN, secs * 1000.0, PDU_BENCH_PACKETS / secs);
+}
+
+TEST_CASE("PDU_Assembler", "[P25 PDU Assembler Test]") {
+    SECTION("Confirmed_Test") {
+        INFO("P25 PDU Assembler Confirmed Test");
+
+        std::vector<uint8_t> packet = testPacket();
+        std::vector<std::vector<uint8_t>> blocks = encodePDU(PDUFormatType::CONFIRMED, packet);
+        REQUIRE(blocks.size() > 21U);              // larger than the old fixed reassembly buffer
+
+        Assembler assembler;
+        REQUIRE(assemble(assembler, blocks) == packet);
+        REQUIRE(assembler.getExtendedAddress());
+        REQUIRE(assembler.header().getSrcLLId() == PDU_TEST_LLID);
+        REQUIRE(assembler.header().getEXSAP() == PDUSAP::PACKET_DATA);
+        REQUIRE(assembler.lastBlock().getLastBlock());
+
+        // a block past the end of the PDU is refused
+        REQUIRE(!assembler.decodeBlock(blocks[1U].data()));
+
+        // the assembler is reused for the next PDU
+        packet[0U] ^= 0xFFU;
+        blocks = encodePDU(PDUFormatType::CONFIRMED, packet);
+        REQUIRE(assemble(assembler, blocks) == packet);
+    }
+
+    SECTION("Unconfirmed_Test") {
+        INFO("P25 PDU Assembler Unconfirmed Test");
+
+        std::vector<uint8_t> packet(PDU_TEST_PKT_LEN / 2U, 0x5AU);
+        packet.resize(PDU_TEST_PKT_LEN, 0xA5U);
+        std::vector<std::vector<uint8_t>> blocks = encodePDU(PDUFormatType::UNCONFIRMED, packet);
+
+        Assembler assembler;
+        REQUIRE(assembler.decodeHeader(blocks[0U].data()));
+        REQUIRE(assembler.isSecondHeader());
+        REQUIRE(assemble(assembler, blocks) == packet);
+        REQUIRE(assembler.getExtendedAddress());
+        REQUIRE(assembler.header().getSrcLLId() == PDU_TEST_LLID);
+        REQUIRE(assembler.getDecodedCount() == assembler.header().getBlocksToFollow());
+    }
+
+    SECTION("Damaged_Block_Test") {
+        INFO("P25 PDU Assembler Damaged Block Test");
+
+        std::vector<uint8_t> packet = testPacket();
+        std::vector<std::vector<uint8_t>> blocks = encodePDU(PDUFormatType::CONFIRMED, packet);
+
+        // wreck a block
+        for (uint32_t i = 0U; i < P25_PDU_FEC_LENGTH_BYTES; i++)
+            blocks[3U][i] = (uint8_t)(i * 37U);
+
+        Assembler assembler;
+        REQUIRE(assembler.decodeHeader(blocks[0U].data()));
+        for (size_t i = 1U; i < blocks.size(); i++)
+            assembler.decodeBlock(blocks[i].data());
+
+        // the damaged block keeps its slot, so the blocks behind it stay in place
+        REQUIRE(assembler.isComplete());
+        REQUIRE(assembler.getUserDataLength() == assembler.header().getPDULength());
+        REQUIRE(!edac::CRC::checkCRC32(assembler.userData(), assembler.getUserDataLength()));
+        REQUIRE(::memcmp(assembler.userData() + (3U * P25_PDU_CONFIRMED_DATA_LENGTH_BYTES), packet.data() + (3U * P25_PDU_CONFIRMED_DATA_LENGTH_BYTES) - 4U,
+            P25_PDU_CONFIRMED_DATA_LENGTH_BYTES) == 0);
+    }
+}
+
+TEST_CASE("PDU_Assembler", "[.][PDU Assembler Benchmark]") {
+    INFO("P25 PDU Assembler Benchmark Test");
+
+    std::vector<uint8_t> packet = testPacket();
+    std::vector<std::vector<uint8_t>> blocks = encodePDU(PDUFormatType::CONFIRMED, packet);
+    uint32_t blockCount = (uint32_t)blocks.size() - 1U;
+
+    Assembler assembler;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0U; n < PDU_BENCH_PACKETS; n++) {
+        assembler.decodeHeader(blocks[0U].data());
+        for (uint32_t i = 1U; i <= blockCount; i++)
+            assembler.decodeBlock(blocks[i].data());
+
+        REQUIRE(edac::CRC::checkCRC32(assembler.userData(), assembler.getUserDataLength()));
+    }
+    reportPackets("Assembler_Bench_Test, assembler", start);
+
+    // for comparison, buffering the raw blocks and decoding them into data blocks once all have arrived
+    start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0U; n < PDU_BENCH_PACKETS; n++) {
+        DataBlock* blockData = new DataBlock[P25_MAX_PDU_BLOCKS];
+        uint8_t* netPDU = new uint8_t[P25_MAX_PDU_BLOCKS * P25_PDU_FEC_LENGTH_BYTES];
+        uint8_t* pduUserData = new uint8_t[P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U];
+        ::memset(pduUserData, 0x00U, P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U);
+
+        DataHeader header = DataHeader();
+        header.decode(blocks[0U].data());
+        for (uint32_t i = 1U; i <= blockCount; i++)
+            ::memcpy(netPDU + ((i - 1U) * P25_PDU_FEC_LENGTH_BYTES), blocks[i].data(), P25_PDU_FEC_LENGTH_BYTES);
+
+        uint32_t dataOffset = 0U;
+        for (uint32_t i = 0U; i < blockCount; i++) {
+            uint8_t buffer[P25_PDU_FEC_LENGTH_BYTES];
+            ::memcpy(buffer, netPDU + (i * P25_PDU_FEC_LENGTH_BYTES), P25_PDU_FEC_LENGTH_BYTES);
+
+            blockData[i].decode(buffer, header);
+            dataOffset += blockData[i].getData(pduUserData + dataOffset);
+        }
+
+        REQUIRE(edac::CRC::checkCRC32(pduUserData, dataOffset));
+
+        delete[] blockData;
+        delete[] netPDU;
+        delete[] pduUserData;
+    }
+    reportPackets("Assembler_Bench_Test, buffered blocks", start);
+}
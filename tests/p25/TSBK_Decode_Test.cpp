@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/lc/tsbk/TSBKFactory.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::lc;
+using namespace p25::lc::tsbk;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+TEST_CASE("TSBK", "[P25 TSBK Decode Test]") {
+    SECTION("Borrowed_Decode_Test") {
+        INFO("P25 TSBK Borrowed Decode Test");
+
+        uint8_t grpVch[P25_TSDU_FRAME_LENGTH_BYTES];
+        ::memset(grpVch, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        IOSP_GRP_VCH iosp = IOSP_GRP_VCH();
+        iosp.setLastBlock(true);
+        iosp.setSrcId(1234U);
+        iosp.setDstId(1U);
+        iosp.setEmergency(true);
+        iosp.encode(grpVch);
+
+        TSBK* tsbk = TSBKFactory::decodeTSBK(grpVch);
+        REQUIRE(tsbk != nullptr);
+        REQUIRE(tsbk->getLCO() == TSBKO::IOSP_GRP_VCH);
+        REQUIRE(tsbk->getSrcId() == 1234U);
+        REQUIRE(tsbk->getDstId() == 1U);
+        REQUIRE(tsbk->getEmergency());
+        REQUIRE(tsbk->getDecodedRaw() != nullptr);
+
+        // the next TSBK of the same type reuses the instance, without carrying anything over
+        iosp.setSrcId(5678U);
+        iosp.setEmergency(false);
+        iosp.encode(grpVch);
+
+        TSBK* next = TSBKFactory::decodeTSBK(grpVch);
+        REQUIRE(next == tsbk);
+        REQUIRE(next->getSrcId() == 5678U);
+        REQUIRE(!next->getEmergency());
+
+        // a TSBK of another type does not disturb it
+        uint8_t uReg[P25_TSDU_FRAME_LENGTH_BYTES];
+        ::memset(uReg, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+        IOSP_U_REG reg = IOSP_U_REG();
+        reg.setLastBlock(true);
+        reg.setSrcId(9999U);
+        reg.encode(uReg);
+
+        TSBK* other = TSBKFactory::decodeTSBK(uReg);
+        REQUIRE(other != nullptr);
+        REQUIRE(other != tsbk);
+        REQUIRE(other->getLCO() == TSBKO::IOSP_U_REG);
+        REQUIRE(other->getSrcId() == 9999U);
+        REQUIRE(tsbk->getSrcId() == 5678U);
+
+        // owned instances are still available
+        std::unique_ptr<TSBK> owned = TSBKFactory::createTSBK(grpVch);
+        REQUIRE(owned != nullptr);
+        REQUIRE(owned.get() != tsbk);
+        REQUIRE(owned->getSrcId() == 5678U);
+
+        // corrupt TSBKs are rejected
+        ::memset(grpVch, 0x55U, P25_TSDU_FRAME_LENGTH_BYTES);
+        REQUIRE(TSBKFactory::decodeTSBK(grpVch) == nullptr);
+    }
+}
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "vocoder/MBEEncoder.h"
+#include "vocoder/imbe/typedef.h"
+#include "vocoder/imbe/basic_op.h"
+#include "vocoder/imbe/imbe.h"
+#include "vocoder/imbe/aux_sub.h"
+#include "vocoder/imbe/pe_lpf.h"
+
+using namespace vocoder;
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <math.h>
+
+static const Word16 BASIC_OP_TEST_EDGES[] = { 0, 1, -1, 2, -2, 0x3FFF, 0x4000, -0x4000, 0x7FFE, MAX_16, MIN_16, -0x7FFF };
+
+/* Helper to clamp a 64 bit value into 32 bits. */
+static Word32 refSat32(int64_t v)
+{
+    return (v > MAX_32) ? MAX_32 : ((v < MIN_32) ? MIN_32 : (Word32)v);
+}
+
+/* Helper to clamp a 64 bit value into 16 bits. */
+static Word16 refSat16(int64_t v)
+{
+    return (v > MAX_16) ? MAX_16 : ((v < MIN_16) ? MIN_16 : (Word16)v);
+}
+
+/* Helper to generate a random 16 bit operand, favouring the edge cases. */
+static Word16 rand16(uint32_t& seed)
+{
+    seed = seed * 1103515245U + 12345U;
+    if ((seed >> 28) == 0U)
+        return BASIC_OP_TEST_EDGES[(seed >> 16) % (sizeof(BASIC_OP_TEST_EDGES) / sizeof(Word16))];
+    return (Word16)(seed >> 12);
+}
+
+/* Helper to generate a random 32 bit operand. */
+static Word32 rand32(uint32_t& seed)
+{
+    Word32 hi = rand16(seed);
+    Word32 lo = rand16(seed);
+    return (Word32)(((UWord32)hi << 16) | ((UWord32)lo & 0xFFFFU));
+}
+
+/* Helper implementing the reference (per sample shifting) pitch estimation low-pass filter. */
+static void refPeLpf(const Word16* sigin, Word16* sigout, Word16* mem, const Word16* coef, Word16 len)
+{
+    for (Word16 n = 0; n < len; n++) {
+        for (int i = 0; i < PE_LPF_ORD - 1; i++)
+            mem[i] = mem[i + 1];
+        mem[PE_LPF_ORD - 1] = sigin[n];
+
+        int64_t sum = 0;
+        for (int i = 0; i < PE_LPF_ORD; i++)
+            sum = refSat32(sum + (((int64_t)mem[i] * coef[i]) * 2));
+
+        sigout[n] = (Word16)(refSat32(sum + 0x8000) >> 16);
+    }
+}
+
+TEST_CASE("IMBE", "[Vocoder Basic Op Test]") {
+    SECTION("IMBE_BasicOp_Test") {
+        bool failed = false;
+
+        INFO("IMBE Fixed Point Primitive Test");
+
+        uint32_t seed = 0x1234U;
+        for (uint32_t n = 0U; n < 200000U && !failed; n++) {
+            Word16 a = rand16(seed), b = rand16(seed);
+            Word32 L_a = rand32(seed);
+            Word16 s = (Word16)((rand16(seed) & 0x3F) - 16);    // shifts from -16 to 47
+
+            int64_t prod = (int64_t)a * b;
+            int64_t lshift = (s >= 0) ? ((s < 32) ? ((int64_t)L_a * ((int64_t)1 << s)) : ((L_a == 0) ? 0 : ((L_a > 0) ? INT64_MAX : INT64_MIN))) :
+                ((s <= -31) ? ((L_a < 0) ? -1 : 0) : ((int64_t)L_a >> -s));
+
+            if (add(a, b) != refSat16((int64_t)a + b) ||
+                sub(a, b) != refSat16((int64_t)a - b) ||
+                mult(a, b) != refSat16(prod >> 15) ||
+                mult_r(a, b) != refSat16((prod + 0x4000) >> 15) ||
+                L_mult(a, b) != refSat32(prod * 2) ||
+                L_add(L_a, (Word32)prod) != refSat32((int64_t)L_a + prod) ||
+                L_sub(L_a, (Word32)prod) != refSat32((int64_t)L_a - prod) ||
+                L_mac(L_a, a, b) != refSat32((int64_t)L_a + refSat32(prod * 2)) ||
+                L_shl(L_a, s) != refSat32(lshift) ||
+                L_shr(L_a, -s) != refSat32(lshift) ||
+                L_round(L_a) != (Word16)(refSat32((int64_t)L_a + 0x8000) >> 16)) {
+                ::LogDebug("T", "IMBE_BasicOp_Test, mismatch a = %d, b = %d, L_a = %d, s = %d", a, b, L_a, s);
+                failed = true;
+            }
+
+            // norm is the left shift which brings the value into the 0x4000 / 0x40000000 range
+            Word16 norm = norm_s(a);
+            if (a != 0 && a != -1 && ((a << norm) > MAX_16 || (a << norm) < MIN_16 || abs((Word32)(a << norm)) < 0x4000)) {
+                ::LogDebug("T", "IMBE_BasicOp_Test, norm_s(%d) = %d", a, norm);
+                failed = true;
+            }
+
+            norm = norm_l(L_a);
+            if (L_a != 0 && L_a != -1 && L_shl(L_a, norm) != (Word32)((int64_t)L_a * ((int64_t)1 << norm))) {
+                ::LogDebug("T", "IMBE_BasicOp_Test, norm_l(%d) = %d", L_a, norm);
+                failed = true;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("IMBE_VectorDot_Test") {
+        bool failed = false;
+
+        INFO("IMBE Vector Dot Product Test");
+
+        uint32_t seed = 0xBEEFU;
+        Word16 vec1[301], vec2[301];
+        for (uint32_t i = 0U; i < 301U; i++) {
+            vec1[i] = rand16(seed) >> 6;
+            vec2[i] = rand16(seed) >> 6;
+        }
+
+        // every length exercises a different split between the vector body and the scalar tail
+        for (Word16 n = 0; n <= 301 && !failed; n++) {
+            Word32 expected = 0;
+            for (Word16 i = 0; i < n; i++)
+                expected += (Word32)vec1[i] * vec2[i];
+
+            if (L_v_dot(vec1, vec2, n) != expected) {
+                ::LogDebug("T", "IMBE_VectorDot_Test, length %d mismatch", n);
+                failed = true;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("IMBE_PeLpf_Test") {
+        bool failed = false;
+
+        INFO("IMBE Pitch Estimation Low-Pass Filter Test");
+
+        const Word16 coef[PE_LPF_ORD] = {
+             -94,  -92,  185,   543,  288, -883, -1834, -495, 3891, 9141, 11512,
+            9141, 3891, -495, -1834, -883,  288,   543,  185,  -92,  -94
+        };
+
+        Word16 mem[PE_LPF_ORD], refMem[PE_LPF_ORD];
+        ::memset(mem, 0x00U, sizeof(mem));
+        ::memset(refMem, 0x00U, sizeof(refMem));
+
+        // quiet frames take the dot product path, full scale frames (which can saturate) the L_mac path
+        uint32_t seed = 0x5A5AU;
+        for (uint32_t f = 0U; f < 64U && !failed; f++) {
+            Word16 sigin[FRAME], sigout[FRAME], refOut[FRAME];
+            for (uint32_t n = 0U; n < FRAME; n++) {
+                float t = (float)((f * FRAME) + n) / 8000.0F;
+                float amp = ((f & 3U) == 3U) ? 48000.0F : 16000.0F;
+                float v = amp * sinf(2.0F * (float)M_PI * 210.0F * t) + (float)(rand16(seed) >> 4);
+                sigin[n] = refSat16((int64_t)v);
+            }
+
+            pe_lpf(sigin, sigout, mem, FRAME);
+            refPeLpf(sigin, refOut, refMem, coef, FRAME);
+
+            if (::memcmp(sigout, refOut, sizeof(sigout)) != 0 || ::memcmp(mem, refMem, sizeof(mem)) != 0) {
+                ::LogDebug("T", "IMBE_PeLpf_Test, frame %u mismatch", f);
+                failed = true;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+}
+
+TEST_CASE("IMBE", "[.][Vocoder Encode Benchmark]") {
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+
+    int16_t samples[160U];
+    uint32_t seed = 0x1234U;
+    for (uint32_t n = 0U; n < 160U; n++)
+        samples[n] = (int16_t)(8000.0F * sinf(2.0F * (float)M_PI * 330.0F * (float)n / 8000.0F)) + (rand16(seed) >> 5);
+
+    // one frame per iteration; frames/second per core is 1 / mean
+    BENCHMARK("IMBE Encode Frame") {
+        uint8_t codeword[11U];
+        encoder.encode(samples, codeword);
+        return codeword[0U];
+    };
+}
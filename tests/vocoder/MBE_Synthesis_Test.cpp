@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "vocoder/mbe.h"
+#include "vocoder/mbe_const.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <math.h>
+#include <string.h>
+
+const uint32_t MBE_SYNTH_TEST_FRAMES = 200U;
+const int MBE_SYNTH_TEST_SAMPLES = 160;
+const int MBE_SYNTH_TEST_UVQUALITY = 3;
+
+// the oscillator synthesis must stay within this SNR of the direct cosf() synthesis; the two agree to
+// ~90 dB over the first frames, drifting towards ~65 dB over a long run as the accumulated PSIl phase
+// grows and the float phase argument of the direct synthesis itself loses precision
+const double MBE_SYNTH_MIN_SNR_DB = 60.0;
+
+/* Helper replicating the decoder PRNG. */
+static float refRand(mbe_parms* mp)
+{
+    mp->seed = mp->seed * 1103515245U + 12345U;
+    return ((float)((mp->seed >> 16) & 0x7FFFU) / (float)0x7FFFU);
+}
+
+/* Helper replicating the decoder random phase. */
+static float refRandPhase(mbe_parms* mp)
+{
+    return refRand(mp) * (((float)M_PI) * 2.0F) - ((float)M_PI);
+}
+
+/* Helper implementing the reference (per sample cosf()) harmonic synthesis. */
+static void refSynthesizeSpeechF(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp, int uvquality)
+{
+    const int N = MBE_SYNTH_TEST_SAMPLES;
+
+    float uvthreshold = ((2700.0F * M_PI) / 4000.0F);
+    float uvsine = 1.3591409F * M_E;
+    float uvrand = 2.0F;
+    float qfactor = (uvquality == 1) ? (1.0F / M_E) : (log((float)uvquality) / (float)uvquality);
+    float uvstep = 1.0F / (float)uvquality;
+    float uvoffset = (uvstep * (float)(uvquality - 1)) / 2.0F;
+    float rphase[64], rphase2[64];
+
+    int numUv = 0;
+    for (int l = 1; l <= cur_mp->L; l++) {
+        if (cur_mp->Vl[l] == 0)
+            numUv++;
+    }
+
+    float cw0 = cur_mp->w0;
+    float pw0 = prev_mp->w0;
+
+    for (int n = 0; n < N; n++)
+        aout_buf[n] = 0.0F;
+
+    int maxl;
+    if (cur_mp->L > prev_mp->L) {
+        maxl = cur_mp->L;
+        for (int l = prev_mp->L + 1; l <= maxl; l++) {
+            prev_mp->Ml[l] = 0.0F;
+            prev_mp->Vl[l] = 1;
+        }
+    } else {
+        maxl = prev_mp->L;
+        for (int l = cur_mp->L + 1; l <= maxl; l++) {
+            cur_mp->Ml[l] = 0.0F;
+            cur_mp->Vl[l] = 1;
+        }
+    }
+
+    for (int l = 1; l <= 56; l++) {
+        cur_mp->PSIl[l] = prev_mp->PSIl[l] + ((pw0 + cw0) * ((float)(l * N) / 2.0F));
+        if (l <= (int)(cur_mp->L / 4))
+            cur_mp->PHIl[l] = cur_mp->PSIl[l];
+        else
+            cur_mp->PHIl[l] = cur_mp->PSIl[l] + ((numUv * refRandPhase(cur_mp)) / cur_mp->L);
+    }
+
+    for (int l = 1; l <= maxl; l++) {
+        float cw0l = (cw0 * (float)l);
+        float pw0l = (pw0 * (float)l);
+        if ((cur_mp->Vl[l] == 0) && (prev_mp->Vl[l] == 1)) {
+            for (int i = 0; i < uvquality; i++)
+                rphase[i] = refRandPhase(cur_mp);
+
+            for (int n = 0; n < N; n++) {
+                float C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
+                float C3 = 0.0F;
+                for (int i = 0; i < uvquality; i++) {
+                    C3 = C3 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
+                    if (cw0l > uvthreshold)
+                        C3 = C3 + ((cw0l - uvthreshold) * uvrand * refRand(cur_mp));
+                }
+                C3 = C3 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
+                aout_buf[n] = aout_buf[n] + C1 + C3;
+            }
+        }
+        else if ((cur_mp->Vl[l] == 1) && (prev_mp->Vl[l] == 0)) {
+            for (int i = 0; i < uvquality; i++)
+                rphase[i] = refRandPhase(cur_mp);
+
+            for (int n = 0; n < N; n++) {
+                float C1 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
+                float C3 = 0.0F;
+                for (int i = 0; i < uvquality; i++) {
+                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
+                    if (pw0l > uvthreshold)
+                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * refRand(cur_mp));
+                }
+                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
+                aout_buf[n] = aout_buf[n] + C1 + C3;
+            }
+        }
+        else if ((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) {
+            for (int n = 0; n < N; n++) {
+                float C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
+                float C2 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
+                aout_buf[n] = aout_buf[n] + C1 + C2;
+            }
+        }
+        else {
+            for (int i = 0; i < uvquality; i++)
+                rphase[i] = refRandPhase(cur_mp);
+            for (int i = 0; i < uvquality; i++)
+                rphase2[i] = refRandPhase(cur_mp);
+
+            for (int n = 0; n < N; n++) {
+                float C3 = 0.0F;
+                for (int i = 0; i < uvquality; i++) {
+                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
+                    if (pw0l > uvthreshold)
+                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * refRand(cur_mp));
+                }
+                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
+
+                float C4 = 0.0F;
+                for (int i = 0; i < uvquality; i++) {
+                    C4 = C4 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase2[i]);
+                    if (cw0l > uvthreshold)
+                        C4 = C4 + ((cw0l - uvthreshold) * uvrand * refRand(cur_mp));
+                }
+                C4 = C4 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
+                aout_buf[n] = aout_buf[n] + C3 + C4;
+            }
+        }
+    }
+}
+
+/* Helper to generate a deterministic frame of model parameters covering voiced, unvoiced and mixed bands. */
+static void makeFrame(uint32_t f, uint32_t& noise, mbe_parms* cur_mp)
+{
+    // sweep the fundamental across the IMBE pitch range (L from 9 to 56 harmonics)
+    noise = noise * 1103515245U + 12345U;
+    cur_mp->w0 = 0.05F + (0.3F * (float)((noise >> 16) & 0x7FFFU) / (float)0x7FFFU);
+    cur_mp->L = (int)(0.9254F * (int)((M_PI / cur_mp->w0) + 0.25F));
+    if (cur_mp->L > 56)
+        cur_mp->L = 56;
+    if (cur_mp->L < 9)
+        cur_mp->L = 9;
+
+    for (int l = 1; l <= 56; l++) {
+        noise = noise * 1103515245U + 12345U;
+        cur_mp->Ml[l] = 0.1F + (float)((noise >> 16) & 0x3FFU) / 64.0F;
+
+        // alternate frames of mostly voiced and mostly unvoiced bands
+        noise = noise * 1103515245U + 12345U;
+        cur_mp->Vl[l] = (((noise >> 16) & 0x3U) != 0U) ? ((f & 1U) == 0U) : ((f & 1U) == 1U);
+    }
+}
+
+/* Helper to synthesize a run of frames with both implementations and measure the SNR between them. */
+static double measureSNR(uint32_t seed)
+{
+    mbe_parms cur, prev, prevEnh;
+    mbe_parms refCur, refPrev, refPrevEnh;
+    mbe_initMbeParms(&cur, &prev, &prevEnh);
+    mbe_initMbeParms(&refCur, &refPrev, &refPrevEnh);
+
+    double signal = 0.0, error = 0.0;
+    uint32_t noise = seed;
+    for (uint32_t f = 0U; f < MBE_SYNTH_TEST_FRAMES; f++) {
+        makeFrame(f, noise, &cur);
+
+        refCur.w0 = cur.w0;
+        refCur.L = cur.L;
+        ::memcpy(refCur.Ml, cur.Ml, sizeof(cur.Ml));
+        ::memcpy(refCur.Vl, cur.Vl, sizeof(cur.Vl));
+
+        float out[MBE_SYNTH_TEST_SAMPLES], ref[MBE_SYNTH_TEST_SAMPLES];
+        mbe_synthesizeSpeechF(out, &cur, &prev, MBE_SYNTH_TEST_UVQUALITY);
+        refSynthesizeSpeechF(ref, &refCur, &refPrev, MBE_SYNTH_TEST_UVQUALITY);
+
+        // the PRNG must be drawn from in exactly the same order
+        if (cur.seed != refCur.seed) {
+            ::LogDebug("T", "MBE_Synthesis_Test, frame %u PRNG sequence diverged", f);
+            return 0.0;
+        }
+
+        for (int n = 0; n < MBE_SYNTH_TEST_SAMPLES; n++) {
+            signal += (double)ref[n] * (double)ref[n];
+            error += ((double)out[n] - (double)ref[n]) * ((double)out[n] - (double)ref[n]);
+        }
+
+        mbe_moveMbeParms(&cur, &prev);
+        mbe_moveMbeParms(&refCur, &refPrev);
+    }
+
+    if (error == 0.0)
+        return 1000.0;
+    return 10.0 * log10(signal / error);
+}
+
+TEST_CASE("MBE", "[Vocoder Synthesis Test]") {
+    SECTION("MBE_Synthesis_Test") {
+        INFO("MBE Harmonic Synthesis SNR Test");
+
+        double snr = measureSNR(0x1234U);
+        ::LogDebug("T", "MBE_Synthesis_Test, SNR %.1f dB", snr);
+        REQUIRE(snr >= MBE_SYNTH_MIN_SNR_DB);
+
+        snr = measureSNR(0xBEEFU);
+        ::LogDebug("T", "MBE_Synthesis_Test, SNR %.1f dB", snr);
+        REQUIRE(snr >= MBE_SYNTH_MIN_SNR_DB);
+    }
+}
+
+TEST_CASE("MBE", "[.][Vocoder Synthesis Benchmark]") {
+    mbe_parms cur, prev, prevEnh;
+    mbe_initMbeParms(&cur, &prev, &prevEnh);
+
+    uint32_t noise = 0x1234U;
+    makeFrame(0U, noise, &prev);
+    makeFrame(0U, noise, &cur);
+
+    // one frame per iteration; frames/second per core is 1 / mean
+    BENCHMARK("MBE Synthesize Frame") {
+        float out[MBE_SYNTH_TEST_SAMPLES];
+        mbe_parms c = cur, p = prev;
+        mbe_synthesizeSpeechF(out, &c, &p, MBE_SYNTH_TEST_UVQUALITY);
+        return out[0U];
+    };
+
+    BENCHMARK("MBE Synthesize Frame (Reference)") {
+        float out[MBE_SYNTH_TEST_SAMPLES];
+        mbe_parms c = cur, p = prev;
+        refSynthesizeSpeechF(out, &c, &p, MBE_SYNTH_TEST_UVQUALITY);
+        return out[0U];
+    };
+}
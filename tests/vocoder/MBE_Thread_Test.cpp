@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2024 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "common/Thread.h"
+#include "common/Utils.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+
+using namespace vocoder;
+
+#include <catch2/catch_test_macros.hpp>
+#include <math.h>
+
+const uint32_t MBE_TEST_STREAMS = 8U;
+const uint32_t MBE_TEST_FRAMES = 50U;
+const uint32_t MBE_TEST_SAMPLES = 160U;
+const uint32_t MBE_TEST_CODEWORD_BYTES = 11U;
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Encodes and then decodes a single synthetic audio stream.
+ */
+class MBEStreamWorker : public Thread {
+public:
+    /**
+     * @brief Initializes a new instance of the MBEStreamWorker class.
+     * @param stream Stream number (selects the test tone).
+     * @param ambe Flag indicating DMR AMBE is used instead of P25 IMBE.
+     */
+    MBEStreamWorker(uint32_t stream, bool ambe) :
+        m_stream(stream),
+        m_ambe(ambe)
+    {
+        ::memset(codewords, 0x00U, sizeof(codewords));
+        ::memset(pcm, 0x00U, sizeof(pcm));
+    }
+
+    /**
+     * @brief Runs the stream.
+     */
+    void entry() override
+    {
+        MBEEncoder encoder(m_ambe ? ENCODE_DMR_AMBE : ENCODE_88BIT_IMBE);
+        MBEDecoder decoder(m_ambe ? DECODE_DMR_AMBE : DECODE_88BIT_IMBE);
+
+        // a tone unique to the stream with a little deterministic noise, to exercise both the voiced and
+        // unvoiced synthesis
+        uint32_t noise = m_stream + 1U;
+        for (uint32_t f = 0U; f < MBE_TEST_FRAMES; f++) {
+            int16_t samples[MBE_TEST_SAMPLES];
+            for (uint32_t n = 0U; n < MBE_TEST_SAMPLES; n++) {
+                noise = noise * 1103515245U + 12345U;
+                float t = (float)((f * MBE_TEST_SAMPLES) + n) / 8000.0F;
+                samples[n] = (int16_t)(8000.0F * sinf(2.0F * (float)M_PI * (300.0F + (m_stream * 110.0F)) * t)) +
+                    (int16_t)((int32_t)((noise >> 16) & 0x7FFU) - 0x400);
+            }
+
+            encoder.encode(samples, codewords[f]);
+            decoder.decode(codewords[f], pcm[f]);
+        }
+    }
+
+    uint8_t codewords[MBE_TEST_FRAMES][MBE_TEST_CODEWORD_BYTES];
+    int16_t pcm[MBE_TEST_FRAMES][MBE_TEST_SAMPLES];
+
+private:
+    uint32_t m_stream;
+    bool m_ambe;
+};
+
+/* Helper to run the streams serially and then concurrently, and compare the results. */
+static bool runStreams(const char* name, bool ambe)
+{
+    MBEStreamWorker* serial[MBE_TEST_STREAMS];
+    MBEStreamWorker* parallel[MBE_TEST_STREAMS];
+
+    for (uint32_t s = 0U; s < MBE_TEST_STREAMS; s++) {
+        serial[s] = new MBEStreamWorker(s, ambe);
+        serial[s]->entry();
+    }
+
+    for (uint32_t s = 0U; s < MBE_TEST_STREAMS; s++) {
+        parallel[s] = new MBEStreamWorker(s, ambe);
+        parallel[s]->run();
+    }
+
+    for (uint32_t s = 0U; s < MBE_TEST_STREAMS; s++)
+        parallel[s]->wait();
+
+    bool ret = true;
+    for (uint32_t s = 0U; s < MBE_TEST_STREAMS; s++) {
+        if (::memcmp(serial[s]->codewords, parallel[s]->codewords, sizeof(serial[s]->codewords)) != 0) {
+            ::LogDebug("T", "%s, stream %u encoded codewords differ", name, s);
+            ret = false;
+        }
+
+        if (::memcmp(serial[s]->pcm, parallel[s]->pcm, sizeof(serial[s]->pcm)) != 0) {
+            ::LogDebug("T", "%s, stream %u decoded audio differs", name, s);
+            ret = false;
+        }
+
+        delete serial[s];
+        delete parallel[s];
+    }
+
+    return ret;
+}
+
+TEST_CASE("MBE", "[Vocoder Thread Test]") {
+    SECTION("IMBE_Thread_Test") {
+        INFO("IMBE Concurrent Stream Test");
+        REQUIRE(runStreams("IMBE_Thread_Test", false));
+    }
+
+    SECTION("AMBE_Thread_Test") {
+        INFO("AMBE Concurrent Stream Test");
+        REQUIRE(runStreams("AMBE_Thread_Test", true));
+    }
+}